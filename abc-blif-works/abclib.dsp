@@ -347,6 +347,10 @@ SOURCE=.\src\base\abci\abcPart.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\abci\abcPortfolio.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\abci\abcPrint.c
 # End Source File
 # Begin Source File
@@ -555,6 +559,14 @@ SOURCE=.\src\base\io\ioReadVerilog.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\io\ioSession.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\base\io\ioTruth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\io\ioUtil.c
 # End Source File
 # Begin Source File
@@ -1259,6 +1271,10 @@ SOURCE=.\src\sat\bsat\satInterP.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bsat\satPort.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bsat\satMem.c
 # End Source File
 # Begin Source File
@@ -1359,6 +1375,10 @@ SOURCE=.\src\sat\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -4215,6 +4235,10 @@ SOURCE=.\src\aig\llb\llb4Nonlin.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\llb\llb4Par.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\llb\llb4Sweep.c
 # End Source File
 # Begin Source File
@@ -398,6 +398,37 @@ pMan->timeSort += clock() - clk;
     pMan->timeTotal += clock() - clkTotal;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Appends the recent patterns of another manager.]
+
+  Description [Used to merge the patterns found by the SAT sweeping 
+  threads into the pattern manager of the main thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManPatAppend( Cec_ManPat_t * pMan, Cec_ManPat_t * pOther )
+{
+    int i;
+    for ( i = pOther->iStart; i < Vec_StrSize(pOther->vStorage); i++ )
+        Vec_StrPush( pMan->vStorage, Vec_StrEntry(pOther->vStorage, i) );
+    pMan->nPats          += pOther->nPats;
+    pMan->nPatsAll       += pOther->nPats;
+    pMan->nPatLits       += pOther->nPatLits;
+    pMan->nPatLitsAll    += pOther->nPatLits;
+    pMan->nPatLitsMin    += pOther->nPatLitsMin;
+    pMan->nPatLitsMinAll += pOther->nPatLitsMin;
+    pMan->timeFind       += pOther->timeFind;
+    pMan->timeShrink     += pOther->timeShrink;
+    pMan->timeVerify     += pOther->timeVerify;
+    pMan->timeSort       += pOther->timeSort;
+    pMan->timeTotal      += pOther->timeTotal;
+    pMan->timeTotalSave  += pOther->timeTotalSave;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Packs patterns into array of simulation info.]
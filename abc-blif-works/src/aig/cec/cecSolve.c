@@ -20,6 +20,10 @@
 
 #include "cecInt.h"
 
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -30,6 +34,17 @@ ABC_NAMESPACE_IMPL_START
 static inline int  Cec_ObjSatNum( Cec_ManSat_t * p, Gia_Obj_t * pObj )             { return p->pSatVars[Gia_ObjId(p->pAig,pObj)]; }
 static inline void Cec_ObjSetSatNum( Cec_ManSat_t * p, Gia_Obj_t * pObj, int Num ) { p->pSatVars[Gia_ObjId(p->pAig,pObj)] = Num;  }
 
+typedef struct Cec_SatThData_t_ Cec_SatThData_t;
+struct Cec_SatThData_t_
+{
+    Cec_ManPat_t *   pPat;              // patterns found by this thread
+    Gia_Man_t *      pAig;              // private copy of the AIG
+    Cec_ParSat_t *   pPars;             // SAT parameters
+    int              iThread;           // the slice of outputs solved by this thread
+    int              nThreads;          // the number of slices
+    volatile int *   pStop;             // set when one of the threads disproved the miter
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -671,6 +686,27 @@ p->timeSatUndec += clock() - clk;
 
 ***********************************************************************/
 void Cec_ManSatSolve( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPars )
+{
+    if ( pPars->nThreads > 1 && Gia_ManCoNum(pAig) > 1 )
+        Cec_ManSatSolvePar( pPat, pAig, pPars );
+    else
+        Cec_ManSatSolveSlice( pPat, pAig, pPars, 0, 1, NULL );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs belonging to one slice.]
+
+  Description [The slice contains the outputs whose index modulo nSlices 
+  equals to iSlice. If pStop is given, the procedure quits when it is 
+  set by another thread and sets it when the miter is disproved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSatSolveSlice( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPars, int iSlice, int nSlices, volatile int * pStop )
 {
     Bar_Progress_t * pProgress = NULL;
     Cec_ManSat_t * p;
@@ -688,9 +724,14 @@ void Cec_ManSatSolve( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPar
     Gia_ManLevelNum( pAig );
     Gia_ManIncrementTravId( pAig );
     p = Cec_ManSatCreate( pAig, pPars );
-    pProgress = Bar_ProgressStart( stdout, Gia_ManPoNum(pAig) );
+    if ( nSlices == 1 )
+        pProgress = Bar_ProgressStart( stdout, Gia_ManPoNum(pAig) );
     Gia_ManForEachCo( pAig, pObj, i )
     {
+        if ( i % nSlices != iSlice )
+            continue;
+        if ( pStop && *pStop )
+            break;
         if ( Gia_ObjIsConst0(Gia_ObjFanin0(pObj)) )
         {
             pObj->fMark0 = 0;
@@ -722,13 +763,114 @@ clk2 = clock();
         }
         // quit if one of them is solved
         if ( pPars->fCheckMiter )
+        {
+            if ( pStop )
+                *pStop = 1;
             break;
+        }
     }
     p->timeTotal = clock() - clk;
-    Bar_ProgressStop( pProgress );
-    if ( pPars->fVerbose )
+    if ( pProgress )
+        Bar_ProgressStop( pProgress );
+    if ( pPars->fVerbose && nSlices == 1 )
         Cec_ManSatPrintStats( p );
     Cec_ManSatStop( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Procedure executed by one SAT sweeping thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Cec_ManSatWorkerThread( void * pArg )
+{
+    Cec_SatThData_t * pData = (Cec_SatThData_t *)pArg;
+    Cec_ManSatSolveSlice( pData->pPat, pData->pAig, pData->pPars, pData->iThread, pData->nThreads, pData->pStop );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of solving using several threads.]
+
+  Description [The outputs are distributed among the threads, each of 
+  which solves its slice using its own SAT solver on its own copy of the 
+  AIG. The copies have the same object numbering, so the labels of the 
+  outputs and the patterns in terms of the primary inputs are merged 
+  back into the original AIG and the pattern manager in the order of 
+  threads, making the result independent of thread scheduling (unless 
+  the miter is disproved and the threads are stopped early).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSatSolvePar( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPars )
+{
+#ifdef ABC_USE_PTHREADS
+    Cec_SatThData_t * pData;
+    pthread_t * pThreads;
+    Gia_Obj_t * pObj;
+    volatile int Stop = 0;
+    int i, k, Status, nThreads = Abc_MinInt( pPars->nThreads, Gia_ManCoNum(pAig) );
+    if ( pPat )
+    {
+        pPat->iStart = Vec_StrSize(pPat->vStorage);
+        pPat->nPats = 0;
+        pPat->nPatLits = 0;
+        pPat->nPatLitsMin = 0;
+    } 
+    pData = ABC_CALLOC( Cec_SatThData_t, nThreads );
+    pThreads = ABC_ALLOC( pthread_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pData[i].pPat     = pPat ? Cec_ManPatStart() : NULL;
+        pData[i].pAig     = i ? Gia_ManDup( pAig ) : pAig;
+        pData[i].pPars    = pPars;
+        pData[i].iThread  = i;
+        pData[i].nThreads = nThreads;
+        pData[i].pStop    = &Stop;
+    }
+    for ( i = 1; i < nThreads; i++ )
+    {
+        Status = pthread_create( pThreads + i, NULL, Cec_ManSatWorkerThread, (void *)(pData + i) );
+        assert( Status == 0 );
+    }
+    Cec_ManSatWorkerThread( (void *)pData );
+    for ( i = 1; i < nThreads; i++ )
+        pthread_join( pThreads[i], NULL );
+    // merge the results
+    for ( i = 0; i < nThreads; i++ )
+    {
+        if ( i > 0 )
+        {
+            Gia_ManForEachCo( pAig, pObj, k )
+            {
+                if ( k % nThreads != i )
+                    continue;
+                pObj->fMark0 = Gia_ManCo(pData[i].pAig, k)->fMark0;
+                pObj->fMark1 = Gia_ManCo(pData[i].pAig, k)->fMark1;
+            }
+            Gia_ManStop( pData[i].pAig );
+        }
+        if ( pPat )
+        {
+            Cec_ManPatAppend( pPat, pData[i].pPat );
+            Cec_ManPatStop( pData[i].pPat );
+        }
+    }
+    ABC_FREE( pThreads );
+    ABC_FREE( pData );
+#else
+    Cec_ManSatSolveSlice( pPat, pAig, pPars, 0, 1, NULL );
+#endif
 }
 
 
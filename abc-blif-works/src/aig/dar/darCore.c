@@ -20,6 +20,10 @@
 
 #include "darInt.h"
 
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -33,6 +37,11 @@ ABC_NAMESPACE_IMPL_START
           p->iNext && (((pObj) = Aig_ManObj(p, p->iNext)), 1);                  \
           p->iNext = p->pOrderData[2*p->iPrev+1] )
 
+// the rewriting library is shared by all threads
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_DarLibMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -75,7 +84,7 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
   SeeAlso     []
 
 ***********************************************************************/
-int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+static int Dar_ManRewriteInt( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
 {
     extern Vec_Int_t * Saig_ManComputeSwitchProbs( Aig_Man_t * p, int nFrames, int nPref, int fProbOne );
     Dar_Man_t * p;
@@ -242,6 +251,31 @@ p->timeOther = p->timeTotal - p->timeCuts - p->timeEval;
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs rewriting.]
+
+  Description [The library subgraphs are prepared and evaluated in the
+  shared library, so rewriting of different AIGs is serialized.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    int RetValue;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &s_DarLibMutex );
+#endif
+    RetValue = Dar_ManRewriteInt( pAig, pPars );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &s_DarLibMutex );
+#endif
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the total number of cuts.]
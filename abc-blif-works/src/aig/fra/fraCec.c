@@ -21,6 +21,10 @@
 #include "fra.h"
 #include "cnf.h"
 
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -28,6 +32,20 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+typedef struct Fra_CecThData_t_ Fra_CecThData_t;
+struct Fra_CecThData_t_
+{
+    Vec_Ptr_t *      vParts;            // the miters of the partitions
+    int *            pStatus;           // the status of each partition
+    abctime *        pTimes;            // the runtime of each partition
+    int *            pNodes;            // the original size of each partition
+    int *            pThreads;          // the thread that solved each partition
+    int              nConfLimit;        // the conflict limit
+    int              iThread;           // the number of this thread
+    volatile int *   pNext;             // the next partition to be solved
+    volatile int *   pStop;             // set when a partition is disproved
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -44,6 +62,41 @@ ABC_NAMESPACE_IMPL_START
 
 ***********************************************************************/
 int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int fFlipBits, int fAndOuts, int fVerbose )
+{
+    return Fra_FraigSatPar( pMan, nConfLimit, nInsLimit, fFlipBits, fAndOuts, 1, fVerbose );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the miter using a portfolio of SAT solvers.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_FraigSatPar( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int fFlipBits, int fAndOuts, int nThreads, int fVerbose )
+{
+    return Fra_FraigSatInt( pMan, nConfLimit, nInsLimit, fFlipBits, fAndOuts, nThreads, NULL, fVerbose );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the miter using a portfolio of SAT solvers.]
+
+  Description [Runs nThreads differently configured solvers on the same
+  CNF, which share short learned clauses and stop as soon as one of them
+  solves the problem. If pStop is given, the single-threaded solver 
+  quits when it is set by another thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_FraigSatInt( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int fFlipBits, int fAndOuts, int nThreads, volatile int * pStop, int fVerbose )
 {
     sat_solver * pSat;
     Cnf_Dat_t * pCnf;
@@ -113,7 +166,8 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
     clk = clock();
     if ( fVerbose )
         pSat->verbosity = 1;
-    status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    pSat->pStop = pStop;
+    status = sat_solver_solve_portfolio( pSat, nThreads, NULL, NULL, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, fVerbose );
     if ( status == l_Undef )
     {
 //        printf( "The problem timed out.\n" );
@@ -162,6 +216,23 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
 
 ***********************************************************************/
 int Fra_FraigCec( Aig_Man_t ** ppAig, int nConfLimit, int fVerbose )
+{
+    return Fra_FraigCecInt( ppAig, nConfLimit, NULL, fVerbose );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Proves the miter using fraiging and rewriting.]
+
+  Description [If pStop is given, the procedure quits with the undecided
+  status as soon as it is set by another thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_FraigCecInt( Aig_Man_t ** ppAig, int nConfLimit, volatile int * pStop, int fVerbose )
 {
     int nBTLimitStart =        300;   // starting SAT run
     int nBTLimitFirst =          2;   // first fraiging iteration
@@ -187,7 +258,7 @@ int Fra_FraigCec( Aig_Man_t ** ppAig, int nConfLimit, int fVerbose )
 
     // if SAT only, solve without iteration
 clk = clock();
-    RetValue = Fra_FraigSat( pAig, (ABC_INT64_T)2*nBTLimitStart, (ABC_INT64_T)0, 1, 0, 0 );
+    RetValue = Fra_FraigSatInt( pAig, (ABC_INT64_T)2*nBTLimitStart, (ABC_INT64_T)0, 1, 0, 1, pStop, 0 );
     if ( fVerbose )
     {
         printf( "Initial SAT:      Nodes = %6d.  ", Aig_ManNodeNum(pAig) );
@@ -214,6 +285,8 @@ ABC_PRT( "Time", clock() - clk );
     pParams->fProve = 1;
     for ( i = 0; i < 6; i++ )
     {
+        if ( pStop && *pStop )
+            break;
 //printf( "Running fraiging with %d BTnode and %d BTmiter.\n", pParams->nBTLimitNode, pParams->nBTLimitMiter );
         // run fraiging
 clk = clock();
@@ -252,10 +325,10 @@ ABC_PRT( "Time", clock() - clk );
     }
 
     // if still unsolved try last gasp
-    if ( RetValue == -1 )
+    if ( RetValue == -1 && !(pStop && *pStop) )
     {
 clk = clock();
-        RetValue = Fra_FraigSat( pAig, (ABC_INT64_T)nBTLimitLast, (ABC_INT64_T)0, 1, 0, 0 );
+        RetValue = Fra_FraigSatInt( pAig, (ABC_INT64_T)nBTLimitLast, (ABC_INT64_T)0, 1, 0, 1, pStop, 0 );
         if ( fVerbose )
         {
             printf( "Final SAT:            Nodes = %6d.  ", Aig_ManNodeNum(pAig) );
@@ -329,6 +402,153 @@ int Fra_FraigCecPartitioned( Aig_Man_t * pMan1, Aig_Man_t * pMan2, int nConfLimi
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Procedure executed by one partitioned CEC thread.]
+
+  Description [Takes the next unsolved partition until all partitions
+  are solved or one of them is disproved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Fra_CecWorkerThread( void * pArg )
+{
+    Fra_CecThData_t * pData = (Fra_CecThData_t *)pArg;
+    Aig_Man_t * pAig;
+    abctime clk;
+    int i, RetValue;
+    while ( !*pData->pStop )
+    {
+#ifdef ABC_USE_PTHREADS
+        i = __sync_fetch_and_add( pData->pNext, 1 );
+#else
+        i = (*pData->pNext)++;
+#endif
+        if ( i >= Vec_PtrSize(pData->vParts) )
+            break;
+        clk = Abc_ClockTicks( 1 );
+        pAig = (Aig_Man_t *)Vec_PtrEntry( pData->vParts, i );
+        pData->pNodes[i] = Aig_ManNodeNum( pAig );
+        RetValue = Fra_FraigMiterStatus( pAig );
+        if ( RetValue == -1 )
+        {
+            RetValue = Fra_FraigCecInt( &pAig, pData->nConfLimit, pData->pStop, 0 );
+            Vec_PtrWriteEntry( pData->vParts, i, pAig );
+        }
+        pData->pStatus[i]  = RetValue;
+        pData->pThreads[i] = pData->iThread;
+        pData->pTimes[i]   = Abc_ClockTicks( 1 ) - clk;
+        if ( RetValue == 0 )
+            *pData->pStop = 1;
+    }
+    Cnf_ClearMemory();
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs partitioned CEC using several threads.]
+
+  Description [The outputs are partitioned using their structural supports
+  as in Fra_FraigCecPartitioned(). The partitions are solved independently
+  by the threads, which stop as soon as one partition is disproved.
+  The threads rely on the CNF manager and the random number generator
+  being private to each thread (ABC_THREAD_LOCAL). If the compiler does
+  not support thread-local storage, the partitions are solved serially.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_FraigCecPartitionedPar( Aig_Man_t * pMan1, Aig_Man_t * pMan2, int nConfLimit, int nPartSize, int fSmart, int nThreads, int fVerbose )
+{
+#if defined(ABC_USE_PTHREADS) && !defined(ABC_NO_THREAD_LOCAL)
+    Fra_CecThData_t * pData;
+    pthread_t * pThreads;
+    Vec_Ptr_t * vParts;
+    Aig_Man_t * pAig;
+    volatile int Next = 0, Stop = 0;
+    int * pStatus, * pNodes, * pThreadIds;
+    abctime * pTimes;
+    int i, Status, nSolved = 0, RetValue = 1;
+    // create partitions
+    vParts = Aig_ManMiterPartitioned( pMan1, pMan2, nPartSize, fSmart );
+    nThreads = Abc_MinInt( nThreads, Vec_PtrSize(vParts) );
+    if ( fVerbose )
+        printf( "Solving %d partitions using %d threads.\n", Vec_PtrSize(vParts), nThreads );
+    pStatus    = ABC_ALLOC( int, Vec_PtrSize(vParts) );
+    pTimes     = ABC_CALLOC( abctime, Vec_PtrSize(vParts) );
+    pNodes     = ABC_CALLOC( int, Vec_PtrSize(vParts) );
+    pThreadIds = ABC_CALLOC( int, Vec_PtrSize(vParts) );
+    for ( i = 0; i < Vec_PtrSize(vParts); i++ )
+        pStatus[i] = -2;
+    // solve the partitions
+    pData = ABC_CALLOC( Fra_CecThData_t, Abc_MaxInt(nThreads, 1) );
+    pThreads = ABC_ALLOC( pthread_t, Abc_MaxInt(nThreads, 1) );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pData[i].vParts     = vParts;
+        pData[i].pStatus    = pStatus;
+        pData[i].pTimes     = pTimes;
+        pData[i].pNodes     = pNodes;
+        pData[i].pThreads   = pThreadIds;
+        pData[i].nConfLimit = nConfLimit;
+        pData[i].iThread    = i;
+        pData[i].pNext      = &Next;
+        pData[i].pStop      = &Stop;
+    }
+    for ( i = 1; i < nThreads; i++ )
+    {
+        Status = pthread_create( pThreads + i, NULL, Fra_CecWorkerThread, (void *)(pData + i) );
+        assert( Status == 0 );
+    }
+    if ( nThreads > 0 )
+        Fra_CecWorkerThread( (void *)pData );
+    for ( i = 1; i < nThreads; i++ )
+        pthread_join( pThreads[i], NULL );
+    // collect the results
+    for ( i = 0; i < Vec_PtrSize(vParts); i++ )
+    {
+        if ( pStatus[i] == 0 )
+            RetValue = 0;
+        else if ( pStatus[i] != 1 && RetValue == 1 )
+            RetValue = -1;
+        if ( pStatus[i] == 1 )
+            nSolved++;
+        if ( !fVerbose || pStatus[i] == -2 )
+            continue;
+        pAig = (Aig_Man_t *)Vec_PtrEntry( vParts, i );
+        printf( "Part %4d : PI = %5d. PO = %5d. And = %6d. Thread = %2d. %-9s ", 
+            i+1, Aig_ManPiNum(pAig), Aig_ManPoNum(pAig), pNodes[i], pThreadIds[i],
+            pStatus[i] == 1 ? "Proved" : (pStatus[i] == 0 ? "Disproved" : (Stop ? "Stopped" : "Undecided")) );
+        ABC_PRT( "Time", pTimes[i] );
+    }
+    // report the timeout
+    if ( RetValue == -1 )
+    {
+        printf( "Timed out after verifying %d partitions (out of %d).\n", nSolved, Vec_PtrSize(vParts) );
+        fflush( stdout );
+    }
+    ABC_FREE( pThreads );
+    ABC_FREE( pData );
+    ABC_FREE( pStatus );
+    ABC_FREE( pTimes );
+    ABC_FREE( pNodes );
+    ABC_FREE( pThreadIds );
+    // free intermediate results
+    Vec_PtrForEachEntry( Aig_Man_t *, vParts, pAig, i )
+        Aig_ManStop( pAig );
+    Vec_PtrFree( vParts );
+    return RetValue;
+#else
+    return Fra_FraigCecPartitioned( pMan1, pMan2, nConfLimit, nPartSize, fSmart, fVerbose );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    []
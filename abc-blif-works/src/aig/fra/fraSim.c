@@ -20,6 +20,10 @@
 
 #include "fra.h"
 #include "saig.h"
+
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -28,6 +32,14 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+typedef struct Fra_SmlThData_t_ Fra_SmlThData_t;
+struct Fra_SmlThData_t_
+{
+    Fra_Sml_t *      p;                 // simulation manager
+    int              iWordStart;        // the first word of the slice in each frame
+    int              iWordStop;         // the word after the last word of the slice
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -660,9 +672,15 @@ int Fra_SmlCheckNonConstOutputs( Fra_Sml_t * p )
 ***********************************************************************/
 void Fra_SmlSimulateOne( Fra_Sml_t * p )
 {
+    extern void Fra_SmlSimulateOnePar( Fra_Sml_t * p );
     Aig_Obj_t * pObj, * pObjLi, * pObjLo;
     int f, i, clk;
 clk = clock();
+#ifdef ABC_USE_PTHREADS
+    if ( p->nThreads > 1 && p->nWordsFrame > 1 )
+        Fra_SmlSimulateOnePar( p );
+    else
+#endif
     for ( f = 0; f < p->nFrames; f++ )
     {
         // simulate the nodes
@@ -685,6 +703,123 @@ p->timeSim += clock() - clk;
 p->nSimRounds++;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates the given range of words in each timeframe.]
+
+  Description [Performs the same computation as Fra_SmlSimulateOne()
+  restricted to words iWordStart <= w < iWordStop of every frame.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Fra_SmlSimulateOneRange( Fra_Sml_t * p, int iWordStart, int iWordStop )
+{
+    Aig_Obj_t * pObj, * pObjLi, * pObjLo;
+    unsigned * pSims, * pSims0, * pSims1, uMask, uMask0, uMask1;
+    int f, i, k;
+    for ( f = 0; f < p->nFrames; f++ )
+    {
+        // simulate the nodes
+        Aig_ManForEachNode( p->pAig, pObj, i )
+        {
+            pSims  = Fra_ObjSim(p, pObj->Id) + p->nWordsFrame * f;
+            pSims0 = Fra_ObjSim(p, Aig_ObjFanin0(pObj)->Id) + p->nWordsFrame * f;
+            pSims1 = Fra_ObjSim(p, Aig_ObjFanin1(pObj)->Id) + p->nWordsFrame * f;
+            uMask  = pObj->fPhase ? ~0 : 0;
+            uMask0 = Aig_ObjPhaseReal(Aig_ObjChild0(pObj)) ? ~0 : 0;
+            uMask1 = Aig_ObjPhaseReal(Aig_ObjChild1(pObj)) ? ~0 : 0;
+            for ( k = iWordStart; k < iWordStop; k++ )
+                pSims[k] = ((pSims0[k] ^ uMask0) & (pSims1[k] ^ uMask1)) ^ uMask;
+        }
+        // copy simulation info into outputs
+        Aig_ManForEachPo( p->pAig, pObj, i )
+        {
+            if ( f == p->nFrames - 1 && i >= Aig_ManPoNum(p->pAig) - Aig_ManRegNum(p->pAig) )
+                break;
+            pSims  = Fra_ObjSim(p, pObj->Id) + p->nWordsFrame * f;
+            pSims0 = Fra_ObjSim(p, Aig_ObjFanin0(pObj)->Id) + p->nWordsFrame * f;
+            uMask0 = Aig_ObjPhaseReal(Aig_ObjChild0(pObj)) ? ~0 : 0;
+            for ( k = iWordStart; k < iWordStop; k++ )
+                pSims[k] = pSims0[k] ^ uMask0;
+        }
+        // quit if this is the last timeframe
+        if ( f == p->nFrames - 1 )
+            break;
+        // copy simulation info into the inputs
+        Aig_ManForEachLiLoSeq( p->pAig, pObjLi, pObjLo, i )
+        {
+            pSims0 = Fra_ObjSim(p, pObjLi->Id) + p->nWordsFrame * f;
+            pSims1 = Fra_ObjSim(p, pObjLo->Id) + p->nWordsFrame * (f+1);
+            for ( k = iWordStart; k < iWordStop; k++ )
+                pSims1[k] = pSims0[k];
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the slice of words assigned to one thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Fra_SmlWorkerThread( void * pArg )
+{
+    Fra_SmlThData_t * pData = (Fra_SmlThData_t *)pArg;
+    Fra_SmlSimulateOneRange( pData->p, pData->iWordStart, pData->iWordStop );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates AIG manager using several threads.]
+
+  Description [The words of each frame are split into slices, which 
+  are simulated through all timeframes by different threads. Since the
+  patterns are assigned before the simulation starts, the result is the
+  same as that of the single-threaded simulation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Fra_SmlSimulateOnePar( Fra_Sml_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    Fra_SmlThData_t * pData;
+    pthread_t * pThreads;
+    int i, Status, nThreads = Abc_MinInt( p->nThreads, p->nWordsFrame );
+    pData = ABC_ALLOC( Fra_SmlThData_t, nThreads );
+    pThreads = ABC_ALLOC( pthread_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pData[i].p          = p;
+        pData[i].iWordStart = p->nWordsFrame * i / nThreads;
+        pData[i].iWordStop  = p->nWordsFrame * (i + 1) / nThreads;
+    }
+    for ( i = 1; i < nThreads; i++ )
+    {
+        Status = pthread_create( pThreads + i, NULL, Fra_SmlWorkerThread, (void *)(pData + i) );
+        assert( Status == 0 );
+    }
+    Fra_SmlWorkerThread( (void *)pData );
+    for ( i = 1; i < nThreads; i++ )
+        pthread_join( pThreads[i], NULL );
+    ABC_FREE( pThreads );
+    ABC_FREE( pData );
+#else
+    Fra_SmlSimulateOneRange( p, 0, p->nWordsFrame );
+#endif
+}
+
 
 /**Function*************************************************************
 
@@ -868,9 +1003,26 @@ Fra_Sml_t * Fra_SmlSimulateComb( Aig_Man_t * pAig, int nWords )
 
 ***********************************************************************/
 Fra_Sml_t * Fra_SmlSimulateSeq( Aig_Man_t * pAig, int nPref, int nFrames, int nWords, int fCheckMiter )
+{
+    return Fra_SmlSimulateSeqPar( pAig, nPref, nFrames, nWords, fCheckMiter, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs simulation of the initialized circuit using threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Fra_Sml_t * Fra_SmlSimulateSeqPar( Aig_Man_t * pAig, int nPref, int nFrames, int nWords, int fCheckMiter, int nThreads )
 {
     Fra_Sml_t * p;
     p = Fra_SmlStart( pAig, nPref, nFrames, nWords );
+    p->nThreads = nThreads;
     Fra_SmlInitialize( p, 1 );
     Fra_SmlSimulateOne( p );
     if ( fCheckMiter )
@@ -98,6 +98,7 @@ struct Gia_Obj_t_
 
 // new AIG manager
 typedef struct Gia_Man_t_ Gia_Man_t;
+typedef struct Gia_AigWr_t_ Gia_AigWr_t;
 struct Gia_Man_t_
 {
     char *         pName;         // name of the AIG
@@ -189,6 +190,7 @@ struct Gia_ParSim_t_
     int            fCheckMiter;   // check if miter outputs are non-zero
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
+    int            nThreads;      // the number of threads
 };
 
 extern void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p );
@@ -604,8 +606,16 @@ extern int                 Gia_ManPbaPerform( Gia_Man_t * pGia, int nFrames, int
 extern int                 Gia_ManCbaPerform( Gia_Man_t * pGia, void * pPars );
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
+extern char *              Gia_FileMap( char * pFileName, size_t * pnFileSize );
+extern void                Gia_FileUnmap( char * pContents, size_t nFileSize );
 extern Gia_Man_t *         Gia_ReadAigerFromMemory( char * pContents, int nFileSize, int fCheck );
 extern Gia_Man_t *         Gia_ReadAiger( char * pFileName, int fCheck );
+extern Gia_AigWr_t *       Gia_AigWrStart( char * pFileName );
+extern void                Gia_AigWrFlush( Gia_AigWr_t * p );
+extern int                 Gia_AigWrStop( Gia_AigWr_t * p );
+extern void                Gia_AigWrWrite( Gia_AigWr_t * p, void * pData, int nSize );
+extern int                 Gia_AigWrPrintf( Gia_AigWr_t * p, char * pFormat, ... );
+extern void                Gia_AigWrEncode( Gia_AigWr_t * p, unsigned x );
 extern void                Gia_WriteAiger( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 /*=== giaBidec.c ===========================================================*/
@@ -19,7 +19,21 @@
 
 ***********************************************************************/
 
+#include <stdarg.h>
 #include "gia.h"
+#include "zlib.h"
+#include "bzlib.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -28,6 +42,44 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_AIG_WINDOW  (1 << 20)   // the window for reading compressed files (bytes)
+#define GIA_AIG_LINE    (1 << 12)   // the longest line of the ASCII header (bytes)
+
+typedef struct Gia_AigRd_t_ Gia_AigRd_t;
+struct Gia_AigRd_t_
+{
+    gzFile          pGz;         // gzip input (NULL if the input is in memory)
+    FILE *          pFile;       // bzip2 input file
+    BZFILE *        pBz;         // bzip2 input (NULL if the input is in memory)
+    unsigned char * pBuf;        // the beginning of the data
+    unsigned char * pCur;        // the current reading position
+    unsigned char * pEnd;        // the end of the data (followed by a zero byte)
+    int             fEof;        // set when the compressed input is exhausted
+};
+
+#define GIA_AIG_CHUNK   (1 << 20)   // the chunk of the output passed to the writer (bytes)
+
+struct Gia_AigWr_t_
+{
+    FILE *          pFile;       // output file (uncompressed or bzip2)
+    gzFile          pGz;         // gzip stream
+    BZFILE *        pBz;         // bzip2 stream
+    unsigned char * pChunks[2];  // the chunk being filled and the chunk being written
+    unsigned char * pCur;        // the current position in the chunk being filled
+    unsigned char * pLimit;      // the end of the chunk being filled
+    int             iChunk;      // the chunk being filled
+    int             fError;      // set if writing has failed
+#ifdef ABC_USE_PTHREADS
+    int             fThread;     // set if the background writer is running
+    pthread_t       Thread;      // the background writer
+    pthread_mutex_t Mutex;       // protects the pending chunk
+    pthread_cond_t  Cond;        // signals changes of the pending chunk
+    unsigned char * pPending;    // the chunk handed to the writer (NULL if none)
+    int             nPending;    // the size of the pending chunk
+    int             fStop;       // set when the writer should quit
+#endif
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -132,6 +184,97 @@ int Gia_FileSize( char * pFileName )
     return nFileSize;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [The contents are followed by at least one zero byte, so
+  that the parsers can run past the end of the file without a check.
+  The pages are mapped privately and can be overwritten by the caller.
+  Without mmap(), the file is read into a newly allocated buffer.
+  The size is 64-bit, so that files larger than 2 GB can be mapped.]
+
+  SideEffects []
+
+  SeeAlso     [Gia_FileUnmap]
+
+***********************************************************************/
+char * Gia_FileMap( char * pFileName, size_t * pnFileSize )
+{
+    char * pContents;
+    size_t nFileSize;
+#ifndef _WIN32
+    struct stat Stat;
+    size_t nMap, nPage = (size_t)sysconf( _SC_PAGESIZE );
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+    {
+        printf( "Gia_FileMap(): Cannot open input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    if ( fstat( fd, &Stat ) == -1 || (ABC_UINT64_T)Stat.st_size >= (ABC_UINT64_T)((size_t)-1 - nPage) )
+    {
+        printf( "Gia_FileMap(): Cannot get the size of input file \"%s\".\n", pFileName );
+        close( fd );
+        return NULL;
+    }
+    nFileSize = (size_t)Stat.st_size;
+    nMap = (nFileSize / nPage + 1) * nPage;
+    // reserve zero pages covering the file and the terminating zero
+    pContents = (char *)mmap( NULL, nMap, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if ( pContents != MAP_FAILED && nFileSize > 0 && 
+         mmap( pContents, nFileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0 ) == MAP_FAILED )
+    {
+        munmap( pContents, nMap );
+        pContents = (char *)MAP_FAILED;
+    }
+    close( fd );
+    if ( pContents == MAP_FAILED )
+    {
+        printf( "Gia_FileMap(): Cannot map input file \"%s\" into memory.\n", pFileName );
+        return NULL;
+    }
+    madvise( pContents, nFileSize, MADV_SEQUENTIAL );
+#else
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Gia_FileMap(): Cannot open input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    _fseeki64( pFile, 0, SEEK_END );
+    nFileSize = (size_t)_ftelli64( pFile );
+    _fseeki64( pFile, 0, SEEK_SET );
+    pContents = ABC_ALLOC( char, nFileSize + 1 );
+    fread( pContents, nFileSize, 1, pFile );
+    pContents[nFileSize] = 0;
+    fclose( pFile );
+#endif
+    *pnFileSize = nFileSize;
+    return pContents;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Releases the file mapped into memory.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     [Gia_FileMap]
+
+***********************************************************************/
+void Gia_FileUnmap( char * pContents, size_t nFileSize )
+{
+#ifndef _WIN32
+    size_t nPage = (size_t)sysconf( _SC_PAGESIZE );
+    munmap( pContents, (nFileSize / nPage + 1) * nPage );
+#else
+    ABC_FREE( pContents );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -557,144 +700,25 @@ Gia_Man_t * Gia_ReadAiger2( char * pFileName, int fCheck )
 
 /**Function*************************************************************
 
-  Synopsis    [Reads the AIG in the binary AIGER format.]
+  Synopsis    [Reads the extensions and the symbol table.]
 
-  Description []
+  Description [The buffer contains the part of the file following the
+  AND gates. Returns the types of the POs if constraints or invariants
+  were recognized by their names, or NULL otherwise.]
   
-  SideEffects []
+  SideEffects [May overwrite the buffer.]
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_ReadAigerFromMemory( char * pContents, int nFileSize, int fCheck )
+static Vec_Int_t * Gia_ReadAigerSymbols( Gia_Man_t * pNew, char * pContents, size_t nFileSize, int nInputs, int nOutputs, int nLatches )
 {
-    Gia_Man_t * pNew, * pTemp;
-    Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
-    Vec_Int_t * vNodes, * vDrivers;//, * vTerms;
-    int iObj, iNode0, iNode1;
-    int nTotal, nInputs, nOutputs, nLatches, nAnds, i;//, iTerm, nDigits;
-    unsigned char * pDrivers, * pSymbols, * pCur;//, * pType;
-    unsigned uLit0, uLit1, uLit;
-
-    // read the file type
-    pCur = (unsigned char *)pContents;  while ( *pCur++ != ' ' );
-    // read the number of objects
-    nTotal = atoi( (char *)pCur );    while ( *pCur++ != ' ' );
-    // read the number of inputs
-    nInputs = atoi( (char *)pCur );   while ( *pCur++ != ' ' );
-    // read the number of latches
-    nLatches = atoi( (char *)pCur );  while ( *pCur++ != ' ' );
-    // read the number of outputs
-    nOutputs = atoi( (char *)pCur );  while ( *pCur++ != ' ' );
-    // read the number of nodes
-    nAnds = atoi( (char *)pCur );     while ( *pCur++ != '\n' );  
-    // check the parameters
-    if ( nTotal != nInputs + nLatches + nAnds )
-    {
-        ABC_FREE( pContents );
-        fprintf( stdout, "The paramters are wrong.\n" );
-        return NULL;
-    }
-
-    // allocate the empty AIG
-    pNew = Gia_ManStart( nTotal + nLatches + nOutputs + 1 );
-
-    // prepare the array of nodes
-    vNodes = Vec_IntAlloc( 1 + nTotal );
-    Vec_IntPush( vNodes, 0 );
-
-    // create the PIs
-    for ( i = 0; i < nInputs + nLatches; i++ )
-    {
-        iObj = Gia_ManAppendCi(pNew);    
-        Vec_IntPush( vNodes, iObj );
-    }
-
-    // remember the beginning of latch/PO literals
-    pDrivers = pCur;
-    if ( pContents[3] == ' ' ) // standard AIGER
-    {
-        // scroll to the beginning of the binary data
-        for ( i = 0; i < nLatches + nOutputs; )
-            if ( *pCur++ == '\n' )
-                i++;
-    }
-    else // modified AIGER
-    {
-        vLits = Gia_WriteDecodeLiterals( &pCur, nLatches + nOutputs );
-    }
-
-    // create the AND gates
-    Gia_ManHashAlloc( pNew );
-    for ( i = 0; i < nAnds; i++ )
-    {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_ReadAigerDecode( &pCur );
-        uLit0 = uLit1 - Gia_ReadAigerDecode( &pCur );
-//        assert( uLit1 > uLit0 );
-        iNode0 = Gia_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
-        iNode1 = Gia_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
-        assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
-//        Vec_IntPush( vNodes, Gia_And(pNew, iNode0, iNode1) );
-        Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
-    }
-    Gia_ManHashStop( pNew );
-
-    // remember the place where symbols begin
-    pSymbols = pCur;
-
-    // read the latch driver literals
-    vDrivers = Vec_IntAlloc( nLatches + nOutputs );
-    if ( pContents[3] == ' ' ) // standard AIGER
-    {
-        pCur = pDrivers;
-        for ( i = 0; i < nLatches; i++ )
-        {
-            uLit0 = atoi( (char *)pCur );  while ( *pCur++ != '\n' );
-            iNode0 = Gia_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
-            Vec_IntPush( vDrivers, iNode0 );
-        }
-        // read the PO driver literals
-        for ( i = 0; i < nOutputs; i++ )
-        {
-            uLit0 = atoi( (char *)pCur );  while ( *pCur++ != '\n' );
-            iNode0 = Gia_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
-            Vec_IntPush( vDrivers, iNode0 );
-        }
-
-    }
-    else
-    {
-        // read the latch driver literals
-        for ( i = 0; i < nLatches; i++ )
-        {
-            uLit0 = Vec_IntEntry( vLits, i );
-            iNode0 = Gia_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
-            Vec_IntPush( vDrivers, iNode0 );
-        }
-        // read the PO driver literals
-        for ( i = 0; i < nOutputs; i++ )
-        {
-            uLit0 = Vec_IntEntry( vLits, i+nLatches );
-            iNode0 = Gia_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
-            Vec_IntPush( vDrivers, iNode0 );
-        }
-        Vec_IntFree( vLits );
-    }
-
-    // create the POs
-    for ( i = 0; i < nOutputs; i++ )
-        Gia_ManAppendCo( pNew, Vec_IntEntry(vDrivers, nLatches + i) );
-    for ( i = 0; i < nLatches; i++ )
-        Gia_ManAppendCo( pNew, Vec_IntEntry(vDrivers, i) );
-    Vec_IntFree( vDrivers );
-
-    // create the latches
-    Gia_ManSetRegNum( pNew, nLatches );
-
+    Vec_Int_t * vPoTypes = NULL;
+    unsigned char * pCur;
+    int i;
 
     // check if there are other types of information to read
-    pCur = pSymbols;
+    pCur = (unsigned char *)pContents;
     if ( (char *)pCur + 1 < pContents + nFileSize && *pCur == 'c' )
     {
         pCur++;
@@ -878,17 +902,28 @@ Gia_Man_t * Gia_ReadAigerFromMemory( char * pContents, int nFileSize, int fCheck
         }
     }
 
-    // skipping the comments
-    Vec_IntFree( vNodes );
-/*
-    // check the result
-    if ( fCheck && !Gia_ManCheck( pNew ) )
-    {
-        printf( "Gia_ReadAiger: The network check has failed.\n" );
-        Gia_ManStop( pNew );
-        return NULL;
-    }
-*/
+    return vPoTypes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finalizes the AIG after reading.]
+
+  Description [Adds the constraints and removes the dangling nodes. If
+  all nodes are used, the AIG is not duplicated, which keeps the peak
+  memory close to the size of the resulting AIG. In this case, the 
+  information not transferred by Gia_ManDupMarked() is freed, so that
+  the result is the same as with the duplication.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Gia_ReadAigerFinish( Gia_Man_t * pNew, Vec_Int_t * vPoTypes )
+{
+    Gia_Man_t * pTemp;
+    Vec_Int_t * vFlopMap;
     // clean the PO drivers
     if ( vPoTypes )
     {
@@ -896,87 +931,88 @@ Gia_Man_t * Gia_ReadAigerFromMemory( char * pContents, int nFileSize, int fCheck
         Gia_ManStop( pTemp );
         Vec_IntFreeP( &vPoTypes );
     }
-
+    vFlopMap = pNew->vFlopClasses; pNew->vFlopClasses = NULL;
+    if ( pNew->pReprs == NULL && Gia_ManCombMarkUsed( pNew ) == Gia_ManAndNum( pNew ) )
+    {
+        ABC_FREE( pNew->pMapping );
+        ABC_FREE( pNew->pPlacement );
+        ABC_FREE( pNew->pSwitching );
+        Vec_IntFreeP( &pNew->vUserPiIds );
+        Vec_IntFreeP( &pNew->vUserPoIds );
+        Vec_IntFreeP( &pNew->vUserFfIds );
+    }
+    else
     {
-        Vec_Int_t * vFlopMap;
-        vFlopMap = pNew->vFlopClasses; pNew->vFlopClasses = NULL;
         pNew = Gia_ManCleanup( pTemp = pNew );
         Gia_ManStop( pTemp );
-        pNew->vFlopClasses = vFlopMap;
     }
+    pNew->vFlopClasses = vFlopMap;
     return pNew;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Reads the AIG in the binary AIGER format.]
+  Synopsis    [Inflates the given number of bytes of compressed input.]
 
-  Description []
+  Description [Returns the number of bytes read, which is smaller than
+  requested only at the end of the input.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_ReadAiger( char * pFileName, int fCheck )
+static int Gia_AigRdRead( Gia_AigRd_t * p, unsigned char * pData, int nBytes )
 {
-    FILE * pFile;
-    Gia_Man_t * pNew;
-    char * pName, * pContents;
-    int nFileSize;
-
-    // read the file into the buffer
-    Gia_FixFileName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
-    pNew = Gia_ReadAigerFromMemory( pContents, nFileSize, fCheck );
-    ABC_FREE( pContents );
-    if ( pNew )
+    int nRead, nTotal = 0, bzError;
+    while ( !p->fEof && nTotal < nBytes )
     {
-        ABC_FREE( pNew->pName );
-        pName = Gia_FileNameGeneric( pFileName );
-        pNew->pName = Gia_UtilStrsav( pName );
-//        pNew->pSpec = Ioa_UtilStrsav( pFileName );
-        ABC_FREE( pName );
+        if ( p->pGz )
+            nRead = gzread( p->pGz, pData + nTotal, nBytes - nTotal );
+        else
+        {
+            nRead = BZ2_bzRead( &bzError, p->pBz, pData + nTotal, nBytes - nTotal );
+            if ( bzError != BZ_OK )
+                p->fEof = 1;
+        }
+        if ( nRead <= 0 )
+            p->fEof = 1;
+        else
+            nTotal += nRead;
     }
-    return pNew;
+    return nTotal;
 }
 
-
-
 /**Function*************************************************************
 
-  Synopsis    [Adds one unsigned AIG edge to the output buffer.]
+  Synopsis    [Makes sure that the window contains the given number of bytes.]
 
-  Description [This procedure is a slightly modified version of Armin Biere's
-  procedure "void encode (FILE * file, unsigned x)" ]
+  Description [Only compressed input is read through the window. For
+  the input in memory, the complete file is available at once.]
   
-  SideEffects [Returns the current writing position.]
+  SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_WriteAigerEncode( unsigned char * pBuffer, int Pos, unsigned x )
+static inline void Gia_AigRdEnsure( Gia_AigRd_t * p, int nBytes )
 {
-    unsigned char ch;
-    while (x & ~0x7f)
-    {
-        ch = (x & 0x7f) | 0x80;
-        pBuffer[Pos++] = ch;
-        x >>= 7;
-    }
-    ch = x;
-    pBuffer[Pos++] = ch;
-    return Pos;
+    int nLeft;
+    if ( (p->pGz == NULL && p->pBz == NULL) || p->fEof )
+        return;
+    nLeft = (int)(p->pEnd - p->pCur);
+    if ( nLeft >= nBytes )
+        return;
+    memmove( p->pBuf, p->pCur, nLeft );
+    p->pCur = p->pBuf;
+    p->pEnd = p->pBuf + nLeft;
+    p->pEnd += Gia_AigRdRead( p, p->pEnd, GIA_AIG_WINDOW - nLeft );
+    *p->pEnd = 0;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Create the array of literals to be written.]
+  Synopsis    [Decodes the encoded array of literals.]
 
   Description []
   
@@ -985,16 +1021,347 @@ int Gia_WriteAigerEncode( unsigned char * pBuffer, int Pos, unsigned x )
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Int_t * Gia_WriteAigerLiterals( Gia_Man_t * p )
+static Vec_Int_t * Gia_AigRdDecodeLiterals( Gia_AigRd_t * p, int nEntries )
 {
     Vec_Int_t * vLits;
-    Gia_Obj_t * pObj;
-    int i;
-    vLits = Vec_IntAlloc( Gia_ManPoNum(p) );
-    Gia_ManForEachRi( p, pObj, i )
-        Vec_IntPush( vLits, Gia_ObjFaninLit0p(p, pObj) );
-    Gia_ManForEachPo( p, pObj, i )
-        Vec_IntPush( vLits, Gia_ObjFaninLit0p(p, pObj) );
+    int Lit, LitPrev, Diff, i;
+    vLits = Vec_IntAlloc( nEntries );
+    if ( nEntries == 0 )
+        return vLits;
+    Gia_AigRdEnsure( p, 8 );
+    LitPrev = Gia_ReadAigerDecode( &p->pCur );
+    Vec_IntPush( vLits, LitPrev );
+    for ( i = 1; i < nEntries; i++ )
+    {
+        Gia_AigRdEnsure( p, 8 );
+        Diff = Gia_ReadAigerDecode( &p->pCur );
+        Diff = (Diff & 1)? -(Diff >> 1) : Diff >> 1;
+        Lit  = Diff + LitPrev;
+        Vec_IntPush( vLits, Lit );
+        LitPrev = Lit;
+    }
+    return vLits;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the rest of the input following the AND gates.]
+
+  Description [For compressed input, inflates the rest of the file into
+  a new buffer, which should be freed by the caller.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Gia_AigRdRest( Gia_AigRd_t * p, size_t * pnSize )
+{
+    char * pRest;
+    size_t nSize, nCap;
+    if ( p->pGz == NULL && p->pBz == NULL )
+    {
+        *pnSize = (size_t)(p->pEnd - p->pCur);
+        return (char *)p->pCur;
+    }
+    nSize = (size_t)(p->pEnd - p->pCur);
+    nCap  = 2 * nSize > (1 << 16) ? 2 * nSize : (1 << 16);
+    pRest = ABC_ALLOC( char, nCap + 1 );
+    memcpy( pRest, p->pCur, nSize );
+    while ( !p->fEof )
+    {
+        if ( nSize == nCap )
+        {
+            nCap *= 2;
+            pRest = ABC_REALLOC( char, pRest, nCap + 1 );
+        }
+        nSize += Gia_AigRdRead( p, (unsigned char *)pRest + nSize, (int)(nCap - nSize < (1 << 30) ? nCap - nSize : (1 << 30)) );
+    }
+    pRest[nSize] = 0;
+    p->pCur = p->pEnd;
+    *pnSize = nSize;
+    return pRest;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [Reads the input sequentially, either from memory or from
+  the window of the compressed file. As long as the structural hashing
+  does not merge nodes, the AIGER variables are the same as the object
+  IDs, so the AND gates are decoded directly into the object array and
+  the variable-to-literal map is only created after the first merge.
+  Returns NULL if the header is wrong.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Gia_ReadAigerStream( Gia_AigRd_t * p )
+{
+    Gia_Man_t * pNew;
+    Vec_Int_t * vLits, * vPoTypes, * vNodes = NULL;
+    int nTotal, nInputs, nOutputs, nLatches, nAnds, fStandard, i, k;
+    size_t nRest;
+    int iNode, iNode0, iNode1;
+    unsigned uLit0, uLit1, uLit;
+    char * pRest;
+
+    Gia_AigRdEnsure( p, GIA_AIG_LINE );
+    fStandard = (p->pCur[3] == ' ');
+    // read the file type
+    while ( *p->pCur++ != ' ' );
+    // read the number of objects
+    nTotal = atoi( (char *)p->pCur );    while ( *p->pCur++ != ' ' );
+    // read the number of inputs
+    nInputs = atoi( (char *)p->pCur );   while ( *p->pCur++ != ' ' );
+    // read the number of latches
+    nLatches = atoi( (char *)p->pCur );  while ( *p->pCur++ != ' ' );
+    // read the number of outputs
+    nOutputs = atoi( (char *)p->pCur );  while ( *p->pCur++ != ' ' );
+    // read the number of nodes
+    nAnds = atoi( (char *)p->pCur );     while ( *p->pCur++ != '\n' );  
+    // check the parameters
+    if ( nTotal != nInputs + nLatches + nAnds )
+    {
+        fprintf( stdout, "The paramters are wrong.\n" );
+        return NULL;
+    }
+
+    // read the latch/PO literals
+    if ( fStandard ) // standard AIGER
+    {
+        vLits = Vec_IntAlloc( nLatches + nOutputs );
+        for ( i = 0; i < nLatches + nOutputs; i++ )
+        {
+            Gia_AigRdEnsure( p, GIA_AIG_LINE );
+            Vec_IntPush( vLits, atoi( (char *)p->pCur ) );  while ( *p->pCur++ != '\n' );
+        }
+    }
+    else // modified AIGER
+        vLits = Gia_AigRdDecodeLiterals( p, nLatches + nOutputs );
+
+    // allocate the empty AIG
+    pNew = Gia_ManStart( nTotal + nLatches + nOutputs + 1 );
+    // create the PIs
+    for ( i = 0; i < nInputs + nLatches; i++ )
+        Gia_ManAppendCi( pNew );
+
+    // create the AND gates
+    Gia_ManHashAlloc( pNew );
+    for ( i = 0; i < nAnds; i++ )
+    {
+        Gia_AigRdEnsure( p, 16 );
+        uLit = ((i + 1 + nInputs + nLatches) << 1);
+        uLit1 = uLit  - Gia_ReadAigerDecode( &p->pCur );
+        uLit0 = uLit1 - Gia_ReadAigerDecode( &p->pCur );
+        iNode0 = vNodes ? Gia_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 ) : (int)uLit0;
+        iNode1 = vNodes ? Gia_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 ) : (int)uLit1;
+        iNode  = Gia_ManHashAnd( pNew, iNode0, iNode1 );
+        if ( vNodes )
+            Vec_IntPush( vNodes, iNode );
+        else if ( iNode != (int)uLit )
+        {
+            // the first merged node; start mapping variables into literals
+            vNodes = Vec_IntAlloc( 1 + nTotal );
+            for ( k = 0; k < (int)(uLit >> 1); k++ )
+                Vec_IntPush( vNodes, Gia_Var2Lit(k, 0) );
+            Vec_IntPush( vNodes, iNode );
+        }
+    }
+    Gia_ManHashStop( pNew );
+
+    // create the POs
+    for ( i = 0; i < nOutputs; i++ )
+    {
+        uLit0 = Vec_IntEntry( vLits, nLatches + i );
+        Gia_ManAppendCo( pNew, vNodes ? Gia_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 ) : (int)uLit0 );
+    }
+    // create the latch inputs
+    for ( i = 0; i < nLatches; i++ )
+    {
+        uLit0 = Vec_IntEntry( vLits, i );
+        Gia_ManAppendCo( pNew, vNodes ? Gia_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 ) : (int)uLit0 );
+    }
+    Gia_ManSetRegNum( pNew, nLatches );
+    Vec_IntFreeP( &vNodes );
+    Vec_IntFree( vLits );
+
+    // read the extensions and the symbols
+    pRest = Gia_AigRdRest( p, &nRest );
+    vPoTypes = Gia_ReadAigerSymbols( pNew, pRest, nRest, nInputs, nOutputs, nLatches );
+    if ( p->pGz || p->pBz )
+        ABC_FREE( pRest );
+    return Gia_ReadAigerFinish( pNew, vPoTypes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ReadAigerFromMemory( char * pContents, int nFileSize, int fCheck )
+{
+    Gia_AigRd_t Rd, * p = &Rd;
+    Gia_Man_t * pNew;
+    memset( p, 0, sizeof(Gia_AigRd_t) );
+    p->pBuf = p->pCur = (unsigned char *)pContents;
+    p->pEnd = (unsigned char *)pContents + nFileSize;
+    pNew = Gia_ReadAigerStream( p );
+    if ( pNew == NULL )
+        ABC_FREE( pContents );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [Uncompressed files are memory-mapped and decoded without
+  copying. Files ending in ".gz" and ".bz2" are inflated while being 
+  decoded, one window at a time.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ReadAiger( char * pFileName, int fCheck )
+{
+    Gia_AigRd_t Rd, * p = &Rd;
+    Gia_Man_t * pNew = NULL;
+    char * pName, * pContents = NULL;
+    size_t nFileSize = 0;
+    int bzError;
+
+    // prepare the input
+    Gia_FixFileName( pFileName );
+    memset( p, 0, sizeof(Gia_AigRd_t) );
+    if ( !strncmp(pFileName+strlen(pFileName)-3,".gz",3) )
+    {
+        p->pGz = gzopen( pFileName, "rb" );
+        if ( p->pGz == NULL )
+        {
+            printf( "Gia_ReadAiger(): Cannot open input file \"%s\".\n", pFileName );
+            return NULL;
+        }
+        p->pBuf = p->pCur = p->pEnd = ABC_ALLOC( unsigned char, GIA_AIG_WINDOW + 1 );
+        Gia_AigRdEnsure( p, GIA_AIG_WINDOW );
+    }
+    else if ( !strncmp(pFileName+strlen(pFileName)-4,".bz2",4) )
+    {
+        p->pFile = fopen( pFileName, "rb" );
+        if ( p->pFile == NULL )
+        {
+            printf( "Gia_ReadAiger(): Cannot open input file \"%s\".\n", pFileName );
+            return NULL;
+        }
+        p->pBz = BZ2_bzReadOpen( &bzError, p->pFile, 0, 0, NULL, 0 );
+        if ( bzError != BZ_OK )
+        {
+            printf( "Gia_ReadAiger(): BZ2_bzReadOpen() failed for \"%s\".\n", pFileName );
+            BZ2_bzReadClose( &bzError, p->pBz );
+            fclose( p->pFile );
+            return NULL;
+        }
+        p->pBuf = p->pCur = p->pEnd = ABC_ALLOC( unsigned char, GIA_AIG_WINDOW + 1 );
+        Gia_AigRdEnsure( p, GIA_AIG_WINDOW );
+    }
+    else
+    {
+        pContents = Gia_FileMap( pFileName, &nFileSize );
+        if ( pContents == NULL )
+            return NULL;
+        p->pBuf = p->pCur = (unsigned char *)pContents;
+        p->pEnd = (unsigned char *)pContents + nFileSize;
+    }
+
+    // read the AIG
+    if ( strncmp((char *)p->pCur, "aig", 3) != 0 || (p->pCur[3] != ' ' && p->pCur[3] != '2') )
+        fprintf( stdout, "Wrong input file format.\n" );
+    else
+        pNew = Gia_ReadAigerStream( p );
+    if ( p->pGz )
+    {
+        gzclose( p->pGz );
+        ABC_FREE( p->pBuf );
+    }
+    else if ( p->pBz )
+    {
+        BZ2_bzReadClose( &bzError, p->pBz );
+        fclose( p->pFile );
+        ABC_FREE( p->pBuf );
+    }
+    else
+        Gia_FileUnmap( pContents, nFileSize );
+    if ( pNew )
+    {
+        ABC_FREE( pNew->pName );
+        pName = Gia_FileNameGeneric( pFileName );
+        pNew->pName = Gia_UtilStrsav( pName );
+//        pNew->pSpec = Ioa_UtilStrsav( pFileName );
+        ABC_FREE( pName );
+    }
+    return pNew;
+}
+
+
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one unsigned AIG edge to the output buffer.]
+
+  Description [This procedure is a slightly modified version of Armin Biere's
+  procedure "void encode (FILE * file, unsigned x)" ]
+  
+  SideEffects [Returns the current writing position.]
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_WriteAigerEncode( unsigned char * pBuffer, int Pos, unsigned x )
+{
+    unsigned char ch;
+    while (x & ~0x7f)
+    {
+        ch = (x & 0x7f) | 0x80;
+        pBuffer[Pos++] = ch;
+        x >>= 7;
+    }
+    ch = x;
+    pBuffer[Pos++] = ch;
+    return Pos;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Create the array of literals to be written.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_WriteAigerLiterals( Gia_Man_t * p )
+{
+    Vec_Int_t * vLits;
+    Gia_Obj_t * pObj;
+    int i;
+    vLits = Vec_IntAlloc( Gia_ManPoNum(p) );
+    Gia_ManForEachRi( p, pObj, i )
+        Vec_IntPush( vLits, Gia_ObjFaninLit0p(p, pObj) );
+    Gia_ManForEachPo( p, pObj, i )
+        Vec_IntPush( vLits, Gia_ObjFaninLit0p(p, pObj) );
     return vLits;
 }
 
@@ -1185,7 +1552,222 @@ unsigned char * Gia_WriteMapping( Gia_Man_t * p, int * pMapSize )
 
 /**Function*************************************************************
 
-  Synopsis    [Writes the AIG in the binary AIGER format.]
+  Synopsis    [Writes one chunk into the output stream.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_AigWrWriteChunk( Gia_AigWr_t * p, unsigned char * pData, int nSize )
+{
+    int bzError;
+    if ( nSize == 0 || p->fError )
+        return;
+    if ( p->pGz )
+        p->fError = (gzwrite( p->pGz, pData, nSize ) != nSize);
+    else if ( p->pBz )
+    {
+        BZ2_bzWrite( &bzError, p->pBz, pData, nSize );
+        p->fError = (bzError != BZ_OK);
+    }
+    else
+        p->fError = (fwrite( pData, 1, nSize, p->pFile ) != (size_t)nSize);
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Background thread writing the filled chunks.]
+
+  Description [Compression happens here, while the caller is encoding
+  the next chunk.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Gia_AigWrThread( void * pArg )
+{
+    Gia_AigWr_t * p = (Gia_AigWr_t *)pArg;
+    unsigned char * pData;
+    int nSize;
+    pthread_mutex_lock( &p->Mutex );
+    while ( 1 )
+    {
+        while ( p->pPending == NULL && !p->fStop )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        if ( p->pPending == NULL )
+            break;
+        pData = p->pPending;
+        nSize = p->nPending;
+        pthread_mutex_unlock( &p->Mutex );
+        Gia_AigWrWriteChunk( p, pData, nSize );
+        pthread_mutex_lock( &p->Mutex );
+        p->pPending = NULL;
+        pthread_cond_broadcast( &p->Cond );
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    return NULL;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the chunked output stream.]
+
+  Description [Files ending in ".gz" and ".bz2" are compressed using
+  gzip and bzip2, respectively. Returns NULL if the file cannot be 
+  opened.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_AigWr_t * Gia_AigWrStart( char * pFileName )
+{
+    Gia_AigWr_t * p;
+    int bzError, nLength = strlen(pFileName);
+    p = ABC_CALLOC( Gia_AigWr_t, 1 );
+    if ( nLength > 3 && !strcmp(pFileName + nLength - 3, ".gz") )
+    {
+        p->pGz = gzopen( pFileName, "wb" );
+        if ( p->pGz == NULL )
+        {
+            ABC_FREE( p );
+            return NULL;
+        }
+        gzbuffer( p->pGz, GIA_AIG_CHUNK / 4 );
+    }
+    else
+    {
+        p->pFile = fopen( pFileName, "wb" );
+        if ( p->pFile == NULL )
+        {
+            ABC_FREE( p );
+            return NULL;
+        }
+        if ( nLength > 4 && !strcmp(pFileName + nLength - 4, ".bz2") )
+        {
+            p->pBz = BZ2_bzWriteOpen( &bzError, p->pFile, 9, 0, 0 );
+            if ( bzError != BZ_OK )
+            {
+                BZ2_bzWriteClose( &bzError, p->pBz, 0, NULL, NULL );
+                fclose( p->pFile );
+                ABC_FREE( p );
+                return NULL;
+            }
+        }
+    }
+    p->pChunks[0] = ABC_ALLOC( unsigned char, GIA_AIG_CHUNK );
+    p->pCur   = p->pChunks[0];
+    p->pLimit = p->pChunks[0] + GIA_AIG_CHUNK;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Passes the filled chunk to the writer.]
+
+  Description [The background writer is started when the first chunk
+  is filled, so small files are written without creating a thread.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigWrFlush( Gia_AigWr_t * p )
+{
+    unsigned char * pData = p->pChunks[p->iChunk];
+    int nSize = p->pCur - pData;
+#ifdef ABC_USE_PTHREADS
+    if ( !p->fThread )
+    {
+        pthread_mutex_init( &p->Mutex, NULL );
+        pthread_cond_init( &p->Cond, NULL );
+        p->fThread = !pthread_create( &p->Thread, NULL, Gia_AigWrThread, (void *)p );
+        if ( !p->fThread )
+        {
+            pthread_mutex_destroy( &p->Mutex );
+            pthread_cond_destroy( &p->Cond );
+        }
+    }
+    if ( p->fThread )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->pPending )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        p->pPending = pData;
+        p->nPending = nSize;
+        pthread_cond_broadcast( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+        // continue with the other chunk
+        p->iChunk ^= 1;
+        if ( p->pChunks[p->iChunk] == NULL )
+            p->pChunks[p->iChunk] = ABC_ALLOC( unsigned char, GIA_AIG_CHUNK );
+    }
+    else
+#endif
+    Gia_AigWrWriteChunk( p, pData, nSize );
+    p->pCur   = p->pChunks[p->iChunk];
+    p->pLimit = p->pChunks[p->iChunk] + GIA_AIG_CHUNK;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the output stream.]
+
+  Description [Returns 1 if all data has been written successfully.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_AigWrStop( Gia_AigWr_t * p )
+{
+    int RetValue, bzError;
+#ifdef ABC_USE_PTHREADS
+    if ( p->fThread )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        p->fStop = 1;
+        pthread_cond_broadcast( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+        pthread_join( p->Thread, NULL );
+        pthread_mutex_destroy( &p->Mutex );
+        pthread_cond_destroy( &p->Cond );
+    }
+#endif
+    Gia_AigWrWriteChunk( p, p->pChunks[p->iChunk], p->pCur - p->pChunks[p->iChunk] );
+    if ( p->pGz )
+        p->fError |= (gzclose( p->pGz ) != Z_OK);
+    else
+    {
+        if ( p->pBz )
+        {
+            BZ2_bzWriteClose( &bzError, p->pBz, p->fError, NULL, NULL );
+            p->fError |= (bzError != BZ_OK);
+        }
+        p->fError |= (fclose( p->pFile ) != 0);
+    }
+    RetValue = !p->fError;
+    ABC_FREE( p->pChunks[0] );
+    ABC_FREE( p->pChunks[1] );
+    ABC_FREE( p );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the data into the output stream.]
 
   Description []
   
@@ -1193,14 +1775,93 @@ unsigned char * Gia_WriteMapping( Gia_Man_t * p, int * pMapSize )
 
   SeeAlso     []
 
+***********************************************************************/
+void Gia_AigWrWrite( Gia_AigWr_t * p, void * pData, int nSize )
+{
+    unsigned char * pBytes = (unsigned char *)pData;
+    int nCopy;
+    while ( nSize > 0 )
+    {
+        nCopy = Abc_MinInt( nSize, p->pLimit - p->pCur );
+        memcpy( p->pCur, pBytes, nCopy );
+        p->pCur += nCopy;
+        pBytes  += nCopy;
+        nSize   -= nCopy;
+        if ( p->pCur == p->pLimit )
+            Gia_AigWrFlush( p );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints formatted data into the output stream.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_AigWrPrintf( Gia_AigWr_t * p, char * pFormat, ... )
+{
+    char * pTemp;
+    int nSize;
+    va_list ap;
+    va_start( ap, pFormat );
+    nSize = vsnprintf( (char *)p->pCur, p->pLimit - p->pCur, pFormat, ap );
+    va_end( ap );
+    if ( nSize >= 0 && nSize < p->pLimit - p->pCur )
+    {
+        p->pCur += nSize;
+        return nSize;
+    }
+    // the string does not fit into the rest of the chunk
+    pTemp = ABC_ALLOC( char, nSize + 1 );
+    va_start( ap, pFormat );
+    vsnprintf( pTemp, nSize + 1, pFormat, ap );
+    va_end( ap );
+    Gia_AigWrWrite( p, pTemp, nSize );
+    ABC_FREE( pTemp );
+    return nSize;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one unsigned AIG edge to the output stream.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigWrEncode( Gia_AigWr_t * p, unsigned x )
+{
+    if ( p->pLimit - p->pCur < 8 )
+        Gia_AigWrFlush( p );
+    p->pCur += Gia_WriteAigerEncode( p->pCur, 0, x );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG in the binary AIGER format.]
+
+  Description [The AIG is encoded directly into the output stream, which
+  is compressed if the file name ends in ".gz" or ".bz2".]
+  
+  SideEffects []
+
+  SeeAlso     []
+
 ***********************************************************************/
 void Gia_WriteAiger( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact )
 {
-    FILE * pFile;
+    Gia_AigWr_t * pFile;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
-    int i, nBufferSize, Pos;
-    unsigned char * pBuffer;
+    int i;
     unsigned uLit0, uLit1, uLit;
 
     if ( Gia_ManCoNum(pInit) == 0 )
@@ -1210,7 +1871,7 @@ void Gia_WriteAiger( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     }
 
     // start the output stream
-    pFile = fopen( pFileName, "wb" );
+    pFile = Gia_AigWrStart( pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Gia_WriteAiger(): Cannot open the output file \"%s\".\n", pFileName );
@@ -1227,7 +1888,7 @@ void Gia_WriteAiger( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         p = pInit;
 
     // write the header "M I L O A" where M = I + L + A
-    fprintf( pFile, "aig%s %u %u %u %u %u\n", 
+    Gia_AigWrPrintf( pFile, "aig%s %u %u %u %u %u\n", 
         fCompact? "2" : "",
         Gia_ManCiNum(p) + Gia_ManAndNum(p), 
         Gia_ManPiNum(p),
@@ -1239,46 +1900,30 @@ void Gia_WriteAiger( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     {
         // write latch drivers
         Gia_ManForEachRi( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigWrPrintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
         // write PO drivers
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigWrPrintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
     }
     else
     {
         Vec_Int_t * vLits = Gia_WriteAigerLiterals( p );
         Vec_Str_t * vBinary = Gia_WriteEncodeLiterals( vLits );
-        fwrite( Vec_StrArray(vBinary), 1, Vec_StrSize(vBinary), pFile );
+        Gia_AigWrWrite( pFile, Vec_StrArray(vBinary), Vec_StrSize(vBinary) );
         Vec_StrFree( vBinary );
         Vec_IntFree( vLits );
     }
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 6 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+    // write the nodes
     Gia_ManForEachAnd( p, pObj, i )
     {
         uLit  = Gia_Var2Lit( i, 0 );
         uLit0 = Gia_ObjFaninLit0( pObj, i );
         uLit1 = Gia_ObjFaninLit1( pObj, i );
         assert( uLit0 < uLit1 );
-        Pos = Gia_WriteAigerEncode( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_WriteAigerEncode( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
-        {
-            printf( "Gia_WriteAiger(): AIGER generation has failed because the allocated buffer is too small.\n" );
-	        fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
-        }
+        Gia_AigWrEncode( pFile, uLit  - uLit1 );
+        Gia_AigWrEncode( pFile, uLit1 - uLit0 );
     }
-    assert( Pos < nBufferSize );
-
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1287,24 +1932,24 @@ void Gia_WriteAiger( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         assert( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(p) );
         // write PIs
         Gia_ManForEachPi( p, pObj, i )
-            fprintf( pFile, "i%d %s\n", i, Vec_PtrEntry(p->vNamesIn, i) );
+            Gia_AigWrPrintf( pFile, "i%d %s\n", i, Vec_PtrEntry(p->vNamesIn, i) );
         // write latches
         Gia_ManForEachRo( p, pObj, i )
-            fprintf( pFile, "l%d %s\n", i, Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
+            Gia_AigWrPrintf( pFile, "l%d %s\n", i, Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
         // write POs
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "o%d %s\n", i, Vec_PtrEntry(p->vNamesOut, i) );
+            Gia_AigWrPrintf( pFile, "o%d %s\n", i, Vec_PtrEntry(p->vNamesOut, i) );
     }
 
     // write the comment
-    fprintf( pFile, "c" );
+    Gia_AigWrPrintf( pFile, "c" );
     // write equivalences
     if ( p->pReprs && p->pNexts )
     {
         int nEquivSize;
         unsigned char * pEquivs = Gia_WriteEquivClasses( p, &nEquivSize );
-        fprintf( pFile, "e" );
-        fwrite( pEquivs, 1, nEquivSize, pFile );
+        Gia_AigWrPrintf( pFile, "e" );
+        Gia_AigWrWrite( pFile, pEquivs, nEquivSize );
         ABC_FREE( pEquivs );
     }
     // write flop classes
@@ -1313,17 +1958,17 @@ void Gia_WriteAiger( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         unsigned char Buffer[10];
         int nSize = 4*Gia_ManRegNum(p);
         Gia_WriteInt( Buffer, nSize );
-        fprintf( pFile, "f" );
-        fwrite( Buffer, 1, 4, pFile );
-        fwrite( Vec_IntArray(p->vFlopClasses), 1, nSize, pFile );
+        Gia_AigWrPrintf( pFile, "f" );
+        Gia_AigWrWrite( pFile, Buffer, 4 );
+        Gia_AigWrWrite( pFile, Vec_IntArray(p->vFlopClasses), nSize );
     }
     // write mapping
     if ( p->pMapping )
     {
         int nMapSize;
         unsigned char * pMaps = Gia_WriteMapping( p, &nMapSize );
-        fprintf( pFile, "m" );
-        fwrite( pMaps, 1, nMapSize, pFile );
+        Gia_AigWrPrintf( pFile, "m" );
+        Gia_AigWrWrite( pFile, pMaps, nMapSize );
         ABC_FREE( pMaps );
     }
     // write placement
@@ -1332,9 +1977,9 @@ void Gia_WriteAiger( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         unsigned char Buffer[10];
         int nSize = 4*Gia_ManObjNum(p);
         Gia_WriteInt( Buffer, nSize );
-        fprintf( pFile, "p" );
-        fwrite( Buffer, 1, 4, pFile );
-        fwrite( p->pPlacement, 1, nSize, pFile );
+        Gia_AigWrPrintf( pFile, "p" );
+        Gia_AigWrWrite( pFile, Buffer, 4 );
+        Gia_AigWrWrite( pFile, p->pPlacement, nSize );
     }
     // write flop classes
     if ( p->pSwitching )
@@ -1342,24 +1987,25 @@ void Gia_WriteAiger( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         unsigned char Buffer[10];
         int nSize = Gia_ManObjNum(p);
         Gia_WriteInt( Buffer, nSize );
-        fprintf( pFile, "s" );
-        fwrite( Buffer, 1, 4, pFile );
-        fwrite( p->pSwitching, 1, nSize, pFile );
+        Gia_AigWrPrintf( pFile, "s" );
+        Gia_AigWrWrite( pFile, Buffer, 4 );
+        Gia_AigWrWrite( pFile, p->pSwitching, nSize );
     }
     // write constraints
     if ( p->nConstrs )
     {
         unsigned char Buffer[10];
         Gia_WriteInt( Buffer, p->nConstrs );
-        fprintf( pFile, "c" );
-        fwrite( Buffer, 1, 4, pFile );
+        Gia_AigWrPrintf( pFile, "c" );
+        Gia_AigWrWrite( pFile, Buffer, 4 );
     }
     // write name
     if ( p->pName )
-        fprintf( pFile, "n%s%c", p->pName, '\0' );
-    fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
-    fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
-	fclose( pFile );
+        Gia_AigWrPrintf( pFile, "n%s%c", p->pName, '\0' );
+    Gia_AigWrPrintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
+    Gia_AigWrPrintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+    if ( !Gia_AigWrStop( pFile ) )
+        fprintf( stdout, "Gia_WriteAiger(): Writing the output file \"%s\" has failed.\n", pFileName );
     if ( p != pInit )
         Gia_ManStop( p );
 }
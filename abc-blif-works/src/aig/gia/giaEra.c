@@ -21,6 +21,10 @@
 #include "gia.h"
 #include "mem.h"
 
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -47,18 +51,65 @@ struct Gia_ManEra_t_
     int            nWordsSim;       // 2^(PInum)
     int            nWordsDat;   // Gia_BitWordNum
     unsigned *     pDataSim;     // simulation data
-    Mem_Fixed_t *  pMemory;      // memory manager
-    Vec_Ptr_t *    vStates;      // reached states
-    Gia_ObjEra_t * pStateNew;    // temporary state
-    int            iCurState;    // the current state
-    Vec_Int_t *    vBugTrace;    // the sequence of transitions
-    // hash table for states
-    int            nBins;         
-    unsigned *     pBins;
 };
 
 static inline unsigned *     Gia_ManEraData( Gia_ManEra_t * p, int i )    { return p->pDataSim + i * p->nWordsSim;  }
-static inline Gia_ObjEra_t * Gia_ManEraState( Gia_ManEra_t * p, int i )   { return (Gia_ObjEra_t *)Vec_PtrEntry(p->vStates, i);  }
+
+#define ERA_PAGE_BITS          20  // the log size of a page of the compressed store in bytes
+#define ERA_PAGE_NUM       (1<<11) // the max number of pages of the compressed store
+#define ERA_CHAIN_MAX          16  // the max number of deltas between two states stored in full
+#define ERA_STATE_FULL     0xFFFF  // the marker of a state stored in full
+
+// compressed state record (followed by the gaps between flipped bits or by the state bits)
+typedef struct Gia_RecEra_t_ Gia_RecEra_t;
+struct Gia_RecEra_t_
+{
+    unsigned       iPrev;        // handle of the previous state
+    unsigned       uSign;        // signature of the state bits
+    unsigned short Cond;         // input condition
+    unsigned short nDiffs;       // the number of bits flipped w.r.t. the previous state
+};
+
+// compressed state store shared by the threads
+typedef struct Gia_StoEra_t_ Gia_StoEra_t;
+struct Gia_StoEra_t_
+{
+    int            nWordsDat;    // Gia_BitWordNum
+    int            nStatesMax;   // the max number of states
+    int            nReserve;     // the max number of states added without resizing
+    int            fMiter;       // stops when the miter output is 1
+    unsigned char ** ppPages;    // pages with the state records
+    volatile int   nPages;       // the number of pages used
+    volatile int   nStates;      // the number of reached states
+    unsigned *     pBins;        // lock-free hash table of state handles
+    int            nBins;        // the hash table size (power of 2)
+    Vec_Int_t *    vFront;       // handles of the states in the current frontier
+    volatile int   iFront;       // the next frontier state to be expanded
+    volatile int   fStop;        // set high when the traversal is stopped
+    volatile int   fLimit;       // set high when the limit on states is reached
+    volatile int   fOutOfMem;    // set high when the store is out of pages
+    volatile unsigned iFail;     // handle of the state where the miter failed
+    int            iFailCond;    // input condition where the miter failed
+    int            iFailPo;      // the output where the miter failed
+};
+
+// worker expanding frontier states
+typedef struct Gia_WrkEra_t_ Gia_WrkEra_t;
+struct Gia_WrkEra_t_
+{
+    Gia_ManEra_t   Sim;          // simulation manager with private simulation data
+    Gia_StoEra_t * pSto;         // shared state store
+    int            iPage;        // the page used by this worker
+    int            nUsed;        // the number of bytes used on this page
+    int            nBytes;       // the size of the last record written
+    int            nBytesAll;    // the total size of records committed
+    Vec_Int_t *    vNext;        // the new states found by this worker
+    unsigned *     pState;       // the state being expanded
+    unsigned *     pSucc;        // its successor
+    unsigned *     pTemp;        // the state decoded for comparison
+};
+
+static inline Gia_RecEra_t * Gia_StoEraRec( Gia_StoEra_t * p, unsigned h ) { return (Gia_RecEra_t *)(p->ppPages[h >> ERA_PAGE_BITS] + (h & ((1 << ERA_PAGE_BITS) - 1)));  }
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -86,11 +137,6 @@ Gia_ManEra_t * Gia_ManEraCreate( Gia_Man_t * pAig )
     p->nWordsSim = Gia_TruthWordNum( Gia_ManPiNum(pAig) );
     p->nWordsDat = Gia_BitWordNum( Gia_ManRegNum(pAig) );
     p->pDataSim  = ABC_ALLOC( unsigned, p->nWordsSim*Gia_ManObjNum(pAig) );
-    p->pMemory   = Mem_FixedStart( sizeof(Gia_ObjEra_t) + sizeof(unsigned) * p->nWordsDat );
-    p->vStates   = Vec_PtrAlloc( 100000 );
-    p->nBins     = Gia_PrimeCudd( 100000 );
-    p->pBins     = ABC_CALLOC( unsigned, p->nBins );
-    Vec_PtrPush( p->vStates, NULL );
     // assign primary input values
     vTruths = Vec_PtrAllocTruthTables( Gia_ManPiNum(pAig) );
     Vec_PtrForEachEntry( unsigned *, vTruths, pTruth, i )
@@ -118,17 +164,13 @@ Gia_ManEra_t * Gia_ManEraCreate( Gia_Man_t * pAig )
 ***********************************************************************/
 void Gia_ManEraFree( Gia_ManEra_t * p )
 {
-    Mem_FixedStop( p->pMemory, 0 );
-    Vec_PtrFree( p->vStates );
-    if ( p->vBugTrace ) Vec_IntFree( p->vBugTrace );
     ABC_FREE( p->pDataSim );
-    ABC_FREE( p->pBins );
     ABC_FREE( p );
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Creates new state.]
+  Synopsis    [Returns -1 if outputs are not asserted.]
 
   Description []
                
@@ -137,20 +179,19 @@ void Gia_ManEraFree( Gia_ManEra_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_ObjEra_t * Gia_ManEraCreateState( Gia_ManEra_t * p )
+static inline int Gia_ManOutputAsserted( Gia_ManEra_t * p, Gia_Obj_t * pObj )
 {
-    Gia_ObjEra_t * pNew;
-    pNew = (Gia_ObjEra_t *)Mem_FixedEntryFetch( p->pMemory );
-    pNew->Num = Vec_PtrSize( p->vStates );
-    pNew->iPrev = 0;
-    Vec_PtrPush( p->vStates, pNew );
-    return pNew;
+    unsigned * pInfo  = Gia_ManEraData( p, Gia_ObjId(p->pAig, pObj) );
+    int w;
+    for ( w = 0; w < p->nWordsSim; w++ )
+        if ( pInfo[w] )
+            return 32*w + Gia_WordFindFirstBit( pInfo[w] );
+    return -1;
 }
 
-
 /**Function*************************************************************
 
-  Synopsis    [Computes hash value of the node using its simulation info.]
+  Synopsis    []
 
   Description []
                
@@ -159,34 +200,23 @@ Gia_ObjEra_t * Gia_ManEraCreateState( Gia_ManEra_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManEraStateHash( unsigned * pState, int nWordsSim, int nTableSize )
+static inline void Gia_ManSimulateCo( Gia_ManEra_t * p, Gia_Obj_t * pObj )
 {
-    static int s_FPrimes[128] = { 
-        1009, 1049, 1093, 1151, 1201, 1249, 1297, 1361, 1427, 1459, 
-        1499, 1559, 1607, 1657, 1709, 1759, 1823, 1877, 1933, 1997, 
-        2039, 2089, 2141, 2213, 2269, 2311, 2371, 2411, 2467, 2543, 
-        2609, 2663, 2699, 2741, 2797, 2851, 2909, 2969, 3037, 3089, 
-        3169, 3221, 3299, 3331, 3389, 3461, 3517, 3557, 3613, 3671, 
-        3719, 3779, 3847, 3907, 3943, 4013, 4073, 4129, 4201, 4243, 
-        4289, 4363, 4441, 4493, 4549, 4621, 4663, 4729, 4793, 4871, 
-        4933, 4973, 5021, 5087, 5153, 5227, 5281, 5351, 5417, 5471, 
-        5519, 5573, 5651, 5693, 5749, 5821, 5861, 5923, 6011, 6073, 
-        6131, 6199, 6257, 6301, 6353, 6397, 6481, 6563, 6619, 6689, 
-        6737, 6803, 6863, 6917, 6977, 7027, 7109, 7187, 7237, 7309, 
-        7393, 7477, 7523, 7561, 7607, 7681, 7727, 7817, 7877, 7933, 
-        8011, 8039, 8059, 8081, 8093, 8111, 8123, 8147
-    };
-    unsigned uHash;
-    int i;
-    uHash = 0;
-    for ( i = 0; i < nWordsSim; i++ )
-        uHash ^= pState[i] * s_FPrimes[i & 0x7F];
-    return uHash % nTableSize;
+    int Id = Gia_ObjId(p->pAig, pObj);
+    unsigned * pInfo  = Gia_ManEraData( p, Id );
+    unsigned * pInfo0 = Gia_ManEraData( p, Gia_ObjFaninId0(pObj, Id) );
+    int w;
+    if ( Gia_ObjFaninC0(pObj) )
+        for ( w = p->nWordsSim-1; w >= 0; w-- )
+            pInfo[w] = ~pInfo0[w];
+    else 
+        for ( w = p->nWordsSim-1; w >= 0; w-- )
+            pInfo[w] = pInfo0[w];
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Returns the place of this state in the table or NULL if it exists.]
+  Synopsis    []
 
   Description []
                
@@ -195,20 +225,36 @@ int Gia_ManEraStateHash( unsigned * pState, int nWordsSim, int nTableSize )
   SeeAlso     []
 
 ***********************************************************************/
-static inline unsigned * Gia_ManEraHashFind( Gia_ManEra_t * p, Gia_ObjEra_t * pState )
+static inline void Gia_ManSimulateNode( Gia_ManEra_t * p, Gia_Obj_t * pObj )
 {
-    Gia_ObjEra_t * pThis;
-    unsigned * pPlace = p->pBins + Gia_ManEraStateHash( pState->pData, p->nWordsDat, p->nBins );
-    for ( pThis = (*pPlace)? Gia_ManEraState(p, *pPlace) : NULL; pThis; 
-          pPlace = (unsigned *)&pThis->iNext, pThis = (*pPlace)? Gia_ManEraState(p, *pPlace) : NULL )
-              if ( !memcmp( pState->pData, pThis->pData, sizeof(unsigned) * p->nWordsDat ) )
-                  return NULL;
-    return pPlace;
+    int Id = Gia_ObjId(p->pAig, pObj);
+    unsigned * pInfo  = Gia_ManEraData( p, Id );
+    unsigned * pInfo0 = Gia_ManEraData( p, Gia_ObjFaninId0(pObj, Id) );
+    unsigned * pInfo1 = Gia_ManEraData( p, Gia_ObjFaninId1(pObj, Id) );
+    int w;
+    if ( Gia_ObjFaninC0(pObj) )
+    {
+        if (  Gia_ObjFaninC1(pObj) )
+            for ( w = p->nWordsSim-1; w >= 0; w-- )
+                pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
+        else 
+            for ( w = p->nWordsSim-1; w >= 0; w-- )
+                pInfo[w] = ~pInfo0[w] & pInfo1[w];
+    }
+    else 
+    {
+        if (  Gia_ObjFaninC1(pObj) )
+            for ( w = p->nWordsSim-1; w >= 0; w-- )
+                pInfo[w] = pInfo0[w] & ~pInfo1[w];
+        else 
+            for ( w = p->nWordsSim-1; w >= 0; w-- )
+                pInfo[w] = pInfo0[w] & pInfo1[w];
+    }
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Resizes the hash table.]
+  Synopsis    [Performs one iteration of reachability analysis.]
 
   Description []
                
@@ -217,341 +263,612 @@ static inline unsigned * Gia_ManEraHashFind( Gia_ManEra_t * p, Gia_ObjEra_t * pS
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManEraHashResize( Gia_ManEra_t * p )
+void Gia_ManPerformOneIter( Gia_ManEra_t * p )
 {
-    Gia_ObjEra_t * pThis;
-    unsigned * pBinsOld, * piPlace;
-    int nBinsOld, iNext, Counter, i;
-    assert( p->pBins != NULL );
-    // replace the table
-    pBinsOld = p->pBins;
-    nBinsOld = p->nBins;
-    p->nBins = Gia_PrimeCudd( 3 * p->nBins ); 
-    p->pBins = ABC_CALLOC( unsigned, p->nBins );
-    // rehash the entries from the old table
-    Counter = 0;
-    for ( i = 0; i < nBinsOld; i++ )
-    for ( pThis = (pBinsOld[i]? Gia_ManEraState(p, pBinsOld[i]) : NULL),
-          iNext = (pThis? pThis->iNext : 0);  
-          pThis;  pThis = (iNext? Gia_ManEraState(p, iNext) : NULL),   
-          iNext = (pThis? pThis->iNext : 0)  )
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManForEachObj1( p->pAig, pObj, i )
     {
-        assert( pThis->Num );
-        pThis->iNext = 0;
-        piPlace = Gia_ManEraHashFind( p, pThis );
-        assert( *piPlace == 0 ); // should not be there
-        *piPlace = pThis->Num;
-        Counter++;
+        if ( Gia_ObjIsAnd(pObj) )
+            Gia_ManSimulateNode( p, pObj );
+        else if ( Gia_ObjIsCo(pObj) )
+            Gia_ManSimulateCo( p, pObj );
     }
-    assert( Counter == Vec_PtrSize( p->vStates ) - 1 );
-    ABC_FREE( pBinsOld );
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Initialize register output to the given state.]
+  Synopsis    [Atomic primitives used by the concurrent state store.]
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManInsertState( Gia_ManEra_t * p, Gia_ObjEra_t * pState )
+static inline int Gia_EraAtomicAdd( volatile int * pValue, int Inc )
 {
-    Gia_Obj_t * pObj;
-    unsigned * pSimInfo;
+#ifdef ABC_USE_PTHREADS
+    return __sync_fetch_and_add( pValue, Inc );
+#else
+    int Old = *pValue;
+    *pValue += Inc;
+    return Old;
+#endif
+}
+static inline int Gia_EraAtomicCas( volatile unsigned * pValue, unsigned Old, unsigned New )
+{
+#ifdef ABC_USE_PTHREADS
+    return __sync_bool_compare_and_swap( pValue, Old, New );
+#else
+    if ( *pValue != Old )
+        return 0;
+    *pValue = New;
+    return 1;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the 32-bit signature of the state.]
+
+  Description [The signature is stored with the state and is used both
+  to place the state in the hash table and to filter the comparisons.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Gia_StoEraSign( unsigned * pState, int nWords )
+{
+    unsigned uHash = 0x811C9DC5;
     int i;
-    Gia_ManForEachRo( p->pAig, pObj, i )
-    {
-        pSimInfo = Gia_ManEraData( p, Gia_ObjId(p->pAig, pObj) );
-        if ( Gia_InfoHasBit(pState->pData, i) )
-            memset( pSimInfo, 0xff, sizeof(unsigned) * p->nWordsSim );
-        else
-            memset( pSimInfo, 0, sizeof(unsigned) * p->nWordsSim );
-    }
+    for ( i = 0; i < nWords; i++ )
+        uHash = (uHash ^ pState[i]) * 0x9E3779B1;
+    uHash ^= uHash >> 15;
+    uHash *= 0x85EBCA6B;
+    uHash ^= uHash >> 13;
+    return uHash;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Returns -1 if outputs are not asserted.]
+  Synopsis    [Creates the state store.]
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Gia_ManOutputAsserted( Gia_ManEra_t * p, Gia_Obj_t * pObj )
+Gia_StoEra_t * Gia_StoEraCreate( Gia_Man_t * pAig, int nStatesMax, int nReserve, int fMiter )
 {
-    unsigned * pInfo  = Gia_ManEraData( p, Gia_ObjId(p->pAig, pObj) );
-    int w;
-    for ( w = 0; w < p->nWordsSim; w++ )
-        if ( pInfo[w] )
-            return 32*w + Gia_WordFindFirstBit( pInfo[w] );
-    return -1;
+    Gia_StoEra_t * p;
+    p = ABC_CALLOC( Gia_StoEra_t, 1 );
+    p->nWordsDat  = Gia_BitWordNum( Gia_ManRegNum(pAig) );
+    p->nStatesMax = nStatesMax;
+    p->nReserve   = nReserve;
+    p->fMiter     = fMiter;
+    p->ppPages    = ABC_CALLOC( unsigned char *, ERA_PAGE_NUM );
+    p->nPages     = 1; // page 0 is not used to make sure handles are non-zero
+    for ( p->nBins = (1 << 16); p->nBins < 4 * nReserve; p->nBins <<= 1 );
+    p->pBins      = ABC_CALLOC( unsigned, p->nBins );
+    p->vFront     = Vec_IntAlloc( 1000 );
+    assert( sizeof(Gia_RecEra_t) + 4 * p->nWordsDat <= (1 << ERA_PAGE_BITS) );
+    return p;
 }
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Deletes the state store.]
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCo( Gia_ManEra_t * p, Gia_Obj_t * pObj )
+void Gia_StoEraFree( Gia_StoEra_t * p )
 {
-    int Id = Gia_ObjId(p->pAig, pObj);
-    unsigned * pInfo  = Gia_ManEraData( p, Id );
-    unsigned * pInfo0 = Gia_ManEraData( p, Gia_ObjFaninId0(pObj, Id) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-        for ( w = p->nWordsSim-1; w >= 0; w-- )
-            pInfo[w] = ~pInfo0[w];
-    else 
-        for ( w = p->nWordsSim-1; w >= 0; w-- )
-            pInfo[w] = pInfo0[w];
+    int i;
+    for ( i = 1; i < Abc_MinInt(p->nPages, ERA_PAGE_NUM); i++ )
+        ABC_FREE( p->ppPages[i] );
+    ABC_FREE( p->ppPages );
+    ABC_FREE( p->pBins );
+    Vec_IntFree( p->vFront );
+    ABC_FREE( p );
 }
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Doubles the hash table.]
+
+  Description [Should be called when no worker is running. The states
+  are rehashed using their stored signatures without being decoded.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateNode( Gia_ManEra_t * p, Gia_Obj_t * pObj )
+void Gia_StoEraResize( Gia_StoEra_t * p )
 {
-    int Id = Gia_ObjId(p->pAig, pObj);
-    unsigned * pInfo  = Gia_ManEraData( p, Id );
-    unsigned * pInfo0 = Gia_ManEraData( p, Gia_ObjFaninId0(pObj, Id) );
-    unsigned * pInfo1 = Gia_ManEraData( p, Gia_ObjFaninId1(pObj, Id) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
+    unsigned * pBinsOld = p->pBins;
+    int nBinsOld = p->nBins, i, k;
+    p->nBins *= 2;
+    p->pBins  = ABC_CALLOC( unsigned, p->nBins );
+    for ( i = 0; i < nBinsOld; i++ )
     {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWordsSim-1; w >= 0; w-- )
-                pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
-        else 
-            for ( w = p->nWordsSim-1; w >= 0; w-- )
-                pInfo[w] = ~pInfo0[w] & pInfo1[w];
+        if ( pBinsOld[i] == 0 )
+            continue;
+        for ( k = Gia_StoEraRec(p, pBinsOld[i])->uSign & (p->nBins - 1); p->pBins[k]; k = (k + 1) & (p->nBins - 1) );
+        p->pBins[k] = pBinsOld[i];
     }
-    else 
+    ABC_FREE( pBinsOld );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Applies the delta of the record to the parent state.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_StoEraApply( Gia_RecEra_t * pRec, unsigned * pState )
+{
+    unsigned char * pData = (unsigned char *)(pRec + 1);
+    unsigned Gap, iBit = 0;
+    int i, Shift;
+    for ( i = 0; i < (int)pRec->nDiffs; i++ )
     {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWordsSim-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & ~pInfo1[w];
-        else 
-            for ( w = p->nWordsSim-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & pInfo1[w];
+        for ( Gap = 0, Shift = 0; *pData & 0x80; Shift += 7 )
+            Gap |= (unsigned)(*pData++ & 0x7F) << Shift;
+        Gap |= (unsigned)(*pData++) << Shift;
+        iBit += Gap;
+        Gia_InfoXorBit( pState, iBit );
     }
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Performs one iteration of reachability analysis.]
+  Synopsis    [Decodes the state.]
+
+  Description [Follows the chain of delta records up to the closest state
+  stored in full. Returns the length of this chain.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManPerformOneIter( Gia_ManEra_t * p )
+static inline int Gia_StoEraDecode( Gia_StoEra_t * p, unsigned Handle, unsigned * pState )
 {
-    Gia_Obj_t * pObj;
-    int i;
-    Gia_ManForEachObj1( p->pAig, pObj, i )
+    Gia_RecEra_t * pChain[ERA_CHAIN_MAX];
+    Gia_RecEra_t * pRec = Gia_StoEraRec( p, Handle );
+    int i, nChain = 0;
+    for ( ; pRec->nDiffs != ERA_STATE_FULL; pRec = Gia_StoEraRec(p, pRec->iPrev) )
     {
-        if ( Gia_ObjIsAnd(pObj) )
-            Gia_ManSimulateNode( p, pObj );
-        else if ( Gia_ObjIsCo(pObj) )
-            Gia_ManSimulateCo( p, pObj );
+        assert( nChain < ERA_CHAIN_MAX );
+        pChain[nChain++] = pRec;
     }
+    memcpy( pState, pRec + 1, sizeof(unsigned) * p->nWordsDat );
+    for ( i = nChain - 1; i >= 0; i-- )
+        Gia_StoEraApply( pChain[i], pState );
+    return nChain;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Performs one iteration of reachability analysis.]
+  Synopsis    [Writes the new state at the end of the current page.]
+
+  Description [The state is encoded as the list of bits that differ from
+  the parent state, unless it is cheaper to store it in full or the delta
+  chain becomes too long. The record is not committed until the state is
+  inserted into the hash table. Returns the handle or 0 if the store has
+  run out of pages.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Int_t * Gia_ManCollectBugTrace( Gia_ManEra_t * p, Gia_ObjEra_t * pState, int iCond )
+static inline unsigned Gia_WrkEraWriteState( Gia_WrkEra_t * pWrk, unsigned iPrev, int Cond, int nChain, unsigned * pParent, unsigned * pState )
 {
-    Vec_Int_t * vTrace;
-    vTrace = Vec_IntAlloc( 10 );
-    Vec_IntPush( vTrace, iCond );
-    for ( ; pState; pState = pState->iPrev ? Gia_ManEraState(p, pState->iPrev) : NULL )
-        Vec_IntPush( vTrace, pState->Cond );
-    Vec_IntReverseOrder( vTrace );
-    return vTrace;
+    Gia_StoEra_t * p = pWrk->pSto;
+    int nBytesMax = sizeof(Gia_RecEra_t) + sizeof(unsigned) * p->nWordsDat;
+    Gia_RecEra_t * pRec;
+    unsigned char * pData, * pLimit;
+    unsigned Diff, Gap, iBit, iBitLast = 0;
+    int w, nDiffs = 0;
+    // make sure the record fits on the current page
+    if ( pWrk->iPage == 0 || pWrk->nUsed + nBytesMax > (1 << ERA_PAGE_BITS) )
+    {
+        pWrk->iPage = Gia_EraAtomicAdd( &p->nPages, 1 );
+        if ( pWrk->iPage >= ERA_PAGE_NUM )
+        {
+            pWrk->iPage = 0;
+            return 0;
+        }
+        p->ppPages[pWrk->iPage] = ABC_ALLOC( unsigned char, (1 << ERA_PAGE_BITS) );
+        pWrk->nUsed = 0;
+    }
+    pRec = (Gia_RecEra_t *)(p->ppPages[pWrk->iPage] + pWrk->nUsed);
+    pRec->iPrev = iPrev;
+    pRec->Cond  = Cond;
+    pRec->uSign = Gia_StoEraSign( pState, p->nWordsDat );
+    pRec->nDiffs = ERA_STATE_FULL;
+    // encode the gaps between the flipped bits
+    pData  = (unsigned char *)(pRec + 1);
+    pLimit = pData + sizeof(unsigned) * p->nWordsDat;
+    if ( pParent && nChain < ERA_CHAIN_MAX )
+    {
+        for ( w = 0; w < p->nWordsDat && pData < pLimit; w++ )
+            for ( Diff = pState[w] ^ pParent[w]; Diff && pData < pLimit; Diff &= Diff - 1 )
+            {
+                iBit = 32 * w + Gia_WordFindFirstBit( Diff );
+                for ( Gap = iBit - iBitLast; Gap >= 0x80 && pData < pLimit; Gap >>= 7 )
+                    *pData++ = (unsigned char)(Gap | 0x80);
+                if ( pData == pLimit )
+                    break;
+                *pData++ = (unsigned char)Gap;
+                iBitLast = iBit;
+                nDiffs++;
+            }
+        if ( pData < pLimit && nDiffs < ERA_STATE_FULL )
+            pRec->nDiffs = nDiffs;
+    }
+    if ( pRec->nDiffs == ERA_STATE_FULL )
+        memcpy( pRec + 1, pState, sizeof(unsigned) * p->nWordsDat );
+    else
+        pLimit = pData;
+    pWrk->nBytes = sizeof(Gia_RecEra_t) + (((int)(pLimit - (unsigned char *)(pRec + 1)) + 3) & ~3);
+    return (pWrk->iPage << ERA_PAGE_BITS) | pWrk->nUsed;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Counts the depth of state transitions leading ot this state.]
+  Synopsis    [Inserts the state into the lock-free hash table.]
+
+  Description [Returns 1 if the state is new, 0 if it was already there.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManCountDepth( Gia_ManEra_t * p )
+static inline int Gia_WrkEraInsert( Gia_WrkEra_t * pWrk, unsigned Handle, unsigned * pState )
 {
-    Gia_ObjEra_t * pState;
-    int Counter = 0;
-    pState = (Gia_ObjEra_t *)Vec_PtrEntryLast( p->vStates );
-    if ( pState->iPrev == 0 && Vec_PtrSize(p->vStates) > 3 )
-        pState = (Gia_ObjEra_t *)Vec_PtrEntry( p->vStates, Vec_PtrSize(p->vStates) - 2 );
-    for ( ; pState; pState = pState->iPrev ? Gia_ManEraState(p, pState->iPrev) : NULL )
-        Counter++;
-    return Counter;
+    Gia_StoEra_t * p = pWrk->pSto;
+    unsigned uSign = Gia_StoEraRec(p, Handle)->uSign;
+    unsigned Entry, Mask = p->nBins - 1, i = uSign & Mask;
+    while ( 1 )
+    {
+        Entry = ((volatile unsigned *)p->pBins)[i];
+        if ( Entry == 0 )
+        {
+            if ( Gia_EraAtomicCas( p->pBins + i, 0, Handle ) )
+                return 1;
+            continue;
+        }
+        if ( Gia_StoEraRec(p, Entry)->uSign == uSign )
+        {
+            Gia_StoEraDecode( p, Entry, pWrk->pTemp );
+            if ( !memcmp( pWrk->pTemp, pState, sizeof(unsigned) * p->nWordsDat ) )
+                return 0;
+        }
+        i = (i + 1) & Mask;
+    }
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Analized reached states.]
+  Synopsis    [Expands one state of the frontier.]
+
+  Description [Simulates all input minterms in the given state and adds
+  the new successor states to the store and to the next frontier.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManAnalyzeResult( Gia_ManEra_t * p, Gia_ObjEra_t * pState, int fMiter )
+void Gia_WrkEraExpand( Gia_WrkEra_t * pWrk, unsigned Handle )
 {
+    Gia_StoEra_t * p = pWrk->pSto;
+    Gia_ManEra_t * pSim = &pWrk->Sim;
     Gia_Obj_t * pObj;
-    unsigned * pSimInfo, * piPlace;
-    int i, k, iCond, nMints;
+    unsigned * pSimInfo, HandleNew;
+    int i, k, iCond, nChain, nMints;
+    // simulate the state
+    nChain = Gia_StoEraDecode( p, Handle, pWrk->pState );
+    Gia_ManForEachRo( pSim->pAig, pObj, i )
+    {
+        pSimInfo = Gia_ManEraData( pSim, Gia_ObjId(pSim->pAig, pObj) );
+        memset( pSimInfo, Gia_InfoHasBit(pWrk->pState, i) ? 0xff : 0, sizeof(unsigned) * pSim->nWordsSim );
+    }
+    Gia_ManPerformOneIter( pSim );
     // check if the miter is asserted
-    if ( fMiter )
+    if ( p->fMiter )
     {
-        Gia_ManForEachPo( p->pAig, pObj, i )
+        Gia_ManForEachPo( pSim->pAig, pObj, i )
         {
-            iCond = Gia_ManOutputAsserted( p, pObj );
-            if ( iCond >= 0 )
-            {
-                p->vBugTrace = Gia_ManCollectBugTrace( p, pState, iCond );
-                return 1;
-            }
+            iCond = Gia_ManOutputAsserted( pSim, pObj );
+            if ( iCond < 0 )
+                continue;
+            if ( Gia_EraAtomicCas( &p->iFail, 0, Handle ) )
+                p->iFailCond = iCond, p->iFailPo = i;
+            p->fStop = 1;
+            return;
         }
     }
-    // collect reached states 
-    nMints = (1 << Gia_ManPiNum(p->pAig));
+    // collect the new states
+    nMints = (1 << Gia_ManPiNum(pSim->pAig));
     for ( k = 0; k < nMints; k++ )
     {
-        if ( p->pStateNew == NULL )
-            p->pStateNew = Gia_ManEraCreateState( p );
-        p->pStateNew->pData[p->nWordsDat-1] = 0;
-        Gia_ManForEachRi( p->pAig, pObj, i )
+        memset( pWrk->pSucc, 0, sizeof(unsigned) * p->nWordsDat );
+        Gia_ManForEachRi( pSim->pAig, pObj, i )
+        {
+            pSimInfo = Gia_ManEraData( pSim, Gia_ObjId(pSim->pAig, pObj) );
+            if ( Gia_InfoHasBit(pSimInfo, k) )
+                Gia_InfoSetBit( pWrk->pSucc, i );
+        }
+        HandleNew = Gia_WrkEraWriteState( pWrk, Handle, k, nChain + 1, pWrk->pState, pWrk->pSucc );
+        if ( HandleNew == 0 )
         {
-            pSimInfo = Gia_ManEraData( p, Gia_ObjId(p->pAig, pObj) );
-            if ( Gia_InfoHasBit(p->pStateNew->pData, i) != Gia_InfoHasBit(pSimInfo, k) )
-                Gia_InfoXorBit( p->pStateNew->pData, i );
+            p->fOutOfMem = 1;
+            p->fStop = 1;
+            return;
         }
-        piPlace = Gia_ManEraHashFind( p, p->pStateNew );
-        if ( piPlace == NULL )
+        if ( !Gia_WrkEraInsert( pWrk, HandleNew, pWrk->pSucc ) )
             continue;
-//printf( "Inserting %d ", Vec_PtrSize(p->vStates) );
-//Extra_PrintBinary( stdout, p->pStateNew->pData, Gia_ManRegNum(p->pAig) );  printf( "\n" );
-        assert( *piPlace == 0 );
-        *piPlace = p->pStateNew->Num;
-        p->pStateNew->Cond = k;
-        p->pStateNew->iPrev = pState->Num;
-        p->pStateNew->iNext = 0;
-        p->pStateNew = NULL;
-        // expand hash table if needed
-        if ( Vec_PtrSize(p->vStates) > 2 * p->nBins )
-            Gia_ManEraHashResize( p );
+        pWrk->nUsed += pWrk->nBytes;
+        pWrk->nBytesAll += pWrk->nBytes;
+        Vec_IntPush( pWrk->vNext, (int)HandleNew );
+        Gia_EraAtomicAdd( &p->nStates, 1 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Procedure executed by one worker thread.]
+
+  Description [Takes the next state of the frontier until the frontier is
+  exhausted, the hash table needs to grow, or the computation is stopped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_WrkEraThread( void * pArg )
+{
+    Gia_WrkEra_t * pWrk = (Gia_WrkEra_t *)pArg;
+    Gia_StoEra_t * p = pWrk->pSto;
+    int i;
+    while ( !p->fStop )
+    {
+        if ( p->nStates >= p->nStatesMax )
+        {
+            p->fLimit = 1;
+            p->fStop = 1;
+            break;
+        }
+        if ( 2 * (p->nStates + p->nReserve) > p->nBins )
+            break;
+        i = Gia_EraAtomicAdd( &p->iFront, 1 );
+        if ( i >= Vec_IntSize(p->vFront) )
+            break;
+        Gia_WrkEraExpand( pWrk, (unsigned)Vec_IntEntry(p->vFront, i) );
     }
-    return 0;
+    return NULL;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Resizes the hash table.]
+  Synopsis    [Runs the workers on the current frontier.]
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManCollectReachable( Gia_Man_t * pAig, int nStatesMax, int fMiter, int fVerbose )
-{ 
-    Gia_ManEra_t * p;
-    Gia_ObjEra_t * pState;
-    int Hash, clk = clock();
+void Gia_StoEraRunWorkers( Gia_WrkEra_t * pWrks, int nWorkers )
+{
+    int i;
+#ifdef ABC_USE_PTHREADS
+    if ( nWorkers > 1 )
+    {
+        pthread_t * pThreads = ABC_ALLOC( pthread_t, nWorkers );
+        int Status;
+        for ( i = 1; i < nWorkers; i++ )
+        {
+            Status = pthread_create( pThreads + i, NULL, Gia_WrkEraThread, (void *)(pWrks + i) );
+            assert( Status == 0 );
+        }
+        Gia_WrkEraThread( (void *)pWrks );
+        for ( i = 1; i < nWorkers; i++ )
+            pthread_join( pThreads[i], NULL );
+        ABC_FREE( pThreads );
+        return;
+    }
+#endif
+    for ( i = 0; i < nWorkers; i++ )
+        Gia_WrkEraThread( (void *)(pWrks + i) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example leading to the failed state.]
+
+  Description [The input conditions of the states on the path from the
+  init state give the PI values of the frames, and the input condition
+  where the miter failed gives the PI values of the last frame.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Gia_StoEraDeriveCex( Gia_StoEra_t * p, Gia_Man_t * pAig )
+{
+    Abc_Cex_t * pCex;
+    Vec_Int_t * vConds;
+    Gia_RecEra_t * pRec;
+    int i, k, Cond;
+    assert( p->iFail != 0 );
+    vConds = Vec_IntAlloc( 100 );
+    Vec_IntPush( vConds, p->iFailCond );
+    for ( pRec = Gia_StoEraRec(p, p->iFail); pRec->iPrev; pRec = Gia_StoEraRec(p, pRec->iPrev) )
+        Vec_IntPush( vConds, pRec->Cond );
+    Vec_IntReverseOrder( vConds );
+    pCex = Abc_CexAlloc( Gia_ManRegNum(pAig), Gia_ManPiNum(pAig), Vec_IntSize(vConds) );
+    pCex->iPo    = p->iFailPo;
+    pCex->iFrame = Vec_IntSize(vConds) - 1;
+    Vec_IntForEachEntry( vConds, Cond, i )
+        for ( k = 0; k < Gia_ManPiNum(pAig); k++ )
+            if ( (Cond >> k) & 1 )
+                Gia_InfoSetBit( pCex->pData, pCex->nRegs + pCex->nPis * i + k );
+    Vec_IntFree( vConds );
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs explicit reachability with the compressed store.]
+
+  Description [Traverses the state space in the breadth-first order.
+  The states of each frontier are expanded by several threads, which
+  share the lock-free hash table of the reached states. Every state is
+  stored as a delta against its parent state.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManCollectReachablePar( Gia_Man_t * pAig, int nStatesMax, int nThreads, int fMiter, int fVerbose )
+{
+    Gia_ManEra_t * pEra;
+    Gia_StoEra_t * p;
+    Gia_WrkEra_t * pWrks, * pWrk;
+    Gia_RecEra_t * pRec;
+    unsigned Handle;
+    int nLevels, nBytesAll, nPrinted = 0, i, k, clk = clock();
     int RetValue = 1;
     assert( Gia_ManPiNum(pAig) <= 12 );
     assert( Gia_ManRegNum(pAig) > 0 );
-    p = Gia_ManEraCreate( pAig );
-    // create init state
-    pState = Gia_ManEraCreateState( p );
-    pState->Cond  = 0; 
-    pState->iPrev = 0;
-    pState->iNext = 0; 
-    memset( pState->pData, 0, sizeof(unsigned) * p->nWordsDat );
-    Hash = Gia_ManEraStateHash(pState->pData, p->nWordsDat, p->nBins);
-    p->pBins[ Hash ] = pState->Num;
-    // process reachable states
-    while ( p->iCurState < Vec_PtrSize( p->vStates ) - 1 )
+#ifndef ABC_USE_PTHREADS
+    nThreads = 1;
+#endif
+    nThreads = Abc_MaxInt( nThreads, 1 );
+    pEra = Gia_ManEraCreate( pAig );
+    p = Gia_StoEraCreate( pAig, nStatesMax, nThreads * (1 << Gia_ManPiNum(pAig)), fMiter );
+    // start the workers; each worker has its own simulation info
+    pWrks = ABC_CALLOC( Gia_WrkEra_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
     {
-        if ( Vec_PtrSize(p->vStates) >= nStatesMax )
+        pWrk = pWrks + i;
+        pWrk->Sim  = *pEra;
+        pWrk->pSto = p;
+        if ( i > 0 )
         {
-            printf( "Reached the limit on states traversed (%d).  ", nStatesMax );
-            RetValue = -1;
-            break;
+            pWrk->Sim.pDataSim = ABC_ALLOC( unsigned, pEra->nWordsSim * Gia_ManObjNum(pAig) );
+            memcpy( pWrk->Sim.pDataSim, pEra->pDataSim, sizeof(unsigned) * pEra->nWordsSim * Gia_ManObjNum(pAig) );
         }
-        pState = Gia_ManEraState( p, ++p->iCurState );
-        if ( p->iCurState > 1 && pState->iPrev == 0 )
-            continue;
-//printf( "Extracting %d  ", p->iCurState );
-//Extra_PrintBinary( stdout, p->pStateNew->pData, Gia_ManRegNum(p->pAig) );  printf( "\n" );
-        Gia_ManInsertState( p, pState );
-        Gia_ManPerformOneIter( p );
-        if ( Gia_ManAnalyzeResult( p, pState, fMiter ) && fMiter )
+        pWrk->vNext  = Vec_IntAlloc( 1000 );
+        pWrk->pState = ABC_CALLOC( unsigned, 3 * p->nWordsDat );
+        pWrk->pSucc  = pWrk->pState + p->nWordsDat;
+        pWrk->pTemp  = pWrk->pSucc  + p->nWordsDat;
+    }
+    // create the init state
+    Handle = Gia_WrkEraWriteState( pWrks, 0, 0, 0, NULL, pWrks->pState );
+    Gia_WrkEraInsert( pWrks, Handle, pWrks->pState );
+    pWrks->nUsed += pWrks->nBytes;
+    pWrks->nBytesAll += pWrks->nBytes;
+    p->nStates = 1;
+    Vec_IntPush( p->vFront, (int)Handle );
+    // process the frontiers
+    for ( nLevels = 0; Vec_IntSize(p->vFront) > 0; nLevels++ )
+    {
+        for ( p->iFront = 0; ; Gia_StoEraResize(p) )
         {
-            RetValue = 0;
-            printf( "Miter failed in state %d after %d transitions.  ", 
-                p->iCurState, Vec_IntSize(p->vBugTrace)-1 );
+            Gia_StoEraRunWorkers( pWrks, nThreads );
+            if ( p->fStop || p->iFront >= Vec_IntSize(p->vFront) )
+                break;
+        }
+        if ( p->fStop )
             break;
+        Vec_IntClear( p->vFront );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            Vec_IntForEachEntry( pWrks[i].vNext, Handle, k )
+                Vec_IntPush( p->vFront, (int)Handle );
+            Vec_IntClear( pWrks[i].vNext );
         }
-        if ( fVerbose && p->iCurState % 5000 == 0 )
+        if ( fVerbose && (p->nStates - nPrinted >= 5000 || Vec_IntSize(p->vFront) == 0) )
         {
-            printf( "States =%10d. Reached =%10d. R = %5.3f. Depth =%6d. Mem =%9.2f Mb.  ", 
-                p->iCurState, Vec_PtrSize(p->vStates), 1.0*p->iCurState/Vec_PtrSize(p->vStates), Gia_ManCountDepth(p), 
-                (1.0/(1<<20))*(1.0*Vec_PtrSize(p->vStates)*(sizeof(Gia_ObjEra_t) + sizeof(unsigned) * p->nWordsDat) + 
-                   1.0*p->nBins*sizeof(unsigned) + 1.0*p->vStates->nCap * sizeof(void*)) );
+            nPrinted = p->nStates;
+            printf( "Depth =%6d. Frontier =%10d. Reached =%10d. Mem =%9.2f Mb.  ",
+                nLevels + 1, Vec_IntSize(p->vFront), p->nStates,
+                (1.0/(1<<20))*(1.0*(p->nPages-1)*(1<<ERA_PAGE_BITS) + 4.0*p->nBins + 4.0*p->vFront->nCap) );
             ABC_PRT( "Time", clock() - clk );
         }
     }
-    printf( "Reachability analysis traversed %d states with depth %d.  ", p->iCurState-1, Gia_ManCountDepth(p) );
+    if ( p->iFail )
+    {
+        for ( k = 1, pRec = Gia_StoEraRec(p, p->iFail); pRec->iPrev; pRec = Gia_StoEraRec(p, pRec->iPrev) )
+            k++;
+        RetValue = 0;
+        printf( "Miter failed in state %d after %d transitions.  ", p->nStates, k );
+        ABC_FREE( pAig->pCexSeq );
+        pAig->pCexSeq = Gia_StoEraDeriveCex( p, pAig );
+        if ( !Gia_ManVerifyCex( pAig, pAig->pCexSeq, 0 ) )
+            printf( "Generated counter-example is INVALID.  " );
+    }
+    else if ( p->fLimit )
+    {
+        printf( "Reached the limit on states traversed (%d).  ", nStatesMax );
+        RetValue = -1;
+    }
+    else if ( p->fOutOfMem )
+    {
+        printf( "The state store has run out of memory after %d states.  ", p->nStates );
+        RetValue = -1;
+    }
+    printf( "Reachability analysis traversed %d states with depth %d.  ", p->nStates, nLevels );
     ABC_PRT( "Time", clock() - clk );
-    Gia_ManEraFree( p );
+    if ( fVerbose )
+    {
+        for ( nBytesAll = i = 0; i < nThreads; i++ )
+            nBytesAll += pWrks[i].nBytesAll;
+        printf( "Stored %d states using %.2f bytes per state (%d bytes uncompressed) with %d thread%s.\n",
+            p->nStates, 1.0*nBytesAll/Abc_MaxInt(p->nStates, 1), (int)(sizeof(Gia_ObjEra_t) + sizeof(unsigned) * p->nWordsDat),
+            nThreads, nThreads > 1 ? "s" : "" );
+    }
+    // free the workers
+    for ( i = 0; i < nThreads; i++ )
+    {
+        if ( i > 0 )
+            ABC_FREE( pWrks[i].Sim.pDataSim );
+        Vec_IntFree( pWrks[i].vNext );
+        ABC_FREE( pWrks[i].pState );
+    }
+    ABC_FREE( pWrks );
+    Gia_StoEraFree( p );
+    Gia_ManEraFree( pEra );
     return RetValue;
 }
-
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
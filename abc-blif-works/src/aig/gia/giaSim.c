@@ -20,6 +20,15 @@
 
 #include "gia.h"
 
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
+
+#ifdef ABC_USE_AVX
+#include <immintrin.h>
+#define GIA_SIM_USE_SIMD
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,23 +36,41 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_SIM_CACHE  (1 << 18)   // the target size of frontier data for one block (bytes)
+
 typedef struct Gia_ManSim_t_ Gia_ManSim_t;
 struct Gia_ManSim_t_
 {
     Gia_Man_t *    pAig;
     Gia_ParSim_t * pPars; 
-    int            nWords;
+    int            nWords;       // the number of 64-bit words
+    int            fHalfLast;    // the last word holds only 32 patterns
+    int            nBlock;       // the number of words simulated in one block
+    int            nStride;      // the number of words allocated for each frontier node
+    int            Kernel;       // simulation kernel (0 = 64-bit, 1 = AVX2, 2 = AVX-512)
+    int            nThreads;     // the number of threads simulating the blocks
     Vec_Int_t *    vCis2Ids;
     Vec_Int_t *    vConsts;
     // simulation information
-    unsigned *     pDataSim;     // simulation data
-    unsigned *     pDataSimCis;  // simulation data for CIs
-    unsigned *     pDataSimCos;  // simulation data for COs
+    word *         pDataSim;     // simulation data for one block (for each thread)
+    word *         pDataSimCis;  // simulation data for CIs
+    word *         pDataSimCos;  // simulation data for COs
+    char *         pMemSim;      // memory for the above (before alignment)
+    char *         pMemSimCis;
+    char *         pMemSimCos;
 };
 
-static inline unsigned * Gia_SimData( Gia_ManSim_t * p, int i )    { return p->pDataSim + i * p->nWords;    }
-static inline unsigned * Gia_SimDataCi( Gia_ManSim_t * p, int i )  { return p->pDataSimCis + i * p->nWords; }
-static inline unsigned * Gia_SimDataCo( Gia_ManSim_t * p, int i )  { return p->pDataSimCos + i * p->nWords; }
+static inline word * Gia_SimData( Gia_ManSim_t * p, int i )    { return p->pDataSim + i * p->nStride;   }
+static inline word * Gia_SimDataCi( Gia_ManSim_t * p, int i )  { return p->pDataSimCis + i * p->nWords; }
+static inline word * Gia_SimDataCo( Gia_ManSim_t * p, int i )  { return p->pDataSimCos + i * p->nWords; }
+
+typedef struct Gia_SimThData_t_ Gia_SimThData_t;
+struct Gia_SimThData_t_
+{
+    Gia_ManSim_t   Sim;          // copy of the manager pointing to the frontier of this thread
+    int            iThread;      // the first block simulated by this thread
+    int            nThreads;     // the step between the blocks simulated by this thread
+};
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -182,6 +209,7 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
     p->fCheckMiter  =   0;    // check if miter outputs are non-zero 
     p->fVerbose     =   0;    // enables verbose output
     p->iOutFail     =  -1;    // index of the failed output
+    p->nThreads     =   1;    // the number of threads
 }
 
 /**Function*************************************************************
@@ -200,18 +228,39 @@ void Gia_ManSimDelete( Gia_ManSim_t * p )
     Vec_IntFreeP( &p->vConsts );
     Vec_IntFreeP( &p->vCis2Ids );
     Gia_ManStopP( &p->pAig );
-    ABC_FREE( p->pDataSim );
-    ABC_FREE( p->pDataSimCis );
-    ABC_FREE( p->pDataSimCos );
+    ABC_FREE( p->pMemSim );
+    ABC_FREE( p->pMemSimCis );
+    ABC_FREE( p->pMemSimCos );
     ABC_FREE( p );
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Creates fast simulation manager.]
+  Synopsis    [Allocates simulation info aligned on the cache line.]
 
   Description []
-               
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word * Gia_ManSimAllocAligned( int nWords, char ** ppMem )
+{
+    *ppMem = ABC_CALLOC( char, sizeof(word) * (size_t)nWords + 64 );
+    if ( *ppMem == NULL )
+        return NULL;
+    return (word *)(((ABC_PTRUINT_T)*ppMem + 63) & ~(ABC_PTRUINT_T)63);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates fast simulation manager.]
+
+  Description [Simulation info of the frontier is stored for one block
+  of words at a time, which keeps the working set in the cache while
+  the patterns of all CIs and COs are kept for the complete round.]
+
   SideEffects []
 
   SeeAlso     []
@@ -220,7 +269,7 @@ void Gia_ManSimDelete( Gia_ManSim_t * p )
 Gia_ManSim_t * Gia_ManSimCreate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
 {
     Gia_ManSim_t * p;
-    int Entry, i;
+    int Entry, i, nVector;
     p = ABC_ALLOC( Gia_ManSim_t, 1 );
     memset( p, 0, sizeof(Gia_ManSim_t) );
     // look for reset signals
@@ -229,14 +278,32 @@ Gia_ManSim_t * Gia_ManSimCreate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     // derive the frontier
     p->pAig   = Gia_ManFront( pAig );
     p->pPars  = pPars;
-    p->nWords = pPars->nWords;
-    p->pDataSim = ABC_ALLOC( unsigned, p->nWords * p->pAig->nFront );
-    p->pDataSimCis = ABC_ALLOC( unsigned, p->nWords * Gia_ManCiNum(p->pAig) );
-    p->pDataSimCos = ABC_ALLOC( unsigned, p->nWords * Gia_ManCoNum(p->pAig) );
+    p->nWords = (pPars->nWords + 1) / 2;
+    p->fHalfLast = pPars->nWords & 1;
+    p->Kernel = Abc_CpuVectorKernel();
+    nVector   = p->Kernel == 2 ? 8 : (p->Kernel == 1 ? 4 : 1);
+    // choose the block size to fit the frontier data into the cache
+    p->nBlock  = GIA_SIM_CACHE / (int)sizeof(word) / Abc_MaxInt( p->pAig->nFront, 1 );
+    p->nBlock  = Abc_MaxInt( 8, p->nBlock - p->nBlock % 8 );
+    p->nBlock  = Abc_MinInt( p->nBlock, p->nWords );
+    // make sure there is at least one block for each thread
+    p->nThreads = Abc_MaxInt( pPars->nThreads, 1 );
+#ifndef ABC_USE_PTHREADS
+    p->nThreads = 1;
+#endif
+    if ( p->nThreads > 1 )
+    {
+        p->nBlock   = Abc_MinInt( p->nBlock, Abc_MaxInt( 8, (p->nWords + p->nThreads - 1) / p->nThreads ) );
+        p->nThreads = Abc_MinInt( p->nThreads, (p->nWords + p->nBlock - 1) / p->nBlock );
+    }
+    p->nStride = (p->nBlock + nVector - 1) / nVector * nVector;
+    p->pDataSim = Gia_ManSimAllocAligned( p->nThreads * p->nStride * p->pAig->nFront, &p->pMemSim );
+    p->pDataSimCis = Gia_ManSimAllocAligned( p->nWords * Gia_ManCiNum(p->pAig), &p->pMemSimCis );
+    p->pDataSimCos = Gia_ManSimAllocAligned( p->nWords * Gia_ManCoNum(p->pAig), &p->pMemSimCos );
     if ( !p->pDataSim || !p->pDataSimCis || !p->pDataSimCos )
-    { 
-        Abc_Print( 1, "Simulator could not allocate %.2f Gb for simulation info.\n", 
-            4.0 * p->nWords * (p->pAig->nFront + Gia_ManCiNum(p->pAig) + Gia_ManCoNum(p->pAig)) / (1<<30) );
+    {
+        Abc_Print( 1, "Simulator could not allocate %.2f Gb for simulation info.\n",
+            8.0 * (p->nStride * p->pAig->nFront + p->nWords * (Gia_ManCiNum(p->pAig) + Gia_ManCoNum(p->pAig))) / (1<<30) );
         Gia_ManSimDelete( p );
         return NULL;
     }
@@ -244,30 +311,53 @@ Gia_ManSim_t * Gia_ManSimCreate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     Vec_IntForEachEntry( pAig->vCis, Entry, i )
         Vec_IntPush( p->vCis2Ids, i );  //  do we need p->vCis2Ids?
     if ( pPars->fVerbose )
-    Abc_Print( 1, "AIG = %7.2f Mb.   Front mem = %7.2f Mb.  Other mem = %7.2f Mb.\n", 
-        12.0*Gia_ManObjNum(p->pAig)/(1<<20), 
-        4.0*p->nWords*p->pAig->nFront/(1<<20), 
-        4.0*p->nWords*(Gia_ManCiNum(p->pAig) + Gia_ManCoNum(p->pAig))/(1<<20) );
-
+    {
+    Abc_Print( 1, "AIG = %7.2f Mb.   Front mem = %7.2f Mb.  Other mem = %7.2f Mb.\n",
+        12.0*Gia_ManObjNum(p->pAig)/(1<<20),
+        8.0*p->nStride*p->pAig->nFront/(1<<20),
+        8.0*p->nWords*(Gia_ManCiNum(p->pAig) + Gia_ManCoNum(p->pAig))/(1<<20) );
+    Abc_Print( 1, "Kernel = %s.  Words = %d.  Block = %d words.  Threads = %d.\n",
+        p->Kernel == 2 ? "AVX-512" : (p->Kernel == 1 ? "AVX2" : "64-bit"), p->nWords, p->nBlock, p->nThreads );
+    }
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns one 64-bit random word.]
+
+  Description [Consumes two 32-bit random numbers in a fixed order,
+  which is relied upon when the counter-example is regenerated.
+  If fHalf is set, consumes one number and leaves the upper half zero,
+  so that an odd number of 32-bit words gives the same patterns.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Gia_ManSimRandomWord( int fHalf )
+{
+    word Res = fHalf ? 0 : (word)Gia_ManRandom( 0 ) << 32;
+    return Res | (word)Gia_ManRandom( 0 );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimInfoRandom( Gia_ManSim_t * p, unsigned * pInfo )
+static inline void Gia_ManSimInfoRandom( Gia_ManSim_t * p, word * pInfo )
 {
     int w;
     for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = Gia_ManRandom( 0 );
+        pInfo[w] = Gia_ManSimRandomWord( p->fHalfLast && w == p->nWords-1 );
 }
 
 /**Function*************************************************************
@@ -275,13 +365,13 @@ static inline void Gia_ManSimInfoRandom( Gia_ManSim_t * p, unsigned * pInfo )
   Synopsis    []
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimInfoZero( Gia_ManSim_t * p, unsigned * pInfo )
+static inline void Gia_ManSimInfoZero( Gia_ManSim_t * p, word * pInfo )
 {
     int w;
     for ( w = p->nWords-1; w >= 0; w-- )
@@ -290,21 +380,45 @@ static inline void Gia_ManSimInfoZero( Gia_ManSim_t * p, unsigned * pInfo )
 
 /**Function*************************************************************
 
-  Synopsis    [Returns index of the first pattern that failed.]
+  Synopsis    []
 
   Description []
-               
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManSimWordFindFirstBit( word uWord )
+{
+    int i;
+    for ( i = 0; i < 64; i++ )
+        if ( (uWord >> i) & 1 )
+            return i;
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns index of the first pattern that failed.]
+
+  Description [Skips the unused upper half of the last word.]
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Gia_ManSimInfoIsZero( Gia_ManSim_t * p, unsigned * pInfo )
+static inline int Gia_ManSimInfoIsZero( Gia_ManSim_t * p, word * pInfo )
 {
+    word Mask;
     int w;
     for ( w = 0; w < p->nWords; w++ )
-        if ( pInfo[w] )
-            return 32*w + Gia_WordFindFirstBit( pInfo[w] );
+    {
+        Mask = (p->fHalfLast && w == p->nWords-1) ? (word)0xFFFFFFFF : ~(word)0;
+        if ( pInfo[w] & Mask )
+            return 64*w + Gia_ManSimWordFindFirstBit( pInfo[w] & Mask );
+    }
     return -1;
 }
 
@@ -313,124 +427,139 @@ static inline int Gia_ManSimInfoIsZero( Gia_ManSim_t * p, unsigned * pInfo )
   Synopsis    []
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimInfoOne( Gia_ManSim_t * p, unsigned * pInfo )
+static inline void Gia_ManSimInfoCopy( Gia_ManSim_t * p, word * pInfo, word * pInfo0 )
 {
-    int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = ~0;
+    memcpy( pInfo, pInfo0, sizeof(word) * p->nWords );
 }
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Copies one block of CI patterns into the frontier.]
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimInfoCopy( Gia_ManSim_t * p, unsigned * pInfo, unsigned * pInfo0 )
+static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi, int w0, int nWords )
 {
-    int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = pInfo0[w];
+    memcpy( Gia_SimData( p, Gia_ObjValue(pObj) ), Gia_SimDataCi( p, iCi ) + w0, sizeof(word) * nWords );
 }
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Copies one block of CO patterns from the frontier.]
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi )
+static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj, int w0, int nWords )
 {
-    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
-    unsigned * pInfo0 = Gia_SimDataCi( p, iCi );
+    word * pInfo  = Gia_SimDataCo( p, iCo ) + w0;
+    word * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
+    word Mask     = Gia_ObjFaninC0(pObj) ? ~(word)0 : 0;
     int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = pInfo0[w];
+    for ( w = nWords-1; w >= 0; w-- )
+        pInfo[w] = pInfo0[w] ^ Mask;
 }
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Simulates one node using 64-bit words.]
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj, int nWords )
 {
-    unsigned * pInfo  = Gia_SimDataCo( p, iCo );
-    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
+    word * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
+    word * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
+    word * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) );
+    word Mask0    = Gia_ObjFaninC0(pObj) ? ~(word)0 : 0;
+    word Mask1    = Gia_ObjFaninC1(pObj) ? ~(word)0 : 0;
     int w;
-    if ( Gia_ObjFaninC0(pObj) )
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = ~pInfo0[w];
-    else 
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = pInfo0[w];
+    for ( w = nWords-1; w >= 0; w-- )
+        pInfo[w] = (pInfo0[w] ^ Mask0) & (pInfo1[w] ^ Mask1);
 }
 
+#ifdef GIA_SIM_USE_SIMD
+
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Simulates one node using AVX2 instructions.]
+
+  Description [Processes the complete stride of the node, which is
+  a multiple of four words aligned on a 32-byte boundary.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
+static inline __attribute__((target("avx2"))) void Gia_ManSimulateNodeAvx2( Gia_ManSim_t * p, Gia_Obj_t * pObj )
 {
-    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
-    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
-    unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) );
+    __m256i * pInfo  = (__m256i *)Gia_SimData( p, Gia_ObjValue(pObj) );
+    __m256i * pInfo0 = (__m256i *)Gia_SimData( p, Gia_ObjDiff0(pObj) );
+    __m256i * pInfo1 = (__m256i *)Gia_SimData( p, Gia_ObjDiff1(pObj) );
+    __m256i Mask0    = _mm256_set1_epi64x( Gia_ObjFaninC0(pObj) ? -1 : 0 );
+    __m256i Mask1    = _mm256_set1_epi64x( Gia_ObjFaninC1(pObj) ? -1 : 0 );
     int w;
-    if ( Gia_ObjFaninC0(pObj) )
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~pInfo0[w] & pInfo1[w];
-    }
-    else 
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & ~pInfo1[w];
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & pInfo1[w];
-    }
+    for ( w = p->nStride/4-1; w >= 0; w-- )
+        _mm256_store_si256( pInfo + w, _mm256_and_si256(
+            _mm256_xor_si256( _mm256_load_si256(pInfo0 + w), Mask0 ),
+            _mm256_xor_si256( _mm256_load_si256(pInfo1 + w), Mask1 ) ) );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates one node using AVX-512 instructions.]
+
+  Description [Processes the complete stride of the node, which is
+  a multiple of eight words aligned on a 64-byte boundary.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline __attribute__((target("avx512f"))) void Gia_ManSimulateNodeAvx512( Gia_ManSim_t * p, Gia_Obj_t * pObj )
+{
+    __m512i * pInfo  = (__m512i *)Gia_SimData( p, Gia_ObjValue(pObj) );
+    __m512i * pInfo0 = (__m512i *)Gia_SimData( p, Gia_ObjDiff0(pObj) );
+    __m512i * pInfo1 = (__m512i *)Gia_SimData( p, Gia_ObjDiff1(pObj) );
+    __m512i Mask0    = _mm512_set1_epi64( Gia_ObjFaninC0(pObj) ? -1 : 0 );
+    __m512i Mask1    = _mm512_set1_epi64( Gia_ObjFaninC1(pObj) ? -1 : 0 );
+    int w;
+    for ( w = p->nStride/8-1; w >= 0; w-- )
+        _mm512_store_si512( pInfo + w, _mm512_and_si512(
+            _mm512_xor_si512( _mm512_load_si512(pInfo0 + w), Mask0 ),
+            _mm512_xor_si512( _mm512_load_si512(pInfo1 + w), Mask1 ) ) );
+}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    []
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
@@ -453,7 +582,7 @@ static inline void Gia_ManSimInfoInit( Gia_ManSim_t * p )
   Synopsis    []
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
@@ -473,42 +602,154 @@ static inline void Gia_ManSimInfoTransfer( Gia_ManSim_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Simulates one block of words starting at word w0.]
+
+  Description [There are three copies of this procedure, one for each
+  kernel, so that the node simulation is inlined in the object loop.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateRound( Gia_ManSim_t * p )
+static void Gia_ManSimulateBlock( Gia_ManSim_t * p, int w0, int nWords )
 {
     Gia_Obj_t * pObj;
     int i, iCis = 0, iCos = 0;
-    assert( p->pAig->nFront > 0 );
-    assert( Gia_ManConst0(p->pAig)->Value == 0 );
-    Gia_ManSimInfoZero( p, Gia_SimData(p, 0) );
     Gia_ManForEachObj1( p->pAig, pObj, i )
     {
         if ( Gia_ObjIsAndOrConst0(pObj) )
-        {
-            assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateNode( p, pObj );
-        }
+            Gia_ManSimulateNode( p, pObj, nWords );
         else if ( Gia_ObjIsCo(pObj) )
+            Gia_ManSimulateCo( p, iCos++, pObj, w0, nWords );
+        else // if ( Gia_ObjIsCi(pObj) )
+            Gia_ManSimulateCi( p, pObj, iCis++, w0, nWords );
+    }
+}
+#ifdef GIA_SIM_USE_SIMD
+static __attribute__((target("avx2"))) void Gia_ManSimulateBlockAvx2( Gia_ManSim_t * p, int w0, int nWords )
+{
+    Gia_Obj_t * pObj;
+    int i, iCis = 0, iCos = 0;
+    Gia_ManForEachObj1( p->pAig, pObj, i )
+    {
+        if ( Gia_ObjIsAndOrConst0(pObj) )
+            Gia_ManSimulateNodeAvx2( p, pObj );
+        else if ( Gia_ObjIsCo(pObj) )
+            Gia_ManSimulateCo( p, iCos++, pObj, w0, nWords );
+        else // if ( Gia_ObjIsCi(pObj) )
+            Gia_ManSimulateCi( p, pObj, iCis++, w0, nWords );
+    }
+}
+static __attribute__((target("avx512f"))) void Gia_ManSimulateBlockAvx512( Gia_ManSim_t * p, int w0, int nWords )
+{
+    Gia_Obj_t * pObj;
+    int i, iCis = 0, iCos = 0;
+    Gia_ManForEachObj1( p->pAig, pObj, i )
+    {
+        if ( Gia_ObjIsAndOrConst0(pObj) )
+            Gia_ManSimulateNodeAvx512( p, pObj );
+        else if ( Gia_ObjIsCo(pObj) )
+            Gia_ManSimulateCo( p, iCos++, pObj, w0, nWords );
+        else // if ( Gia_ObjIsCi(pObj) )
+            Gia_ManSimulateCi( p, pObj, iCis++, w0, nWords );
+    }
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates every nStep-th block starting from block iStart.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManSimulateBlocks( Gia_ManSim_t * p, int iStart, int nStep )
+{
+    int w0, nWords;
+    memset( Gia_SimData(p, 0), 0, sizeof(word) * p->nStride );
+    for ( w0 = iStart * p->nBlock; w0 < p->nWords; w0 += nStep * p->nBlock )
+    {
+        nWords = Abc_MinInt( p->nBlock, p->nWords - w0 );
+#ifdef GIA_SIM_USE_SIMD
+        if ( p->Kernel == 2 )
+            Gia_ManSimulateBlockAvx512( p, w0, nWords );
+        else if ( p->Kernel == 1 )
+            Gia_ManSimulateBlockAvx2( p, w0, nWords );
+        else
+#endif
+        Gia_ManSimulateBlock( p, w0, nWords );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the blocks assigned to one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Gia_ManSimWorkerThread( void * pArg )
+{
+    Gia_SimThData_t * pData = (Gia_SimThData_t *)pArg;
+    Gia_ManSimulateBlocks( &pData->Sim, pData->iThread, pData->nThreads );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description [The blocks of words are independent, so they are
+  distributed among the threads, each of which uses its own frontier.
+  The random patterns are generated before the round and the outputs
+  are checked after it, so the results do not depend on the number
+  of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_ManSimulateRound( Gia_ManSim_t * p )
+{
+    assert( p->pAig->nFront > 0 );
+    assert( Gia_ManConst0(p->pAig)->Value == 0 );
+#ifdef ABC_USE_PTHREADS
+    if ( p->nThreads > 1 )
+    {
+        Gia_SimThData_t * pData = ABC_ALLOC( Gia_SimThData_t, p->nThreads );
+        pthread_t * pThreads = ABC_ALLOC( pthread_t, p->nThreads );
+        int i, Status;
+        for ( i = 0; i < p->nThreads; i++ )
         {
-            assert( Gia_ObjValue(pObj) == GIA_NONE );
-            Gia_ManSimulateCo( p, iCos++, pObj );
+            pData[i].Sim      = *p;
+            pData[i].Sim.pDataSim = p->pDataSim + i * p->nStride * p->pAig->nFront;
+            pData[i].iThread  = i;
+            pData[i].nThreads = p->nThreads;
         }
-        else // if ( Gia_ObjIsCi(pObj) )
+        for ( i = 1; i < p->nThreads; i++ )
         {
-            assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateCi( p, pObj, iCis++ );
+            Status = pthread_create( pThreads + i, NULL, Gia_ManSimWorkerThread, (void *)(pData + i) );
+            assert( Status == 0 );
         }
+        Gia_ManSimWorkerThread( (void *)pData );
+        for ( i = 1; i < p->nThreads; i++ )
+            pthread_join( pThreads[i], NULL );
+        ABC_FREE( pThreads );
+        ABC_FREE( pData );
+        return;
     }
-    assert( Gia_ManCiNum(p->pAig) == iCis );
-    assert( Gia_ManCoNum(p->pAig) == iCos );
+#endif
+    Gia_ManSimulateBlocks( p, 0, 1 );
 }
 
 /**Function*************************************************************
@@ -542,7 +783,8 @@ static inline int Gia_ManCheckPos( Gia_ManSim_t * p, int * piPo, int * piPat )
 
   Synopsis    [Returns the counter-example.]
 
-  Description []
+  Description [Regenerates the random patterns of the failing frames.
+  The number of words (nWords) is given in 32-bit words.]
                
   SideEffects []
 
@@ -552,23 +794,24 @@ static inline int Gia_ManCheckPos( Gia_ManSim_t * p, int * piPo, int * piPat )
 Abc_Cex_t * Gia_ManGenerateCounter( Gia_Man_t * pAig, int iFrame, int iOut, int nWords, int iPat, Vec_Int_t * vCis2Ids )
 {
     Abc_Cex_t * p;
-    unsigned * pData;
+    word * pData;
+    int nWords64 = (nWords + 1) / 2;
     int f, i, w, iPioId, Counter;
     p = Abc_CexAlloc( Gia_ManRegNum(pAig), Gia_ManPiNum(pAig), iFrame+1 );
     p->iFrame = iFrame;
     p->iPo    = iOut;
     // fill in the binary data
     Counter = p->nRegs;
-    pData = ABC_ALLOC( unsigned, nWords );
+    pData = ABC_ALLOC( word, nWords64 );
     for ( f = 0; f <= iFrame; f++, Counter += p->nPis )
     for ( i = 0; i < Gia_ManPiNum(pAig); i++ )
     {
         iPioId = Vec_IntEntry( vCis2Ids, i );
         if ( iPioId >= p->nPis )
             continue;
-        for ( w = nWords-1; w >= 0; w-- )
-            pData[w] = Gia_ManRandom( 0 );
-        if ( Gia_InfoHasBit( pData, iPat ) )
+        for ( w = nWords64-1; w >= 0; w-- )
+            pData[w] = Gia_ManSimRandomWord( (nWords & 1) && w == nWords64-1 );
+        if ( (pData[iPat >> 6] >> (iPat & 63)) & 1 )
             Gia_InfoSetBit( p->pData, Counter + iPioId );
     }
     ABC_FREE( pData );
@@ -629,7 +872,7 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
         {
             Gia_ManResetRandom( pPars );
             pPars->iOutFail = iOut;
-            pAig->pCexSeq = Gia_ManGenerateCounter( pAig, i, iOut, p->nWords, iPat, p->vCis2Ids );
+            pAig->pCexSeq = Gia_ManGenerateCounter( pAig, i, iOut, pPars->nWords, iPat, p->vCis2Ids );
             Abc_Print( 1, "Networks are NOT EQUIVALENT.   Output %d was asserted in frame %d.  ", iOut, i );
             if ( !Gia_ManVerifyCex( pAig, pAig->pCexSeq, 0 ) )
             {
@@ -62,8 +62,10 @@ struct Inter_ManParams_t_
     int  fUseBackward;  // perform backward interpolation
     int  fUseSeparate;  // solve each output separately
     int  fDropSatOuts;  // replace by 1 the solved outputs
+    int  fUseIncr;      // reuse one SAT solver for the timeframes across iterations
     int  fVerbose;      // print verbose statistics
     int  iFrameMax;     // the time frame reached
+    volatile int * pStop; // set externally when the engine should stop
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -59,6 +59,7 @@ void Inter_ManSetDefaultParams( Inter_ManParams_t * p )
     p->fUseBackward = 0;     // perform backward interpolation
     p->fUseSeparate = 0;     // solve each output separately
     p->fDropSatOuts = 0;     // replace by 1 the solved outputs
+    p->fUseIncr     = 0;     // reuse one SAT solver for the timeframes across iterations
     p->fVerbose     = 0;     // print verbose statistics
     p->iFrameMax    =-1;
 }
@@ -195,6 +196,13 @@ p->timeCnf += clock() - clk;
                 Inter_CheckStop( pCheck );
                 return -1;
             }
+            if ( pPars->pStop && *pPars->pStop )
+            {
+                p->timeTotal = clock() - clkTotal;
+                Inter_ManStop( p );
+                Inter_CheckStop( pCheck );
+                return -1;
+            }
 
             // perform interpolation
             clk = clock();
@@ -206,6 +214,9 @@ p->timeCnf += clock() - clk;
             }
             else 
 #endif
+            if ( pPars->fUseIncr )
+                RetValue = Inter_ManPerformOneStepIncr( p, pPars->fUseBias, pPars->fUseBackward, nTimeNewOut );
+            else
                 RetValue = Inter_ManPerformOneStep( p, pPars->fUseBias, pPars->fUseBackward, nTimeNewOut );
 
             if ( pPars->fVerbose )
@@ -241,6 +252,11 @@ p->timeCnf += clock() - clk;
                     if ( pPars->fVerbose )
                         printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
                 }
+                else if ( pPars->pStop && *pPars->pStop ) // stopped externally
+                {
+                    if ( pPars->fVerbose )
+                        printf( "Interpolation was stopped externally.\n" );
+                }
                 else
                 {
                     assert( p->nConfCur >= p->nConfLimit );
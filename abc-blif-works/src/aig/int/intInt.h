@@ -59,6 +59,9 @@ struct Inter_Man_t_
     // timeframes
     Aig_Man_t *      pFrames;      // the timeframes      
     Cnf_Dat_t *      pCnfFrames;   // CNF for the timeframes 
+    // incremental solving
+    sat_solver *     pSatB;        // the solver holding the timeframes
+    Sto_Man_t *      pCnfB;        // the clauses of the timeframes and those learned from them
     // other data
     Vec_Int_t *      vVarsAB;      // the variables participating in 
     // temporary place for the new interpolant
@@ -69,6 +72,7 @@ struct Inter_Man_t_
     int              nConfCur;     // the current number of conflicts
     int              nConfLimit;   // the limit on the number of conflicts
     int              fVerbose;     // the verbosiness flag
+    volatile int *   pStop;        // set externally when the engine should stop
     // runtime
     int              timeRwr;
     int              timeCnf;
@@ -118,6 +122,8 @@ extern void            Inter_ManStop( Inter_Man_t * p );
 
 /*=== intM114.c ============================================================*/
 extern int             Inter_ManPerformOneStep( Inter_Man_t * p, int fUseBias, int fUseBackward, int nTimeNewOut );
+extern void            Inter_ManStopIncr( Inter_Man_t * p );
+extern int             Inter_ManPerformOneStepIncr( Inter_Man_t * p, int fUseBias, int fUseBackward, int nTimeNewOut );
 
 /*=== intM114p.c ============================================================*/
 #ifdef ABC_USE_LIBRARIES
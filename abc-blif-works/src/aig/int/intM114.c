@@ -222,6 +222,7 @@ int Inter_ManPerformOneStep( Inter_Man_t * p, int fUseBias, int fUseBackward, in
     // set runtime limit
     if ( nTimeNewOut )
         sat_solver_set_runtime_limit( pSat, nTimeNewOut );
+    pSat->pStop = p->pStop;
 
     // collect global variables
     pGlobalVars = ABC_CALLOC( int, sat_solver_nvars(pSat) );
@@ -311,6 +312,354 @@ p->timeInt += clock() - clk;
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the clause guarded by the activation variable.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Inter_ManAddClauseAct( sat_solver * pSat, Vec_Int_t * vLits, int * pBeg, int * pEnd, int iActVar )
+{
+    Vec_IntClear( vLits );
+    for ( ; pBeg < pEnd; pBeg++ )
+        Vec_IntPush( vLits, *pBeg );
+    Vec_IntPush( vLits, toLitCond(iActVar, 1) );
+    return sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the SAT solver containing the timeframes.]
+
+  Description [The solver is kept while the number of timeframes does not
+  change. Its clauses are recorded in p->pCnfB, which later collects the
+  learned clauses derived from the timeframes only. Returns NULL if the
+  timeframes are unsatisfiable by themselves.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+sat_solver * Inter_ManDeriveSatSolverB( Inter_Man_t * p )
+{
+    sat_solver * pSat;
+    int i;
+    assert( p->pSatB == NULL && p->pCnfB == NULL );
+    pSat = sat_solver_new();
+    sat_solver_store_alloc( pSat );
+    sat_solver_setnvars( pSat, p->pCnfFrames->nVars );
+    for ( i = 0; i < p->pCnfFrames->nClauses; i++ )
+        if ( !sat_solver_addclause( pSat, p->pCnfFrames->pClauses[i], p->pCnfFrames->pClauses[i+1] ) )
+        {
+            sat_solver_delete( pSat );
+            return NULL;
+        }
+    p->pCnfB = (Sto_Man_t *)sat_solver_store_release( pSat );
+    sat_solver_store_alloc( pSat );
+    return pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds clauses of A guarded by the activation variable.]
+
+  Description [The interpolant and one timeframe get fresh variables
+  following the activation variable. Returns the number of clauses added.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManAddClausesA( Inter_Man_t * p, sat_solver * pSat, int iActVar, int fUseBackward )
+{
+    Cnf_Dat_t * pCnfInter = p->pCnfInter, * pCnfAig = p->pCnfAig, * pCnfFrames = p->pCnfFrames;
+    Aig_Man_t * pInter = p->pInter, * pAig = p->pAigTrans, * pFrames = p->pFrames;
+    Vec_Int_t * vLits = Vec_IntAlloc( 100 );
+    Aig_Obj_t * pObj, * pObj2;
+    int i, Lits[2], nClauses = 0;
+
+    // prepare CNFs
+    Cnf_DataLift( pCnfAig,   iActVar + 1 );
+    Cnf_DataLift( pCnfInter, iActVar + 1 + pCnfAig->nVars );
+    sat_solver_setnvars( pSat, iActVar + 1 + pCnfAig->nVars + pCnfInter->nVars );
+
+    // interpolant
+    for ( i = 0; i < pCnfInter->nClauses; i++, nClauses++ )
+        if ( !Inter_ManAddClauseAct( pSat, vLits, pCnfInter->pClauses[i], pCnfInter->pClauses[i+1], iActVar ) )
+            assert( 0 );
+    // connector clauses
+    if ( fUseBackward )
+    {
+        Saig_ManForEachLi( pAig, pObj2, i )
+        {
+            if ( Saig_ManRegNum(pAig) == Aig_ManPiNum(pInter) )
+                pObj = Aig_ManPi( pInter, i );
+            else
+            {
+                assert( Aig_ManPiNum(pAig) == Aig_ManPiNum(pInter) );
+                pObj = Aig_ManPi( pInter, Aig_ManPiNum(pAig)-Saig_ManRegNum(pAig) + i );
+            }
+            Lits[0] = toLitCond( pCnfInter->pVarNums[pObj->Id], 0 );
+            Lits[1] = toLitCond( pCnfAig->pVarNums[pObj2->Id], 1 );
+            if ( !Inter_ManAddClauseAct( pSat, vLits, Lits, Lits+2, iActVar ) )
+                assert( 0 );
+            Lits[0] = toLitCond( pCnfInter->pVarNums[pObj->Id], 1 );
+            Lits[1] = toLitCond( pCnfAig->pVarNums[pObj2->Id], 0 );
+            if ( !Inter_ManAddClauseAct( pSat, vLits, Lits, Lits+2, iActVar ) )
+                assert( 0 );
+            nClauses += 2;
+        }
+    }
+    else
+    {
+        Aig_ManForEachPi( pInter, pObj, i )
+        {
+            pObj2 = Saig_ManLo( pAig, i );
+            Lits[0] = toLitCond( pCnfInter->pVarNums[pObj->Id], 0 );
+            Lits[1] = toLitCond( pCnfAig->pVarNums[pObj2->Id], 1 );
+            if ( !Inter_ManAddClauseAct( pSat, vLits, Lits, Lits+2, iActVar ) )
+                assert( 0 );
+            Lits[0] = toLitCond( pCnfInter->pVarNums[pObj->Id], 1 );
+            Lits[1] = toLitCond( pCnfAig->pVarNums[pObj2->Id], 0 );
+            if ( !Inter_ManAddClauseAct( pSat, vLits, Lits, Lits+2, iActVar ) )
+                assert( 0 );
+            nClauses += 2;
+        }
+    }
+    // one timeframe
+    for ( i = 0; i < pCnfAig->nClauses; i++, nClauses++ )
+        if ( !Inter_ManAddClauseAct( pSat, vLits, pCnfAig->pClauses[i], pCnfAig->pClauses[i+1], iActVar ) )
+            assert( 0 );
+    // connector clauses
+    Vec_IntClear( p->vVarsAB );
+    if ( fUseBackward )
+    {
+        Aig_ManForEachPo( pFrames, pObj, i )
+        {
+            assert( pCnfFrames->pVarNums[pObj->Id] >= 0 );
+            Vec_IntPush( p->vVarsAB, pCnfFrames->pVarNums[pObj->Id] );
+
+            pObj2 = Saig_ManLo( pAig, i );
+            Lits[0] = toLitCond( pCnfFrames->pVarNums[pObj->Id], 0 );
+            Lits[1] = toLitCond( pCnfAig->pVarNums[pObj2->Id], 1 );
+            if ( !Inter_ManAddClauseAct( pSat, vLits, Lits, Lits+2, iActVar ) )
+                assert( 0 );
+            Lits[0] = toLitCond( pCnfFrames->pVarNums[pObj->Id], 1 );
+            Lits[1] = toLitCond( pCnfAig->pVarNums[pObj2->Id], 0 );
+            if ( !Inter_ManAddClauseAct( pSat, vLits, Lits, Lits+2, iActVar ) )
+                assert( 0 );
+            nClauses += 2;
+        }
+    }
+    else
+    {
+        Aig_ManForEachPi( pFrames, pObj, i )
+        {
+            if ( i == Aig_ManRegNum(pAig) )
+                break;
+            Vec_IntPush( p->vVarsAB, pCnfFrames->pVarNums[pObj->Id] );
+
+            pObj2 = Saig_ManLi( pAig, i );
+            Lits[0] = toLitCond( pCnfFrames->pVarNums[pObj->Id], 0 );
+            Lits[1] = toLitCond( pCnfAig->pVarNums[pObj2->Id], 1 );
+            if ( !Inter_ManAddClauseAct( pSat, vLits, Lits, Lits+2, iActVar ) )
+                assert( 0 );
+            Lits[0] = toLitCond( pCnfFrames->pVarNums[pObj->Id], 1 );
+            Lits[1] = toLitCond( pCnfAig->pVarNums[pObj2->Id], 0 );
+            if ( !Inter_ManAddClauseAct( pSat, vLits, Lits, Lits+2, iActVar ) )
+                assert( 0 );
+            nClauses += 2;
+        }
+    }
+    // return clauses to the original state
+    Cnf_DataLift( pCnfAig, -iActVar - 1 );
+    Cnf_DataLift( pCnfInter, -iActVar - 1 - pCnfAig->nVars );
+    Vec_IntFree( vLits );
+    return nClauses;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the proof of the current run.]
+
+  Description [pStore contains the clauses of A added in this run followed
+  by the clauses learned in this run. The resulting proof lists clauses
+  of A without the activation literal, then clauses of B together with
+  the clauses learned from B in the previous runs, then the clauses 
+  learned in this run. The clauses learned from B in this run are 
+  appended to p->pCnfB. The clauses depending on A of the previous runs
+  are satisfied by their retired activation literals and are skipped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sto_Man_t * Inter_ManDeriveProofIncr( Inter_Man_t * p, Sto_Man_t * pStore, int nClausesA, int iActVar )
+{
+    Sto_Man_t * pCnf;
+    Sto_Cls_t * pClause;
+    Vec_Int_t * vLits = Vec_IntAlloc( 100 );
+    int nVarsB = p->pCnfFrames->nVars;
+    int i, k, Var, fCurrent, fPrevious;
+    pCnf = Sto_ManAlloc();
+    // clauses of A
+    i = 0;
+    Sto_ManForEachClause( pStore, pClause )
+    {
+        if ( i++ == nClausesA )
+            break;
+        Vec_IntClear( vLits );
+        for ( k = 0; k < (int)pClause->nLits; k++ )
+            if ( lit_var(pClause->pLits[k]) != iActVar )
+                Vec_IntPush( vLits, pClause->pLits[k] );
+        Sto_ManAddClause( pCnf, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
+    }
+    Sto_ManMarkClausesA( pCnf );
+    // clauses of B
+    Sto_ManForEachClause( p->pCnfB, pClause )
+        Sto_ManAddClause( pCnf, pClause->pLits, pClause->pLits + pClause->nLits );
+    Sto_ManMarkRoots( pCnf );
+    // learned clauses
+    i = 0;
+    Sto_ManForEachClause( pStore, pClause )
+    {
+        if ( i++ < nClausesA || pClause->nLits == 0 )
+            continue;
+        fCurrent = fPrevious = 0;
+        Vec_IntClear( vLits );
+        for ( k = 0; k < (int)pClause->nLits; k++ )
+        {
+            Var = lit_var(pClause->pLits[k]);
+            if ( Var >= nVarsB && Var < iActVar )
+                fPrevious = 1;
+            else if ( Var >= iActVar )
+                fCurrent = 1;
+            if ( Var != iActVar )
+                Vec_IntPush( vLits, pClause->pLits[k] );
+        }
+        if ( fPrevious || Vec_IntSize(vLits) == 0 )
+            continue;
+        Sto_ManAddClause( pCnf, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits) );
+        if ( !fCurrent )
+            Sto_ManAddClause( p->pCnfB, pClause->pLits, pClause->pLits + pClause->nLits );
+    }
+    // the empty clause
+    Sto_ManAddClause( pCnf, NULL, NULL );
+    Vec_IntFree( vLits );
+    return pCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the solver used for incremental interpolation.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Inter_ManStopIncr( Inter_Man_t * p )
+{
+    if ( p->pSatB )
+        sat_solver_delete( p->pSatB );
+    if ( p->pCnfB )
+        Sto_ManFree( p->pCnfB );
+    p->pSatB = NULL;
+    p->pCnfB = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one SAT run with interpolation incrementally.]
+
+  Description [Keeps the clauses of B (the timeframes) in one solver
+  while the number of timeframes is unchanged. The clauses of A (the 
+  interpolant and the transition relation) are added in each run under
+  a new activation variable, which is disabled after the run.
+  Returns 1 if proven. 0 if failed. -1 if undecided.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManPerformOneStepIncr( Inter_Man_t * p, int fUseBias, int fUseBackward, int nTimeNewOut )
+{
+    sat_solver * pSat;
+    Sto_Man_t * pSatCnf = NULL;
+    Inta_Man_t * pManInterA; 
+    int * pGlobalVars;
+    int clk, status, RetValue;
+    int i, Var, iActVar, nClausesA, nConfStart, Lit;
+
+    // derive the SAT solver
+    if ( p->pSatB == NULL )
+        p->pSatB = Inter_ManDeriveSatSolverB( p );
+    if ( p->pSatB == NULL )
+        return Inter_ManPerformOneStep( p, fUseBias, fUseBackward, nTimeNewOut );
+    pSat = p->pSatB;
+    iActVar = sat_solver_nvars( pSat );
+    nClausesA = Inter_ManAddClausesA( p, pSat, iActVar, fUseBackward );
+
+    // set runtime limit
+    if ( nTimeNewOut )
+        sat_solver_set_runtime_limit( pSat, nTimeNewOut );
+    pSat->pStop = p->pStop;
+
+    // collect global variables
+    pGlobalVars = ABC_CALLOC( int, sat_solver_nvars(pSat) );
+    Vec_IntForEachEntry( p->vVarsAB, Var, i )
+        pGlobalVars[Var] = 1;
+    pSat->pGlobalVars = fUseBias? pGlobalVars : NULL;
+
+    // solve the problem
+clk = clock();
+    nConfStart = (int)pSat->stats.conflicts;
+    Lit = toLitCond( iActVar, 0 );
+    status = sat_solver_solve( pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    p->nConfCur = (int)pSat->stats.conflicts - nConfStart;
+p->timeSat += clock() - clk;
+
+    pSat->pGlobalVars = NULL;
+    ABC_FREE( pGlobalVars );
+    if ( status == l_False )
+        RetValue = 1;
+    else if ( status == l_True )
+        RetValue = 0;
+    else
+        RetValue = -1;
+
+    // derive the proof and retire the clauses of A
+    if ( RetValue == 1 )
+        pSatCnf = Inter_ManDeriveProofIncr( p, (Sto_Man_t *)pSat->pStore, nClausesA, iActVar );
+    sat_solver_store_free( pSat );
+    Lit = toLitCond( iActVar, 1 );
+    if ( !sat_solver_addclause( pSat, &Lit, &Lit + 1 ) )
+        assert( 0 );
+    sat_solver_store_alloc( pSat );
+    if ( pSatCnf == NULL )
+        return RetValue;
+
+    // create the resulting manager
+clk = clock();
+    pManInterA = Inta_ManAlloc();
+    p->pInterNew = (Aig_Man_t *)Inta_ManInterpolate( pManInterA, pSatCnf, p->vVarsAB, 0 );
+    Inta_ManFree( pManInterA );
+p->timeInt += clock() - clk;
+    Sto_ManFree( pSatCnf );
+    return RetValue;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
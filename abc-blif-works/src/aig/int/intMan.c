@@ -51,6 +51,7 @@ Inter_Man_t * Inter_ManCreate( Aig_Man_t * pAig, Inter_ManParams_t * pPars )
     p->vVarsAB = Vec_IntAlloc( Aig_ManRegNum(pAig) );
     p->nConfLimit = pPars->nBTLimit;
     p->fVerbose = pPars->fVerbose;
+    p->pStop = pPars->pStop;
     p->pAig = pAig;   
     return p;
 }
@@ -68,6 +69,7 @@ Inter_Man_t * Inter_ManCreate( Aig_Man_t * pAig, Inter_ManParams_t * pPars )
 ***********************************************************************/
 void Inter_ManClean( Inter_Man_t * p )
 {
+    Inter_ManStopIncr( p );
     if ( p->pCnfInter )
         Cnf_DataFree( p->pCnfInter );
     if ( p->pCnfFrames )
@@ -104,6 +106,7 @@ void Inter_ManStop( Inter_Man_t * p )
         ABC_PRTP( "TOTAL      ", p->timeTotal, p->timeTotal );
     }
 
+    Inter_ManStopIncr( p );
     if ( p->pCnfAig )
         Cnf_DataFree( p->pCnfAig );
     if ( p->pCnfFrames )
@@ -133,6 +133,8 @@ struct Prove_ParamsStruct_t_
     // global resources applied
     ABC_INT64_T  nTotalBacktracksMade;  // the total number of backtracks made
     ABC_INT64_T  nTotalInspectsMade;    // the total number of inspects made
+    // portfolio SAT solving
+    int     nThreads;              // the number of solvers in the final SAT call
 };
 
 static inline Ivy_FraigSim_t * Ivy_ObjSim( Ivy_Obj_t * pObj )                            { return (Ivy_FraigSim_t *)pObj->pFanout;  }
@@ -64,6 +64,8 @@ struct Gia_ParLlb_t_
     int         fSkipOutCheck; // does not check the property output
     int         TimeLimit;     // time limit for one reachability run
     int         TimeLimitGlo;  // time limit for all reachability runs
+    int         nThreads;      // the number of threads for image computation
+    int         nNodesMax;     // the limit on live BDD nodes in all threads
     // internal parameters
     int         TimeTarget;    // the time to stop
     int         iFrame;        // explored up to this frame
@@ -68,6 +68,8 @@ void Llb_ManSetDefaultParams( Gia_ParLlb_t * p )
     p->TimeLimit     =        0;
 //    p->TimeLimit     =        0;
     p->TimeLimitGlo  =        0;
+    p->nThreads      =        1;
+    p->nNodesMax     =        0;
     p->TimeTarget    =        0;
     p->iFrame        =       -1;
 }
@@ -148,7 +148,14 @@ DdNode * Llb_Nonlin4CreateCube1( Llb_Mgr_t * p, Llb_Prt_t * pPart )
         if ( Vec_IntSize(pVar->vParts) != 1 )
             continue;
         assert( Vec_IntEntry(pVar->vParts, 0) == pPart->iPart );
-        bCube = Cudd_bddAnd( p->dd, bTemp = bCube, Cudd_bddIthVar(p->dd, pVar->iVar) );    Cudd_Ref( bCube );
+        bCube = Cudd_bddAnd( p->dd, bTemp = bCube, Cudd_bddIthVar(p->dd, pVar->iVar) );
+        if ( bCube == NULL )
+        {
+            Cudd_RecursiveDeref( p->dd, bTemp );
+            p->dd->TimeStop = TimeStop;
+            return NULL;
+        }
+        Cudd_Ref( bCube );
         Cudd_RecursiveDeref( p->dd, bTemp );
     }
     Cudd_Deref( bCube );
@@ -182,7 +189,14 @@ DdNode * Llb_Nonlin4CreateCube2( Llb_Mgr_t * p, Llb_Prt_t * pPart1, Llb_Prt_t *
         if ( (Vec_IntEntry(pVar->vParts, 0) == pPart1->iPart && Vec_IntEntry(pVar->vParts, 1) == pPart2->iPart) ||
              (Vec_IntEntry(pVar->vParts, 0) == pPart2->iPart && Vec_IntEntry(pVar->vParts, 1) == pPart1->iPart) )
         {
-            bCube = Cudd_bddAnd( p->dd, bTemp = bCube, Cudd_bddIthVar(p->dd, pVar->iVar) );   Cudd_Ref( bCube );
+            bCube = Cudd_bddAnd( p->dd, bTemp = bCube, Cudd_bddIthVar(p->dd, pVar->iVar) );
+            if ( bCube == NULL )
+            {
+                Cudd_RecursiveDeref( p->dd, bTemp );
+                p->dd->TimeStop = TimeStop;
+                return NULL;
+            }
+            Cudd_Ref( bCube );
             Cudd_RecursiveDeref( p->dd, bTemp );
         }
     }
@@ -264,10 +278,20 @@ int Llb_Nonlin4Quantify1( Llb_Mgr_t * p, Llb_Prt_t * pPart )
     DdNode * bCube, * bTemp;
     int i, RetValue, nSizeNew;
     // create cube to be quantified
-    bCube = Llb_Nonlin4CreateCube1( p, pPart );   Cudd_Ref( bCube );
+    bCube = Llb_Nonlin4CreateCube1( p, pPart );
+    if ( bCube == NULL )
+        return 0;
+    Cudd_Ref( bCube );
 //    assert( !Cudd_IsConstant(bCube) );
     // derive new function
-    pPart->bFunc = Cudd_bddExistAbstract( p->dd, bTemp = pPart->bFunc, bCube );  Cudd_Ref( pPart->bFunc );
+    pPart->bFunc = Cudd_bddExistAbstract( p->dd, bTemp = pPart->bFunc, bCube );
+    if ( pPart->bFunc == NULL )
+    {
+        pPart->bFunc = bTemp;
+        Cudd_RecursiveDeref( p->dd, bCube );
+        return 0;
+    }
+    Cudd_Ref( pPart->bFunc );
     Cudd_RecursiveDeref( p->dd, bTemp );
     Cudd_RecursiveDeref( p->dd, bCube );
     // get support
@@ -298,10 +322,12 @@ int Llb_Nonlin4Quantify1( Llb_Mgr_t * p, Llb_Prt_t * pPart )
         if ( p->pSupp[i] && Vec_IntEntry(p->vVars2Q, i) )
             Vec_IntPush( pPart->vVars, i );
     // remove other variables
+    RetValue = 1;
     Vec_PtrForEachEntry( Llb_Prt_t *, vSingles, pTemp, i )
-        Llb_Nonlin4Quantify1( p, pTemp );
+        if ( RetValue && !Llb_Nonlin4Quantify1( p, pTemp ) )
+            RetValue = 0;
     Vec_PtrFree( vSingles );
-    return 0;
+    return RetValue;
 }
 
 /**Function*************************************************************
@@ -328,7 +354,10 @@ int Llb_Nonlin4Quantify2( Llb_Mgr_t * p, Llb_Prt_t * pPart1, Llb_Prt_t * pPart2
     int liveBeg, liveEnd;
 
     // create cube to be quantified
-    bCube = Llb_Nonlin4CreateCube2( p, pPart1, pPart2 );   Cudd_Ref( bCube );
+    bCube = Llb_Nonlin4CreateCube2( p, pPart1, pPart2 );
+    if ( bCube == NULL )
+        return 0;
+    Cudd_Ref( bCube );
 
 //printf( "Quantifying  " ); Extra_bddPrintSupport( p->dd, bCube );  printf( "\n" );
 
@@ -426,16 +455,18 @@ liveEnd = p->dd->keys - p->dd->dead;
     // remove other variables
 if ( fVerbose )
 Llb_Nonlin4Print( p );
+    RetValue = 1;
     Vec_PtrForEachEntry( Llb_Prt_t *, vSingles, pTemp, i )
     {
 if ( fVerbose )
 printf( "Updating partitiong %d with singlton vars.\n", pTemp->iPart );
-        Llb_Nonlin4Quantify1( p, pTemp );
+        if ( RetValue && !Llb_Nonlin4Quantify1( p, pTemp ) )
+            RetValue = 0;
     }
 if ( fVerbose )
 Llb_Nonlin4Print( p );
     Vec_PtrFree( vSingles );
-    return 1;
+    return RetValue;
 }
 
 /**Function*************************************************************
@@ -757,8 +788,11 @@ DdNode * Llb_Nonlin4Image( DdManager * dd, Vec_Ptr_t * vParts, DdNode * bCurrent
     p = Llb_Nonlin4Alloc( dd, vParts, bCurrent, vVars2Q, 0 );
     // remove singles
     Llb_MgrForEachPart( p, pPart, i )
-        if ( Llb_Nonlin4HasSingletonVars(p, pPart) )
-            Llb_Nonlin4Quantify1( p, pPart );
+        if ( Llb_Nonlin4HasSingletonVars(p, pPart) && !Llb_Nonlin4Quantify1( p, pPart ) )
+        {
+            Llb_Nonlin4Free( p );
+            return NULL;
+        }
     // compute scores
     Llb_Nonlin4RecomputeScores( p );
     // iteratively quantify variables
@@ -779,7 +813,14 @@ DdNode * Llb_Nonlin4Image( DdManager * dd, Vec_Ptr_t * vParts, DdNode * bCurrent
     bFunc = Cudd_ReadOne(p->dd);   Cudd_Ref( bFunc );
     Llb_MgrForEachPart( p, pPart, i )
     {
-        bFunc = Cudd_bddAnd( p->dd, bTemp = bFunc, pPart->bFunc );   Cudd_Ref( bFunc );
+        bFunc = Cudd_bddAnd( p->dd, bTemp = bFunc, pPart->bFunc );
+        if ( bFunc == NULL )
+        {
+            Cudd_RecursiveDeref( p->dd, bTemp );
+            Llb_Nonlin4Free( p );
+            return NULL;
+        }
+        Cudd_Ref( bFunc );
         Cudd_RecursiveDeref( p->dd, bTemp );
     }
 //    nSuppMax = p->nSuppMax;
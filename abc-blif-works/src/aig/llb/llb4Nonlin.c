@@ -42,6 +42,7 @@ struct Llb_Mnx_t_
     DdNode *        bNext;          // to states
     Vec_Ptr_t *     vRings;         // onion rings in ddR
     Vec_Ptr_t *     vRoots;         // BDDs for partitions
+    Llb_Par_t *     pPar;           // workers computing the image in parallel
 
     // structural info
     Vec_Int_t *     vOrder;         // for each object ID, its BDD variable number or -1
@@ -724,8 +725,8 @@ int Llb_Nonlin4Reachability( Llb_Mnx_t * p )
     for ( nIters = 0; nIters < p->pPars->nIterMax; nIters++ )
     { 
         clkIter = clock();
-        // check the runtime limit
-        if ( p->pPars->TimeLimit && clock() >= p->pPars->TimeTarget )
+        // check the runtime limit (on the wall clock if the workers are used)
+        if ( p->pPars->TimeLimit && (p->pPar ? Llb_Nonlin4ParTimeOut(p->pPar) : clock() >= p->pPars->TimeTarget) )
         {
             if ( !p->pPars->fSilent )
                 printf( "Reached timeout (%d seconds) during image computation.\n",  p->pPars->TimeLimit );
@@ -755,7 +756,10 @@ int Llb_Nonlin4Reachability( Llb_Mnx_t * p )
 
         // compute the next states
         clkTemp = clock();
-        p->bNext = Llb_Nonlin4Image( p->dd, p->vRoots, p->bCurrent, p->vVars2Q );
+        if ( p->pPar )
+            p->bNext = Llb_Nonlin4ParImage( p->pPar, p->vRoots, p->bCurrent );
+        else
+            p->bNext = Llb_Nonlin4Image( p->dd, p->vRoots, p->bCurrent, p->vVars2Q );
         if ( p->bNext == NULL )
         {
             if ( !p->pPars->fSilent )
@@ -958,6 +962,8 @@ Llb_Mnx_t * Llb_MnxStart( Aig_Man_t * pAig, Gia_ParLlb_t * pPars )
 
     if ( pPars->fReorder )
         Llb_Nonlin4Reorder( p->dd, 0, 1 );
+    if ( pPars->nThreads > 1 )
+        p->pPar = Llb_Nonlin4ParStart( p->dd, p->vRoots, p->vVars2Q, pPars->nThreads, pPars->nNodesMax, p->pPars->TimeTarget, pPars->fVerbose );
     return p;
 }
  
@@ -986,6 +992,8 @@ void Llb_MnxStop( Llb_Mnx_t * p )
         ABC_PRTP( "TOTAL    ", p->timeTotal, p->timeTotal );
         ABC_PRTP( "  reo    ", p->timeReo,   p->timeTotal );
     }
+    if ( p->pPar )
+        Llb_Nonlin4ParStop( p->pPar );
     // remove BDDs
     if ( p->bBad )
         Cudd_RecursiveDeref( p->dd, p->bBad );
@@ -0,0 +1,412 @@
+/**CFile****************************************************************
+
+  FileName    [llb4Par.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [BDD based reachability.]
+
+  Synopsis    [Partitioned image computation on several threads.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: llb4Par.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "llbInt.h"
+
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Llb_Wrk_t_ Llb_Wrk_t;
+struct Llb_Wrk_t_
+{
+    DdManager *     dd;             // BDD manager of this worker
+    Vec_Ptr_t *     vRoots;         // partitions in this manager
+    Vec_Int_t *     vVars2Q;        // 1 if variable is quantifiable; 0 othervise
+    DdNode *        bCurrent;       // the part of the from-states
+    DdNode *        bImage;         // the image of this part
+};
+
+struct Llb_Par_t_
+{
+    DdManager *     dd;             // the main BDD manager
+    Vec_Int_t *     vVars2Q;        // 1 if variable is quantifiable; 0 othervise
+    int             nWorkers;       // the number of workers
+    Llb_Wrk_t *     pWorkers;       // the workers
+    int             nReorders;      // reorderings of the main manager at the last update
+    abctime         TimeStopWall;   // wall-clock deadline (0 = no timeout)
+    int             fVerbose;       // verbose flag
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the managers of the workers.]
+
+  Description [Each worker gets a copy of the partitions in its own
+  BDD manager with the variable order of the main manager. Dynamic
+  reordering is not used in the workers because CUDD's reordering keeps
+  some of its data in static variables. The node budget nNodesMax
+  (0 = infinite) is divided among the workers. The CPU-time deadline
+  TimeTarget (0 = none) is converted into a wall-clock deadline, because
+  the process CPU time grows faster than the wall time when several
+  workers are running.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Llb_Par_t * Llb_Nonlin4ParStart( DdManager * dd, Vec_Ptr_t * vRoots, Vec_Int_t * vVars2Q, int nThreads, int nNodesMax, int TimeTarget, int fVerbose )
+{
+    Llb_Par_t * p;
+    Llb_Wrk_t * pWrk;
+    DdNode * bFunc, * bTemp;
+    int i, k;
+    assert( nThreads > 1 );
+    p = ABC_CALLOC( Llb_Par_t, 1 );
+    p->dd        = dd;
+    p->vVars2Q   = vVars2Q;
+    p->nWorkers  = nThreads;
+    p->pWorkers  = ABC_CALLOC( Llb_Wrk_t, nThreads );
+    p->nReorders = Cudd_ReadReorderings(dd);
+    p->fVerbose  = fVerbose;
+    if ( TimeTarget )
+        p->TimeStopWall = Abc_ClockTicks(0) + Abc_MaxInt( TimeTarget - (int)clock(), 0 );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pWrk = p->pWorkers + i;
+        pWrk->dd = Cudd_Init( Cudd_ReadSize(dd), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+        Cudd_ShuffleHeap( pWrk->dd, dd->invperm );
+        pWrk->vVars2Q = Vec_IntDup( vVars2Q );
+        pWrk->vRoots  = Vec_PtrAlloc( Vec_PtrSize(vRoots) );
+        Vec_PtrForEachEntry( DdNode *, vRoots, bFunc, k )
+        {
+            bTemp = Cudd_bddTransfer( dd, pWrk->dd, bFunc );  Cudd_Ref( bTemp );
+            Vec_PtrPush( pWrk->vRoots, bTemp );
+        }
+        if ( nNodesMax )
+            Cudd_SetMaxLive( pWrk->dd, Cudd_ReadKeys(pWrk->dd) - Cudd_ReadDead(pWrk->dd) + nNodesMax / nThreads );
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the managers of the workers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_Nonlin4ParStop( Llb_Par_t * p )
+{
+    Llb_Wrk_t * pWrk;
+    DdNode * bFunc;
+    int i, k;
+    for ( i = 0; i < p->nWorkers; i++ )
+    {
+        pWrk = p->pWorkers + i;
+        Vec_PtrForEachEntry( DdNode *, pWrk->vRoots, bFunc, k )
+            Cudd_RecursiveDeref( pWrk->dd, bFunc );
+        Vec_PtrFree( pWrk->vRoots );
+        Vec_IntFree( pWrk->vVars2Q );
+        Extra_StopManager( pWrk->dd );
+    }
+    ABC_FREE( p->pWorkers );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the wall-clock deadline has passed.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Llb_Nonlin4ParTimeOut( Llb_Par_t * p )
+{
+    return p->TimeStopWall && Abc_ClockTicks(0) > p->TimeStopWall;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the CPU-time limits of the managers from the deadline.]
+
+  Description [CUDD compares the timeout of a manager with the process
+  CPU time. The main manager is used by one thread at a time, so its
+  limit is the remaining wall time. The workers run concurrently and
+  the CPU time may grow up to nWorkers times faster than the wall time,
+  so their limit is scaled accordingly and they never stop early; the
+  deadline itself is checked on the wall clock after they finish.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_Nonlin4ParSetTimeStop( Llb_Par_t * p )
+{
+    abctime TimeLeft, TimeMain, TimeWrk;
+    int i;
+    if ( p->TimeStopWall == 0 )
+        return;
+    TimeLeft = p->TimeStopWall - Abc_ClockTicks(0);
+    if ( TimeLeft < 1 )
+        TimeLeft = 1;
+    TimeMain = (abctime)clock() + TimeLeft;
+    TimeWrk  = (abctime)clock() + TimeLeft * p->nWorkers;
+    p->dd->TimeStop = TimeMain < 0x7FFFFFFF ? (int)TimeMain : 0x7FFFFFFF;
+    for ( i = 0; i < p->nWorkers; i++ )
+        p->pWorkers[i].dd->TimeStop = TimeWrk < 0x7FFFFFFF ? (int)TimeWrk : 0x7FFFFFFF;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the topmost variable splitting the set in two.]
+
+  Description [Returns -1 if the set is a cube.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Llb_Nonlin4ParSplitVar( DdManager * dd, DdNode * bFunc )
+{
+    DdNode * bZero = Cudd_ReadLogicZero(dd), * bThen, * bElse;
+    while ( !Cudd_IsConstant(bFunc) )
+    {
+        bThen = Cudd_NotCond( Cudd_T(bFunc), Cudd_IsComplement(bFunc) );
+        bElse = Cudd_NotCond( Cudd_E(bFunc), Cudd_IsComplement(bFunc) );
+        if ( bThen != bZero && bElse != bZero )
+            return Cudd_NodeReadIndex( bFunc );
+        bFunc = (bThen == bZero) ? bElse : bThen;
+    }
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the set of states into at most nParts disjoint parts.]
+
+  Description [Repeatedly splits the largest part using its topmost
+  splitting variable. Returns NULL if the computation has timed out.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Llb_Nonlin4ParSplit( Llb_Par_t * p, DdNode * bCurrent, int nParts )
+{
+    DdManager * dd = p->dd;
+    Vec_Ptr_t * vParts;
+    DdNode * bPart, * bVar, * bCof0, * bCof1;
+    int i, iBest, iVar, iVarBest, nSize, nSizeBest;
+    vParts = Vec_PtrAlloc( nParts );
+    Vec_PtrPush( vParts, bCurrent );  Cudd_Ref( bCurrent );
+    while ( Vec_PtrSize(vParts) < nParts )
+    {
+        // find the largest part that can be split
+        iBest = iVarBest = -1; nSizeBest = 0;
+        Vec_PtrForEachEntry( DdNode *, vParts, bPart, i )
+        {
+            iVar = Llb_Nonlin4ParSplitVar( dd, bPart );
+            if ( iVar == -1 )
+                continue;
+            nSize = Cudd_DagSize( bPart );
+            if ( nSizeBest < nSize )
+                nSizeBest = nSize, iBest = i, iVarBest = iVar;
+        }
+        if ( iBest == -1 )
+            break;
+        // split it
+        bPart = (DdNode *)Vec_PtrEntry( vParts, iBest );
+        bVar  = Cudd_bddIthVar( dd, iVarBest );
+        bCof0 = Cudd_bddAnd( dd, bPart, Cudd_Not(bVar) );
+        if ( bCof0 == NULL )
+            break;
+        Cudd_Ref( bCof0 );
+        bCof1 = Cudd_bddAnd( dd, bPart, bVar );
+        if ( bCof1 == NULL )
+        {
+            Cudd_RecursiveDeref( dd, bCof0 );
+            break;
+        }
+        Cudd_Ref( bCof1 );
+        assert( bCof0 != Cudd_ReadLogicZero(dd) && bCof1 != Cudd_ReadLogicZero(dd) );
+        Cudd_RecursiveDeref( dd, bPart );
+        Vec_PtrWriteEntry( vParts, iBest, bCof0 );
+        Vec_PtrPush( vParts, bCof1 );
+    }
+    if ( Llb_Nonlin4ParTimeOut(p) )
+    {
+        Llb_Nonlin4Deref( dd, vParts );
+        return NULL;
+    }
+    return vParts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the image of one part.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Llb_Nonlin4ParWorker( void * pArg )
+{
+    Llb_Wrk_t * pWrk = (Llb_Wrk_t *)pArg;
+    pWrk->bImage = Llb_Nonlin4Image( pWrk->dd, pWrk->vRoots, pWrk->bCurrent, pWrk->vVars2Q );
+    if ( pWrk->bImage )
+        Cudd_Ref( pWrk->bImage );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the image of the states using the workers.]
+
+  Description [The states are split into disjoint parts, whose images
+  are computed in the managers of the workers in parallel and combined
+  by disjunction in the main manager. If some worker exceeds its node
+  budget, the image is computed in the main manager. Returns NULL if
+  the computation has timed out. The result is not referenced.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode * Llb_Nonlin4ParImage( Llb_Par_t * p, Vec_Ptr_t * vRoots, DdNode * bCurrent )
+{
+    Vec_Ptr_t * vParts;
+    Llb_Wrk_t * pWrk;
+    DdNode * bPart, * bImage, * bTemp;
+    int i, nParts, fFailed = 0;
+    // split the states
+    Llb_Nonlin4ParSetTimeStop( p );
+    vParts = Llb_Nonlin4ParSplit( p, bCurrent, p->nWorkers );
+    if ( vParts == NULL )
+        return NULL;
+    nParts = Vec_PtrSize(vParts);
+    // update the order of variables in the workers
+    if ( p->nReorders != Cudd_ReadReorderings(p->dd) )
+    {
+        for ( i = 0; i < p->nWorkers; i++ )
+            Cudd_ShuffleHeap( p->pWorkers[i].dd, p->dd->invperm );
+        p->nReorders = Cudd_ReadReorderings(p->dd);
+    }
+    // transfer the parts
+    Vec_PtrForEachEntry( DdNode *, vParts, bPart, i )
+    {
+        pWrk = p->pWorkers + i;
+        pWrk->bImage = NULL;
+        pWrk->bCurrent = Cudd_bddTransfer( p->dd, pWrk->dd, bPart );
+        if ( pWrk->bCurrent == NULL )
+            fFailed = 1;
+        else
+            Cudd_Ref( pWrk->bCurrent );
+    }
+    Llb_Nonlin4Deref( p->dd, vParts );
+    // compute the images
+    if ( !fFailed )
+    {
+#ifdef ABC_USE_PTHREADS
+        pthread_t * pThreads = ABC_ALLOC( pthread_t, nParts );
+        int Status;
+        for ( i = 1; i < nParts; i++ )
+        {
+            Status = pthread_create( pThreads + i, NULL, Llb_Nonlin4ParWorker, (void *)(p->pWorkers + i) );
+            assert( Status == 0 );
+        }
+        Llb_Nonlin4ParWorker( (void *)p->pWorkers );
+        for ( i = 1; i < nParts; i++ )
+            pthread_join( pThreads[i], NULL );
+        ABC_FREE( pThreads );
+#else
+        for ( i = 0; i < nParts; i++ )
+            Llb_Nonlin4ParWorker( (void *)(p->pWorkers + i) );
+#endif
+    }
+    // collect the images
+    Llb_Nonlin4ParSetTimeStop( p );
+    bImage = Cudd_ReadLogicZero( p->dd );  Cudd_Ref( bImage );
+    for ( i = 0; i < nParts; i++ )
+    {
+        pWrk = p->pWorkers + i;
+        if ( !fFailed && pWrk->bImage == NULL )
+            fFailed = 1;
+        if ( !fFailed )
+        {
+            bPart = Cudd_bddTransfer( pWrk->dd, p->dd, pWrk->bImage );
+            if ( bPart == NULL )
+                fFailed = 1;
+            else
+            {
+                Cudd_Ref( bPart );
+                bImage = Cudd_bddOr( p->dd, bTemp = bImage, bPart );
+                if ( bImage == NULL )
+                    bImage = bTemp, fFailed = 1;
+                else
+                {
+                    Cudd_Ref( bImage );
+                    Cudd_RecursiveDeref( p->dd, bTemp );
+                }
+                Cudd_RecursiveDeref( p->dd, bPart );
+            }
+        }
+        if ( pWrk->bImage )
+            Cudd_RecursiveDeref( pWrk->dd, pWrk->bImage );
+        if ( pWrk->bCurrent )
+            Cudd_RecursiveDeref( pWrk->dd, pWrk->bCurrent );
+        pWrk->bImage = pWrk->bCurrent = NULL;
+    }
+    if ( !fFailed )
+    {
+        Cudd_Deref( bImage );
+        return bImage;
+    }
+    Cudd_RecursiveDeref( p->dd, bImage );
+    if ( Llb_Nonlin4ParTimeOut(p) )
+        return NULL;
+    // fall back to the main manager
+    if ( p->fVerbose )
+        printf( "The node budget of the workers is exceeded. Computing the image sequentially.\n" );
+    return Llb_Nonlin4Image( p->dd, vRoots, bCurrent, p->vVars2Q );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
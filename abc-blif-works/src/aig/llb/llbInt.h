@@ -47,6 +47,7 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Llb_Man_t_ Llb_Man_t;
 typedef struct Llb_Mtr_t_ Llb_Mtr_t;
 typedef struct Llb_Grp_t_ Llb_Grp_t;
+typedef struct Llb_Par_t_ Llb_Par_t;
 
 struct Llb_Man_t_
 {
@@ -196,6 +197,12 @@ extern Vec_Ptr_t *     Llb_Nonlin4Group( DdManager * dd, Vec_Ptr_t * vParts, Vec
 //extern Vec_Int_t *     Llb_AigMap( Aig_Man_t * pAig, int nLutSize, int nLutMin );
 /*=== llb4Nonlin.c ======================================================*/
 //extern int             Llb_Nonlin4CoreReach( Aig_Man_t * pAig, Gia_ParLlb_t * pPars );
+extern void            Llb_Nonlin4Deref( DdManager * dd, Vec_Ptr_t * vParts );
+/*=== llb4Par.c =========================================================*/
+extern Llb_Par_t *     Llb_Nonlin4ParStart( DdManager * dd, Vec_Ptr_t * vRoots, Vec_Int_t * vVars2Q, int nThreads, int nNodesMax, int TimeTarget, int fVerbose );
+extern void            Llb_Nonlin4ParStop( Llb_Par_t * p );
+extern int             Llb_Nonlin4ParTimeOut( Llb_Par_t * p );
+extern DdNode *        Llb_Nonlin4ParImage( Llb_Par_t * p, Vec_Ptr_t * vRoots, DdNode * bCurrent );
 /*=== llb4Sweep.c ======================================================*/
 extern void            Llb4_Nonlin4Sweep( Aig_Man_t * pAig, int nSweepMax, int nClusterMax, DdManager ** pdd, Vec_Int_t ** pvOrder, Vec_Ptr_t ** pvGroups, int fVerbose );
  
@@ -63,11 +63,13 @@ struct Saig_ParBmc_t_
     int         nConfLimit;   // maximum number of conflicts at a node
     int         nTimeOut;     // approximate timeout in seconds
     int         nPisAbstract; // the number of PIs to abstract
+    int         nThreads;     // the number of solving threads
     int         fSolveAll;    // does not stop at the first SAT output
     int         fDropSatOuts; // replace sat outputs by constant 0
     int         fVerbose;     // verbose 
     int         iFrame;       // explored up to this frame
     int         nFailOuts;    // the number of failed outputs
+    volatile int * pStop;     // set externally when the engine should stop
 };
  
 typedef struct Saig_ParBbr_t_ Saig_ParBbr_t;
@@ -23,6 +23,10 @@
 #include "cnf.h"
 #include "satStore.h"
 
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -51,7 +55,27 @@ struct Gia_ManBmc_t_
     int               nBufNum;     // the number of simple nodes
     int               nDupNum;     // the number of simple nodes
     char * pSopSizes, ** pSops;    // CNF representation
+    int               fShared;     // the mapping is owned by another manager
 };
+
+typedef struct Saig_Bmc3ThData_t_ Saig_Bmc3ThData_t;
+struct Saig_Bmc3ThData_t_
+{
+    Gia_ManBmc_t *    p;           // the manager of this thread
+    Vec_Int_t *       vOuts;       // the cluster of outputs solved by this thread
+    Abc_Cex_t **      ppCexes;     // counter-examples found in the current frame
+    int *             pStatus;     // status of each output (see below)
+    int               iFrame;      // the current frame
+    int               fUnsat;      // the constraints became UNSAT
+    volatile int      iOutCur;     // the output currently solved by this thread
+    volatile int      Stop;        // set when a smaller output was asserted in this frame
+    volatile int *    piFailMin;   // the smallest output asserted in the current frame
+    Saig_Bmc3ThData_t * pThDatas;  // the data of all threads
+    int               nThreads;    // the number of threads
+};
+
+// the status of an output in the current frame
+enum { SAIG_BMC3_UNDEC = -1, SAIG_BMC3_UNSAT = 0, SAIG_BMC3_SAT = 1, SAIG_BMC3_TRIV = 2, SAIG_BMC3_SOLVED = 3 };
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -596,6 +620,43 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig )
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Create manager sharing the mapping with another manager.]
+
+  Description [The mapping, the sections and the numbering of objects 
+  are not changed while the frames are unrolled, so they are shared by 
+  the managers of the threads. Each manager has its own SAT solver and 
+  its own SAT variables of the timeframes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_ManBmc_t * Saig_Bmc3ManDup( Gia_ManBmc_t * pBase )
+{
+    Gia_ManBmc_t * p;
+    p = ABC_CALLOC( Gia_ManBmc_t, 1 );
+    p->pPars     = pBase->pPars;
+    p->pAig      = pBase->pAig;
+    p->vMapping  = pBase->vMapping;
+    p->vSects    = pBase->vSects;
+    p->vId2Num   = pBase->vId2Num;
+    p->nObjNums  = pBase->nObjNums;
+    p->pSopSizes = pBase->pSopSizes;
+    p->pSops     = pBase->pSops;
+    p->fShared   = 1;
+    p->vPiVars   = Vec_IntAlloc( 1000 );
+    p->vId2Var   = Vec_PtrAlloc( 100 );
+    p->vVisited  = Vec_IntAlloc( 1000 );
+    // create solver
+    p->nSatVars  = 1;
+    p->pSat      = sat_solver_new();
+    sat_solver_setnvars( p->pSat, 1000 );
+    return p;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Delete manager.]
@@ -609,6 +670,16 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig )
 ***********************************************************************/
 void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
 {
+    if ( p->fShared )
+    {
+        assert( p->vCexes == NULL );
+        Vec_IntFree( p->vPiVars );
+        Vec_IntFree( p->vVisited );
+        Vec_VecFree( (Vec_Vec_t *)p->vId2Var );
+        sat_solver_delete( p->pSat );
+        free( p );
+        return;
+    }
     Aig_ManCleanMarkA( p->pAig );
     if ( p->vCexes )
     {
@@ -997,6 +1068,437 @@ int Saig_ManBmcCreateCnf( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
 
 
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the next timeframe to the manager.]
+
+  Description [Returns 0 if the SAT problem became UNSAT after adding 
+  the constraints of this frame.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcAddFrame( Gia_ManBmc_t * p, int f )
+{
+    Aig_Obj_t * pObj;
+    int i, Lit;
+    // resize the array
+    Vec_IntFillExtra( p->vPiVars, (f+1)*Saig_ManPiNum(p->pAig), 0 );
+    // map nodes of this section
+    Vec_PtrPush( p->vId2Var, Vec_IntStartFull(p->nObjNums) );
+/*
+    if ( f > 2*Vec_VecSize(p->vSects) )
+    {
+        int iFrameOld = f - 2*Vec_VecSize( p->vSects );
+        void * pMemory = Vec_IntReleaseArray( Vec_PtrEntry(p->vId2Var, iFrameOld) );
+        ABC_FREE( pMemory );
+    } 
+*/
+    // prepare some nodes
+    Saig_ManBmcSetLiteral( p, Aig_ManConst1(p->pAig), f, 1 );
+    if ( f == 0 )
+        Saig_ManForEachLo( p->pAig, pObj, i )
+            Saig_ManBmcSetLiteral( p, pObj, 0, 0 );
+    // set PIs to zero if they are marked
+    Saig_ManForEachPi( p->pAig, pObj, i )
+        if ( pObj->fMarkA )
+            Saig_ManBmcSetLiteral( p, pObj, f, Aig_ManRandom(0) & 1 );
+    // add the constraints for this frame
+    Saig_ManForEachPo( p->pAig, pObj, i )
+    {
+        if ( i < Saig_ManPoNum(p->pAig) - Saig_ManConstrNum(p->pAig) )
+            continue;            
+        Lit = Saig_ManBmcCreateCnf( p, pObj, f );
+        Lit = lit_neg( Lit );
+        if ( !sat_solver_addclause( p->pSat, &Lit, &Lit + 1 ) )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Clusters the outputs by the overlap of their cones.]
+
+  Description [Computes a 32-bit signature of the sequential support of 
+  each object, by hashing the CIs into the bits and propagating them 
+  through the registers for a few iterations. Then assigns the outputs 
+  one at a time to the cluster whose signature overlaps the most with 
+  the signature of the output, while keeping the clusters of equal size.
+  The outputs of one cluster share most of their unrolled cones, which 
+  keeps the SAT solver of the cluster small.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Saig_ManBmcClusterOutputs( Aig_Man_t * p, int nClusters )
+{
+    Vec_Ptr_t * vClusters;
+    Vec_Int_t * vCluster;
+    Aig_Obj_t * pObj, * pObjLi, * pObjLo;
+    unsigned * pSigns, * pClusSigns, uSign;
+    int nTargets = Saig_ManPoNum(p) - Saig_ManConstrNum(p);
+    int nLimit = (nTargets + nClusters - 1) / nClusters;
+    int i, k, iBest, Cost, CostBest, Iter, fChange;
+    // compute the support signatures
+    pSigns = ABC_CALLOC( unsigned, Aig_ManObjNumMax(p) );
+    Aig_ManForEachPi( p, pObj, i )
+        pSigns[Aig_ObjId(pObj)] = (1 << (i & 31));
+    for ( Iter = 0, fChange = 1; fChange && Iter < 32; Iter++ )
+    {
+        fChange = 0;
+        Aig_ManForEachNode( p, pObj, i )
+            pSigns[Aig_ObjId(pObj)] = pSigns[Aig_ObjFaninId0(pObj)] | pSigns[Aig_ObjFaninId1(pObj)];
+        Aig_ManForEachPo( p, pObj, i )
+            pSigns[Aig_ObjId(pObj)] = pSigns[Aig_ObjFaninId0(pObj)];
+        Saig_ManForEachLiLo( p, pObjLi, pObjLo, i )
+        {
+            uSign = pSigns[Aig_ObjId(pObjLo)] | pSigns[Aig_ObjId(pObjLi)];
+            fChange |= (uSign != pSigns[Aig_ObjId(pObjLo)]);
+            pSigns[Aig_ObjId(pObjLo)] = uSign;
+        }
+    }
+    // assign the outputs to the clusters
+    vClusters = Vec_PtrAlloc( nClusters );
+    for ( k = 0; k < nClusters; k++ )
+        Vec_PtrPush( vClusters, Vec_IntAlloc( nLimit ) );
+    pClusSigns = ABC_CALLOC( unsigned, nClusters );
+    Saig_ManForEachPo( p, pObj, i )
+    {
+        if ( i >= nTargets )
+            break;
+        iBest = -1;
+        CostBest = -1;
+        for ( k = 0; k < nClusters; k++ )
+        {
+            vCluster = (Vec_Int_t *)Vec_PtrEntry( vClusters, k );
+            if ( Vec_IntSize(vCluster) == nLimit )
+                continue;
+            Cost = Aig_WordCountOnes( pClusSigns[k] & pSigns[Aig_ObjId(pObj)] );
+            if ( CostBest < Cost || (CostBest == Cost && 
+                 Vec_IntSize(vCluster) < Vec_IntSize((Vec_Int_t *)Vec_PtrEntry(vClusters, iBest))) )
+            {
+                CostBest = Cost;
+                iBest = k;
+            }
+        }
+        assert( iBest >= 0 );
+        Vec_IntPush( (Vec_Int_t *)Vec_PtrEntry(vClusters, iBest), i );
+        pClusSigns[iBest] |= pSigns[Aig_ObjId(pObj)];
+    }
+    ABC_FREE( pClusSigns );
+    ABC_FREE( pSigns );
+    return vClusters;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Records the output asserted in the current frame.]
+
+  Description [Updates the smallest asserted output and interrupts the
+  threads solving larger outputs. The threads solving smaller outputs
+  continue, because one of them may be asserted too.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Saig_ManBmcThreadsStopAbove( Saig_Bmc3ThData_t * pData, int iPo )
+{
+    int i, iFailMin;
+    while ( (iFailMin = *pData->piFailMin) > iPo )
+        if ( __sync_bool_compare_and_swap( pData->piFailMin, iFailMin, iPo ) )
+            break;
+    iFailMin = *pData->piFailMin;
+    for ( i = 0; i < pData->nThreads; i++ )
+        if ( pData->pThDatas[i].iOutCur > iFailMin )
+            pData->pThDatas[i].Stop = 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Procedure executed by one BMC thread.]
+
+  Description [Adds the current frame to the solver of the thread and 
+  solves the outputs of its cluster in this frame. The outputs of the
+  cluster are solved in increasing order, and the thread quits when
+  a smaller output has been asserted by another thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Saig_ManBmcWorkerThread( void * pArg )
+{
+    Saig_Bmc3ThData_t * pData = (Saig_Bmc3ThData_t *)pArg;
+    Gia_ManBmc_t * p = pData->p;
+    Saig_ParBmc_t * pPars = p->pPars;
+    Aig_Man_t * pAig = p->pAig;
+    int i, iPo, Lit, status, * pModel, f = pData->iFrame;
+    if ( !Saig_ManBmcAddFrame( p, f ) )
+    {
+        pData->fUnsat = 1;
+        return NULL;
+    }
+    if ( pPars->nStart && f < pPars->nStart )
+        return NULL;
+    Vec_IntForEachEntry( pData->vOuts, iPo, i )
+    {
+        if ( pPars->pStop && *pPars->pStop )
+            break;
+        // announce the output before checking the smallest asserted one
+        pData->iOutCur = iPo;
+        __sync_synchronize();
+        if ( iPo > *pData->piFailMin )
+            break;
+        // skip solved outputs
+        if ( pData->pStatus[iPo] == SAIG_BMC3_SOLVED )
+            continue;
+        Lit = Saig_ManBmcCreateCnf( p, Aig_ManPo(pAig, iPo), f );
+        if ( Lit == 0 )
+            continue;
+        if ( Lit == 1 )
+        {
+            pData->ppCexes[iPo] = Abc_CexMakeTriv( Aig_ManRegNum(pAig), Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), f*Saig_ManPoNum(pAig)+iPo );
+            pData->pStatus[iPo] = SAIG_BMC3_TRIV;
+        }
+        else
+        {
+            sat_solver_compress( p->pSat );
+            status = sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+            if ( status == l_False )
+                continue;
+            if ( status == l_Undef )
+            {
+                // the output does not matter if a smaller one was asserted
+                if ( !pData->Stop )
+                    pData->pStatus[iPo] = SAIG_BMC3_UNDEC;
+                break;
+            }
+            pModel = Sat_SolverGetModel( p->pSat, Vec_IntArray(p->vPiVars), Vec_IntSize(p->vPiVars) );
+            pData->ppCexes[iPo] = Abc_CexCreate( Aig_ManRegNum(pAig), Saig_ManPiNum(pAig), pModel, f, iPo, 1 );
+            pData->pStatus[iPo] = SAIG_BMC3_SAT;
+            ABC_FREE( pModel );
+        }
+        // stop the threads solving larger outputs
+        if ( !pPars->fSolveAll )
+        {
+            Saig_ManBmcThreadsStopAbove( pData, iPo );
+            break;
+        }
+    }
+    pData->iOutCur = -1;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bounded model checking engine using several threads.]
+
+  Description [The outputs are clustered by the overlap of their cones 
+  and each cluster is solved by one thread, which unrolls the frames into 
+  its own SAT solver. The static data of the unrolling (the mapping and 
+  the numbering of objects) is computed once and shared by the threads. 
+  The frames are solved in lock-step: the threads are synchronized after 
+  each frame and the results are collected in the order of the outputs, 
+  so the shortest counter-example is always found first. Within a frame,
+  only the threads solving outputs larger than an asserted one are
+  interrupted, so the reported output is the smallest asserted output
+  of the frame, as in the serial engine. The timeout is measured on 
+  the wall clock, because the CPU time returned by clock() grows up to 
+  nThreads times faster when the threads are busy.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Saig_Bmc3ThData_t * pData;
+    pthread_t * pThreads;
+    Vec_Ptr_t * vClusters;
+    Gia_ManBmc_t * p;
+    Abc_Cex_t ** ppCexes;
+    volatile int iFailMin = 0;
+    int nTargets = Saig_ManPoNum(pAig) - Saig_ManConstrNum(pAig);
+    int nOutDigits = Aig_Base10Log( nTargets );
+    int nThreads = Abc_MinInt( pPars->nThreads, nTargets );
+    int * pStatus, RetValue = -1, fUndec;
+    int i, f, Status, clk;
+    abctime TimeLeft, TimeStop, TimeStopWall = 0;
+    double nVars, nClauses, nConfs, nProps;
+    if ( pPars->nTimeOut )
+        TimeStopWall = Abc_ClockTicks(0) + (abctime)pPars->nTimeOut * CLOCKS_PER_SEC;
+    if ( pPars->fVerbose && Aig_ManConstrNum(pAig) > 0 )
+        printf( "Performing BMC with constraints...\n" );
+    vClusters = Saig_ManBmcClusterOutputs( pAig, nThreads );
+    pStatus   = ABC_CALLOC( int, nTargets );
+    ppCexes   = ABC_CALLOC( Abc_Cex_t *, nTargets );
+    pData     = ABC_CALLOC( Saig_Bmc3ThData_t, nThreads );
+    pThreads  = ABC_ALLOC( pthread_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pData[i].p        = i ? Saig_Bmc3ManDup( pData[0].p ) : Saig_Bmc3ManStart( pAig );
+        pData[i].p->pPars = pPars;
+        pData[i].p->pSat->pStop  = &pData[i].Stop;
+        pData[i].p->pSat->pStop2 = pPars->pStop;
+        pData[i].vOuts    = (Vec_Int_t *)Vec_PtrEntry( vClusters, i );
+        pData[i].ppCexes  = ppCexes;
+        pData[i].pStatus  = pStatus;
+        pData[i].piFailMin = &iFailMin;
+        pData[i].pThDatas = pData;
+        pData[i].nThreads = nThreads;
+    }
+    p = pData[0].p;
+    if ( pPars->fVerbose )
+    {
+        printf( "AIG:  PI/PO/Reg = %d/%d/%d.  Node = %6d. Lev = %5d.  Map = %6d. Sect =%3d.\n", 
+            Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), Saig_ManRegNum(pAig),
+            Aig_ManNodeNum(pAig), Aig_ManLevelNum(pAig), (Vec_IntSize(p->vMapping)-Aig_ManObjNumMax(pAig))/5, Vec_VecSize(p->vSects) );
+        printf( "Params: Start = %d. FramesMax = %d. ConfLimit = %d. TimeOut = %d. SolveAll = %d.\n", 
+            pPars->nStart, pPars->nFramesMax, pPars->nConfLimit, pPars->nTimeOut, pPars->fSolveAll );
+        printf( "Solving %d outputs using %d threads. Clusters:", nTargets, nThreads );
+        for ( i = 0; i < nThreads; i++ )
+            printf( " %d", Vec_IntSize(pData[i].vOuts) );
+        printf( ".\n" );
+    } 
+    // perform frames
+    Aig_ManRandom( 1 );
+    for ( f = 0; f < pPars->nFramesMax; f++ )
+    {
+        // stop BMC if requested by another engine
+        if ( pPars->pStop && *pPars->pStop )
+            break;
+        // stop BMC after exploring all reachable states
+        if ( Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
+        {
+            RetValue = pPars->nFailOuts ? 0 : 1;
+            break;
+        }
+        // stop BMC if all targets are solved
+        if ( pPars->fSolveAll && pPars->nFailOuts == nTargets )
+        {
+            RetValue = 0;
+            break;
+        }
+        // consider the next timeframe
+        if ( RetValue == -1 && pPars->nStart == 0 )
+            pPars->iFrame = f;
+        for ( i = 0; i < nTargets; i++ )
+            if ( pStatus[i] != SAIG_BMC3_SOLVED )
+                pStatus[i] = SAIG_BMC3_UNSAT;
+        // the solvers compare their limit with the process CPU time, which
+        // grows up to nThreads times faster than the remaining wall time
+        if ( TimeStopWall )
+        {
+            TimeLeft = TimeStopWall - Abc_ClockTicks(0);
+            if ( TimeLeft < 1 )
+                TimeLeft = 1;
+            TimeStop = (abctime)clock() + TimeLeft * nThreads;
+            for ( i = 0; i < nThreads; i++ )
+                sat_solver_set_runtime_limit( pData[i].p->pSat, TimeStop < 0x7FFFFFFF ? (int)TimeStop : 0x7FFFFFFF );
+        }
+        // solve the outputs of this frame
+        clk = clock(); 
+        iFailMin = nTargets;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            pData[i].iFrame  = f;
+            pData[i].iOutCur = -1;
+            pData[i].Stop    = 0;
+        }
+        for ( i = 1; i < nThreads; i++ )
+        {
+            Status = pthread_create( pThreads + i, NULL, Saig_ManBmcWorkerThread, (void *)(pData + i) );
+            assert( Status == 0 );
+        }
+        Saig_ManBmcWorkerThread( (void *)pData );
+        for ( i = 1; i < nThreads; i++ )
+            pthread_join( pThreads[i], NULL );
+        if ( pData[0].fUnsat )
+        {
+            printf( "SAT problem became UNSAT after adding constraints in frame %d.\n", f );
+            RetValue = 1;
+            break;
+        }
+        // collect the results in the order of outputs
+        fUndec = 0;
+        for ( i = 0; i < nTargets; i++ )
+        {
+            if ( pStatus[i] == SAIG_BMC3_UNDEC )
+                fUndec = 1;
+            if ( pStatus[i] != SAIG_BMC3_SAT && pStatus[i] != SAIG_BMC3_TRIV )
+                continue;
+            if ( !pPars->fSolveAll )
+            {
+                if ( pStatus[i] == SAIG_BMC3_TRIV )
+                    printf( "Output %d is trivially SAT in frame %d.\n", i, f );
+                ABC_FREE( pAig->pSeqModel );
+                pAig->pSeqModel = ppCexes[i];
+                ppCexes[i] = NULL;
+                RetValue = 0;
+                break;
+            }
+            pPars->nFailOuts++;
+            printf( "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",  
+                nOutDigits, i, f, nOutDigits, pPars->nFailOuts, nOutDigits, nTargets );
+            if ( p->vCexes == NULL )
+                p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
+            Vec_PtrWriteEntry( p->vCexes, i, ppCexes[i] );
+            ppCexes[i] = NULL;
+            pStatus[i] = SAIG_BMC3_SOLVED;
+            RetValue = 0;
+        }
+        if ( pPars->fVerbose )
+        {
+            nVars = nClauses = nConfs = nProps = 0;
+            for ( i = 0; i < nThreads; i++ )
+            {
+                nVars    += pData[i].p->nSatVars;
+                nClauses += pData[i].p->pSat->stats.clauses;
+                nConfs   += pData[i].p->pSat->stats.conflicts;
+                nProps   += pData[i].p->pSat->stats.propagations;
+            }
+            printf( "%3d : ", f );
+            printf( "Var =%8.0f. ", nVars );
+            printf( "Cla =%9.0f. ", nClauses );
+            printf( "Conf =%7.0f. ",nConfs );
+            printf( "Imp =%10.0f. ", nProps );
+            ABC_PRT( "Time", clock() - clk );
+            fflush( stdout );
+        }
+        if ( iFailMin < nTargets || fUndec )
+            break;
+        if ( TimeStopWall && Abc_ClockTicks(0) > TimeStopWall )
+        {
+            printf( "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
+            break;
+        }
+    }
+    for ( i = 0; i < nTargets; i++ )
+        if ( ppCexes[i] )
+            Abc_CexFree( ppCexes[i] );
+    for ( i = nThreads - 1; i >= 0; i-- )
+        Saig_Bmc3ManStop( pData[i].p );
+    Vec_VecFree( (Vec_Vec_t *)vClusters );
+    ABC_FREE( ppCexes );
+    ABC_FREE( pStatus );
+    ABC_FREE( pThreads );
+    ABC_FREE( pData );
+    return RetValue;
+}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Procedure used for sorting the nodes in decreasing order of levels.]
@@ -1075,6 +1577,7 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nConfLimit     =  2000;    // maximum number of conflicts at a node
     p->nTimeOut       =     0;    // approximate timeout in seconds
     p->nPisAbstract   =     0;    // the number of PIs to abstract
+    p->nThreads       =     1;    // the number of solving threads
     p->fSolveAll      =     0;    // stops on the first SAT instance
     p->fDropSatOuts   =     0;    // replace sat outputs by constant 0
     p->fVerbose       =     0;    // verbose 
@@ -1100,10 +1603,16 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     int RetValue = -1, fFirst = 1;
     int nOutDigits = Aig_Base10Log( Saig_ManPoNum(pAig) - Saig_ManConstrNum(pAig) );
     int i, f, Lit, status, clk, clk2, clkOther = 0, clkTotal = clock();
+#ifdef ABC_USE_PTHREADS
+    // abstracted PIs are assigned random values in each frame, which is not done by the threads
+    if ( pPars->nThreads > 1 && pPars->nPisAbstract == 0 && Saig_ManPoNum(pAig) - Saig_ManConstrNum(pAig) > 1 )
+        return Saig_ManBmcScalablePar( pAig, pPars );
+#endif
     if ( pPars->fVerbose && Aig_ManConstrNum(pAig) > 0 )
         printf( "Performing BMC with constraints...\n" );
     p = Saig_Bmc3ManStart( pAig );
     p->pPars = pPars;
+    p->pSat->pStop = pPars->pStop;
     if ( pPars->fVerbose )
     {
         printf( "AIG:  PI/PO/Reg = %d/%d/%d.  Node = %6d. Lev = %5d.  Map = %6d. Sect =%3d.\n", 
@@ -1120,6 +1629,12 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     Saig_ManBmcMarkPis( pAig, pPars->nPisAbstract );
     for ( f = 0; f < pPars->nFramesMax; f++ )
     {
+        // stop BMC if requested by another engine
+        if ( pPars->pStop && *pPars->pStop )
+        {
+            Saig_Bmc3ManStop( p );
+            return RetValue;
+        }
         // stop BMC after exploring all reachable states
         if ( Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
         {
@@ -1135,43 +1650,15 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // consider the next timeframe
         if ( RetValue == -1 && pPars->nStart == 0 )
             pPars->iFrame = f;
-        // resize the array
-        Vec_IntFillExtra( p->vPiVars, (f+1)*Saig_ManPiNum(p->pAig), 0 );
-        // map nodes of this section
-        Vec_PtrPush( p->vId2Var, Vec_IntStartFull(p->nObjNums) );
-/*
-        if ( f > 2*Vec_VecSize(p->vSects) )
-        {
-            int iFrameOld = f - 2*Vec_VecSize( p->vSects );
-            void * pMemory = Vec_IntReleaseArray( Vec_PtrEntry(p->vId2Var, iFrameOld) );
-            ABC_FREE( pMemory );
-        } 
-*/
-        // prepare some nodes
-        Saig_ManBmcSetLiteral( p, Aig_ManConst1(pAig), f, 1 );
-        if ( f == 0 )
-            Saig_ManForEachLo( p->pAig, pObj, i )
-                Saig_ManBmcSetLiteral( p, pObj, 0, 0 );
-        // set PIs to zero if they are marked
-        Saig_ManForEachPi( p->pAig, pObj, i )
-            if ( pObj->fMarkA )
-                Saig_ManBmcSetLiteral( p, pObj, f, Aig_ManRandom(0) & 1 );
-        // add the constraints for this frame
-        Saig_ManForEachPo( pAig, pObj, i )
-        {
-            if ( i < Saig_ManPoNum(pAig) - Saig_ManConstrNum(pAig) )
-                continue;            
+        // add the frame and its constraints
 clk2 = clock();
-            Lit = Saig_ManBmcCreateCnf( p, pObj, f );
-            Lit = lit_neg( Lit );
+        status = Saig_ManBmcAddFrame( p, f );
 clkOther += clock() - clk2;
-            status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
-            if ( status == 0 )
-            {
-                printf( "SAT problem became UNSAT after adding constraints in frame %d.\n", f );
-                Saig_Bmc3ManStop( p );
-                return 1;
-            }
+        if ( status == 0 )
+        {
+            printf( "SAT problem became UNSAT after adding constraints in frame %d.\n", f );
+            Saig_Bmc3ManStop( p );
+            return 1;
         }
         if ( pPars->nStart && f < pPars->nStart )
             continue;
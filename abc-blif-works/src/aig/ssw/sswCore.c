@@ -47,6 +47,7 @@ void Ssw_ManSetDefaultParams( Ssw_Pars_t * p )
     memset( p, 0, sizeof(Ssw_Pars_t) );
     p->nPartSize      =       0;  // size of the partition
     p->nOverSize      =       0;  // size of the overlap between partitions
+    p->nThreads       =       1;  // the number of threads solving partitions
     p->nFramesK       =       1;  // the induction depth
     p->nFramesAddSim  =       2;  // additional frames to simulate
     p->fConstrs       =       0;  // treat the last nConstrs POs as seq constraints
@@ -250,6 +251,7 @@ Aig_Man_t * Ssw_SignalCorrespondenceRefine( Ssw_Man_t * p )
     if ( !p->pPars->fLatchCorr )
     { 
         p->pMSat = Ssw_SatStart( 0 );
+        p->pMSat->pSat->pStop = p->pPars->pStop;
         if ( p->pPars->fConstrs ) 
             Ssw_ManSweepBmcConstr( p );
         else
@@ -308,6 +310,7 @@ Aig_Man_t * Ssw_SignalCorrespondenceRefine( Ssw_Man_t * p )
 
 clk = clock();
         p->pMSat = Ssw_SatStart( 0 );
+        p->pMSat->pSat->pStop = p->pPars->pStop;
         if ( p->pPars->fLatchCorrOpt )
         {
             RetValue = Ssw_ManSweepLatch( p );
@@ -449,6 +449,7 @@ p->timeReduce += clock() - clk;
                 p->nRecycleCalls = 0;
             }
             p->pMSat = Ssw_SatStart( 0 );
+            p->pMSat->pSat->pStop = p->pPars->pStop;
             assert( p->nPatterns == 0 );
         }
         // resimulate
@@ -307,6 +307,7 @@ int Ssw_ManSweepLatch( Ssw_Man_t * p )
             p->nCallsMax = ABC_MAX( p->nCallsMax, p->pMSat->nSolverCalls );
             Ssw_SatStop( p->pMSat );
             p->pMSat = Ssw_SatStart( 0 );
+            p->pMSat->pSat->pStop = p->pPars->pStop;
             p->nRecycles++;
             p->nRecycleCalls = 0;
         }
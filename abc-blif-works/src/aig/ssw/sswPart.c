@@ -20,6 +20,10 @@
 
 #include "sswInt.h"
 #include "ioa.h"
+
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -28,13 +32,116 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the result of processing one partition
+typedef struct Ssw_PartRes_t_ Ssw_PartRes_t;
+struct Ssw_PartRes_t_
+{
+    Aig_Man_t *      pTemp;        // the partition with the computed classes
+    int *            pMapBack;     // mapping of partition objects into the original AIG
+    int              nCountPis;    // the number of true PIs
+    int              nCountRegs;   // the number of registers
+    int              nIters;       // the number of iterations performed
+    int              iThread;      // the thread that processed the partition
+    abctime          Time;         // the runtime
+};
+
+// the data of one worker thread
+typedef struct Ssw_PartThData_t_ Ssw_PartThData_t;
+struct Ssw_PartThData_t_
+{
+    Aig_Man_t *      pAig;         // the original AIG (read-only while partitions are solved)
+    Ssw_Pars_t       Pars;         // private copy of the parameters
+    Vec_Ptr_t *      vParts;       // register partitions
+    Ssw_PartRes_t *  pRes;         // results for each partition
+    volatile int *   pNext;        // the next partition to be solved
+    int              iThread;      // the number of this thread
+    int              fVerbose;     // verbose output
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t * pMutex;      // protects the original AIG
+#endif
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
 /**Function*************************************************************
 
-  Synopsis    [Performs partitioned sequential SAT sweeping.]
+  Synopsis    [Computes the classes of one partition.]
+
+  Description [The partition is extracted from the original AIG under
+  the lock because extraction uses the traversal IDs of the original AIG.
+  The classes are left in the partition and transferred later.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ssw_SignalCorrespondencePartOne( Ssw_PartThData_t * pData, int i )
+{
+    Ssw_PartRes_t * pRes = pData->pRes + i;
+    Vec_Int_t * vPart = (Vec_Int_t *)Vec_PtrEntry( pData->vParts, i );
+    Aig_Man_t * pTemp, * pNew;
+    abctime clk = Abc_ClockTicks( 1 );
+#ifdef ABC_USE_PTHREADS
+    if ( pData->pMutex )
+        pthread_mutex_lock( pData->pMutex );
+#endif
+    pTemp = Aig_ManRegCreatePart( pData->pAig, vPart, &pRes->nCountPis, &pRes->nCountRegs, &pRes->pMapBack );
+    Aig_ManSetRegNum( pTemp, pTemp->nRegs );
+    // create the projection of 1-hot registers
+    if ( pData->pAig->vOnehots )
+        pTemp->vOnehots = Aig_ManRegProjectOnehots( pData->pAig, pTemp, pData->pAig->vOnehots, pData->fVerbose );
+#ifdef ABC_USE_PTHREADS
+    if ( pData->pMutex )
+        pthread_mutex_unlock( pData->pMutex );
+#endif
+    // run SSW
+    if ( pRes->nCountPis > 0 )
+    {
+        pNew = Ssw_SignalCorrespondence( pTemp, &pData->Pars );
+        pRes->nIters = pData->Pars.nIters;
+        Aig_ManStop( pNew );
+    }
+    pRes->pTemp   = pTemp;
+    pRes->iThread = pData->iThread;
+    pRes->Time    = Abc_ClockTicks( 1 ) - clk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Procedure executed by one worker thread.]
+
+  Description [Takes the next unsolved partition until all partitions
+  are solved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Ssw_SignalCorrespondencePartThread( void * pArg )
+{
+    Ssw_PartThData_t * pData = (Ssw_PartThData_t *)pArg;
+    int i;
+    while ( 1 )
+    {
+#ifdef ABC_USE_PTHREADS
+        i = __sync_fetch_and_add( pData->pNext, 1 );
+#else
+        i = (*pData->pNext)++;
+#endif
+        if ( i >= Vec_PtrSize(pData->vParts) )
+            break;
+        Ssw_SignalCorrespondencePartOne( pData, i );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the partitions using several threads.]
 
   Description []
                
@@ -42,6 +149,63 @@ ABC_NAMESPACE_IMPL_START
 
   SeeAlso     []
 
+***********************************************************************/
+static void Ssw_SignalCorrespondencePartRun( Aig_Man_t * pAig, Ssw_Pars_t * pPars, Vec_Ptr_t * vParts, Ssw_PartRes_t * pRes, int nThreads, int fVerbose )
+{
+    Ssw_PartThData_t * pData;
+    volatile int iNext = 0;
+    int i;
+    pData = ABC_CALLOC( Ssw_PartThData_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pData[i].pAig     = pAig;
+        pData[i].Pars     = *pPars;
+        pData[i].vParts   = vParts;
+        pData[i].pRes     = pRes;
+        pData[i].pNext    = &iNext;
+        pData[i].iThread  = i;
+        pData[i].fVerbose = fVerbose;
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t * pThreads = ABC_ALLOC( pthread_t, nThreads );
+        pthread_mutex_t Mutex;
+        int Status;
+        pthread_mutex_init( &Mutex, NULL );
+        for ( i = 0; i < nThreads; i++ )
+            pData[i].pMutex = &Mutex;
+        for ( i = 1; i < nThreads; i++ )
+        {
+            Status = pthread_create( pThreads + i, NULL, Ssw_SignalCorrespondencePartThread, (void *)(pData + i) );
+            assert( Status == 0 );
+        }
+        Ssw_SignalCorrespondencePartThread( (void *)pData );
+        for ( i = 1; i < nThreads; i++ )
+            pthread_join( pThreads[i], NULL );
+        pthread_mutex_destroy( &Mutex );
+        ABC_FREE( pThreads );
+        ABC_FREE( pData );
+        return;
+    }
+#endif
+    Ssw_SignalCorrespondencePartThread( (void *)pData );
+    ABC_FREE( pData );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs partitioned sequential SAT sweeping.]
+
+  Description [The partitions are solved by a pool of pPars->nThreads
+  threads. When all of them are solved, their equivalence classes are
+  merged into the original AIG in the order of partitions, so that the
+  result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
 ***********************************************************************/
 Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
 {
@@ -50,8 +214,10 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
     Aig_Man_t * pTemp, * pNew;
     Vec_Ptr_t * vResult;
     Vec_Int_t * vPart;
-    int * pMapBack;
-    int i, nCountPis, nCountRegs;
+    Ssw_PartRes_t * pRes;
+    abctime * pTimes, TimeMax, TimeAll;
+    int * pCounts;
+    int i, nCountPis, nCountRegs, nThreads;
     int nClasses, nPartSize, fVerbose;
     int clk = clock();
     if ( pPars->fConstrs )
@@ -96,26 +262,57 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
     }
 
     // perform SSW with partitions
+    nThreads = Abc_MinInt( Abc_MaxInt(pPars->nThreads, 1), Abc_MaxInt(Vec_PtrSize(vResult), 1) );
+#ifndef ABC_USE_PTHREADS
+    nThreads = 1;
+#endif
+    pRes = ABC_CALLOC( Ssw_PartRes_t, Vec_PtrSize(vResult) );
+    Ssw_SignalCorrespondencePartRun( pAig, pPars, vResult, pRes, nThreads, fVerbose );
+    // merge the classes in the order of partitions
     Aig_ManReprStart( pAig, Aig_ManObjNumMax(pAig) );
     Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
     {
-        pTemp = Aig_ManRegCreatePart( pAig, vPart, &nCountPis, &nCountRegs, &pMapBack );
-        Aig_ManSetRegNum( pTemp, pTemp->nRegs );
-        // create the projection of 1-hot registers
-        if ( pAig->vOnehots )
-            pTemp->vOnehots = Aig_ManRegProjectOnehots( pAig, pTemp, pAig->vOnehots, fVerbose );
-        // run SSW
-        if (nCountPis>0) {
-            pNew = Ssw_SignalCorrespondence( pTemp, pPars );
-            nClasses = Aig_TransferMappedClasses( pAig, pTemp, pMapBack );
+        pTemp = pRes[i].pTemp;
+        if ( pRes[i].nCountPis > 0 )
+        {
+            nClasses = Aig_TransferMappedClasses( pAig, pTemp, pRes[i].pMapBack );
             if ( fVerbose )
-                printf( "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n", 
-                    i, Vec_IntSize(vPart), Aig_ManPiNum(pTemp)-Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp), pPars->nIters, nClasses );
-            Aig_ManStop( pNew );
+            {
+                printf( "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.", 
+                    i, Vec_IntSize(vPart), Aig_ManPiNum(pTemp)-Vec_IntSize(vPart), pRes[i].nCountPis, pRes[i].nCountRegs, Aig_ManNodeNum(pTemp), pRes[i].nIters, nClasses );
+                if ( nThreads > 1 )
+                    printf( " Th = %2d. Time = %7.2f sec", pRes[i].iThread, 1.0*pRes[i].Time/CLOCKS_PER_SEC );
+                printf( "\n" );
+            }
         }
         Aig_ManStop( pTemp );
-        ABC_FREE( pMapBack );
+        ABC_FREE( pRes[i].pMapBack );
+    }
+    // report the load balance
+    if ( fVerbose && nThreads > 1 )
+    {
+        pTimes  = ABC_CALLOC( abctime, nThreads );
+        pCounts = ABC_CALLOC( int, nThreads );
+        for ( i = 0; i < Vec_PtrSize(vResult); i++ )
+        {
+            pTimes[pRes[i].iThread] += pRes[i].Time;
+            pCounts[pRes[i].iThread]++;
+        }
+        TimeMax = TimeAll = 0;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            printf( "Thread %2d : Parts = %4d. ", i, pCounts[i] );
+            ABC_PRT( "Time", pTimes[i] );
+            if ( TimeMax < pTimes[i] )
+                TimeMax = pTimes[i];
+            TimeAll += pTimes[i];
+        }
+        printf( "Load balance = %.2f (the ratio of the average to the max thread time).\n", 
+            TimeMax ? 1.0*TimeAll/nThreads/TimeMax : 1.0 );
+        ABC_FREE( pTimes );
+        ABC_FREE( pCounts );
     }
+    ABC_FREE( pRes );
     // remap the AIG
     pNew = Aig_ManDupRepr( pAig, 0 );
     Aig_ManSeqCleanup( pNew );
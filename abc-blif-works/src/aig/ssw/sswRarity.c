@@ -20,6 +20,11 @@
 
 #include "sswInt.h"
 #include "giaAig.h"
+
+#ifdef ABC_USE_AVX
+#include <immintrin.h>
+#define SSW_RAR_USE_SIMD
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -38,6 +43,7 @@ struct Ssw_RarMan_t_
     int            fVerbose;     // the verbosiness flag
     int            nGroups;      // the number of flop groups
     int            nWordsReg;    // the number of words in the registers
+    int            Kernel;       // vector kernel (0 = 64-bit, 1 = AVX2, 2 = AVX-512)
     // internal data
     Aig_Man_t *    pAig;         // AIG with equivalence classes
     Ssw_Cla_t *    ppClasses;    // equivalence classes
@@ -317,9 +323,40 @@ void TransposeTest()
 */
 }
 
+#ifdef SSW_RAR_USE_SIMD
+
 /**Function*************************************************************
 
-  Synopsis    [Transposing pObjData[ nRegs x nWords ] -> pPatData[ nWords x nRegs ].]
+  Synopsis    [Transposing four 64-bit matrices at once using AVX2.]
+
+  Description [Lane l of M[i] is row i of the l-th matrix. Performs the
+  same butterfly network as transpose64() on all lanes in parallel.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline __attribute__((target("avx2"))) void transpose64Avx2( __m256i M[64] )
+{
+    __m256i t, m = _mm256_set1_epi64x( 0x00000000FFFFFFFF );
+    __m128i s;
+    int j, k;
+    for ( j = 32; j != 0; j = j >> 1, m = _mm256_xor_si256(m, _mm256_sll_epi64(m, _mm_cvtsi32_si128(j))) )
+    {
+        s = _mm_cvtsi32_si128( j );
+        for ( k = 0; k < 64; k = (k + j + 1) & ~j )
+        {
+            t = _mm256_and_si256( _mm256_xor_si256(M[k], _mm256_srl_epi64(M[k+j], s)), m );
+            M[k]   = _mm256_xor_si256( M[k], t );
+            M[k+j] = _mm256_xor_si256( M[k+j], _mm256_sll_epi64(t, s) );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transposing eight 64-bit matrices at once using AVX-512.]
 
   Description []
                
@@ -327,13 +364,140 @@ void TransposeTest()
 
   SeeAlso     []
 
+***********************************************************************/
+static inline __attribute__((target("avx512f"))) void transpose64Avx512( __m512i M[64] )
+{
+    __m512i t, m = _mm512_set1_epi64( 0x00000000FFFFFFFF );
+    __m128i s;
+    int j, k;
+    for ( j = 32; j != 0; j = j >> 1, m = _mm512_xor_si512(m, _mm512_sll_epi64(m, _mm_cvtsi32_si128(j))) )
+    {
+        s = _mm_cvtsi32_si128( j );
+        for ( k = 0; k < 64; k = (k + j + 1) & ~j )
+        {
+            t = _mm512_and_si512( _mm512_xor_si512(M[k], _mm512_srl_epi64(M[k+j], s)), m );
+            M[k]   = _mm512_xor_si512( M[k], t );
+            M[k+j] = _mm512_xor_si512( M[k+j], _mm512_sll_epi64(t, s) );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transposes register data for four words at a time using AVX2.]
+
+  Description [Consecutive simulation words of a register are loaded
+  as one vector, so four blocks of 64 patterns are transposed together.
+  Returns the number of words processed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static __attribute__((target("avx2"))) int Ssw_RarTransposeAvx2( Ssw_RarMan_t * p )
+{
+    Aig_Obj_t * pObj;
+    __m256i M[64];
+    word Buf[4];
+    int w, r, i, l;
+    for ( w = 0; w + 4 <= p->nWords; w += 4 )
+    for ( r = 0; r < p->nWordsReg; r++ )
+    {
+        // save input
+        for ( i = 0; i < 64; i++ )
+        {
+            if ( r*64 + 63-i < Aig_ManRegNum(p->pAig) )
+            {
+                pObj = Saig_ManLi( p->pAig, r*64 + 63-i );
+                M[i] = _mm256_loadu_si256( (__m256i *)(Ssw_RarObjSim( p, Aig_ObjId(pObj) ) + w) );
+            }
+            else
+                M[i] = _mm256_setzero_si256();
+        }
+        // transpose
+        transpose64Avx2( M );
+        // save output
+        for ( i = 0; i < 64; i++ )
+        {
+            _mm256_storeu_si256( (__m256i *)Buf, M[i] );
+            for ( l = 0; l < 4; l++ )
+                Ssw_RarPatSim( p, (w+l)*64 + 63-i )[r] = Buf[l];
+        }
+    }
+    return w;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transposes register data for eight words at a time using AVX-512.]
+
+  Description [Returns the number of words processed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static __attribute__((target("avx512f"))) int Ssw_RarTransposeAvx512( Ssw_RarMan_t * p )
+{
+    Aig_Obj_t * pObj;
+    __m512i M[64];
+    word Buf[8];
+    int w, r, i, l;
+    for ( w = 0; w + 8 <= p->nWords; w += 8 )
+    for ( r = 0; r < p->nWordsReg; r++ )
+    {
+        // save input
+        for ( i = 0; i < 64; i++ )
+        {
+            if ( r*64 + 63-i < Aig_ManRegNum(p->pAig) )
+            {
+                pObj = Saig_ManLi( p->pAig, r*64 + 63-i );
+                M[i] = _mm512_loadu_si512( (void *)(Ssw_RarObjSim( p, Aig_ObjId(pObj) ) + w) );
+            }
+            else
+                M[i] = _mm512_setzero_si512();
+        }
+        // transpose
+        transpose64Avx512( M );
+        // save output
+        for ( i = 0; i < 64; i++ )
+        {
+            _mm512_storeu_si512( (void *)Buf, M[i] );
+            for ( l = 0; l < 8; l++ )
+                Ssw_RarPatSim( p, (w+l)*64 + 63-i )[r] = Buf[l];
+        }
+    }
+    return w;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Transposing pObjData[ nRegs x nWords ] -> pPatData[ nWords x nRegs ].]
+
+  Description [Uses the vector kernel for as many words as possible
+  and finishes the remaining words one at a time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
 ***********************************************************************/
 void Ssw_RarTranspose( Ssw_RarMan_t * p )
 {
     Aig_Obj_t * pObj;
     word M[64];
-    int w, r, i;
-    for ( w = 0; w < p->nWords; w++ )
+    int w = 0, r, i;
+#ifdef SSW_RAR_USE_SIMD
+    if ( p->Kernel == 2 )
+        w = Ssw_RarTransposeAvx512( p );
+    else if ( p->Kernel == 1 )
+        w = Ssw_RarTransposeAvx2( p );
+#endif
+    for ( ; w < p->nWords; w++ )
     for ( r = 0; r < p->nWordsReg; r++ )
     {
         // save input
@@ -562,7 +726,7 @@ int Ssw_RarManCheckNonConstOutputs( Ssw_RarMan_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    [Performs one round of simulation.]
+  Synopsis    [Simulates internal nodes using 64-bit words.]
 
   Description []
                
@@ -570,12 +734,120 @@ int Ssw_RarManCheckNonConstOutputs( Ssw_RarMan_t * p )
 
   SeeAlso     []
 
+***********************************************************************/
+static void Ssw_RarManSimulateNodes( Ssw_RarMan_t * p )
+{
+    Aig_Obj_t * pObj;
+    word * pSim, * pSim0, * pSim1;
+    word Flip0, Flip1;
+    int w, i;
+    Aig_ManForEachNode( p->pAig, pObj, i )
+    {
+        pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
+        pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
+        pSim1 = Ssw_RarObjSim( p, Aig_ObjFaninId1(pObj) );
+        Flip0 = Aig_ObjFaninC0(pObj) ? ~0 : 0;
+        Flip1 = Aig_ObjFaninC1(pObj) ? ~0 : 0;
+        for ( w = 0; w < p->nWords; w++ )
+            pSim[w] = (Flip0 ^ pSim0[w]) & (Flip1 ^ pSim1[w]);
+    }
+}
+
+#ifdef SSW_RAR_USE_SIMD
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates internal nodes using AVX2 instructions.]
+
+  Description [Processes four words at a time and the remaining words
+  of each node one at a time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static __attribute__((target("avx2"))) void Ssw_RarManSimulateNodesAvx2( Ssw_RarMan_t * p )
+{
+    Aig_Obj_t * pObj;
+    word * pSim, * pSim0, * pSim1;
+    word Flip0, Flip1;
+    __m256i Mask0, Mask1;
+    int w, i, nVecs = p->nWords / 4;
+    Aig_ManForEachNode( p->pAig, pObj, i )
+    {
+        pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
+        pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
+        pSim1 = Ssw_RarObjSim( p, Aig_ObjFaninId1(pObj) );
+        Flip0 = Aig_ObjFaninC0(pObj) ? ~(word)0 : 0;
+        Flip1 = Aig_ObjFaninC1(pObj) ? ~(word)0 : 0;
+        Mask0 = _mm256_set1_epi64x( (long long)Flip0 );
+        Mask1 = _mm256_set1_epi64x( (long long)Flip1 );
+        for ( w = 0; w < nVecs; w++ )
+            _mm256_storeu_si256( (__m256i *)pSim + w, _mm256_and_si256(
+                _mm256_xor_si256( _mm256_loadu_si256((__m256i *)pSim0 + w), Mask0 ),
+                _mm256_xor_si256( _mm256_loadu_si256((__m256i *)pSim1 + w), Mask1 ) ) );
+        for ( w = 4 * nVecs; w < p->nWords; w++ )
+            pSim[w] = (Flip0 ^ pSim0[w]) & (Flip1 ^ pSim1[w]);
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates internal nodes using AVX-512 instructions.]
+
+  Description [Processes eight words at a time and the remaining words
+  of each node one at a time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static __attribute__((target("avx512f"))) void Ssw_RarManSimulateNodesAvx512( Ssw_RarMan_t * p )
+{
+    Aig_Obj_t * pObj;
+    word * pSim, * pSim0, * pSim1;
+    word Flip0, Flip1;
+    __m512i Mask0, Mask1;
+    int w, i, nVecs = p->nWords / 8;
+    Aig_ManForEachNode( p->pAig, pObj, i )
+    {
+        pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
+        pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
+        pSim1 = Ssw_RarObjSim( p, Aig_ObjFaninId1(pObj) );
+        Flip0 = Aig_ObjFaninC0(pObj) ? ~(word)0 : 0;
+        Flip1 = Aig_ObjFaninC1(pObj) ? ~(word)0 : 0;
+        Mask0 = _mm512_set1_epi64( (long long)Flip0 );
+        Mask1 = _mm512_set1_epi64( (long long)Flip1 );
+        for ( w = 0; w < nVecs; w++ )
+            _mm512_storeu_si512( (void *)((__m512i *)pSim + w), _mm512_and_si512(
+                _mm512_xor_si512( _mm512_loadu_si512((void *)((__m512i *)pSim0 + w)), Mask0 ),
+                _mm512_xor_si512( _mm512_loadu_si512((void *)((__m512i *)pSim1 + w)), Mask1 ) ) );
+        for ( w = 8 * nVecs; w < p->nWords; w++ )
+            pSim[w] = (Flip0 ^ pSim0[w]) & (Flip1 ^ pSim1[w]);
+    }
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of simulation.]
+
+  Description [Internal nodes are simulated first by the vector kernel.
+  The equivalence classes are checked afterwards in the same order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
 ***********************************************************************/
 void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int fFirst )
 {
     Aig_Obj_t * pObj, * pRepr;
-    word * pSim, * pSim0, * pSim1;
-    word Flip, Flip0, Flip1;
+    word * pSim, * pSim0;
+    word Flip;
     int w, i;
     // initialize 
     Ssw_RarManInitialize( p, vInit );
@@ -601,30 +873,32 @@ void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int f
         }
     }
     // simulate 
-    Aig_ManForEachNode( p->pAig, pObj, i )
+#ifdef SSW_RAR_USE_SIMD
+    if ( p->Kernel == 2 )
+        Ssw_RarManSimulateNodesAvx512( p );
+    else if ( p->Kernel == 1 )
+        Ssw_RarManSimulateNodesAvx2( p );
+    else
+#endif
+    Ssw_RarManSimulateNodes( p );
+    // check classes
+    if ( fUpdate )
     {
-        pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
-        pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
-        pSim1 = Ssw_RarObjSim( p, Aig_ObjFaninId1(pObj) );
-        Flip0 = Aig_ObjFaninC0(pObj) ? ~0 : 0;
-        Flip1 = Aig_ObjFaninC1(pObj) ? ~0 : 0;
-        for ( w = 0; w < p->nWords; w++ )
-            pSim[w] = (Flip0 ^ pSim0[w]) & (Flip1 ^ pSim1[w]);
-        if ( !fUpdate )
-            continue;
-        // check classes
-        pRepr = Aig_ObjRepr(p->pAig, pObj);
-        if ( pRepr == NULL || Aig_ObjIsTravIdCurrent( p->pAig, pRepr ) )
-            continue;
-        if ( Ssw_RarManObjsAreEqual( p, pObj, pRepr ) )
-            continue;
-        // save for update
-        if ( pRepr == Aig_ManConst1(p->pAig) )
-            Vec_PtrPush( p->vUpdConst, pObj );
-        else
+        Aig_ManForEachNode( p->pAig, pObj, i )
         {
-            Vec_PtrPush( p->vUpdClass, pRepr );
-            Aig_ObjSetTravIdCurrent( p->pAig, pRepr );
+            pRepr = Aig_ObjRepr(p->pAig, pObj);
+            if ( pRepr == NULL || Aig_ObjIsTravIdCurrent( p->pAig, pRepr ) )
+                continue;
+            if ( Ssw_RarManObjsAreEqual( p, pObj, pRepr ) )
+                continue;
+            // save for update
+            if ( pRepr == Aig_ManConst1(p->pAig) )
+                Vec_PtrPush( p->vUpdConst, pObj );
+            else
+            {
+                Vec_PtrPush( p->vUpdClass, pRepr );
+                Aig_ObjSetTravIdCurrent( p->pAig, pRepr );
+            }
         }
     }
     // transfer to POs
@@ -684,6 +958,7 @@ static Ssw_RarMan_t * Ssw_RarManStart( Aig_Man_t * pAig, int nWords, int nFrames
     p->pRarity   = ABC_CALLOC( int, (1 << nBinSize) * p->nGroups );
     p->pPatCosts = ABC_CALLOC( double, p->nWords * 64 );
     p->nWordsReg = Ssw_RarBitWordNum( Aig_ManRegNum(pAig) );
+    p->Kernel    = Abc_CpuVectorKernel();
     p->pObjData  = ABC_ALLOC( word, Aig_ManObjNumMax(pAig) * p->nWords );
     p->pPatData  = ABC_ALLOC( word, 64 * p->nWords * p->nWordsReg );
     p->vUpdConst = Vec_PtrAlloc( 100 );
@@ -717,6 +992,118 @@ static void Ssw_RarManStop( Ssw_RarMan_t * p )
     ABC_FREE( p );
 }
 
+#ifdef SSW_RAR_USE_SIMD
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the bin counters using AVX-512 gather/scatter.]
+
+  Description [For one pattern, the values of sixteen different groups
+  always fall into sixteen different bins, so the scatter is free of
+  conflicts. Assumes that each group has eight flops.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static __attribute__((target("avx512f"))) void Ssw_RarManCountAvx512( Ssw_RarMan_t * p )
+{
+    unsigned char * pData;
+    __m512i Iota = _mm512_set_epi32( 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 );
+    __m512i One  = _mm512_set1_epi32( 1 );
+    __m512i Index, Value;
+    int i, k;
+    assert( p->nBinSize == 8 );
+    for ( k = 0; k < p->nWords * 64; k++ )
+    {
+        pData = (unsigned char *)Ssw_RarPatSim( p, k );
+        for ( i = 0; i + 16 <= p->nGroups; i += 16 )
+        {
+            Index = _mm512_slli_epi32( _mm512_add_epi32(_mm512_set1_epi32(i), Iota), 8 );
+            Index = _mm512_add_epi32( Index, _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i *)(pData + i))) );
+            Value = _mm512_i32gather_epi32( Index, p->pRarity, 4 );
+            _mm512_i32scatter_epi32( p->pRarity, Index, _mm512_add_epi32(Value, One), 4 );
+        }
+        for ( ; i < p->nGroups; i++ )
+            Ssw_RarAddToBinPat( p, i, pData[i] );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the pattern costs for four patterns at a time using AVX2.]
+
+  Description [Each lane accumulates the cost of one pattern in the same
+  order as the scalar code, so the costs are identical.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static __attribute__((target("avx2"))) void Ssw_RarManCostsAvx2( Ssw_RarMan_t * p )
+{
+    unsigned char * pData[4];
+    __m256d Cost, One = _mm256_set1_pd( 1.0 );
+    __m128i Value;
+    int i, k, l;
+    assert( (p->nWords * 64) % 4 == 0 );
+    for ( k = 0; k < p->nWords * 64; k += 4 )
+    {
+        for ( l = 0; l < 4; l++ )
+            pData[l] = (unsigned char *)Ssw_RarPatSim( p, k + l );
+        Cost = _mm256_setzero_pd();
+        for ( i = 0; i < p->nGroups; i++ )
+        {
+            Value = _mm_set_epi32( pData[3][i], pData[2][i], pData[1][i], pData[0][i] );
+            Value = _mm_add_epi32( Value, _mm_set1_epi32(i << p->nBinSize) );
+            Value = _mm_i32gather_epi32( p->pRarity, Value, 4 );
+            Value = _mm_mullo_epi32( Value, Value );
+            Cost  = _mm256_add_pd( Cost, _mm256_div_pd(One, _mm256_cvtepi32_pd(Value)) );
+        }
+        _mm256_storeu_pd( p->pPatCosts + k, Cost );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the pattern costs for eight patterns at a time using AVX-512.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static __attribute__((target("avx512f"))) void Ssw_RarManCostsAvx512( Ssw_RarMan_t * p )
+{
+    unsigned char * pData[8];
+    __m512d Cost, One = _mm512_set1_pd( 1.0 );
+    __m256i Value;
+    int i, k, l;
+    assert( (p->nWords * 64) % 8 == 0 );
+    for ( k = 0; k < p->nWords * 64; k += 8 )
+    {
+        for ( l = 0; l < 8; l++ )
+            pData[l] = (unsigned char *)Ssw_RarPatSim( p, k + l );
+        Cost = _mm512_setzero_pd();
+        for ( i = 0; i < p->nGroups; i++ )
+        {
+            Value = _mm256_set_epi32( pData[7][i], pData[6][i], pData[5][i], pData[4][i], 
+                                      pData[3][i], pData[2][i], pData[1][i], pData[0][i] );
+            Value = _mm256_add_epi32( Value, _mm256_set1_epi32(i << p->nBinSize) );
+            Value = _mm256_i32gather_epi32( p->pRarity, Value, 4 );
+            Value = _mm256_mullo_epi32( Value, Value );
+            Cost  = _mm512_add_pd( Cost, _mm512_div_pd(One, _mm512_cvtepi32_pd(Value)) );
+        }
+        _mm512_storeu_pd( p->pPatCosts + k, Cost );
+    }
+}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Select best patterns.]
@@ -739,6 +1126,11 @@ static void Ssw_RarTransferPatterns( Ssw_RarMan_t * p, Vec_Int_t * vInits )
     Ssw_RarTranspose( p );
 
     // update counters
+#ifdef SSW_RAR_USE_SIMD
+    if ( p->Kernel == 2 && p->nBinSize == 8 )
+        Ssw_RarManCountAvx512( p );
+    else
+#endif
     for ( k = 0; k < p->nWords * 64; k++ )
     {
         pData = (unsigned char *)Ssw_RarPatSim( p, k );
@@ -747,6 +1139,13 @@ static void Ssw_RarTransferPatterns( Ssw_RarMan_t * p, Vec_Int_t * vInits )
     }
 
     // for each pattern
+#ifdef SSW_RAR_USE_SIMD
+    if ( p->Kernel == 2 )
+        Ssw_RarManCostsAvx512( p );
+    else if ( p->Kernel == 1 )
+        Ssw_RarManCostsAvx2( p );
+    else
+#endif
     for ( k = 0; k < p->nWords * 64; k++ )
     {
         pData = (unsigned char *)Ssw_RarPatSim( p, k );
@@ -960,6 +1359,67 @@ finish:
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Microbenchmark of the rarity simulation kernels.]
+
+  Description [Runs the same simulation rounds with each vector kernel
+  supported by the CPU, starting from the same random seed. Reports
+  the runtime of node simulation, of the register transposition, and
+  of the pattern selection (transposition, bin counting, and costs), and
+  checks that every kernel selects the same patterns as the 64-bit one.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ssw_RarSimulateBench( Aig_Man_t * pAig, int nFrames, int nWords, int nBinSize, int nRounds, int nRandSeed )
+{
+    char * pNames[3] = { "64-bit", "AVX2", "AVX-512" };
+    Ssw_RarMan_t * p;
+    Vec_Int_t * vBests = NULL;
+    int clkSim[3] = {0}, clkTra[3] = {0}, clkSel[3] = {0};
+    int k, r, f, clk, nKernels = Abc_CpuVectorKernel() + 1;
+    assert( Aig_ManRegNum(pAig) > 0 );
+    printf( "Benchmarking %d rounds of %d frames with %d words (%d patterns) for AIG with %d nodes and %d flops.\n", 
+        nRounds, nFrames, nWords, 64 * nWords, Aig_ManNodeNum(pAig), Aig_ManRegNum(pAig) );
+    for ( k = 0; k < nKernels; k++ )
+    {
+        Ssw_RarManPrepareRandom( nRandSeed );
+        p = Ssw_RarManStart( pAig, nWords, nFrames, nBinSize, 0 );
+        p->Kernel = k;
+        p->vInits = Vec_IntStart( Aig_ManRegNum(pAig) * nWords );
+        for ( r = 0; r < nRounds; r++ )
+        {
+            clk = clock();
+            for ( f = 0; f < nFrames; f++ )
+                Ssw_RarManSimulate( p, f ? NULL : p->vInits, 0, 0 );
+            clkSim[k] += clock() - clk;
+            clk = clock();
+            Ssw_RarTranspose( p );
+            clkTra[k] += clock() - clk;
+            clk = clock();
+            Ssw_RarTransferPatterns( p, p->vInits );
+            clkSel[k] += clock() - clk;
+        }
+        // compare the selected patterns with those of the 64-bit kernel
+        if ( vBests == NULL )
+            vBests = Vec_IntDup( p->vPatBests );
+        else if ( Vec_IntSize(vBests) != Vec_IntSize(p->vPatBests) || 
+                  memcmp( Vec_IntArray(vBests), Vec_IntArray(p->vPatBests), sizeof(int) * Vec_IntSize(vBests) ) )
+            printf( "Kernel %s selected different patterns than kernel %s.\n", pNames[k], pNames[0] );
+        Ssw_RarManStop( p );
+        printf( "%-8s : ", pNames[k] );
+        printf( "Sim =%8.3f sec (%8.2f Mpat*frames/sec)  ", 1.0*clkSim[k]/CLOCKS_PER_SEC, 
+            clkSim[k] ? 64.0 * nWords * nFrames * nRounds * CLOCKS_PER_SEC / clkSim[k] / 1000000 : 0.0 );
+        printf( "Transpose =%7.3f sec  ", 1.0*clkTra[k]/CLOCKS_PER_SEC );
+        printf( "Select =%7.3f sec  ", 1.0*clkSel[k]/CLOCKS_PER_SEC );
+        printf( "Speedup =%6.2f\n", clkSim[k]+clkSel[k] ? 1.0*(clkSim[0]+clkSel[0])/(clkSim[k]+clkSel[k]) : 0.0 );
+    }
+    Vec_IntFree( vBests );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Perform sequential simulation.]
@@ -147,12 +147,13 @@ struct Abc_Obj_t_ // 12 words
     // connectivity
     Vec_Int_t         vFanins;       // the array of fanins
     Vec_Int_t         vFanouts;      // the array of fanouts
+    int               pFanBuf[2];    // the inline storage of the first two fanins
     // miscellaneous
     union {
         void *        pData;         // the network specific data (SOP, BDD, gate, equiv class, etc)
         int           iData;
     };
-    Abc_Obj_t *       pNext;         // the next pointer in the hash table
+    Abc_Obj_t *       pNext;         // the next pointer in the temporary lists
     union {                          // temporary store for user's data
         Abc_Obj_t *   pCopy;         // the copy of this object
         void *        pTemp;
@@ -187,6 +188,7 @@ struct Abc_Ntk_t_
     // the backup network and the step number
     Abc_Ntk_t *       pNetBackup;    // the pointer to the previous backup network
     int               iStep;         // the generation number for the given network
+    Vec_Int_t *       vImage;        // the compact image of the backup network (if not kept as objects)
     // hierarchy
     Abc_Lib_t *       pDesign;
     short             fHieVisited;   // flag to mark the visited network
@@ -800,6 +802,7 @@ extern ABC_DLL int                Abc_NtkRefactor( Abc_Ntk_t * pNtk, int nNodeSi
 extern ABC_DLL int                Abc_NtkRewrite( Abc_Ntk_t * pNtk, int fUpdateLevel, int fUseZeros, int fVerbose, int fVeryVerbose, int fPlaceEnable );
 /*=== abcSat.c ==========================================================*/
 extern ABC_DLL int                Abc_NtkMiterSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int fVerbose, ABC_INT64_T * pNumConfs, ABC_INT64_T * pNumInspects );
+extern ABC_DLL int                Abc_NtkMiterSatPar( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nThreads, int fVerbose, ABC_INT64_T * pNumConfs, ABC_INT64_T * pNumInspects );
 extern ABC_DLL void *             Abc_NtkMiterSatCreate( Abc_Ntk_t * pNtk, int fAllPrimes );
 /*=== abcSop.c ==========================================================*/
 extern ABC_DLL char *             Abc_SopRegister( Mem_Flex_t * pMan, char * pName );
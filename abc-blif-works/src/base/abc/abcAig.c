@@ -53,13 +53,25 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the entry of the structural hash table
+typedef struct Abc_AigEnt_t_ Abc_AigEnt_t;
+struct Abc_AigEnt_t_
+{
+    int               Lit0;              // the first fanin literal (2 * Id + Compl)
+    int               Lit1;              // the second fanin literal (2 * Id + Compl)
+    int               Id;                // the node ID (0 = empty, -1 = deleted)
+};
+
 // the simple AIG manager
 struct Abc_Aig_t_
 {
     Abc_Ntk_t *       pNtkAig;           // the AIG network
     Abc_Obj_t *       pConst1;           // the constant 1 object (not a node!)
-    Abc_Obj_t **      pBins;             // the table bins
-    int               nBins;             // the size of the table
+    Abc_AigEnt_t *    pTable;            // the open-addressing table
+    int               nTable;            // the size of the table (power of 2)
+    Abc_AigEnt_t *    pTableOld;         // the table being migrated into the new one
+    int               nTableOld;         // the size of the old table
+    int               iTableOld;         // the next entry of the old table to migrate
     int               nEntries;          // the total number of entries in the table
     Vec_Ptr_t *       vNodes;            // the temporary array of nodes
     Vec_Ptr_t *       vStackReplaceOld;  // the nodes to be replaced
@@ -75,31 +87,27 @@ struct Abc_Aig_t_
     int               nStrash2;
 };
 
-// iterators through the entries in the linked lists of nodes
-#define Abc_AigBinForEachEntry( pBin, pEnt )                   \
-    for ( pEnt = pBin;                                         \
-          pEnt;                                                \
-          pEnt = pEnt->pNext )
-#define Abc_AigBinForEachEntrySafe( pBin, pEnt, pEnt2 )        \
-    for ( pEnt = pBin,                                         \
-          pEnt2 = pEnt? pEnt->pNext: NULL;                     \
-          pEnt;                                                \
-          pEnt = pEnt2,                                        \
-          pEnt2 = pEnt? pEnt->pNext: NULL )
-
-// hash key for the structural hash table
-//static inline unsigned Abc_HashKey2( Abc_Obj_t * p0, Abc_Obj_t * p1, int TableSize ) { return ((unsigned)(p0) + (unsigned)(p1) * 12582917) % TableSize; }
-//static inline unsigned Abc_HashKey2( Abc_Obj_t * p0, Abc_Obj_t * p1, int TableSize ) { return ((unsigned)((a)->Id + (b)->Id) * ((a)->Id + (b)->Id + 1) / 2) % TableSize; }
+// iterator through the nodes in the table (the old table should be migrated)
+#define Abc_AigTableForEachEntry( pMan, pEnt, i )              \
+    for ( i = 0; i < pMan->nTable; i++ )                       \
+        if ( pMan->pTable[i].Id <= 0 ) {} else                 \
+        if ( (pEnt = Abc_NtkObj(pMan->pNtkAig, pMan->pTable[i].Id)) == NULL ) {} else
+
+// the initial size of the table and the number of old entries migrated per insertion
+#define ABC_AIG_TABLE_START   (1 << 14)
+#define ABC_AIG_TABLE_STEP    8
+
+// the literal of the (complemented) node
+static inline int Abc_AigObjLit( Abc_Obj_t * p ) { return (Abc_ObjRegular(p)->Id << 1) | Abc_ObjIsComplement(p); }
 
 // hashing the node
-static unsigned Abc_HashKey2( Abc_Obj_t * p0, Abc_Obj_t * p1, int TableSize ) 
+static inline unsigned Abc_HashKey2( int Lit0, int Lit1, int TableSize ) 
 {
-    unsigned Key = 0;
-    Key ^= Abc_ObjRegular(p0)->Id * 7937;
-    Key ^= Abc_ObjRegular(p1)->Id * 2971;
-    Key ^= Abc_ObjIsComplement(p0) * 911;
-    Key ^= Abc_ObjIsComplement(p1) * 353;
-    return Key % TableSize;
+    unsigned Key = (unsigned)Lit0 * 0x9E3779B1 + (unsigned)Lit1;
+    Key ^= Key >> 15;
+    Key *= 0x2C1B3C6D;
+    Key ^= Key >> 12;
+    return Key & (TableSize - 1);
 }
 
 // structural hash table procedures
@@ -107,6 +115,7 @@ static Abc_Obj_t * Abc_AigAndCreate( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t
 static Abc_Obj_t * Abc_AigAndCreateFrom( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t * p1, Abc_Obj_t * pAnd );
 static void        Abc_AigAndDelete( Abc_Aig_t * pMan, Abc_Obj_t * pThis );
 static void        Abc_AigResize( Abc_Aig_t * pMan );
+static void        Abc_AigResizeStep( Abc_Aig_t * pMan, int nSteps );
 // incremental AIG procedures
 static void        Abc_AigReplace_int( Abc_Aig_t * pMan, Abc_Obj_t * pOld, Abc_Obj_t * pNew, int fUpdateLevel );
 static void        Abc_AigUpdateLevel_int( Abc_Aig_t * pMan );
@@ -137,9 +146,8 @@ Abc_Aig_t * Abc_AigAlloc( Abc_Ntk_t * pNtkAig )
     pMan = ABC_ALLOC( Abc_Aig_t, 1 );
     memset( pMan, 0, sizeof(Abc_Aig_t) );
     // allocate the table
-    pMan->nBins    = Cudd_Prime( 10000 );
-    pMan->pBins    = ABC_ALLOC( Abc_Obj_t *, pMan->nBins );
-    memset( pMan->pBins, 0, sizeof(Abc_Obj_t *) * pMan->nBins );
+    pMan->nTable   = ABC_AIG_TABLE_START;
+    pMan->pTable   = ABC_CALLOC( Abc_AigEnt_t, pMan->nTable );
     pMan->vNodes   = Vec_PtrAlloc( 100 );
     pMan->vLevels  = Vec_VecAlloc( 100 );
     pMan->vLevelsR = Vec_VecAlloc( 100 );
@@ -181,7 +189,8 @@ void Abc_AigFree( Abc_Aig_t * pMan )
     Vec_PtrFree( pMan->vStackReplaceOld );
     Vec_PtrFree( pMan->vStackReplaceNew );
     Vec_PtrFree( pMan->vNodes );
-    ABC_FREE( pMan->pBins );
+    ABC_FREE( pMan->pTableOld );
+    ABC_FREE( pMan->pTable );
     ABC_FREE( pMan );
 }
 
@@ -206,10 +215,10 @@ int Abc_AigCleanup( Abc_Aig_t * pMan )
     nNodesOld = pMan->nEntries;
     // collect the AND nodes that do not fanout
     vDangles = Vec_PtrAlloc( 100 );
-    for ( i = 0; i < pMan->nBins; i++ )
-        Abc_AigBinForEachEntry( pMan->pBins[i], pAnd )
-            if ( Abc_ObjFanoutNum(pAnd) == 0 )
-                Vec_PtrPush( vDangles, pAnd );
+    Abc_AigResizeStep( pMan, ABC_INFINITY );
+    Abc_AigTableForEachEntry( pMan, pAnd, i )
+        if ( Abc_ObjFanoutNum(pAnd) == 0 )
+            Vec_PtrPush( vDangles, pAnd );
     // process the dangling nodes and their MFFCs
     Vec_PtrForEachEntry( Abc_Obj_t *, vDangles, pAnd, i )
         Abc_AigDeleteNode( pMan, pAnd );
@@ -262,9 +271,9 @@ int Abc_AigCheck( Abc_Aig_t * pMan )
     }
     // count the number of nodes in the table
     Counter = 0;
-    for ( i = 0; i < pMan->nBins; i++ )
-        Abc_AigBinForEachEntry( pMan->pBins[i], pAnd )
-            Counter++;
+    Abc_AigResizeStep( pMan, ABC_INFINITY );
+    Abc_AigTableForEachEntry( pMan, pAnd, i )
+        Counter++;
     if ( Counter != Abc_NtkNodeNum(pMan->pNtkAig) )
     {
         printf( "Abc_AigCheck: The number of nodes in the structural hashing table is wrong.\n" );
@@ -308,6 +317,37 @@ int Abc_AigLevel( Abc_Ntk_t * pNtk )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the node with the ordered fanins to the table.]
+
+  Description [Grows the table when it becomes half full. The entries
+  of the old table are moved into the new one a few at a time, with
+  each insertion, so that no single call pays for rehashing the table.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_AigAndInsert( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t * p1, Abc_Obj_t * pAnd )
+{
+    int Lit0 = Abc_AigObjLit(p0), Lit1 = Abc_AigObjLit(p1);
+    unsigned Key, Mask;
+    // check if it is a good time for table resizing
+    if ( 2 * pMan->nEntries > pMan->nTable )
+        Abc_AigResize( pMan );
+    if ( pMan->pTableOld )
+        Abc_AigResizeStep( pMan, ABC_AIG_TABLE_STEP );
+    // find the empty entry
+    Mask = pMan->nTable - 1;
+    for ( Key = Abc_HashKey2( Lit0, Lit1, pMan->nTable ); pMan->pTable[Key].Id; Key = (Key + 1) & Mask );
+    pMan->pTable[Key].Lit0 = Lit0;
+    pMan->pTable[Key].Lit1 = Lit1;
+    pMan->pTable[Key].Id   = pAnd->Id;
+    pMan->nEntries++;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs canonicization step.]
@@ -322,10 +362,6 @@ int Abc_AigLevel( Abc_Ntk_t * pNtk )
 Abc_Obj_t * Abc_AigAndCreate( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t * p1 )
 {
     Abc_Obj_t * pAnd;
-    unsigned Key;
-    // check if it is a good time for table resizing
-    if ( pMan->nEntries > 2 * pMan->nBins )
-        Abc_AigResize( pMan );
     // order the arguments
     if ( Abc_ObjRegular(p0)->Id > Abc_ObjRegular(p1)->Id )
         pAnd = p0, p0 = p1, p1 = pAnd;
@@ -337,11 +373,8 @@ Abc_Obj_t * Abc_AigAndCreate( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t * p1 )
     pAnd->Level  = 1 + ABC_MAX( Abc_ObjRegular(p0)->Level, Abc_ObjRegular(p1)->Level ); 
     pAnd->fExor  = Abc_NodeIsExorType(pAnd);
     pAnd->fPhase = (Abc_ObjIsComplement(p0) ^ Abc_ObjRegular(p0)->fPhase) & (Abc_ObjIsComplement(p1) ^ Abc_ObjRegular(p1)->fPhase);
-    // add the node to the corresponding linked list in the table
-    Key = Abc_HashKey2( p0, p1, pMan->nBins );
-    pAnd->pNext      = pMan->pBins[Key];
-    pMan->pBins[Key] = pAnd;
-    pMan->nEntries++;
+    // add the node to the table
+    Abc_AigAndInsert( pMan, p0, p1, pAnd );
     // create the cuts if defined
 //    if ( pAnd->pNtk->pManCut )
 //        Abc_NodeGetCuts( pAnd->pNtk->pManCut, pAnd );
@@ -369,7 +402,6 @@ Abc_Obj_t * Abc_AigAndCreate( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t * p1 )
 Abc_Obj_t * Abc_AigAndCreateFrom( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t * p1, Abc_Obj_t * pAnd )
 {
     Abc_Obj_t * pTemp;
-    unsigned Key;
     assert( !Abc_ObjIsComplement(pAnd) );
     // order the arguments
     if ( Abc_ObjRegular(p0)->Id > Abc_ObjRegular(p1)->Id )
@@ -380,11 +412,8 @@ Abc_Obj_t * Abc_AigAndCreateFrom( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t *
     // set the level of the new node
     pAnd->Level      = 1 + ABC_MAX( Abc_ObjRegular(p0)->Level, Abc_ObjRegular(p1)->Level ); 
     pAnd->fExor      = Abc_NodeIsExorType(pAnd);
-    // add the node to the corresponding linked list in the table
-    Key = Abc_HashKey2( p0, p1, pMan->nBins );
-    pAnd->pNext      = pMan->pBins[Key];
-    pMan->pBins[Key] = pAnd;
-    pMan->nEntries++;
+    // add the node to the table
+    Abc_AigAndInsert( pMan, p0, p1, pAnd );
     // create the cuts if defined
 //    if ( pAnd->pNtk->pManCut )
 //        Abc_NodeGetCuts( pAnd->pNtk->pManCut, pAnd );
@@ -412,7 +441,9 @@ Abc_Obj_t * Abc_AigAndCreateFrom( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t *
 Abc_Obj_t * Abc_AigAndLookup( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t * p1 )
 {
     Abc_Obj_t * pAnd, * pConst1;
-    unsigned Key;
+    Abc_AigEnt_t * pEnt;
+    unsigned Key, Mask;
+    int Lit0, Lit1;
     assert( Abc_ObjRegular(p0)->pNtk->pManFunc == pMan );
     assert( Abc_ObjRegular(p1)->pNtk->pManFunc == pMan );
     // check for trivial cases
@@ -457,15 +488,20 @@ Abc_Obj_t * Abc_AigAndLookup( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t * p1 )
     // order the arguments
     if ( Abc_ObjRegular(p0)->Id > Abc_ObjRegular(p1)->Id )
         pAnd = p0, p0 = p1, p1 = pAnd;
-    // get the hash key for these two nodes
-    Key = Abc_HashKey2( p0, p1, pMan->nBins );
+    Lit0 = Abc_AigObjLit(p0);
+    Lit1 = Abc_AigObjLit(p1);
     // find the matching node in the table
-    Abc_AigBinForEachEntry( pMan->pBins[Key], pAnd )
-        if ( p0 == Abc_ObjChild0(pAnd) && p1 == Abc_ObjChild1(pAnd) )
-        {
-//            assert( Abc_ObjFanoutNum(Abc_ObjRegular(p0)) && Abc_ObjFanoutNum(p1) );
-             return pAnd;
-        }
+    Mask = pMan->nTable - 1;
+    for ( Key = Abc_HashKey2( Lit0, Lit1, pMan->nTable ); (pEnt = pMan->pTable + Key)->Id; Key = (Key + 1) & Mask )
+        if ( pEnt->Lit0 == Lit0 && pEnt->Lit1 == Lit1 )
+            return Abc_NtkObj( pMan->pNtkAig, pEnt->Id );
+    // find the matching node in the table being migrated
+    if ( pMan->pTableOld == NULL )
+        return NULL;
+    Mask = pMan->nTableOld - 1;
+    for ( Key = Abc_HashKey2( Lit0, Lit1, pMan->nTableOld ); (pEnt = pMan->pTableOld + Key)->Id; Key = (Key + 1) & Mask )
+        if ( pEnt->Id > 0 && pEnt->Lit0 == Lit0 && pEnt->Lit1 == Lit1 )
+            return Abc_NtkObj( pMan->pNtkAig, pEnt->Id );
     return NULL;
 }
 
@@ -550,29 +586,45 @@ Abc_Obj_t * Abc_AigMuxLookup( Abc_Aig_t * pMan, Abc_Obj_t * pC, Abc_Obj_t * pT,
 ***********************************************************************/
 void Abc_AigAndDelete( Abc_Aig_t * pMan, Abc_Obj_t * pThis )
 {
-    Abc_Obj_t * pAnd, * pAnd0, * pAnd1, ** ppPlace;
-    unsigned Key;
+    Abc_AigEnt_t * pEnt;
+    unsigned Key, Mask, Home, i;
+    int Lit0, Lit1;
     assert( !Abc_ObjIsComplement(pThis) );
     assert( Abc_ObjIsNode(pThis) );
     assert( Abc_ObjFaninNum(pThis) == 2 );
     assert( pMan->pNtkAig == pThis->pNtk );
     // get the hash key for these two nodes
-    pAnd0 = Abc_ObjRegular( Abc_ObjChild0(pThis) );
-    pAnd1 = Abc_ObjRegular( Abc_ObjChild1(pThis) );
-    Key = Abc_HashKey2( Abc_ObjChild0(pThis), Abc_ObjChild1(pThis), pMan->nBins );
-    // find the matching node in the table
-    ppPlace = pMan->pBins + Key;
-    Abc_AigBinForEachEntry( pMan->pBins[Key], pAnd )
+    Lit0 = Abc_AigObjLit( Abc_ObjChild0(pThis) );
+    Lit1 = Abc_AigObjLit( Abc_ObjChild1(pThis) );
+    // find the node in the table
+    Mask = pMan->nTable - 1;
+    for ( Key = Abc_HashKey2( Lit0, Lit1, pMan->nTable ); (pEnt = pMan->pTable + Key)->Id; Key = (Key + 1) & Mask )
+        if ( pEnt->Id == pThis->Id )
+            break;
+    if ( pEnt->Id )
     {
-        if ( pAnd != pThis )
+        // shift the following entries of the cluster back to keep the probe sequences unbroken
+        for ( i = (Key + 1) & Mask; pMan->pTable[i].Id; i = (i + 1) & Mask )
         {
-            ppPlace = &pAnd->pNext;
-            continue;
+            Home = Abc_HashKey2( pMan->pTable[i].Lit0, pMan->pTable[i].Lit1, pMan->nTable );
+            if ( ((i - Home) & Mask) < ((i - Key) & Mask) )
+                continue;
+            pMan->pTable[Key] = pMan->pTable[i];
+            Key = i;
         }
-        *ppPlace = pAnd->pNext;
-        break;
+        pMan->pTable[Key].Id = 0;
+    }
+    else
+    {
+        // the node is still in the table being migrated, mark it as deleted there
+        assert( pMan->pTableOld != NULL );
+        Mask = pMan->nTableOld - 1;
+        for ( Key = Abc_HashKey2( Lit0, Lit1, pMan->nTableOld ); (pEnt = pMan->pTableOld + Key)->Id; Key = (Key + 1) & Mask )
+            if ( pEnt->Id == pThis->Id )
+                break;
+        assert( pEnt->Id == pThis->Id );
+        pEnt->Id = -1;
     }
-    assert( pAnd == pThis );
     pMan->nEntries--;
     // delete the cuts if defined
     if ( pThis->pNtk->pManCut )
@@ -583,7 +635,8 @@ void Abc_AigAndDelete( Abc_Aig_t * pMan, Abc_Obj_t * pThis )
 
   Synopsis    [Resizes the hash table of AIG nodes.]
 
-  Description []
+  Description [Allocates the table of the double size. The entries of the
+  current table are moved into it incrementally by Abc_AigResizeStep().]
                
   SideEffects []
 
@@ -592,39 +645,20 @@ void Abc_AigAndDelete( Abc_Aig_t * pMan, Abc_Obj_t * pThis )
 ***********************************************************************/
 void Abc_AigResize( Abc_Aig_t * pMan )
 {
-    Abc_Obj_t ** pBinsNew;
-    Abc_Obj_t * pEnt, * pEnt2;
-    int nBinsNew, Counter, i, clk;
-    unsigned Key;
-
-clk = clock();
-    // get the new table size
-    nBinsNew = Cudd_Prime( 3 * pMan->nBins ); 
-    // allocate a new array
-    pBinsNew = ABC_ALLOC( Abc_Obj_t *, nBinsNew );
-    memset( pBinsNew, 0, sizeof(Abc_Obj_t *) * nBinsNew );
-    // rehash the entries from the old table
-    Counter = 0;
-    for ( i = 0; i < pMan->nBins; i++ )
-        Abc_AigBinForEachEntrySafe( pMan->pBins[i], pEnt, pEnt2 )
-        {
-            Key = Abc_HashKey2( Abc_ObjChild0(pEnt), Abc_ObjChild1(pEnt), nBinsNew );
-            pEnt->pNext   = pBinsNew[Key];
-            pBinsNew[Key] = pEnt;
-            Counter++;
-        }
-    assert( Counter == pMan->nEntries );
-//    printf( "Increasing the structural table size from %6d to %6d. ", pMan->nBins, nBinsNew );
-//    ABC_PRT( "Time", clock() - clk );
-    // replace the table and the parameters
-    ABC_FREE( pMan->pBins );
-    pMan->pBins = pBinsNew;
-    pMan->nBins = nBinsNew;
+    // finish the previous resizing (this should not happen often)
+    Abc_AigResizeStep( pMan, ABC_INFINITY );
+    assert( pMan->pTableOld == NULL );
+//    printf( "Increasing the structural table size from %6d to %6d.\n", pMan->nTable, 2 * pMan->nTable );
+    pMan->pTableOld = pMan->pTable;
+    pMan->nTableOld = pMan->nTable;
+    pMan->iTableOld = 0;
+    pMan->nTable    = 2 * pMan->nTable;
+    pMan->pTable    = ABC_CALLOC( Abc_AigEnt_t, pMan->nTable );
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Resizes the hash table of AIG nodes.]
+  Synopsis    [Moves the given number of entries of the old table into the new one.]
 
   Description []
                
@@ -632,44 +666,70 @@ clk = clock();
 
   SeeAlso     []
 
+***********************************************************************/
+void Abc_AigResizeStep( Abc_Aig_t * pMan, int nSteps )
+{
+    Abc_AigEnt_t * pEnt;
+    unsigned Key, Mask = pMan->nTable - 1;
+    if ( pMan->pTableOld == NULL )
+        return;
+    for ( ; nSteps > 0 && pMan->iTableOld < pMan->nTableOld; nSteps-- )
+    {
+        pEnt = pMan->pTableOld + pMan->iTableOld++;
+        if ( pEnt->Id <= 0 )
+            continue;
+        for ( Key = Abc_HashKey2( pEnt->Lit0, pEnt->Lit1, pMan->nTable ); pMan->pTable[Key].Id; Key = (Key + 1) & Mask );
+        pMan->pTable[Key] = *pEnt;
+        pEnt->Id = -1;
+    }
+    if ( pMan->iTableOld < pMan->nTableOld )
+        return;
+    ABC_FREE( pMan->pTableOld );
+    pMan->nTableOld = 0;
+    pMan->iTableOld = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rehashes the AIG nodes after their IDs have changed.]
+
+  Description [Also restores the order of fanins of each node.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
 ***********************************************************************/
 void Abc_AigRehash( Abc_Aig_t * pMan )
 {
-    Abc_Obj_t ** pBinsNew;
-    Abc_Obj_t * pEnt, * pEnt2;
+    Abc_Obj_t * pEnt;
     int * pArray;
-    unsigned Key;
-    int Counter, Temp, i;
-
-    // allocate a new array
-    pBinsNew = ABC_ALLOC( Abc_Obj_t *, pMan->nBins );
-    memset( pBinsNew, 0, sizeof(Abc_Obj_t *) * pMan->nBins );
-    // rehash the entries from the old table
-    Counter = 0;
-    for ( i = 0; i < pMan->nBins; i++ )
-        Abc_AigBinForEachEntrySafe( pMan->pBins[i], pEnt, pEnt2 )
+    int Temp, i;
+    // clean the table
+    ABC_FREE( pMan->pTableOld );
+    pMan->nTableOld = 0;
+    pMan->iTableOld = 0;
+    memset( pMan->pTable, 0, sizeof(Abc_AigEnt_t) * pMan->nTable );
+    pMan->nEntries = 0;
+    // add the nodes of the network using their new IDs
+    Abc_NtkForEachNode( pMan->pNtkAig, pEnt, i )
+    {
+        if ( Abc_ObjFaninNum(pEnt) != 2 )
+            continue;
+        // swap the fanins if needed
+        pArray = pEnt->vFanins.pArray;
+        if ( pArray[0] > pArray[1] )
         {
-            // swap the fanins if needed
-            pArray = pEnt->vFanins.pArray;
-            if ( pArray[0] > pArray[1] )
-            {
-                Temp = pArray[0];
-                pArray[0] = pArray[1];
-                pArray[1] = Temp;
-                Temp = pEnt->fCompl0;
-                pEnt->fCompl0 = pEnt->fCompl1;
-                pEnt->fCompl1 = Temp;
-            }
-            // rehash the node
-            Key = Abc_HashKey2( Abc_ObjChild0(pEnt), Abc_ObjChild1(pEnt), pMan->nBins );
-            pEnt->pNext   = pBinsNew[Key];
-            pBinsNew[Key] = pEnt;
-            Counter++;
+            Temp = pArray[0];
+            pArray[0] = pArray[1];
+            pArray[1] = Temp;
+            Temp = pEnt->fCompl0;
+            pEnt->fCompl0 = pEnt->fCompl1;
+            pEnt->fCompl1 = Temp;
         }
-    assert( Counter == pMan->nEntries );
-    // replace the table and the parameters
-    ABC_FREE( pMan->pBins );
-    pMan->pBins = pBinsNew;
+        // rehash the node
+        Abc_AigAndInsert( pMan, Abc_ObjChild0(pEnt), Abc_ObjChild1(pEnt), pEnt );
+    }
 }
 
 
@@ -1545,16 +1605,16 @@ void Abc_AigCheckFaninOrder( Abc_Aig_t * pMan )
 {
     Abc_Obj_t * pEnt;
     int i;
-    for ( i = 0; i < pMan->nBins; i++ )
-        Abc_AigBinForEachEntry( pMan->pBins[i], pEnt )
+    Abc_AigResizeStep( pMan, ABC_INFINITY );
+    Abc_AigTableForEachEntry( pMan, pEnt, i )
+    {
+        if ( Abc_ObjRegular(Abc_ObjChild0(pEnt))->Id > Abc_ObjRegular(Abc_ObjChild1(pEnt))->Id )
         {
-            if ( Abc_ObjRegular(Abc_ObjChild0(pEnt))->Id > Abc_ObjRegular(Abc_ObjChild1(pEnt))->Id )
-            {
-//                int i0 = Abc_ObjRegular(Abc_ObjChild0(pEnt))->Id;
-//                int i1 = Abc_ObjRegular(Abc_ObjChild1(pEnt))->Id;
-                printf( "Node %d has incorrect ordering of fanins.\n", pEnt->Id );
-            }
+//            int i0 = Abc_ObjRegular(Abc_ObjChild0(pEnt))->Id;
+//            int i1 = Abc_ObjRegular(Abc_ObjChild1(pEnt))->Id;
+            printf( "Node %d has incorrect ordering of fanins.\n", pEnt->Id );
         }
+    }
 }
 
 /**Function*************************************************************
@@ -1661,14 +1721,14 @@ int Abc_AigCountNext( Abc_Aig_t * pMan )
 {
     Abc_Obj_t * pAnd;
     int i, Counter = 0, CounterTotal = 0;
-    // count how many nodes have pNext set
-    for ( i = 0; i < pMan->nBins; i++ )
-        Abc_AigBinForEachEntry( pMan->pBins[i], pAnd )
-        {
-            Counter += (pAnd->pNext != NULL);
-            CounterTotal++;
-        }
-    printf( "Counter = %d.  Nodes = %d.  Ave = %6.2f\n", Counter, CounterTotal, 1.0 * CounterTotal/pMan->nBins );
+    // count how many nodes are not in their home entry
+    Abc_AigResizeStep( pMan, ABC_INFINITY );
+    Abc_AigTableForEachEntry( pMan, pAnd, i )
+    {
+        Counter += ((int)Abc_HashKey2( pMan->pTable[i].Lit0, pMan->pTable[i].Lit1, pMan->nTable ) != i);
+        CounterTotal++;
+    }
+    printf( "Counter = %d.  Nodes = %d.  Ave = %6.2f\n", Counter, CounterTotal, 1.0 * CounterTotal/pMan->nTable );
     return Counter;
 }
 
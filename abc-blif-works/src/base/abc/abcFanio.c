@@ -42,7 +42,7 @@ ABC_NAMESPACE_IMPL_START
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Vec_IntPushMem( Mem_Step_t * pMemMan, Vec_Int_t * p, int Entry )
+static inline void Vec_IntPushMem( Mem_Step_t * pMemMan, Vec_Int_t * p, int * pBuf, int Entry )
 {
     if ( p->nSize == p->nCap )
     {
@@ -59,10 +59,14 @@ static inline void Vec_IntPushMem( Mem_Step_t * pMemMan, Vec_Int_t * p, int Entr
         {
             for ( i = 0; i < p->nSize; i++ )
                 pArray[i] = p->pArray[i];
-            if ( pMemMan )
-                Mem_StepEntryRecycle( pMemMan, (char *)p->pArray, p->nCap * 4 );
-            else
-                ABC_FREE( p->pArray );
+            // the inline storage belongs to the object and is not recycled
+            if ( p->pArray != pBuf )
+            {
+                if ( pMemMan )
+                    Mem_StepEntryRecycle( pMemMan, (char *)p->pArray, p->nCap * 4 );
+                else
+                    ABC_FREE( p->pArray );
+            }
         }
         p->nCap *= 2;
         p->pArray = pArray;
@@ -87,8 +91,8 @@ void Abc_ObjAddFanin( Abc_Obj_t * pObj, Abc_Obj_t * pFanin )
     assert( !Abc_ObjIsComplement(pObj) );
     assert( pObj->pNtk == pFaninR->pNtk );
     assert( pObj->Id >= 0 && pFaninR->Id >= 0 );
-    Vec_IntPushMem( pObj->pNtk->pMmStep, &pObj->vFanins,     pFaninR->Id );
-    Vec_IntPushMem( pObj->pNtk->pMmStep, &pFaninR->vFanouts, pObj->Id    );
+    Vec_IntPushMem( pObj->pNtk->pMmStep, &pObj->vFanins,     pObj->pFanBuf, pFaninR->Id );
+    Vec_IntPushMem( pObj->pNtk->pMmStep, &pFaninR->vFanouts, NULL,          pObj->Id    );
     if ( Abc_ObjIsComplement(pFanin) )
         Abc_ObjSetFaninC( pObj, Abc_ObjFaninNum(pObj)-1 );
     if ( Abc_ObjIsNet(pObj) && Abc_ObjFaninNum(pObj) > 1 )
@@ -213,7 +217,7 @@ void Abc_ObjPatchFanin( Abc_Obj_t * pObj, Abc_Obj_t * pFaninOld, Abc_Obj_t * pFa
         printf( " the fanouts of its old fanin %s...\n", Abc_ObjName(pFaninOld) );
 //        return;
     }
-    Vec_IntPushMem( pObj->pNtk->pMmStep, &pFaninNewR->vFanouts, pObj->Id );
+    Vec_IntPushMem( pObj->pNtk->pMmStep, &pFaninNewR->vFanouts, NULL, pObj->Id );
 }
 
 /**Function*************************************************************
@@ -248,8 +252,8 @@ Abc_Obj_t * Abc_ObjInsertBetween( Abc_Obj_t * pNodeIn, Abc_Obj_t * pNodeOut, Abc
     // create the new node
     pNodeNew = Abc_NtkCreateObj( pNodeIn->pNtk, Type );
     // add pNodeIn as fanin and pNodeOut as fanout
-    Vec_IntPushMem( pNodeNew->pNtk->pMmStep, &pNodeNew->vFanins,  pNodeIn->Id  );
-    Vec_IntPushMem( pNodeNew->pNtk->pMmStep, &pNodeNew->vFanouts, pNodeOut->Id );
+    Vec_IntPushMem( pNodeNew->pNtk->pMmStep, &pNodeNew->vFanins,  pNodeNew->pFanBuf, pNodeIn->Id  );
+    Vec_IntPushMem( pNodeNew->pNtk->pMmStep, &pNodeNew->vFanouts, NULL,              pNodeOut->Id );
     // update the fanout of pNodeIn
     Vec_IntWriteEntry( &pNodeIn->vFanouts, iFanoutIndex, pNodeNew->Id );
     // update the fanin of pNodeOut
@@ -975,7 +975,8 @@ void Abc_NtkDelete( Abc_Ntk_t * pNtk )
         Abc_NtkForEachObj( pNtk, pObj, i )
         {
             ABC_FREE( pObj->vFanouts.pArray );
-            ABC_FREE( pObj->vFanins.pArray );
+            if ( pObj->vFanins.pArray != pObj->pFanBuf )
+                ABC_FREE( pObj->vFanins.pArray );
         }
     }
     if ( pNtk->pMmObj == NULL )
@@ -1048,6 +1049,7 @@ void Abc_NtkDelete( Abc_Ntk_t * pNtk )
     Vec_PtrFreeP( &pNtk->vLtlProperties );
     Vec_IntFreeP( &pNtk->vObjPerm );
     Vec_VecFreeP( &pNtk->vRealPos );
+    Vec_IntFreeP( &pNtk->vImage );
     ABC_FREE( pNtk );
 }
 
@@ -56,6 +56,9 @@ Abc_Obj_t * Abc_ObjAlloc( Abc_Ntk_t * pNtk, Abc_ObjType_t Type )
     pObj->pNtk = pNtk;
     pObj->Type = Type;
     pObj->Id   = -1;
+    // the first two fanins are stored in the object itself
+    pObj->vFanins.pArray = pObj->pFanBuf;
+    pObj->vFanins.nCap   = 2;
     return pObj;
 }
 
@@ -80,7 +83,8 @@ void Abc_ObjRecycle( Abc_Obj_t * pObj )
     if ( pNtk->pMmStep == NULL )
     {
         ABC_FREE( pObj->vFanouts.pArray );
-        ABC_FREE( pObj->vFanins.pArray );
+        if ( pObj->vFanins.pArray != pObj->pFanBuf )
+            ABC_FREE( pObj->vFanins.pArray );
     }
     // clean the memory to make deleted object distinct from the live one
     memset( pObj, 0, sizeof(Abc_Obj_t) );
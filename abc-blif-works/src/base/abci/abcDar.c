@@ -1227,7 +1227,7 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName )
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int fAlignPol, int fAndOuts, int fVerbose )
+int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int fAlignPol, int fAndOuts, int nThreads, int fVerbose )
 {
     Aig_Man_t * pMan;
     int RetValue;//, clk = clock();
@@ -1235,7 +1235,7 @@ int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit
     assert( Abc_NtkLatchNum(pNtk) == 0 );
 //    assert( Abc_NtkPoNum(pNtk) == 1 );
     pMan = Abc_NtkToDar( pNtk, 0, 0 );
-    RetValue = Fra_FraigSat( pMan, nConfLimit, nInsLimit, fAlignPol, fAndOuts, fVerbose ); 
+    RetValue = Fra_FraigSatPar( pMan, nConfLimit, nInsLimit, fAlignPol, fAndOuts, nThreads, fVerbose ); 
     pNtk->pModel = (int *)pMan->pData, pMan->pData = NULL;
     Aig_ManStop( pMan );
     return RetValue;
@@ -1277,7 +1277,7 @@ int Abc_NtkPartitionedSat( Abc_Ntk_t * pNtk, int nAlgo, int nPartSize, int nConf
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NtkDarCec( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nConfLimit, int fPartition, int fVerbose )
+int Abc_NtkDarCec( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nConfLimit, int fPartition, int nThreads, int fVerbose )
 {
     Aig_Man_t * pMan, * pMan1, * pMan2;
     Abc_Ntk_t * pMiter;
@@ -1305,7 +1305,10 @@ int Abc_NtkDarCec( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nConfLimit, int fPa
     {
         pMan1 = Abc_NtkToDar( pNtk1, 0, 0 );
         pMan2 = Abc_NtkToDar( pNtk2, 0, 0 );
-        RetValue = Fra_FraigCecPartitioned( pMan1, pMan2, nConfLimit, 100, 1, fVerbose );
+        if ( nThreads > 1 )
+            RetValue = Fra_FraigCecPartitionedPar( pMan1, pMan2, nConfLimit, 100, 1, nThreads, fVerbose );
+        else
+            RetValue = Fra_FraigCecPartitioned( pMan1, pMan2, nConfLimit, 100, 1, fVerbose );
         Aig_ManStop( pMan1 );
         Aig_ManStop( pMan2 );
         goto finish;
@@ -1791,7 +1794,8 @@ int Abc_NtkDarBmc3( Abc_Ntk_t * pNtk, Saig_ParBmc_t * pPars )
 {
     Aig_Man_t * pMan;
     int status, RetValue = -1, clk = clock();
-    int nTimeOut = pPars->nTimeOut ? clock() + pPars->nTimeOut * CLOCKS_PER_SEC : 0;
+    // the threaded engine measures the timeout on the wall clock
+    abctime nTimeOut = pPars->nTimeOut ? Abc_ClockTicks(0) + (abctime)pPars->nTimeOut * CLOCKS_PER_SEC : 0;
     pMan = Abc_NtkToDar( pNtk, 0, 1 );
     if ( pMan == NULL )
     {
@@ -1812,7 +1816,7 @@ int Abc_NtkDarBmc3( Abc_Ntk_t * pNtk, Saig_ParBmc_t * pPars )
         if ( pPars->nFailOuts == 0 )
         {
             printf( "No output asserted in %d frames. Resource limit reached ", pPars->iFrame );
-            if ( nTimeOut < clock() )
+            if ( nTimeOut < Abc_ClockTicks(0) )
                 printf( "(timeout %d sec). ", pPars->nTimeOut );
             else
                 printf( "(conf limit %d). ", pPars->nConfLimit );
@@ -1820,7 +1824,7 @@ int Abc_NtkDarBmc3( Abc_Ntk_t * pNtk, Saig_ParBmc_t * pPars )
         else
         {
             printf( "The total of %d outputs asserted in %d frames. Resource limit reached ", pPars->nFailOuts, pPars->iFrame );
-            if ( nTimeOut < clock() )
+            if ( nTimeOut < Abc_ClockTicks(0) )
                 printf( "(timeout %d sec). ", pPars->nTimeOut );
             else
                 printf( "(conf limit %d). ", pPars->nConfLimit );
@@ -2393,7 +2397,9 @@ int Abc_NtkDarPdr( Abc_Ntk_t * pNtk, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
         return -1;
     }
     // perform ORing the primary outputs
-    if ( pPars->iOutput == -1 )
+    if ( pPars->fSolveAll )
+        RetValue = Pdr_ManSolve( pMan, pPars, ppCex );
+    else if ( pPars->iOutput == -1 )
     {
         Aig_Man_t * pTemp = Saig_ManDupOrpos( pMan );
         RetValue = Pdr_ManSolve( pTemp, pPars, ppCex );
@@ -2404,7 +2410,10 @@ int Abc_NtkDarPdr( Abc_Ntk_t * pNtk, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
     else
         RetValue = Pdr_ManSolve( pMan, pPars, ppCex );
     // output the result
-    if ( RetValue == 1 )
+    if ( pPars->fSolveAll )
+        printf( "Proved %d, disproved %d, undecided %d outputs (out of %d).  ", pPars->nProveOuts, pPars->nFailOuts, 
+            Saig_ManPoNum(pMan) - pPars->nProveOuts - pPars->nFailOuts, Saig_ManPoNum(pMan) );
+    else if ( RetValue == 1 )
         printf( "Property proved.  " );
     else if ( RetValue == 0 )
         printf( "Property DISPROVED in frame %d (use \"write_counter\" to dump a witness).  ", ppCex? (*ppCex)->iFrame : -1 );
@@ -2416,6 +2425,17 @@ ABC_PRT( "Time", clock() - clk );
 
     if ( *ppCex && !Saig_ManVerifyCex( pMan, *ppCex ) )
         printf( "Abc_NtkDarPdr(): Counter-example verification has FAILED.\n" );
+    if ( pMan->vSeqModelVec )
+    {
+        Abc_Cex_t * pCex;
+        int i;
+        Vec_PtrForEachEntry( Abc_Cex_t *, pMan->vSeqModelVec, pCex, i )
+            if ( pCex && !Saig_ManVerifyCex( pMan, pCex ) )
+                printf( "Abc_NtkDarPdr(): Counter-example verification for output %d has FAILED.\n", i );
+        if ( pNtk->vSeqModelVec )
+            Vec_PtrFreeFree( pNtk->vSeqModelVec );
+        pNtk->vSeqModelVec = pMan->vSeqModelVec;  pMan->vSeqModelVec = NULL;
+    }
     Aig_ManStop( pMan );
     return RetValue;
 }
@@ -2832,7 +2852,7 @@ Abc_Ntk_t * Abc_NtkDarHaigRecord( Abc_Ntk_t * pNtk, int nIters, int nSteps, int
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NtkDarSeqSim( Abc_Ntk_t * pNtk, int nFrames, int nWords, int TimeOut, int fNew, int fComb, int fMiter, int fVerbose )
+int Abc_NtkDarSeqSim( Abc_Ntk_t * pNtk, int nFrames, int nWords, int TimeOut, int fNew, int fComb, int fMiter, int nThreads, int fVerbose )
 {
     extern int Cec_ManSimulate( Aig_Man_t * pAig, int nWords, int nIters, int TimeLimit, int fMiter, int fVerbose );
     extern int Raig_ManSimulate( Aig_Man_t * pAig, int nWords, int nIters, int TimeLimit, int fMiter, int fVerbose );
@@ -2935,6 +2955,7 @@ int Abc_NtkDarSeqSim( Abc_Ntk_t * pNtk, int nFrames, int nWords, int TimeOut, in
         pPars->nIters = nFrames;
         pPars->TimeLimit = TimeOut;
         pPars->fCheckMiter = fMiter;
+        pPars->nThreads = nThreads;
         pPars->fVerbose = fVerbose;
         pGia = Gia_ManFromAig( pMan );
         if ( Gia_ManSimSimulate( pGia, pPars ) )
@@ -2962,7 +2983,7 @@ int Abc_NtkDarSeqSim( Abc_Ntk_t * pNtk, int nFrames, int nWords, int TimeOut, in
     else
     {
         Fra_Sml_t * pSml;
-        pSml = Fra_SmlSimulateSeq( pMan, 0, nFrames, nWords, fMiter );
+        pSml = Fra_SmlSimulateSeqPar( pMan, 0, nFrames, nWords, fMiter, nThreads );
         if ( pSml->fNonConstOut )
         {
             pCex = Fra_SmlGetCounterExample( pSml );
@@ -0,0 +1,380 @@
+/**CFile****************************************************************
+
+  FileName    [abcPortfolio.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Network and node package.]
+
+  Synopsis    [Portfolio of sequential verification engines.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: abcPortfolio.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "abc.h"
+#include "main.h"
+#include "saig.h"
+#include "cnf.h"
+#include "int.h"
+#include "ssw.h"
+#include "pdr.h"
+
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#include <errno.h>
+#include <time.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the engines of the portfolio
+enum {
+    ABC_PORT_PDR,       // property directed reachability
+    ABC_PORT_BMC,       // bounded model checking (bmc3)
+    ABC_PORT_INT,       // interpolation
+    ABC_PORT_SCORR,     // signal correspondence
+    ABC_PORT_NUM        // the number of engines
+};
+
+static char * s_PortNames[ABC_PORT_NUM] = { "pdr", "bmc3", "int", "scorr" };
+
+// data shared by the engines
+typedef struct Abc_PortShare_t_ Abc_PortShare_t;
+struct Abc_PortShare_t_
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;             // protects the fields below
+    pthread_cond_t   Cond;              // signaled when an engine is done
+#endif
+    volatile int     fStop;             // set when the engines should stop
+    int              iWinner;           // the engine with the first definitive result
+    int              nDone;             // the number of finished engines
+};
+
+// data of one engine
+typedef struct Abc_PortThData_t_ Abc_PortThData_t;
+struct Abc_PortThData_t_
+{
+    Aig_Man_t *      pAig;              // the private copy of the AIG
+    int              iEngine;           // the engine to run
+    int              iThread;           // the number of this thread
+    int              RetValue;          // the result of the engine
+    int              iFrame;            // the frame reached by the engine
+    abctime          Time;              // the runtime of the engine
+    int              fStopped;          // the engine was stopped by another one
+    Abc_Cex_t *      pCex;              // the counter-example
+    Abc_PortShare_t * pShare;           // the shared data
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if all property outputs are constant 0.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_PortMiterIsConst0( Aig_Man_t * p )
+{
+    Aig_Obj_t * pObj;
+    int i;
+    Saig_ManForEachPo( p, pObj, i )
+        if ( Aig_ObjChild0(pObj) != Aig_ManConst0(p) )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine of the portfolio.]
+
+  Description [Returns 1 if the property is proved, 0 if it is disproved
+  (and sets the counter-example), -1 if undecided. The engine may change
+  the AIG, which should be a private copy of the engine.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_PortRunEngine( Aig_Man_t * pAig, int iEngine, int nTimeOut, volatile int * pStop, Abc_Cex_t ** ppCex, int * piFrame )
+{
+    Aig_Man_t * pTemp;
+    int RetValue = -1;
+    *ppCex   = NULL;
+    *piFrame = -1;
+    if ( iEngine == ABC_PORT_PDR )
+    {
+        Pdr_Par_t Pars, * pPars = &Pars;
+        Pdr_ManSetDefaultParams( pPars );
+        pPars->nTimeOut = nTimeOut;
+        pPars->pStop    = pStop;
+        if ( Saig_ManPoNum(pAig) > 1 )
+        {
+            pTemp = Saig_ManDupOrpos( pAig );
+            RetValue = Pdr_ManSolve( pTemp, pPars, ppCex );
+            if ( RetValue == 0 )
+                (*ppCex)->iPo = Saig_ManFindFailedPoCex( pAig, *ppCex );
+            Aig_ManStop( pTemp );
+        }
+        else
+            RetValue = Pdr_ManSolve( pAig, pPars, ppCex );
+        *piFrame = pPars->iFrame;
+    }
+    else if ( iEngine == ABC_PORT_BMC )
+    {
+        Saig_ParBmc_t Pars, * pPars = &Pars;
+        Saig_ParBmcSetDefaultParams( pPars );
+        pPars->nTimeOut = nTimeOut;
+        pPars->pStop    = pStop;
+        RetValue = Saig_ManBmcScalable( pAig, pPars );
+        *ppCex = pAig->pSeqModel;  pAig->pSeqModel = NULL;
+        *piFrame = pPars->iFrame;
+    }
+    else if ( iEngine == ABC_PORT_INT )
+    {
+        Inter_ManParams_t Pars, * pPars = &Pars;
+        // interpolation requires primary inputs
+        if ( Saig_ManPiNum(pAig) == 0 )
+            return -1;
+        Inter_ManSetDefaultParams( pPars );
+        pPars->nSecLimit = nTimeOut;
+        pPars->pStop     = pStop;
+        pTemp = Saig_ManPoNum(pAig) > 1 ? Saig_ManDupOrpos( pAig ) : Aig_ManDupSimple( pAig );
+        RetValue = Inter_ManPerformInterpolation( pTemp, pPars, piFrame );
+        *piFrame = pPars->iFrameMax;
+        if ( RetValue == 0 )
+        {
+            *ppCex = pTemp->pSeqModel;  pTemp->pSeqModel = NULL;
+            (*ppCex)->iPo = Saig_ManFindFailedPoCex( pAig, *ppCex );
+        }
+        Aig_ManStop( pTemp );
+    }
+    else if ( iEngine == ABC_PORT_SCORR )
+    {
+        // failed SAT calls only drop candidate equivalences,
+        // so the reduced AIG is valid even if the engine was stopped
+        Ssw_Pars_t Pars, * pPars = &Pars;
+        Ssw_ManSetDefaultParams( pPars );
+        pPars->pStop = pStop;
+        pTemp = Ssw_SignalCorrespondence( pAig, pPars );
+        if ( pTemp && Abc_PortMiterIsConst0( pTemp ) )
+            RetValue = 1;
+        if ( pTemp )
+            Aig_ManStop( pTemp );
+    }
+    else assert( 0 );
+    return RetValue;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Procedure executed by one engine of the portfolio.]
+
+  Description [The first engine with a definitive result becomes the
+  winner and stops the other engines.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Abc_PortWorkerThread( void * pArg )
+{
+    Abc_PortThData_t * pData = (Abc_PortThData_t *)pArg;
+    Abc_PortShare_t * pShare = pData->pShare;
+    abctime clk = Abc_ClockTicks( 1 );
+    // the engines measure their own timeouts with clock(), which adds up the
+    // CPU time of all threads, so the wall-clock timeout is enforced by the
+    // main thread, which waits until the deadline and then sets the stop flag
+    pData->RetValue = Abc_PortRunEngine( pData->pAig, pData->iEngine, 0, &pShare->fStop, &pData->pCex, &pData->iFrame );
+    pData->Time = Abc_ClockTicks( 1 ) - clk;
+    // the CNF manager of this thread is no longer needed
+    Cnf_ClearMemory();
+    // report the result
+    pthread_mutex_lock( &pShare->Mutex );
+    pData->fStopped = pShare->fStop;
+    if ( pData->RetValue != -1 && pShare->iWinner == -1 )
+    {
+        pShare->iWinner = pData->iThread;
+        pShare->fStop = 1;
+    }
+    pShare->nDone++;
+    pthread_cond_signal( &pShare->Cond );
+    pthread_mutex_unlock( &pShare->Mutex );
+    return NULL;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the portfolio of sequential verification engines.]
+
+  Description [Each engine in fEngines (the bit-mask of engine numbers)
+  works on a private copy of the AIG in a separate thread. The first
+  definitive result stops the remaining engines. Returns 1 if the property
+  is proved, 0 if disproved (and sets the counter-example), -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkDarPortfolio( Abc_Ntk_t * pNtk, int fEngines, int nTimeOut, int fVerbose, Abc_Cex_t ** ppCex, int * piFrame )
+{
+    extern Aig_Man_t * Abc_NtkToDar( Abc_Ntk_t * pNtk, int fExors, int fRegisters );
+    Abc_PortThData_t pData[ABC_PORT_NUM];
+    Abc_PortShare_t Share, * pShare = &Share;
+    Aig_Man_t * pMan;
+    int i, nEngines, iWinner = -1, fTimeOut = 0, RetValue = -1, clk = clock();
+    *ppCex   = NULL;
+    *piFrame = -1;
+    pMan = Abc_NtkToDar( pNtk, 0, 1 );
+    if ( pMan == NULL )
+    {
+        printf( "Converting network into AIG has failed.\n" );
+        return -1;
+    }
+    // create private copies of the AIG for the engines
+    memset( pShare, 0, sizeof(Abc_PortShare_t) );
+    memset( pData, 0, sizeof(Abc_PortThData_t) * ABC_PORT_NUM );
+    pShare->iWinner = -1;
+    nEngines = 0;
+    for ( i = 0; i < ABC_PORT_NUM; i++ )
+    {
+        if ( !(fEngines & (1 << i)) )
+            continue;
+        pData[nEngines].pAig     = Aig_ManDupSimple( pMan );
+        pData[nEngines].iEngine  = i;
+        pData[nEngines].iThread  = nEngines;
+        pData[nEngines].RetValue = -1;
+        pData[nEngines].iFrame   = -1;
+        pData[nEngines].pShare   = pShare;
+        nEngines++;
+    }
+#ifdef ABC_USE_PTHREADS
+    {
+        pthread_t pThreads[ABC_PORT_NUM];
+        struct timespec Deadline;
+        int Status;
+        pthread_mutex_init( &pShare->Mutex, NULL );
+        pthread_cond_init( &pShare->Cond, NULL );
+        clock_gettime( CLOCK_REALTIME, &Deadline );
+        Deadline.tv_sec += nTimeOut;
+        for ( i = 0; i < nEngines; i++ )
+        {
+            Status = pthread_create( pThreads + i, NULL, Abc_PortWorkerThread, (void *)(pData + i) );
+            assert( Status == 0 );
+        }
+        // wait for the first definitive result or the timeout
+        pthread_mutex_lock( &pShare->Mutex );
+        while ( pShare->iWinner == -1 && pShare->nDone < nEngines )
+        {
+            if ( nTimeOut == 0 )
+                pthread_cond_wait( &pShare->Cond, &pShare->Mutex );
+            else if ( pthread_cond_timedwait( &pShare->Cond, &pShare->Mutex, &Deadline ) == ETIMEDOUT )
+            {
+                fTimeOut = 1;
+                break;
+            }
+        }
+        pShare->fStop = 1;
+        pthread_mutex_unlock( &pShare->Mutex );
+        for ( i = 0; i < nEngines; i++ )
+            pthread_join( pThreads[i], NULL );
+        pthread_cond_destroy( &pShare->Cond );
+        pthread_mutex_destroy( &pShare->Mutex );
+        iWinner = pShare->iWinner;
+    }
+#else
+    // run the engines one after another, each with its own timeout
+    for ( i = 0; i < nEngines; i++ )
+    {
+        int clkOne = clock();
+        pData[i].RetValue = Abc_PortRunEngine( pData[i].pAig, pData[i].iEngine, nTimeOut, NULL, &pData[i].pCex, &pData[i].iFrame );
+        pData[i].Time = clock() - clkOne;
+        if ( pData[i].RetValue != -1 )
+        {
+            iWinner = i;
+            break;
+        }
+    }
+#endif
+    // report the engines
+    if ( fVerbose )
+    {
+        for ( i = 0; i < nEngines; i++ )
+        {
+            printf( "Engine %-5s : ", s_PortNames[pData[i].iEngine] );
+            if ( pData[i].RetValue == 1 )
+                printf( "Proved     " );
+            else if ( pData[i].RetValue == 0 )
+                printf( "Disproved  " );
+            else if ( pData[i].fStopped )
+                printf( "Stopped    " );
+            else
+                printf( "Undecided  " );
+            printf( "Frame = %5d.  ", pData[i].iFrame );
+            ABC_PRT( "Time", pData[i].Time );
+        }
+    }
+    // get the result of the winner
+    if ( iWinner != -1 )
+    {
+        RetValue = pData[iWinner].RetValue;
+        *piFrame = pData[iWinner].iFrame;
+        *ppCex   = pData[iWinner].pCex;  pData[iWinner].pCex = NULL;
+        if ( *ppCex )
+            *piFrame = (*ppCex)->iFrame;
+    }
+    if ( RetValue == 1 )
+        printf( "Property proved by %s.  ", s_PortNames[pData[iWinner].iEngine] );
+    else if ( RetValue == 0 )
+        printf( "Property DISPROVED in frame %d by %s (use \"write_counter\" to dump a witness).  ",
+            *ppCex ? (*ppCex)->iFrame : -1, s_PortNames[pData[iWinner].iEngine] );
+    else if ( fTimeOut )
+        printf( "Property UNDECIDED (timeout %d sec).  ", nTimeOut );
+    else
+        printf( "Property UNDECIDED.  " );
+ABC_PRT( "Time", clock() - clk );
+    if ( *ppCex && !Saig_ManVerifyCex( pMan, *ppCex ) )
+        printf( "Abc_NtkDarPortfolio(): Counter-example verification has FAILED.\n" );
+    // clean up
+    for ( i = 0; i < nEngines; i++ )
+    {
+        if ( pData[i].pCex )
+            Abc_CexFree( pData[i].pCex );
+        Aig_ManStop( pData[i].pAig );
+    }
+    Aig_ManStop( pMan );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -50,6 +50,22 @@ static int nMuxes;
 
 ***********************************************************************/
 int Abc_NtkMiterSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int fVerbose, ABC_INT64_T * pNumConfs, ABC_INT64_T * pNumInspects )
+{
+    return Abc_NtkMiterSatPar( pNtk, nConfLimit, nInsLimit, 1, fVerbose, pNumConfs, pNumInspects );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Attempts to solve the miter using a portfolio of SAT solvers.]
+
+  Description [Returns -1 if timed out; 0 if SAT; 1 if UNSAT.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkMiterSatPar( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int nThreads, int fVerbose, ABC_INT64_T * pNumConfs, ABC_INT64_T * pNumInspects )
 {
     sat_solver * pSat;
     lbool   status;
@@ -93,7 +109,7 @@ int Abc_NtkMiterSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsL
     clk = clock();
     if ( fVerbose )
         pSat->verbosity = 1;
-    status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    status = sat_solver_solve_portfolio( pSat, nThreads, NULL, NULL, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, fVerbose );
     if ( status == l_Undef )
     {
 //        printf( "The problem timed out.\n" );
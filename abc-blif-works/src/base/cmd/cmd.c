@@ -950,7 +950,7 @@ int CmdCommandRecall( Abc_Frame_t * pAbc, int argc, char **argv )
         if ( pNtk == NULL )
             fprintf( pAbc->Out, "There is no previously saved network.\n" );
         else // set the current network to be the copy of the previous one
-            Abc_FrameSetCurrentNetwork( pAbc, Abc_NtkDup(pNtk) );
+            Abc_FrameSetCurrentNetwork( pAbc, Abc_FrameDupNetwork(pNtk) );
          return 0;
     }
     if ( argc == 2 ) // the second argument is the number of the step to return to
@@ -997,7 +997,7 @@ int CmdCommandRecall( Abc_Frame_t * pAbc, int argc, char **argv )
                     fprintf( pAbc->Out, "Can only recall steps %d-%d.\n", iStepStart, iStepStop );
             }
             else
-                Abc_FrameSetCurrentNetwork( pAbc, Abc_NtkDup(pNtk) );
+                Abc_FrameSetCurrentNetwork( pAbc, Abc_FrameDupNetwork(pNtk) );
         }
         return 0;
     }
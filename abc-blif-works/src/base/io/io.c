@@ -44,6 +44,7 @@ static int IoCommandReadVerilog ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandReadVer     ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandReadVerLib  ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandReadStatus  ( Abc_Frame_t * pAbc, int argc, char **argv );
+static int IoCommandLoadSession ( Abc_Frame_t * pAbc, int argc, char **argv );
 
 static int IoCommandWrite       ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteHie    ( Abc_Frame_t * pAbc, int argc, char **argv );
@@ -69,10 +70,12 @@ static int IoCommandWriteSortCnf( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteTruth  ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteStatus ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteSmv    ( Abc_Frame_t * pAbc, int argc, char **argv );
+static int IoCommandSaveSession ( Abc_Frame_t * pAbc, int argc, char **argv );
 
 extern void Abc_FrameCopyLTLDataBase( Abc_Frame_t *pAbc, Abc_Ntk_t * pNtk );
 
 extern int glo_fMapped;
+extern int glo_nVerThreads;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -108,6 +111,7 @@ void Io_Init( Abc_Frame_t * pAbc )
 //    Cmd_CommandAdd( pAbc, "I/O", "read_ver",      IoCommandReadVer,      1 );
 //    Cmd_CommandAdd( pAbc, "I/O", "read_verlib",   IoCommandReadVerLib,   0 );
     Cmd_CommandAdd( pAbc, "I/O", "read_status",   IoCommandReadStatus,   0 );
+    Cmd_CommandAdd( pAbc, "I/O", "load_session",  IoCommandLoadSession,  1 );
 
     Cmd_CommandAdd( pAbc, "I/O", "write",         IoCommandWrite,        0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_hie",     IoCommandWriteHie,     0 );
@@ -133,6 +137,7 @@ void Io_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "I/O", "write_truth",   IoCommandWriteTruth,   0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_status",  IoCommandWriteStatus,  0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_smv",     IoCommandWriteSmv,     0 );
+    Cmd_CommandAdd( pAbc, "I/O", "save_session",  IoCommandSaveSession,  0 );
 }
 
 /**Function*************************************************************
@@ -400,17 +405,30 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fReadAsAig;
     int fCheck;
     int fUseNewParser;
+    int nThreads;
     int c;
     extern Abc_Ntk_t * Io_ReadBlifAsAig( char * pFileName, int fCheck );
 
     fCheck = 1;
     fReadAsAig = 0;
     fUseNewParser = 1;
+    nThreads = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "nach" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Jnach" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'J':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( stdout, "Command line switch \"-J\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads <= 0 ) 
+                    goto usage;
+                break;
             case 'n':
                 fUseNewParser ^= 1;
                 break;
@@ -438,7 +456,7 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     else
     {
         Abc_Ntk_t * pTemp;
-        pNtk = Io_ReadBlif( pFileName, fCheck );
+        pNtk = Io_ReadBlifPar( pFileName, nThreads, fCheck );
         if ( pNtk == NULL )
             return 1;
         pNtk = Abc_NtkToLogic( pTemp = pNtk );
@@ -453,12 +471,13 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_blif [-nach] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_blif [-J num] [-nach] <file>\n" );
     fprintf( pAbc->Err, "\t         reads the network in binary BLIF format\n" );
     fprintf( pAbc->Err, "\t         (if this command does not work, try \"read\")\n" );
     fprintf( pAbc->Err, "\t-n     : toggle using old BLIF parser without hierarchy support [default = %s]\n", !fUseNewParser? "yes":"no" );
     fprintf( pAbc->Err, "\t-a     : toggle creating AIG while reading the file [default = %s]\n", fReadAsAig? "yes":"no" );
     fprintf( pAbc->Err, "\t-c     : toggle network check after reading [default = %s]\n", fCheck? "yes":"no" );
+    fprintf( pAbc->Err, "\t-J num : the number of threads parsing the file (use with -n) [default = %d]\n", nThreads );
     fprintf( pAbc->Err, "\t-h     : prints the command summary\n" );
     fprintf( pAbc->Err, "\tfile   : the name of a file to read\n" );
     return 1;
@@ -905,17 +924,22 @@ int IoCommandReadTruth( Abc_Frame_t * pAbc, int argc, char ** argv )
     Abc_Ntk_t * pNtk;
     char * pSopCover;
     int fHex;
+    int fBinary;
     int c;
 
     fHex = 1;
+    fBinary = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "xh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "xbh" ) ) != EOF )
     {
         switch ( c )
         {
             case 'x':
                 fHex ^= 1;
                 break;
+            case 'b':
+                fBinary ^= 1;
+                break;
             case 'h':
                 goto usage;
             default:
@@ -928,6 +952,29 @@ int IoCommandReadTruth( Abc_Frame_t * pAbc, int argc, char ** argv )
         goto usage;
     }
 
+    // read the truth tables from the binary file
+    if ( fBinary )
+    {
+        word * pTruths;
+        int nVars, nFuncs;
+        pTruths = Io_ReadTruthBin( argv[globalUtilOptind], &nVars, &nFuncs );
+        if ( pTruths == NULL )
+        {
+            fprintf( pAbc->Err, "Reading truth table has failed.\n" );
+            return 1;
+        }
+        pNtk = Io_NtkFromTruthBin( pTruths, nVars, nFuncs );
+        ABC_FREE( pTruths );
+        if ( pNtk == NULL )
+        {
+            fprintf( pAbc->Err, "Deriving the network has failed.\n" );
+            return 1;
+        }
+        Abc_FrameReplaceCurrentNetwork( pAbc, pNtk );
+        Abc_FrameClearVerifStatus( pAbc );
+        return 0;
+    }
+
     // convert truth table to SOP
     if ( fHex )
         pSopCover = Abc_SopFromTruthHex(argv[globalUtilOptind]);
@@ -953,11 +1000,13 @@ int IoCommandReadTruth( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_truth [-xh] <truth>\n" );
+    fprintf( pAbc->Err, "usage: read_truth [-xbh] <truth>\n" );
     fprintf( pAbc->Err, "\t         creates network with node having given truth table\n" );
     fprintf( pAbc->Err, "\t-x     : toggles between bin and hex representation [default = %s]\n", fHex? "hex":"bin" );
+    fprintf( pAbc->Err, "\t-b     : toggles reading truth tables from the binary file [default = %s]\n", fBinary? "yes":"no" );
     fprintf( pAbc->Err, "\t-h     : prints the command summary\n" );
     fprintf( pAbc->Err, "\ttruth  : truth table with most signficant bit first (e.g. 1000 for AND(a,b))\n" );
+    fprintf( pAbc->Err, "\t         or the name of the binary file (\".gz\" for compressed) with -b\n" );
     return 1;
 }
 
@@ -977,21 +1026,40 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
     Abc_Ntk_t * pNtk;
     char * pFileName;
     int fCheck;
+    int nThreads;
+    int fBench;
     int c;
+    extern void Ver_ParseBench( char * pFileName, int nThreads, int fCheck );
 
     fCheck = 1;
+    nThreads = 1;
+    fBench = 0;
     glo_fMapped = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "mch" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Jmcbh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'J':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( stdout, "Command line switch \"-J\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads <= 0 ) 
+                    goto usage;
+                break;
             case 'm':
                 glo_fMapped ^= 1;
                 break;
             case 'c':
                 fCheck ^= 1;
                 break;
+            case 'b':
+                fBench ^= 1;
+                break;
             case 'h':
                 goto usage;
             default:
@@ -1002,8 +1070,15 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
         goto usage;
     // get the input file name
     pFileName = argv[globalUtilOptind];
+    if ( fBench )
+    {
+        Ver_ParseBench( pFileName, nThreads, fCheck );
+        return 0;
+    }
     // read the file using the corresponding file reader
+    glo_nVerThreads = nThreads;
     pNtk = Io_Read( pFileName, IO_FILE_VERILOG, fCheck );
+    glo_nVerThreads = 1;
     if ( pNtk == NULL )
         return 1;
     // replace the current network
@@ -1012,10 +1087,12 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_verilog [-mch] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_verilog [-J num] [-mcbh] <file>\n" );
     fprintf( pAbc->Err, "\t         reads the network in Verilog (IWLS 2002/2005 subset)\n" );
     fprintf( pAbc->Err, "\t-m     : toggle reading mapped Verilog [default = %s]\n", glo_fMapped? "yes":"no" );
     fprintf( pAbc->Err, "\t-c     : toggle network check after reading [default = %s]\n", fCheck? "yes":"no" );
+    fprintf( pAbc->Err, "\t-J num : the number of threads parsing the modules [default = %d]\n", nThreads );
+    fprintf( pAbc->Err, "\t-b     : toggle measuring the parsing throughput for 1, 2, 4, etc threads [default = %s]\n", fBench? "yes":"no" );
     fprintf( pAbc->Err, "\t-h     : prints the command summary\n" );
     fprintf( pAbc->Err, "\tfile   : the name of a file to read\n" );
     return 1;
@@ -2497,16 +2574,20 @@ int IoCommandWriteTruth( Abc_Frame_t * pAbc, int argc, char **argv )
     FILE * pFile;
     unsigned * pTruth;
     int fReverse = 0;
+    int fBinary = 0;
     int c;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "rh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "rbh" ) ) != EOF )
     {
         switch ( c )
         {
             case 'r':
                 fReverse ^= 1;
                 break;
+            case 'b':
+                fBinary ^= 1;
+                break;
             case 'h':
                 goto usage;
             default:
@@ -2518,6 +2599,28 @@ int IoCommandWriteTruth( Abc_Frame_t * pAbc, int argc, char **argv )
         printf( "Current networks is not available.\n" );
         return 0;
     }
+    // write the truth tables of all outputs into the binary file
+    if ( fBinary )
+    {
+        word * pTruths;
+        int RetValue;
+        if ( argc != globalUtilOptind + 1 )
+            goto usage;
+        pTruths = Io_NtkToTruthBin( pNtk );
+        if ( pTruths == NULL )
+        {
+            fprintf( pAbc->Err, "Deriving the truth tables has failed.\n" );
+            return 1;
+        }
+        RetValue = Io_WriteTruthBin( argv[globalUtilOptind], pTruths, Abc_NtkPiNum(pNtk), Abc_NtkPoNum(pNtk) );
+        ABC_FREE( pTruths );
+        if ( !RetValue )
+        {
+            fprintf( pAbc->Err, "Writing the truth tables has failed.\n" );
+            return 1;
+        }
+        return 0;
+    }
     if ( !Abc_NtkIsLogic(pNtk) )
     {
         printf( "Current networks should not an AIG. Run \"logic\".\n" );
@@ -2565,9 +2668,10 @@ int IoCommandWriteTruth( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: write_truth [-rh] <file>\n" );
+    fprintf( pAbc->Err, "usage: write_truth [-rbh] <file>\n" );
     fprintf( pAbc->Err, "\t         writes truth table into a file\n" );
     fprintf( pAbc->Err, "\t-r     : toggle reversing bits in the truth table [default = %s]\n", fReverse? "yes":"no" );
+    fprintf( pAbc->Err, "\t-b     : toggle writing all outputs into the binary file [default = %s]\n", fBinary? "yes":"no" );
     fprintf( pAbc->Err, "\t-h     : print the help massage\n" );
     fprintf( pAbc->Err, "\tfile   : the name of the file to write\n" );
     return 1;
@@ -2665,6 +2769,108 @@ usage:
     fprintf( pAbc->Err, "\tfile   : the name of the file to write (extension .smv)\n" );
     return 1;
 }
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int IoCommandSaveSession( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    extern int Io_WriteSession( Abc_Frame_t * pAbc, char * pFileName, int fVerbose );
+    char * pFileName;
+    int fVerbose;
+    int c;
+
+    fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "vh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    // get the output file name
+    pFileName = argv[globalUtilOptind];
+    if ( !Io_WriteSession( pAbc, pFileName, fVerbose ) )
+        return 1;
+    return 0;
+
+usage:
+    fprintf( pAbc->Err, "usage: save_session [-vh] <file>\n" );
+    fprintf( pAbc->Err, "\t         saves the current network, the AIG of the &-space, the LUT\n" );
+    fprintf( pAbc->Err, "\t         and genlib libraries, and the counter-example into a binary file\n" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( pAbc->Err, "\t-h     : print the help message\n" );
+    fprintf( pAbc->Err, "\tfile   : the name of the file to write\n" );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int IoCommandLoadSession( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    extern int Io_ReadSession( Abc_Frame_t * pAbc, char * pFileName, int fVerbose );
+    char * pFileName;
+    int fVerbose;
+    int c;
+
+    fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "vh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    // get the input file name
+    pFileName = argv[globalUtilOptind];
+    if ( !Io_ReadSession( pAbc, pFileName, fVerbose ) )
+        return 1;
+    return 0;
+
+usage:
+    fprintf( pAbc->Err, "usage: load_session [-vh] <file>\n" );
+    fprintf( pAbc->Err, "\t         restores the session saved by \"save_session\"\n" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( pAbc->Err, "\t-h     : print the help message\n" );
+    fprintf( pAbc->Err, "\tfile   : the name of the file to read\n" );
+    return 1;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -64,11 +64,57 @@ typedef enum {
     IO_FILE_UNKNOWN       
 } Io_FileType_t;
 
+// buffered text output shared by the netlist writers
+typedef struct Io_Out_t_ Io_Out_t;
+struct Io_Out_t_
+{
+    void *     pStream;        // the chunked output stream (Gia_AigWr_t)
+    char *     pBuffer;        // the buffer collecting the text
+    char *     pCur;           // the current position in the buffer
+    char *     pLimit;         // the end of the buffer
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
 
 #define  IO_WRITE_LINE_LENGTH    78    // the output line length
+#define  IO_OUT_BUFFER    (1 << 16)    // the size of the text buffer of Io_Out_t
+
+extern void               Io_OutFlush( Io_Out_t * p );
+
+static inline void Io_OutChar( Io_Out_t * p, char c )
+{
+    if ( p->pCur == p->pLimit )
+        Io_OutFlush( p );
+    *p->pCur++ = c;
+}
+static inline void Io_OutStr( Io_Out_t * p, const char * pStr )
+{
+    for ( ; *pStr; pStr++ )
+    {
+        if ( p->pCur == p->pLimit )
+            Io_OutFlush( p );
+        *p->pCur++ = *pStr;
+    }
+}
+static inline int Io_OutInt( Io_Out_t * p, int Num )
+{
+    char Digits[16];
+    unsigned Value = Num < 0 ? 0 - (unsigned)Num : (unsigned)Num;
+    int nDigits = 0, nSize = (Num < 0);
+    if ( p->pLimit - p->pCur < 12 )
+        Io_OutFlush( p );
+    do {
+        Digits[nDigits++] = '0' + Value % 10;
+    } while ( Value /= 10 );
+    if ( Num < 0 )
+        *p->pCur++ = '-';
+    nSize += nDigits;
+    while ( nDigits )
+        *p->pCur++ = Digits[--nDigits];
+    return nSize;
+}
 
 ////////////////////////////////////////////////////////////////////////
 ///                    FUNCTION DECLARATIONS                         ///
@@ -82,6 +128,7 @@ extern Abc_Ntk_t *        Io_ReadBaf( char * pFileName, int fCheck );
 extern Abc_Ntk_t *        Io_ReadBblif( char * pFileName, int fCheck );
 /*=== abcReadBlif.c ===========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlif( char * pFileName, int fCheck );
+extern Abc_Ntk_t *        Io_ReadBlifPar( char * pFileName, int nThreads, int fCheck );
 /*=== abcReadBlifMv.c =========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck );
 /*=== abcReadBench.c ==========================================================*/
@@ -95,6 +142,11 @@ extern Abc_Ntk_t *        Io_ReadEqn( char * pFileName, int fCheck );
 extern Abc_Ntk_t *        Io_ReadPla( char * pFileName, int fZeros, int fCheck );
 /*=== abcReadVerilog.c ========================================================*/
 extern Abc_Ntk_t *        Io_ReadVerilog( char * pFileName, int fCheck );
+/*=== ioTruth.c ===============================================================*/
+extern int                Io_WriteTruthBin( char * pFileName, word * pTruths, int nVars, int nFuncs );
+extern word *             Io_ReadTruthBin( char * pFileName, int * pnVars, int * pnFuncs );
+extern Abc_Ntk_t *        Io_NtkFromTruthBin( word * pTruths, int nVars, int nFuncs );
+extern word *             Io_NtkToTruthBin( Abc_Ntk_t * pNtk );
 /*=== abcWriteAiger.c =========================================================*/
 extern void               Io_WriteAiger( Abc_Ntk_t * pNtk, char * pFileName, int fWriteSymbols, int fCompact );
 extern void               Io_WriteAigerCex( Abc_Cex_t * pCex, Abc_Ntk_t * pNtk, void * pG, char * pFileName );
@@ -105,7 +157,7 @@ extern void               Io_WriteBblif( Abc_Ntk_t * pNtk, char * pFileName );
 /*=== abcWriteBlif.c ==========================================================*/
 extern void               Io_WriteBlifLogic( Abc_Ntk_t * pNtk, char * pFileName, int fWriteLatches );
 extern void               Io_WriteBlif( Abc_Ntk_t * pNtk, char * pFileName, int fWriteLatches, int fBb2Wb, int fSeq );
-extern void               Io_WriteTimingInfo( FILE * pFile, Abc_Ntk_t * pNtk );
+extern void               Io_WriteTimingInfo( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
 extern void               Io_WriteBlifSpecial( Abc_Ntk_t * pNtk, char * FileName );
 /*=== abcWriteBlifMv.c ==========================================================*/ 
 extern void               Io_WriteBlifMv( Abc_Ntk_t * pNtk, char * FileName );
@@ -148,6 +200,9 @@ extern Abc_Obj_t *        Io_ReadCreateConst( Abc_Ntk_t * pNtk, char * pName, in
 extern Abc_Obj_t *        Io_ReadCreateInv( Abc_Ntk_t * pNtk, char * pNameIn, char * pNameOut );
 extern Abc_Obj_t *        Io_ReadCreateBuf( Abc_Ntk_t * pNtk, char * pNameIn, char * pNameOut );
 extern FILE *             Io_FileOpen( const char * FileName, const char * PathVar, const char * Mode, int fVerbose );
+extern Io_Out_t *         Io_OutStart( char * pFileName );
+extern int                Io_OutStop( Io_Out_t * p );
+extern int                Io_OutPrintf( Io_Out_t * p, const char * pFormat, ... );
 
 
 
@@ -227,37 +227,42 @@ static char * Ioa_ReadLoadFileGzAig( char * pFileName, int * pFileSize )
 ***********************************************************************/
 Abc_Ntk_t * Io_ReadAiger( char * pFileName, int fCheck )
 {
+    extern char * Gia_FileMap( char * pFileName, size_t * pnFileSize );
+    extern void Gia_FileUnmap( char * pContents, size_t nFileSize );
     ProgressBar * pProgress;
-    FILE * pFile;
     Vec_Ptr_t * vNodes, * vTerms;
     Vec_Int_t * vLits = NULL;
     Abc_Obj_t * pObj, * pNode0, * pNode1;
     Abc_Ntk_t * pNtkNew;
-    int nTotal, nInputs, nOutputs, nLatches, nAnds, nFileSize = -1, iTerm, nDigits, i;
+    int nTotal, nInputs, nOutputs, nLatches, nAnds, nLoaded = -1, iTerm, nDigits, fMapped = 0, i;
+    size_t nFileSize = 0;
     char * pContents, * pDrivers = NULL, * pSymbols, * pCur, * pName, * pType;
     unsigned uLit0, uLit1, uLit;
 
     // read the file into the buffer
     if ( !strncmp(pFileName+strlen(pFileName)-4,".bz2",4) )
-        pContents = Ioa_ReadLoadFileBz2Aig( pFileName, &nFileSize );
+        pContents = Ioa_ReadLoadFileBz2Aig( pFileName, &nLoaded ), nFileSize = (size_t)nLoaded;
     else if ( !strncmp(pFileName+strlen(pFileName)-3,".gz",3) )
-        pContents = Ioa_ReadLoadFileGzAig( pFileName, &nFileSize );
+        pContents = Ioa_ReadLoadFileGzAig( pFileName, &nLoaded ), nFileSize = (size_t)nLoaded;
     else
     {
 //        pContents = Ioa_ReadLoadFile( pFileName );
-        nFileSize = Extra_FileSize( pFileName );
-        pFile = fopen( pFileName, "rb" );
-        pContents = ABC_ALLOC( char, nFileSize );
-        fread( pContents, nFileSize, 1, pFile );
-        fclose( pFile );
+        // map the file instead of copying it into memory
+        pContents = Gia_FileMap( pFileName, &nFileSize );
+        fMapped = 1;
     }
+    if ( pContents == NULL )
+        return NULL;
 
 
     // check if the input file format is correct
     if ( strncmp(pContents, "aig", 3) != 0 || (pContents[3] != ' ' && pContents[3] != '2') )
     {
         fprintf( stdout, "Wrong input file format.\n" );
-        free( pContents );
+        if ( fMapped )
+            Gia_FileUnmap( pContents, nFileSize );
+        else
+            free( pContents );
         return NULL;
     }
 
@@ -480,7 +485,10 @@ Abc_Ntk_t * Io_ReadAiger( char * pFileName, int fCheck )
     }
 
     // skipping the comments
-    ABC_FREE( pContents );
+    if ( fMapped )
+        Gia_FileUnmap( pContents, nFileSize );
+    else
+        ABC_FREE( pContents );
     Vec_PtrFree( vNodes );
 
     // remove the extra nodes
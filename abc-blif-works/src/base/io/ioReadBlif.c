@@ -21,6 +21,11 @@
 #include "ioAbc.h"
 #include "main.h"
 #include "mio.h"
+#include "gia.h"
+
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -29,12 +34,39 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define IO_BLIF_REC    6             // the number of entries in the record of one line
+#define IO_BLIF_CHUNK  (1 << 22)     // the smallest chunk parsed by one thread (bytes)
+
+typedef struct Io_BlifChunk_t_       Io_BlifChunk_t;  // one chunk of the file
+struct Io_BlifChunk_t_
+{
+    char *               pBeg;         // the first char of the chunk
+    char *               pEnd;         // the char following the chunk
+    int                  LineBeg;      // the number of the first line of the chunk
+    int                  nBreaks;      // the number of line breaks in the chunk
+    Vec_Ptr_t *          vTokens;      // the tokens of all lines
+    Vec_Int_t *          vRecs;        // the lines (first token, token count, line, cover, error, error line)
+    Vec_Str_t *          vCovers;      // the SOP covers of the .names lines
+};
+
 typedef struct Io_ReadBlif_t_        Io_ReadBlif_t;   // all reading info
 struct Io_ReadBlif_t_
 {
     // general info about file
     char *               pFileName;    // the name of the file
-    Extra_FileReader_t * pReader;      // the input file reader
+    Extra_FileReader_t * pReader;      // the input file reader (NULL if the file is pre-parsed)
+    // pre-parsed file
+    char *               pContents;    // the file mapped into memory
+    size_t               nContents;    // the size of the file
+    Vec_Ptr_t *          vChunks;      // the parsed chunks of the file
+    int                  iChunk;       // the current chunk
+    int                  iRec;         // the current line of the chunk
+    int                  LineLast;     // the line number of the current tokens
+    size_t               PosLast;      // the file position of the current tokens
+    Vec_Ptr_t *          vChunkTokens; // the current tokens
+    char *               pCover;       // the SOP cover of the current .names line
+    int                  CoverError;   // the error found in the cover
+    int                  CoverLine;    // the line of the error found in the cover
     // current processing info
     Abc_Ntk_t *          pNtkMaster;   // the primary network
     Abc_Ntk_t *          pNtkCur;      // the primary network
@@ -66,6 +98,22 @@ static int Io_ReadBlifNetworkSubcircuit( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens
 static int Io_ReadBlifNetworkInputArrival( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens );
 static int Io_ReadBlifNetworkDefaultInputArrival( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens );
 static int Io_ReadBlifNetworkConnectBoxes( Io_ReadBlif_t * p, Abc_Ntk_t * pNtkMaster );
+static Io_ReadBlif_t * Io_ReadBlifFileChunks( char * pFileName, int nThreads );
+static Vec_Ptr_t * Io_ReadBlifGetTokensChunk( Io_ReadBlif_t * p );
+static int Io_ReadBlifNetworkNamesChunk( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens );
+
+// the errors detected in the covers while parsing the chunks
+static char * s_IoBlifCoverErrors[4] = {
+    NULL,
+    "The number of tokens in the constant cube is wrong.",
+    "The number of tokens in the cube is wrong.",
+    "The output character in the constant cube is wrong."
+};
+
+static inline int Io_ReadBlifLineNumber( Io_ReadBlif_t * p )   { return p->pReader ? Extra_FileReaderGetLineNumber(p->pReader, 0) : p->LineLast;   }
+// the positions in the pre-parsed file are given in 256-byte units to fit the progress bar
+static inline int Io_ReadBlifFileSize( Io_ReadBlif_t * p )     { return p->pReader ? Extra_FileReaderGetFileSize(p->pReader) : (int)(p->nContents >> 8);   }
+static inline int Io_ReadBlifCurPosition( Io_ReadBlif_t * p )  { return p->pReader ? Extra_FileReaderGetCurPosition(p->pReader) : (int)(p->PosLast >> 8); }
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -83,12 +131,36 @@ static int Io_ReadBlifNetworkConnectBoxes( Io_ReadBlif_t * p, Abc_Ntk_t * pNtkMa
 
 ***********************************************************************/
 Abc_Ntk_t * Io_ReadBlif( char * pFileName, int fCheck )
+{
+    return Io_ReadBlifPar( pFileName, 1, fCheck );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the (hierarchical) network from the BLIF file.]
+
+  Description [If nThreads is more than 1, the file is mapped into memory,
+  split into chunks at the .names/.latch lines, and the chunks are
+  tokenized and their SOP covers are derived by nThreads threads. The 
+  nets are then linked by name while creating the objects in the order
+  of the file, so that the network is the same as the one produced by 
+  the sequential reader.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadBlifPar( char * pFileName, int nThreads, int fCheck )
 {
     Io_ReadBlif_t * p;
     Abc_Ntk_t * pNtk;
 
     // start the file
-    p = Io_ReadBlifFile( pFileName );
+    if ( nThreads > 1 )
+        p = Io_ReadBlifFileChunks( pFileName, nThreads );
+    else
+        p = Io_ReadBlifFile( pFileName );
     if ( p == NULL )
         return NULL;
 
@@ -224,7 +296,7 @@ Abc_Ntk_t * Io_ReadBlifNetworkOne( Io_ReadBlif_t * p )
         char * pToken, * pPivot;
         if ( Vec_PtrSize(p->vTokens) != 2 )
         {
-            p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+            p->LineCur = Io_ReadBlifLineNumber(p);
             sprintf( p->sError, "The .model line does not have exactly two entries." );
             Io_ReadBlifPrintErrorMessage( p );
             return NULL;
@@ -237,7 +309,7 @@ Abc_Ntk_t * Io_ReadBlifNetworkOne( Io_ReadBlif_t * p )
     else if ( strcmp( (char *)p->vTokens->pArray[0], ".exdc" ) != 0 ) 
     {
         printf( "%s: File parsing skipped after line %d (\"%s\").\n", p->pFileName, 
-            Extra_FileReaderGetLineNumber(p->pReader, 0), (char*)p->vTokens->pArray[0] );
+            Io_ReadBlifLineNumber(p), (char*)p->vTokens->pArray[0] );
         Abc_NtkDelete(pNtk);
         p->pNtkCur = NULL;
         return NULL;
@@ -245,12 +317,12 @@ Abc_Ntk_t * Io_ReadBlifNetworkOne( Io_ReadBlif_t * p )
 
     // read the inputs/outputs
     if ( p->pNtkMaster == NULL )
-        pProgress = Extra_ProgressBarStart( stdout, Extra_FileReaderGetFileSize(p->pReader) );
+        pProgress = Extra_ProgressBarStart( stdout, Io_ReadBlifFileSize(p) );
     fTokensReady = fStatus = 0;
     for ( iLine = 0; fTokensReady || (p->vTokens = Io_ReadBlifGetTokens(p)); iLine++ )
     {
         if ( p->pNtkMaster == NULL && iLine % 1000 == 0 )
-            Extra_ProgressBarUpdate( pProgress, Extra_FileReaderGetCurPosition(p->pReader), NULL );
+            Extra_ProgressBarUpdate( pProgress, Io_ReadBlifCurPosition(p), NULL );
 
         // consider different line types
         fTokensReady = 0;
@@ -287,7 +359,7 @@ Abc_Ntk_t * Io_ReadBlifNetworkOne( Io_ReadBlif_t * p )
         }
         else
             printf( "%s (line %d): Skipping directive \"%s\".\n", p->pFileName, 
-                Extra_FileReaderGetLineNumber(p->pReader, 0), pDirective );
+                Io_ReadBlifLineNumber(p), pDirective );
         if ( p->vTokens == NULL ) // some files do not have ".end" in the end
             break;
         if ( fStatus == 1 )
@@ -358,7 +430,7 @@ int Io_ReadBlifNetworkLatch( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
     int ResetValue;
     if ( vTokens->nSize < 3 )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "The .latch line does not have enough tokens." );
         Io_ReadBlifPrintErrorMessage( p );
         return 1;
@@ -373,7 +445,7 @@ int Io_ReadBlifNetworkLatch( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
         ResetValue = atoi((char *)vTokens->pArray[vTokens->nSize-1]);
         if ( ResetValue != 0 && ResetValue != 1 && ResetValue != 2 )
         {
-            p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+            p->LineCur = Io_ReadBlifLineNumber(p);
             sprintf( p->sError, "The .latch line has an unknown reset value (%s).", (char*)vTokens->pArray[3] );
             Io_ReadBlifPrintErrorMessage( p );
             return 1;
@@ -388,6 +460,67 @@ int Io_ReadBlifNetworkLatch( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Creates the node of the .names line of the pre-parsed file.]
+
+  Description [The SOP cover has been derived while parsing the chunk.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ReadBlifNetworkNamesChunk( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens )
+{
+    Vec_Ptr_t * vTokens = *pvTokens;
+    Abc_Ntk_t * pNtk = p->pNtkCur;
+    Abc_Obj_t * pNode;
+    char ** ppNames;
+    int nNames;
+
+    // create a new node and add it to the network
+    if ( vTokens->nSize < 2 )
+    {
+        p->LineCur = Io_ReadBlifLineNumber(p);
+        sprintf( p->sError, "The .names line has less than two tokens." );
+        Io_ReadBlifPrintErrorMessage( p );
+        return 1;
+    }
+
+    // create the node
+    ppNames = (char **)vTokens->pArray + 1;
+    nNames  = vTokens->nSize - 2;
+    pNode   = Io_ReadCreateNode( pNtk, ppNames[nNames], ppNames, nNames );
+
+    // report the error found in the cover
+    if ( p->CoverError )
+    {
+        p->LineCur = p->CoverLine;
+        sprintf( p->sError, "%s", s_IoBlifCoverErrors[p->CoverError] );
+        Io_ReadBlifPrintErrorMessage( p );
+        return 1;
+    }
+
+    // set the pointer to the functionality of the node
+    Abc_ObjSetData( pNode, Abc_SopRegister((Mem_Flex_t *)pNtk->pManFunc, p->pCover) );
+    vTokens = Io_ReadBlifGetTokens(p);
+
+    // check the size
+    if ( Abc_ObjFaninNum(pNode) != Abc_SopGetVarNum((char *)Abc_ObjData(pNode)) )
+    {
+        p->LineCur = Io_ReadBlifLineNumber(p);
+        sprintf( p->sError, "The number of fanins (%d) of node %s is different from SOP size (%d).", 
+            Abc_ObjFaninNum(pNode), Abc_ObjName(Abc_ObjFanout(pNode,0)), Abc_SopGetVarNum((char *)Abc_ObjData(pNode)) );
+        Io_ReadBlifPrintErrorMessage( p );
+        return 1;
+    }
+
+    // return the last array of tokens
+    *pvTokens = vTokens;
+    return 0;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -407,10 +540,14 @@ int Io_ReadBlifNetworkNames( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens )
     char * pToken, Char, ** ppNames;
     int nFanins, nNames;
 
+    // the covers of the pre-parsed file are ready
+    if ( p->pReader == NULL )
+        return Io_ReadBlifNetworkNamesChunk( p, pvTokens );
+
     // create a new node and add it to the network
     if ( vTokens->nSize < 2 )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "The .names line has less than two tokens." );
         Io_ReadBlifPrintErrorMessage( p );
         return 1;
@@ -434,7 +571,7 @@ int Io_ReadBlifNetworkNames( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens )
             // read the cube
             if ( vTokens->nSize != 1 )
             {
-                p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+                p->LineCur = Io_ReadBlifLineNumber(p);
                 sprintf( p->sError, "The number of tokens in the constant cube is wrong." );
                 Io_ReadBlifPrintErrorMessage( p );
                 return 1;
@@ -456,7 +593,7 @@ int Io_ReadBlifNetworkNames( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens )
             // read the cube
             if ( vTokens->nSize != 2 )
             {
-                p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+                p->LineCur = Io_ReadBlifLineNumber(p);
                 sprintf( p->sError, "The number of tokens in the cube is wrong." );
                 Io_ReadBlifPrintErrorMessage( p );
                 return 1;
@@ -467,7 +604,7 @@ int Io_ReadBlifNetworkNames( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens )
             Char = ((char *)vTokens->pArray[1])[0];
             if ( Char != '0' && Char != '1' && Char != 'x' && Char != 'n' )
             {
-                p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+                p->LineCur = Io_ReadBlifLineNumber(p);
                 sprintf( p->sError, "The output character in the constant cube is wrong." );
                 Io_ReadBlifPrintErrorMessage( p );
                 return 1;
@@ -493,7 +630,7 @@ int Io_ReadBlifNetworkNames( Io_ReadBlif_t * p, Vec_Ptr_t ** pvTokens )
     // check the size
     if ( Abc_ObjFaninNum(pNode) != Abc_SopGetVarNum((char *)Abc_ObjData(pNode)) )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "The number of fanins (%d) of node %s is different from SOP size (%d).", 
             Abc_ObjFaninNum(pNode), Abc_ObjName(Abc_ObjFanout(pNode,0)), Abc_SopGetVarNum((char *)Abc_ObjData(pNode)) );
         Io_ReadBlifPrintErrorMessage( p );
@@ -593,7 +730,7 @@ int Io_ReadBlifNetworkGate( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
     pGenlib = (Mio_Library_t *)Abc_FrameReadLibGen();
     if ( pGenlib == NULL )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "The current library is not available." );
         Io_ReadBlifPrintErrorMessage( p );
         return 1;
@@ -602,7 +739,7 @@ int Io_ReadBlifNetworkGate( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
     // create a new node and add it to the network
     if ( vTokens->nSize < 2 )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "The .gate line has less than two tokens." );
         Io_ReadBlifPrintErrorMessage( p );
         return 1;
@@ -612,7 +749,7 @@ int Io_ReadBlifNetworkGate( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
     pGate = Mio_LibraryReadGateByName( pGenlib, (char *)vTokens->pArray[1] );
     if ( pGate == NULL )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "Cannot find gate \"%s\" in the library.", (char*)vTokens->pArray[1] );
         Io_ReadBlifPrintErrorMessage( p );
         return 1;
@@ -630,7 +767,7 @@ int Io_ReadBlifNetworkGate( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
     // reorder the formal inputs to be in the same order as in the gate
     if ( !Io_ReadBlifReorderFormalNames( vTokens, pGate ) )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "Mismatch in the fanins of gate \"%s\".", (char*)vTokens->pArray[1] );
         Io_ReadBlifPrintErrorMessage( p );
         return 1;
@@ -643,7 +780,7 @@ int Io_ReadBlifNetworkGate( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
         vTokens->pArray[i] = Io_ReadBlifCleanName( (char *)vTokens->pArray[i] );
         if ( vTokens->pArray[i] == NULL )
         {
-            p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+            p->LineCur = Io_ReadBlifLineNumber(p);
             sprintf( p->sError, "Invalid gate input assignment." );
             Io_ReadBlifPrintErrorMessage( p );
             return 1;
@@ -681,7 +818,7 @@ int Io_ReadBlifNetworkSubcircuit( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
     // create a new node and add it to the network
     if ( vTokens->nSize < 3 )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "The .subcircuit line has less than three tokens." );
         Io_ReadBlifPrintErrorMessage( p );
         return 1;
@@ -698,7 +835,7 @@ int Io_ReadBlifNetworkSubcircuit( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
     // set the pointer to the node names
     Abc_ObjSetData( pBox, vNames );
     // remember the line of the file
-    pBox->pCopy = (Abc_Obj_t *)(ABC_PTRINT_T)Extra_FileReaderGetLineNumber(p->pReader, 0);
+    pBox->pCopy = (Abc_Obj_t *)(ABC_PTRINT_T)Io_ReadBlifLineNumber(p);
     return 0;
 }
 
@@ -744,7 +881,7 @@ int Io_ReadBlifNetworkInputArrival( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
     assert( strncmp( (char *)vTokens->pArray[0], ".input_arrival", 14 ) == 0 );
     if ( vTokens->nSize != 4 )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "Wrong number of arguments on .input_arrival line." );
         Io_ReadBlifPrintErrorMessage( p );
         return 1;
@@ -752,7 +889,7 @@ int Io_ReadBlifNetworkInputArrival( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
     pNet = Abc_NtkFindNet( p->pNtkCur, (char *)vTokens->pArray[1] );
     if ( pNet == NULL )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "Cannot find object corresponding to %s on .input_arrival line.", (char*)vTokens->pArray[1] );
         Io_ReadBlifPrintErrorMessage( p );
         return 1;
@@ -761,7 +898,7 @@ int Io_ReadBlifNetworkInputArrival( Io_ReadBlif_t * p, Vec_Ptr_t * vTokens )
     TimeFall = strtod( (char *)vTokens->pArray[3], &pFoo2 );
     if ( *pFoo1 != '\0' || *pFoo2 != '\0' )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "Bad value (%s %s) for rise or fall time on .input_arrival line.", (char*)vTokens->pArray[2], (char*)vTokens->pArray[3] );
         Io_ReadBlifPrintErrorMessage( p );
         return 1;
@@ -791,7 +928,7 @@ int Io_ReadBlifNetworkDefaultInputArrival( Io_ReadBlif_t * p, Vec_Ptr_t * vToken
     assert( strncmp( (char *)vTokens->pArray[0], ".default_input_arrival", 23 ) == 0 );
     if ( vTokens->nSize != 3 )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "Wrong number of arguments on .default_input_arrival line." );
         Io_ReadBlifPrintErrorMessage( p );
         return 1;
@@ -800,7 +937,7 @@ int Io_ReadBlifNetworkDefaultInputArrival( Io_ReadBlif_t * p, Vec_Ptr_t * vToken
     TimeFall = strtod( (char *)vTokens->pArray[2], &pFoo2 );
     if ( *pFoo1 != '\0' || *pFoo2 != '\0' )
     {
-        p->LineCur = Extra_FileReaderGetLineNumber(p->pReader, 0);
+        p->LineCur = Io_ReadBlifLineNumber(p);
         sprintf( p->sError, "Bad value (%s %s) for rise or fall time on .default_input_arrival line.", (char*)vTokens->pArray[1], (char*)vTokens->pArray[2] );
         Io_ReadBlifPrintErrorMessage( p );
         return 1;
@@ -847,6 +984,10 @@ Vec_Ptr_t * Io_ReadBlifGetTokens( Io_ReadBlif_t * p )
     char * pLastToken;
     int i;
 
+    // take the tokens of the pre-parsed file
+    if ( p->pReader == NULL )
+        return Io_ReadBlifGetTokensChunk( p );
+
     // get rid of the old tokens
     if ( p->vNewTokens->nSize > 0 )
     {
@@ -947,13 +1088,441 @@ Io_ReadBlif_t * Io_ReadBlifFile( char * pFileName )
 ***********************************************************************/
 void Io_ReadBlifFree( Io_ReadBlif_t * p )
 {
-    Extra_FileReaderFree( p->pReader );
+    Io_BlifChunk_t * pChunk;
+    int i;
+    if ( p->pReader )
+        Extra_FileReaderFree( p->pReader );
+    if ( p->vChunks )
+    {
+        Vec_PtrForEachEntry( Io_BlifChunk_t *, p->vChunks, pChunk, i )
+        {
+            Vec_PtrFree( pChunk->vTokens );
+            Vec_IntFree( pChunk->vRecs );
+            Vec_StrFree( pChunk->vCovers );
+            ABC_FREE( pChunk );
+        }
+        Vec_PtrFree( p->vChunks );
+        Vec_PtrFree( p->vChunkTokens );
+        Gia_FileUnmap( p->pContents, p->nContents );
+    }
     Vec_PtrFree( p->vNewTokens );
     Vec_StrFree( p->vCubes );
     ABC_FREE( p );
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Reads the tokens of the next non-empty line of the chunk.]
+
+  Description [Follows the conventions of the BLIF file reader: comments
+  start with '#', tokens are separated by spaces and tabs, and lines end
+  with '\n' or '\r'. The tokens are zero-terminated in place and added 
+  to the array of the chunk. Returns the number of tokens, or -1 if the 
+  chunk is over.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ReadBlifChunkLine( Io_BlifChunk_t * p, char ** ppCur, int * pLine )
+{
+    char * pCur = *ppCur;
+    int nTokens = 0, fStarted = 0;
+    while ( nTokens == 0 && pCur < p->pEnd )
+    {
+        for ( fStarted = 0; pCur < p->pEnd; pCur++ )
+        {
+            if ( *pCur == '\n' || *pCur == '\r' )
+            {
+                p->nBreaks += (*pCur == '\n');
+                *pCur++ = 0;
+                break;
+            }
+            if ( *pCur == ' ' || *pCur == '\t' )
+            {
+                *pCur = 0;
+                fStarted = 0;
+            }
+            else if ( *pCur == '#' )
+            {
+                // erase the comment till the end of line
+                while ( pCur < p->pEnd && *pCur != '\n' )
+                    *pCur++ = 0;
+                pCur--;
+                fStarted = 0;
+            }
+            else if ( !fStarted )
+            {
+                if ( nTokens++ == 0 )
+                    *pLine = p->nBreaks;
+                Vec_PtrPush( p->vTokens, pCur );
+                fStarted = 1;
+            }
+        }
+    }
+    *ppCur = pCur;
+    return nTokens ? nTokens : -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the tokens of the next line taking into account the line breaks.]
+
+  Description [Returns the number of tokens, or -1 if the chunk is over.
+  The line number is that of the last line read, as in the sequential
+  reader.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ReadBlifChunkTokens( Io_BlifChunk_t * p, char ** ppCur, int * pLine )
+{
+    char * pLastToken;
+    int nTokens, nTotal = 0;
+    while ( (nTokens = Io_ReadBlifChunkLine( p, ppCur, pLine )) > 0 )
+    {
+        nTotal += nTokens;
+        // check if there is a transfer to another line
+        pLastToken = (char *)Vec_PtrEntryLast( p->vTokens );
+        if ( pLastToken[ strlen(pLastToken)-1 ] != '\\' )
+            return nTotal;
+        // remove the slash
+        pLastToken[ strlen(pLastToken)-1 ] = 0;
+        if ( pLastToken[0] == 0 )
+        {
+            Vec_PtrPop( p->vTokens );
+            nTotal--;
+        }
+    }
+    return nTotal ? nTotal : -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Tokenizes the chunk and derives the SOP covers of .names lines.]
+
+  Description [Each line is recorded as (first token, number of tokens,
+  line, cover, error, error line), where the lines are counted from the
+  beginning of the chunk. The cube lines are absorbed into the cover of 
+  the preceding .names line. The errors found in the cubes are recorded
+  and reported when the .names line is processed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_ReadBlifChunkParse( Io_BlifChunk_t * p )
+{
+    char * pCur = p->pBeg, * pToken, Char;
+    int iToken, nTokens, Line, LineCube, nFanins, iCover, Error, ErrorLine;
+    iToken  = Vec_PtrSize( p->vTokens );
+    nTokens = Io_ReadBlifChunkTokens( p, &pCur, &Line );
+    while ( nTokens >= 0 )
+    {
+        if ( nTokens == 0 )
+        {
+            iToken  = Vec_PtrSize( p->vTokens );
+            nTokens = Io_ReadBlifChunkTokens( p, &pCur, &Line );
+            continue;
+        }
+        Vec_IntPush( p->vRecs, iToken );
+        Vec_IntPush( p->vRecs, nTokens );
+        Vec_IntPush( p->vRecs, Line );
+        if ( nTokens < 2 || strcmp( (char *)Vec_PtrEntry(p->vTokens, iToken), ".names" ) )
+        {
+            Vec_IntPush( p->vRecs, -1 );
+            Vec_IntPush( p->vRecs, 0 );
+            Vec_IntPush( p->vRecs, 0 );
+            iToken  = Vec_PtrSize( p->vTokens );
+            nTokens = Io_ReadBlifChunkTokens( p, &pCur, &Line );
+            continue;
+        }
+        // derive the cover from the following cube lines
+        nFanins = nTokens - 2;
+        iCover  = Vec_StrSize( p->vCovers );
+        Error   = ErrorLine = 0;
+        while ( 1 )
+        {
+            iToken  = Vec_PtrSize( p->vTokens );
+            nTokens = Io_ReadBlifChunkTokens( p, &pCur, &LineCube );
+            if ( nTokens < 0 )
+                break;
+            Line = LineCube;
+            if ( nTokens > 0 && ((char *)Vec_PtrEntry(p->vTokens, iToken))[0] == '.' )
+                break;
+            if ( !Error && nFanins == 0 )
+            {
+                if ( nTokens != 1 )
+                    Error = 1, ErrorLine = LineCube;
+                else
+                {
+                    Char = ((char *)Vec_PtrEntry(p->vTokens, iToken))[0];
+                    Vec_StrPush( p->vCovers, ' ' );
+                    Vec_StrPush( p->vCovers, Char );
+                    Vec_StrPush( p->vCovers, '\n' );
+                }
+            }
+            else if ( !Error )
+            {
+                if ( nTokens != 2 )
+                    Error = 2, ErrorLine = LineCube;
+                else
+                {
+                    for ( pToken = (char *)Vec_PtrEntry(p->vTokens, iToken); *pToken; pToken++ )
+                        Vec_StrPush( p->vCovers, *pToken );
+                    Char = ((char *)Vec_PtrEntry(p->vTokens, iToken+1))[0];
+                    if ( Char != '0' && Char != '1' && Char != 'x' && Char != 'n' )
+                        Error = 3, ErrorLine = LineCube;
+                    Vec_StrPush( p->vCovers, ' ' );
+                    Vec_StrPush( p->vCovers, Char );
+                    Vec_StrPush( p->vCovers, '\n' );
+                }
+            }
+            // the tokens of the cube are not needed
+            Vec_PtrShrink( p->vTokens, iToken );
+        }
+        // if there is nothing there, create an empty cube
+        if ( Vec_StrSize(p->vCovers) == iCover )
+        {
+            Vec_StrPush( p->vCovers, ' ' );
+            Vec_StrPush( p->vCovers, '0' );
+            Vec_StrPush( p->vCovers, '\n' );
+        }
+        Vec_StrPush( p->vCovers, 0 );
+        Vec_IntPush( p->vRecs, iCover );
+        Vec_IntPush( p->vRecs, Error );
+        Vec_IntPush( p->vRecs, ErrorLine );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the line is the continuation of the previous one.]
+
+  Description [Looks for the last line with tokens before the given one
+  and checks whether its last token, with the comment removed, ends
+  with a backslash, as Io_ReadBlifChunkTokens() does.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_ReadBlifChunkIsContinued( char * pContents, char * pLine )
+{
+    char * pBeg, * pStop, * pTemp, * pLast;
+    for ( pStop = pLine - 1; pStop > pContents; pStop = pBeg - 1 )
+    {
+        // find the previous line [pBeg, pStop)
+        for ( pBeg = pStop; pBeg > pContents && pBeg[-1] != '\n' && pBeg[-1] != '\r'; pBeg-- );
+        // find its last non-blank character before the comment
+        pLast = NULL;
+        for ( pTemp = pBeg; pTemp < pStop && *pTemp != '#'; pTemp++ )
+            if ( *pTemp != ' ' && *pTemp != '\t' )
+                pLast = pTemp;
+        if ( pLast )
+            return *pLast == '\\';
+        if ( pBeg == pContents )
+            break;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the beginning of the chunk following the given position.]
+
+  Description [The chunk begins with a .names or .latch line, which is
+  not the continuation of the previous line.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_ReadBlifChunkBoundary( char * pContents, char * pCur, char * pEnd )
+{
+    char * pLine;
+    while ( pCur < pEnd )
+    {
+        pLine = (char *)memchr( pCur, '\n', pEnd - pCur );
+        if ( pLine == NULL )
+            break;
+        pCur = ++pLine;
+        if ( strncmp(pLine, ".names", 6) && strncmp(pLine, ".latch", 6) )
+            continue;
+        if ( pLine[6] != ' ' && pLine[6] != '\t' )
+            continue;
+        // make sure the previous line is not continued
+        if ( !Io_ReadBlifChunkIsContinued( pContents, pLine ) )
+            return pLine;
+    }
+    return pEnd;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the chunks of the file.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Io_BlifThData_t_ Io_BlifThData_t;
+struct Io_BlifThData_t_
+{
+    Vec_Ptr_t *          vChunks;      // the chunks of the file
+    int *                pNext;        // the next chunk to be parsed
+};
+static void * Io_ReadBlifChunkThread( void * pArg )
+{
+    Io_BlifThData_t * pData = (Io_BlifThData_t *)pArg;
+    int i;
+#ifdef ABC_USE_PTHREADS
+    while ( (i = __sync_fetch_and_add( pData->pNext, 1 )) < Vec_PtrSize(pData->vChunks) )
+#else
+    while ( (i = (*pData->pNext)++) < Vec_PtrSize(pData->vChunks) )
+#endif
+        Io_ReadBlifChunkParse( (Io_BlifChunk_t *)Vec_PtrEntry(pData->vChunks, i) );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the reading data structure for the pre-parsed file.]
+
+  Description [Maps the file into memory, splits it into chunks, and 
+  parses the chunks using nThreads threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Io_ReadBlif_t * Io_ReadBlifFileChunks( char * pFileName, int nThreads )
+{
+    Io_BlifThData_t Data;
+    Io_BlifChunk_t * pChunk;
+    Io_ReadBlif_t * p;
+    char * pContents, * pBeg, * pEnd, * pCur;
+    size_t nContents;
+    int i, nChunks, iNext = 0, LineBeg = 1;
+
+    // map the file
+    pContents = Gia_FileMap( pFileName, &nContents );
+    if ( pContents == NULL )
+        return NULL;
+
+    // start the reading data structure
+    p = ABC_ALLOC( Io_ReadBlif_t, 1 );
+    memset( p, 0, sizeof(Io_ReadBlif_t) );
+    p->pFileName    = pFileName;
+    p->pContents    = pContents;
+    p->nContents    = nContents;
+    p->Output       = stdout;
+    p->vNewTokens   = Vec_PtrAlloc( 100 );
+    p->vCubes       = Vec_StrAlloc( 100 );
+    p->vChunkTokens = Vec_PtrAlloc( 100 );
+
+    // split the file into chunks
+    nChunks = Abc_MinInt( 4 * nThreads, (int)(nContents / IO_BLIF_CHUNK) + 1 );
+    p->vChunks = Vec_PtrAlloc( nChunks );
+    for ( pBeg = pContents, i = 1; pBeg < pContents + nContents; pBeg = pEnd, i++ )
+    {
+        pEnd = pContents + nContents;
+        if ( i < nChunks )
+        {
+            pCur = pContents + (ABC_INT64_T)nContents * i / nChunks;
+            pEnd = Io_ReadBlifChunkBoundary( pContents, pCur > pBeg ? pCur : pBeg, pEnd );
+        }
+        pChunk = ABC_CALLOC( Io_BlifChunk_t, 1 );
+        pChunk->pBeg    = pBeg;
+        pChunk->pEnd    = pEnd;
+        pChunk->vTokens = Vec_PtrAlloc( 1000 );
+        pChunk->vRecs   = Vec_IntAlloc( 1000 );
+        pChunk->vCovers = Vec_StrAlloc( 1000 );
+        Vec_PtrPush( p->vChunks, pChunk );
+    }
+
+    // parse the chunks
+    Data.vChunks = p->vChunks;
+    Data.pNext   = &iNext;
+    nThreads = Abc_MinInt( nThreads, Vec_PtrSize(p->vChunks) );
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t * pThreads = ABC_ALLOC( pthread_t, nThreads );
+        int Status;
+        for ( i = 1; i < nThreads; i++ )
+        {
+            Status = pthread_create( pThreads + i, NULL, Io_ReadBlifChunkThread, (void *)&Data );
+            assert( Status == 0 );
+        }
+        Io_ReadBlifChunkThread( (void *)&Data );
+        for ( i = 1; i < nThreads; i++ )
+            pthread_join( pThreads[i], NULL );
+        ABC_FREE( pThreads );
+    }
+    else
+#endif
+    Io_ReadBlifChunkThread( (void *)&Data );
+
+    // set the line numbers
+    Vec_PtrForEachEntry( Io_BlifChunk_t *, p->vChunks, pChunk, i )
+    {
+        pChunk->LineBeg = LineBeg;
+        LineBeg += pChunk->nBreaks;
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the tokens of the next line of the pre-parsed file.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Io_ReadBlifGetTokensChunk( Io_ReadBlif_t * p )
+{
+    Io_BlifChunk_t * pChunk;
+    int * pRec, i;
+    while ( p->iChunk < Vec_PtrSize(p->vChunks) )
+    {
+        pChunk = (Io_BlifChunk_t *)Vec_PtrEntry( p->vChunks, p->iChunk );
+        if ( p->iRec == Vec_IntSize(pChunk->vRecs) / IO_BLIF_REC )
+        {
+            p->iChunk++;
+            p->iRec = 0;
+            continue;
+        }
+        pRec = Vec_IntArray(pChunk->vRecs) + IO_BLIF_REC * p->iRec++;
+        // copy the tokens, which may be reordered by the caller
+        Vec_PtrClear( p->vChunkTokens );
+        for ( i = 0; i < pRec[1]; i++ )
+            Vec_PtrPush( p->vChunkTokens, Vec_PtrEntry(pChunk->vTokens, pRec[0] + i) );
+        p->LineLast   = pChunk->LineBeg + pRec[2];
+        p->PosLast    = (size_t)((char *)Vec_PtrEntry(p->vChunkTokens, 0) - p->pContents);
+        p->pCover     = pRec[3] >= 0 ? Vec_StrArray(pChunk->vCovers) + pRec[3] : NULL;
+        p->CoverError = pRec[4];
+        p->CoverLine  = pChunk->LineBeg + pRec[5];
+        return p->vChunkTokens;
+    }
+    return NULL;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Connect one box.]
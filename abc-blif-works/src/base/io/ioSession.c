@@ -0,0 +1,1197 @@
+/**CFile****************************************************************
+
+  FileName    [ioSession.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Saving and restoring the session in a binary file.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: ioSession.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "ioAbc.h"
+#include "mainInt.h"
+#include "gia.h"
+#include "if.h"
+#include "mio.h"
+#include "amap.h"
+#include "mapper.h"
+#include "utilSignal.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    The session file starts with a fixed header followed by a sequence
+    of sections terminated by a section of type IO_SES_NONE.
+    Each section has a four-word header (type, number of words, number
+    of string bytes, reserved), the words, and the string pool padded
+    to the word boundary. Strings are referenced by their byte offset
+    in the pool of the section (-1 stands for no string). The file does
+    not contain pointers and is loaded by mapping it into memory.
+    The sections are written in the order, in which they are restored:
+    the libraries precede the mapped network that refers to them.
+*/
+
+#define IO_SES_VERSION    1
+#define IO_SES_BYTE_ORDER 0x01020304
+
+typedef enum {
+    IO_SES_NONE = 0,      // 0: the last section
+    IO_SES_GENLIB,        // 1: the current genlib library
+    IO_SES_LUTLIB,        // 2: the current LUT library
+    IO_SES_NTK,           // 3: the current network
+    IO_SES_GIA,           // 4: the current AIG of the &-space
+    IO_SES_CEX,           // 5: the current counter-example
+    IO_SES_VOID           // 6: unused
+} Io_SesType_t;
+
+typedef struct Io_SesHead_t_ Io_SesHead_t;
+struct Io_SesHead_t_
+{
+    char           Magic[8];      // "ABC-SES"
+    int            Version;       // file format version
+    int            ByteOrder;     // detects the platform with a different byte order
+    int            nGiaObjSize;   // the size of the AIG object in bytes
+    int            nLutSizeMax;   // the max LUT size in the LUT library
+};
+
+typedef struct Io_Ses_t_ Io_Ses_t;
+struct Io_Ses_t_
+{
+    int            Type;          // the section type
+    Vec_Int_t *    vInts;         // the words of the section
+    Vec_Str_t *    vStrs;         // the string pool of the section
+    // the section as mapped from the file
+    int            nInts;         // the number of words
+    int            nStrs;         // the number of string bytes
+    int *          pInts;         // the words
+    char *         pStrs;         // the string pool
+};
+
+// the number of words in the header of the network and AIG sections
+#define IO_SES_NTK_HEAD   8
+#define IO_SES_GIA_HEAD   10
+
+static inline char * Io_SesStr( Io_Ses_t * p, int iStr )   { return (iStr < 0 || iStr >= p->nStrs) ? NULL : p->pStrs + iStr; }
+static inline int    Io_SesStrIsOk( Io_Ses_t * p, int iStr ) { return iStr == -1 || (iStr >= 0 && iStr < p->nStrs);        }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the section to be written.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Io_Ses_t * Io_SesStart( int Type, int nInts )
+{
+    Io_Ses_t * p;
+    p = ABC_CALLOC( Io_Ses_t, 1 );
+    p->Type  = Type;
+    p->vInts = Vec_IntAlloc( nInts );
+    p->vStrs = Vec_StrAlloc( 1000 );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the string to the pool and returns its offset.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_SesAddStr( Io_Ses_t * p, char * pStr )
+{
+    int iStr = Vec_StrSize(p->vStrs);
+    if ( pStr == NULL )
+        return -1;
+    Vec_StrAppend( p->vStrs, pStr );
+    Vec_StrPush( p->vStrs, '\0' );
+    return iStr;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the section into the file and deallocates it.]
+
+  Description [Returns 0 if writing has failed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_SesWrite( FILE * pFile, Io_Ses_t * p )
+{
+    int Head[4], RetValue;
+    // pad the string pool to keep the next section aligned
+    while ( Vec_StrSize(p->vStrs) % sizeof(int) )
+        Vec_StrPush( p->vStrs, '\0' );
+    Head[0] = p->Type;
+    Head[1] = Vec_IntSize(p->vInts);
+    Head[2] = Vec_StrSize(p->vStrs);
+    Head[3] = 0;
+    RetValue  = (fwrite( Head, sizeof(int), 4, pFile ) == 4);
+    RetValue &= (fwrite( Vec_IntArray(p->vInts), sizeof(int), Vec_IntSize(p->vInts), pFile ) == (size_t)Vec_IntSize(p->vInts));
+    RetValue &= (fwrite( Vec_StrArray(p->vStrs), sizeof(char), Vec_StrSize(p->vStrs), pFile ) == (size_t)Vec_StrSize(p->vStrs));
+    Vec_IntFree( p->vInts );
+    Vec_StrFree( p->vStrs );
+    ABC_FREE( p );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the section with the network.]
+
+  Description [The CIs, the COs and the latches are saved first, in the
+  order of their arrays, so that the restored network has the same order
+  of inputs, outputs and latches. They are followed by the other objects
+  in the order of their IDs; for AIGs, the nodes follow in a topological
+  order. Each object takes four words: the object type, the number of
+  fanins, the functionality (the SOP, the gate name, or the latch init
+  value), and the name. The fanins are listed as literals after
+  the objects, followed by the default arrival and required times and
+  the PI arrival times, if the network has timing information.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Io_Ses_t * Io_SesDeriveNtk( Abc_Ntk_t * pNtk )
+{
+    Io_Ses_t * p;
+    Vec_Ptr_t * vObjs, * vNodes;
+    Vec_Int_t * vMap, * vFanins;
+    Abc_Obj_t * pObj, * pFanin;
+    Abc_Time_t * pTime;
+    int i, k, Data;
+    assert( Abc_NtkIsStrash(pNtk) || (Abc_NtkIsLogic(pNtk) && (Abc_NtkHasSop(pNtk) || Abc_NtkHasMapping(pNtk))) );
+    // order the objects
+    vObjs = Vec_PtrAlloc( Abc_NtkObjNum(pNtk) );
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        Vec_PtrPush( vObjs, pObj );
+    Abc_NtkForEachCo( pNtk, pObj, i )
+        Vec_PtrPush( vObjs, pObj );
+    Abc_NtkForEachBox( pNtk, pObj, i )
+        Vec_PtrPush( vObjs, pObj );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        if ( !Abc_ObjIsCi(pObj) && !Abc_ObjIsCo(pObj) && !Abc_ObjIsBox(pObj) && (!Abc_NtkIsStrash(pNtk) || !Abc_ObjIsNode(pObj)) )
+            Vec_PtrPush( vObjs, pObj );
+    if ( Abc_NtkIsStrash(pNtk) )
+    {
+        vNodes = Abc_AigDfs( pNtk, 1, 0 );
+        Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+            Vec_PtrPush( vObjs, pObj );
+        Vec_PtrFree( vNodes );
+    }
+    vMap = Vec_IntStartFull( Abc_NtkObjNumMax(pNtk) );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pObj, i )
+        Vec_IntWriteEntry( vMap, Abc_ObjId(pObj), i );
+    // save the header
+    p = Io_SesStart( IO_SES_NTK, IO_SES_NTK_HEAD + 6 * Vec_PtrSize(vObjs) );
+    Vec_IntPush( p->vInts, pNtk->ntkType );
+    Vec_IntPush( p->vInts, pNtk->ntkFunc );
+    Vec_IntPush( p->vInts, Io_SesAddStr(p, pNtk->pName) );
+    Vec_IntPush( p->vInts, Io_SesAddStr(p, pNtk->pSpec) );
+    Vec_IntPush( p->vInts, pNtk->nConstrs );
+    Vec_IntPush( p->vInts, Vec_PtrSize(vObjs) );
+    Vec_IntPush( p->vInts, 0 );
+    Vec_IntPush( p->vInts, 0 );
+    // save the objects
+    vFanins = Vec_IntAlloc( 2 * Vec_PtrSize(vObjs) );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pObj, i )
+    {
+        if ( Abc_ObjIsLatch(pObj) )
+            Data = (int)(ABC_PTRINT_T)pObj->pData;
+        else if ( !Abc_ObjIsNode(pObj) || Abc_NtkIsStrash(pNtk) )
+            Data = -1;
+        else if ( Abc_NtkHasMapping(pNtk) )
+            Data = Io_SesAddStr( p, Mio_GateReadName((Mio_Gate_t *)pObj->pData) );
+        else
+            Data = Io_SesAddStr( p, (char *)pObj->pData );
+        Vec_IntPush( p->vInts, pObj->Type );
+        Vec_IntPush( p->vInts, Abc_ObjFaninNum(pObj) );
+        Vec_IntPush( p->vInts, Data );
+        Vec_IntPush( p->vInts, Io_SesAddStr(p, Nm_ManFindNameById(pNtk->pManName, Abc_ObjId(pObj))) );
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Vec_IntPush( vFanins, 2 * Vec_IntEntry(vMap, Abc_ObjId(pFanin)) + (Abc_NtkIsStrash(pNtk) && Abc_ObjFaninC(pObj, k)) );
+    }
+    Vec_IntWriteEntry( p->vInts, 6, Vec_IntSize(vFanins) );
+    Vec_IntForEachEntry( vFanins, Data, i )
+        Vec_IntPush( p->vInts, Data );
+    // save the timing information
+    if ( pNtk->pManTime )
+    {
+        Vec_IntWriteEntry( p->vInts, 7, 4 + 2 * Abc_NtkPiNum(pNtk) );
+        pTime = Abc_NtkReadDefaultArrival( pNtk );
+        Vec_IntPush( p->vInts, Abc_Float2Int(pTime->Rise) );
+        Vec_IntPush( p->vInts, Abc_Float2Int(pTime->Fall) );
+        pTime = Abc_NtkReadDefaultRequired( pNtk );
+        Vec_IntPush( p->vInts, Abc_Float2Int(pTime->Rise) );
+        Vec_IntPush( p->vInts, Abc_Float2Int(pTime->Fall) );
+        Abc_NtkForEachPi( pNtk, pObj, i )
+        {
+            pTime = Abc_NodeReadArrival( pObj );
+            Vec_IntPush( p->vInts, Abc_Float2Int(pTime->Rise) );
+            Vec_IntPush( p->vInts, Abc_Float2Int(pTime->Fall) );
+        }
+    }
+    Vec_IntFree( vFanins );
+    Vec_IntFree( vMap );
+    Vec_PtrFree( vObjs );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the string is an SOP with the given number of variables.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_SesCheckSop( char * pSop, int nVars )
+{
+    char * pCube;
+    int k;
+    if ( pSop == NULL || *pSop == '\0' )
+        return 0;
+    for ( pCube = pSop; *pCube; pCube += nVars + 3 )
+    {
+        for ( k = 0; k < nVars; k++ )
+            if ( pCube[k] != '0' && pCube[k] != '1' && pCube[k] != '-' )
+                return 0;
+        if ( pCube[nVars] != ' ' || pCube[nVars+1] != pSop[nVars+1] || pCube[nVars+2] != '\n' )
+            return 0;
+    }
+    return pSop[nVars+1] == '0' || pSop[nVars+1] == '1';
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the object of this type can drive a node or a CO.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Io_SesObjIsDriver( int Type )
+{
+    return Type == ABC_OBJ_CONST1 || Type == ABC_OBJ_PI || Type == ABC_OBJ_BO || Type == ABC_OBJ_NODE;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the network section before it is restored.]
+
+  Description [Returns 1 if the sizes, the object types, the fanins and
+  the string offsets are consistent, so that restoring the network does
+  not access memory outside of the section. The fanins of AIG nodes 
+  should precede the nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_SesCheckNtk( Io_Ses_t * p )
+{
+    int * pObjs, * pFans, * pFan, * pRec;
+    int nObjs, nFanins, nTimes, nPis = 0, fStrash, Type, TypeFan, i, k;
+    if ( p->nInts < IO_SES_NTK_HEAD )
+        return 0;
+    nObjs   = p->pInts[5];
+    nFanins = p->pInts[6];
+    nTimes  = p->pInts[7];
+    if ( nObjs < 0 || nObjs > (p->nInts - IO_SES_NTK_HEAD) / 4 )
+        return 0;
+    if ( nFanins < 0 || nFanins > p->nInts - IO_SES_NTK_HEAD - 4 * nObjs )
+        return 0;
+    if ( nTimes != p->nInts - IO_SES_NTK_HEAD - 4 * nObjs - nFanins )
+        return 0;
+    fStrash = (p->pInts[0] == ABC_NTK_STRASH && p->pInts[1] == ABC_FUNC_AIG);
+    if ( !fStrash && !(p->pInts[0] == ABC_NTK_LOGIC && (p->pInts[1] == ABC_FUNC_SOP || p->pInts[1] == ABC_FUNC_MAP)) )
+        return 0;
+    if ( !Io_SesStrIsOk(p, p->pInts[2]) || !Io_SesStrIsOk(p, p->pInts[3]) )
+        return 0;
+    pObjs = p->pInts + IO_SES_NTK_HEAD;
+    pFans = pObjs + 4 * nObjs;
+    for ( pFan = pFans, i = 0; i < nObjs; pFan += pRec[1], i++ )
+    {
+        pRec = pObjs + 4 * i;
+        Type = pRec[0];
+        if ( pRec[1] < 0 || pRec[1] > nFanins - (pFan - pFans) || !Io_SesStrIsOk(p, pRec[3]) )
+            return 0;
+        // check the number of fanins and the functionality
+        if ( Type == ABC_OBJ_CONST1 )
+        {
+            if ( !fStrash || pRec[1] != 0 )
+                return 0;
+        }
+        else if ( Type == ABC_OBJ_PI )
+        {
+            if ( pRec[1] != 0 )
+                return 0;
+            nPis++;
+        }
+        else if ( Type == ABC_OBJ_PO || Type == ABC_OBJ_BI || Type == ABC_OBJ_BO )
+        {
+            if ( pRec[1] != 1 )
+                return 0;
+        }
+        else if ( Type == ABC_OBJ_LATCH )
+        {
+            if ( pRec[1] != 1 || pRec[2] < ABC_INIT_NONE || pRec[2] >= ABC_INIT_OTHER )
+                return 0;
+        }
+        else if ( Type == ABC_OBJ_NODE )
+        {
+            if ( fStrash ? pRec[1] != 2 : Io_SesStr(p, pRec[2]) == NULL )
+                return 0;
+            if ( p->pInts[1] == ABC_FUNC_SOP && !Io_SesCheckSop(Io_SesStr(p, pRec[2]), pRec[1]) )
+                return 0;
+        }
+        else
+            return 0;
+        // check the fanins
+        for ( k = 0; k < pRec[1]; k++ )
+        {
+            if ( pFan[k] < 0 || (pFan[k] >> 1) >= nObjs || (!fStrash && (pFan[k] & 1)) )
+                return 0;
+            TypeFan = pObjs[4 * (pFan[k] >> 1)];
+            if ( Type == ABC_OBJ_LATCH )
+            {
+                if ( TypeFan != ABC_OBJ_BI || (pFan[k] & 1) )
+                    return 0;
+            }
+            else if ( Type == ABC_OBJ_BO )
+            {
+                if ( TypeFan != ABC_OBJ_LATCH || (pFan[k] & 1) )
+                    return 0;
+            }
+            else if ( !Io_SesObjIsDriver(TypeFan) )
+                return 0;
+            else if ( fStrash && Type == ABC_OBJ_NODE && (pFan[k] >> 1) >= i )
+                return 0;
+        }
+    }
+    return nTimes == 0 || nTimes == 4 + 2 * nPis;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the network from the section.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Ntk_t * Io_SesReadNtk( Io_Ses_t * p )
+{
+    Abc_Ntk_t * pNtk;
+    Abc_Obj_t * pObj, * pFanin0, * pFanin1;
+    Vec_Ptr_t * vObjs;
+    char * pName;
+    int nObjs, nFanins, nTimes;
+    int * pObjs, * pFans, * pTimes;
+    int * pFan, * pRec, i, k;
+    if ( !Io_SesCheckNtk( p ) )
+    {
+        printf( "Io_SesReadNtk(): The network section is corrupted.\n" );
+        return NULL;
+    }
+    nObjs   = p->pInts[5];
+    nFanins = p->pInts[6];
+    nTimes  = p->pInts[7];
+    pObjs   = p->pInts + IO_SES_NTK_HEAD;
+    pFans   = pObjs + 4 * nObjs;
+    pTimes  = pFans + nFanins;
+    pNtk = Abc_NtkAlloc( (Abc_NtkType_t)p->pInts[0], (Abc_NtkFunc_t)p->pInts[1], 1 );
+    if ( Abc_NtkHasMapping(pNtk) && pNtk->pManFunc == NULL )
+    {
+        printf( "Io_SesReadNtk(): The mapped network cannot be restored without a genlib library.\n" );
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    pNtk->pName    = Extra_UtilStrsav( Io_SesStr(p, p->pInts[2]) );
+    pNtk->pSpec    = Extra_UtilStrsav( Io_SesStr(p, p->pInts[3]) );
+    pNtk->nConstrs = p->pInts[4];
+    // create the objects
+    vObjs = Vec_PtrAlloc( nObjs );
+    for ( pFan = pFans, i = 0; i < nObjs; pFan += pRec[1], i++ )
+    {
+        pRec = pObjs + 4 * i;
+        if ( pRec[0] == ABC_OBJ_CONST1 )
+            pObj = Abc_AigConst1( pNtk );
+        else if ( pRec[0] == ABC_OBJ_NODE && Abc_NtkIsStrash(pNtk) )
+        {
+            pFanin0 = Abc_ObjNotCond( (Abc_Obj_t *)Vec_PtrEntry(vObjs, pFan[0] >> 1), pFan[0] & 1 );
+            pFanin1 = Abc_ObjNotCond( (Abc_Obj_t *)Vec_PtrEntry(vObjs, pFan[1] >> 1), pFan[1] & 1 );
+            pObj = Abc_AigAnd( (Abc_Aig_t *)pNtk->pManFunc, pFanin0, pFanin1 );
+        }
+        else
+        {
+            pObj = Abc_NtkCreateObj( pNtk, (Abc_ObjType_t)pRec[0] );
+            if ( Abc_ObjIsLatch(pObj) )
+                pObj->pData = (void *)(ABC_PTRINT_T)pRec[2];
+            else if ( Abc_ObjIsNode(pObj) && Abc_NtkHasMapping(pNtk) )
+            {
+                pObj->pData = Mio_LibraryReadGateByName( (Mio_Library_t *)pNtk->pManFunc, Io_SesStr(p, pRec[2]) );
+                if ( pObj->pData == NULL || Mio_GateReadInputs((Mio_Gate_t *)pObj->pData) != pRec[1] )
+                {
+                    printf( "Io_SesReadNtk(): Cannot find gate \"%s\" with %d inputs in the current library.\n", Io_SesStr(p, pRec[2]), pRec[1] );
+                    Vec_PtrFree( vObjs );
+                    Abc_NtkDelete( pNtk );
+                    return NULL;
+                }
+            }
+            else if ( Abc_ObjIsNode(pObj) )
+                pObj->pData = Abc_SopRegister( (Mem_Flex_t *)pNtk->pManFunc, Io_SesStr(p, pRec[2]) );
+            if ( (pName = Io_SesStr(p, pRec[3])) )
+                Abc_ObjAssignName( pObj, pName, NULL );
+        }
+        Vec_PtrPush( vObjs, pObj );
+    }
+    // connect the objects
+    for ( pFan = pFans, i = 0; i < nObjs; pFan += pRec[1], i++ )
+    {
+        pRec = pObjs + 4 * i;
+        if ( pRec[0] == ABC_OBJ_CONST1 || (pRec[0] == ABC_OBJ_NODE && Abc_NtkIsStrash(pNtk)) )
+            continue;
+        pObj = (Abc_Obj_t *)Vec_PtrEntry( vObjs, i );
+        for ( k = 0; k < pRec[1]; k++ )
+            Abc_ObjAddFanin( pObj, Abc_ObjNotCond( (Abc_Obj_t *)Vec_PtrEntry(vObjs, pFan[k] >> 1), pFan[k] & 1 ) );
+    }
+    Vec_PtrFree( vObjs );
+    // restore the timing information
+    if ( nTimes )
+    {
+        Abc_NtkTimeSetDefaultArrival( pNtk, Abc_Int2Float(pTimes[0]), Abc_Int2Float(pTimes[1]) );
+        Abc_NtkTimeSetDefaultRequired( pNtk, Abc_Int2Float(pTimes[2]), Abc_Int2Float(pTimes[3]) );
+        Abc_NtkForEachPi( pNtk, pObj, i )
+            Abc_NtkTimeSetArrival( pNtk, Abc_ObjId(pObj), Abc_Int2Float(pTimes[4+2*i]), Abc_Int2Float(pTimes[5+2*i]) );
+        Abc_NtkTimeInitialize( pNtk );
+    }
+    if ( !Abc_NtkCheckRead( pNtk ) )
+    {
+        printf( "Io_SesReadNtk(): The network check has failed.\n" );
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    return pNtk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Packs the network into a compact image in memory.]
+
+  Description [The image is the network section followed by its string
+  pool, preceded by the number of words and the number of string bytes.
+  Returns NULL if the network cannot be restored from the image without
+  losing information.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Io_SesPackNtk( Abc_Ntk_t * pNtk )
+{
+    Io_Ses_t * p;
+    Vec_Int_t * vImage;
+    int nWords;
+    if ( !Abc_NtkIsStrash(pNtk) && !(Abc_NtkIsLogic(pNtk) && Abc_NtkHasSop(pNtk)) )
+        return NULL;
+    if ( pNtk->pExdc || pNtk->pDesign || Abc_NtkBoxNum(pNtk) != Abc_NtkLatchNum(pNtk) )
+        return NULL;
+    if ( Abc_NtkIsStrash(pNtk) && Abc_NtkGetChoiceNum(pNtk) )
+        return NULL;
+    p = Io_SesDeriveNtk( pNtk );
+    nWords = (Vec_StrSize(p->vStrs) + sizeof(int) - 1) / sizeof(int);
+    vImage = Vec_IntStart( 2 + Vec_IntSize(p->vInts) + nWords );
+    Vec_IntWriteEntry( vImage, 0, Vec_IntSize(p->vInts) );
+    Vec_IntWriteEntry( vImage, 1, Vec_StrSize(p->vStrs) );
+    memcpy( Vec_IntArray(vImage) + 2, Vec_IntArray(p->vInts), sizeof(int) * Vec_IntSize(p->vInts) );
+    memcpy( Vec_IntArray(vImage) + 2 + Vec_IntSize(p->vInts), Vec_StrArray(p->vStrs), Vec_StrSize(p->vStrs) );
+    Vec_IntFree( p->vInts );
+    Vec_StrFree( p->vStrs );
+    ABC_FREE( p );
+    return vImage;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the network from the compact image in memory.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_SesUnpackNtk( Vec_Int_t * vImage )
+{
+    Io_Ses_t Sec, * p = &Sec;
+    memset( p, 0, sizeof(Io_Ses_t) );
+    p->Type  = IO_SES_NTK;
+    p->nInts = Vec_IntEntry( vImage, 0 );
+    p->nStrs = Vec_IntEntry( vImage, 1 );
+    p->pInts = Vec_IntArray( vImage ) + 2;
+    p->pStrs = (char *)(p->pInts + p->nInts);
+    return Io_SesReadNtk( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the section with the AIG.]
+
+  Description [The array of AIG objects is saved as it is, because the
+  objects refer to their fanins by the difference of the IDs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Io_Ses_t * Io_SesDeriveGia( Gia_Man_t * pGia )
+{
+    Io_Ses_t * p;
+    char * pName;
+    int i, Id, nWords = pGia->nObjs * sizeof(Gia_Obj_t) / sizeof(int);
+    p = Io_SesStart( IO_SES_GIA, IO_SES_GIA_HEAD + nWords + Gia_ManCiNum(pGia) + Gia_ManCoNum(pGia) );
+    Vec_IntPush( p->vInts, Io_SesAddStr(p, pGia->pName) );
+    Vec_IntPush( p->vInts, pGia->nObjs );
+    Vec_IntPush( p->vInts, Gia_ManCiNum(pGia) );
+    Vec_IntPush( p->vInts, Gia_ManCoNum(pGia) );
+    Vec_IntPush( p->vInts, pGia->nRegs );
+    Vec_IntPush( p->vInts, pGia->nConstrs );
+    Vec_IntPush( p->vInts, pGia->vNamesIn  ? Vec_PtrSize(pGia->vNamesIn)  : 0 );
+    Vec_IntPush( p->vInts, pGia->vNamesOut ? Vec_PtrSize(pGia->vNamesOut) : 0 );
+    Vec_IntPush( p->vInts, 0 );
+    Vec_IntPush( p->vInts, 0 );
+    for ( i = 0; i < nWords; i++ )
+        Vec_IntPush( p->vInts, ((int *)pGia->pObjs)[i] );
+    Vec_IntForEachEntry( pGia->vCis, Id, i )
+        Vec_IntPush( p->vInts, Id );
+    Vec_IntForEachEntry( pGia->vCos, Id, i )
+        Vec_IntPush( p->vInts, Id );
+    if ( pGia->vNamesIn )
+        Vec_PtrForEachEntry( char *, pGia->vNamesIn, pName, i )
+            Vec_IntPush( p->vInts, Io_SesAddStr(p, pName) );
+    if ( pGia->vNamesOut )
+        Vec_PtrForEachEntry( char *, pGia->vNamesOut, pName, i )
+            Vec_IntPush( p->vInts, Io_SesAddStr(p, pName) );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the objects of the AIG restored from the section.]
+
+  Description [Returns 1 if the fanins of each object precede the object,
+  no object is driven by a CO, and the CIs and COs listed in the section
+  are exactly the terminal objects of the AIG, numbered as in the lists.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_SesCheckGia( Gia_Man_t * pGia, int * pCis, int nCis, int * pCos, int nCos )
+{
+    Gia_Obj_t * pObj;
+    int i, nCisAll = 0, nCosAll = 0;
+    if ( !Gia_ObjIsConst0(Gia_ManObj(pGia, 0)) || Gia_ObjIsTerm(Gia_ManObj(pGia, 0)) )
+        return 0;
+    for ( i = 1; i < pGia->nObjs; i++ )
+    {
+        pObj = Gia_ManObj( pGia, i );
+        if ( Gia_ObjIsCi(pObj) )
+        {
+            if ( Gia_ObjCioId(pObj) >= nCis || pCis[Gia_ObjCioId(pObj)] != i )
+                return 0;
+            nCisAll++;
+            continue;
+        }
+        if ( Gia_ObjIsConst0(pObj) || (!Gia_ObjIsTerm(pObj) && Gia_ObjDiff0(pObj) == GIA_NONE) )
+            return 0;
+        if ( Gia_ObjDiff0(pObj) < 1 || Gia_ObjDiff0(pObj) > i || Gia_ObjIsCo(Gia_ManObj(pGia, i - Gia_ObjDiff0(pObj))) )
+            return 0;
+        if ( Gia_ObjIsCo(pObj) )
+        {
+            if ( Gia_ObjCioId(pObj) >= nCos || pCos[Gia_ObjCioId(pObj)] != i )
+                return 0;
+            nCosAll++;
+            continue;
+        }
+        if ( Gia_ObjDiff1(pObj) < 1 || Gia_ObjDiff1(pObj) > i || Gia_ObjIsCo(Gia_ManObj(pGia, i - Gia_ObjDiff1(pObj))) )
+            return 0;
+    }
+    return nCisAll == nCis && nCosAll == nCos;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the AIG from the section.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Io_SesReadGia( Io_Ses_t * p )
+{
+    Gia_Man_t * pGia;
+    int nObjs, nCis, nCos, nNamesIn, nNamesOut, nWords;
+    int * pCis, * pCos, * pNames, i;
+    if ( p->nInts < IO_SES_GIA_HEAD )
+    {
+        printf( "Io_SesReadGia(): The AIG section is corrupted.\n" );
+        return NULL;
+    }
+    nObjs     = p->pInts[1];
+    nCis      = p->pInts[2];
+    nCos      = p->pInts[3];
+    nNamesIn  = p->pInts[6];
+    nNamesOut = p->pInts[7];
+    if ( nObjs < 1 || nCis < 0 || nCos < 0 || nNamesIn < 0 || nNamesOut < 0 || 
+         IO_SES_GIA_HEAD + (ABC_INT64_T)nObjs * (int)(sizeof(Gia_Obj_t) / sizeof(int)) + nCis + nCos + nNamesIn + nNamesOut != p->nInts ||
+         p->pInts[4] < 0 || p->pInts[4] > Abc_MinInt(nCis, nCos) || !Io_SesStrIsOk(p, p->pInts[0]) )
+    {
+        printf( "Io_SesReadGia(): The AIG section is corrupted.\n" );
+        return NULL;
+    }
+    nWords = nObjs * sizeof(Gia_Obj_t) / sizeof(int);
+    pCis   = p->pInts + IO_SES_GIA_HEAD + nWords;
+    pCos   = pCis + nCis;
+    pNames = pCos + nCos;
+    for ( i = 0; i < nNamesIn + nNamesOut; i++ )
+        if ( Io_SesStr(p, pNames[i]) == NULL )
+        {
+            printf( "Io_SesReadGia(): The AIG section is corrupted.\n" );
+            return NULL;
+        }
+    pGia = Gia_ManStart( nObjs );
+    memcpy( pGia->pObjs, p->pInts + IO_SES_GIA_HEAD, sizeof(Gia_Obj_t) * nObjs );
+    pGia->nObjs    = nObjs;
+    pGia->pName    = Gia_UtilStrsav( Io_SesStr(p, p->pInts[0]) );
+    pGia->nRegs    = p->pInts[4];
+    pGia->nConstrs = p->pInts[5];
+    Vec_IntFree( pGia->vCis );
+    Vec_IntFree( pGia->vCos );
+    pGia->vCis = Vec_IntAllocArrayCopy( pCis, nCis );
+    pGia->vCos = Vec_IntAllocArrayCopy( pCos, nCos );
+    if ( !Io_SesCheckGia( pGia, pCis, nCis, pCos, nCos ) )
+    {
+        printf( "Io_SesReadGia(): The AIG section is corrupted.\n" );
+        Gia_ManStop( pGia );
+        return NULL;
+    }
+    if ( nNamesIn )
+    {
+        pGia->vNamesIn = Vec_PtrAlloc( nNamesIn );
+        for ( i = 0; i < nNamesIn; i++ )
+            Vec_PtrPush( pGia->vNamesIn, Gia_UtilStrsav(Io_SesStr(p, *pNames++)) );
+    }
+    if ( nNamesOut )
+    {
+        pGia->vNamesOut = Vec_PtrAlloc( nNamesOut );
+        for ( i = 0; i < nNamesOut; i++ )
+            Vec_PtrPush( pGia->vNamesOut, Gia_UtilStrsav(Io_SesStr(p, *pNames++)) );
+    }
+    return pGia;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the section with the LUT library.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Io_Ses_t * Io_SesDeriveLutLib( If_Lib_t * pLib )
+{
+    Io_Ses_t * p;
+    int nFloats = (IF_MAX_LUTSIZE+1) * (IF_MAX_LUTSIZE+2);
+    p = Io_SesStart( IO_SES_LUTLIB, 3 + nFloats );
+    Vec_IntPush( p->vInts, Io_SesAddStr(p, pLib->pName) );
+    Vec_IntPush( p->vInts, pLib->LutMax );
+    Vec_IntPush( p->vInts, pLib->fVarPinDelays );
+    Vec_IntGrow( p->vInts, 3 + nFloats );
+    memcpy( Vec_IntArray(p->vInts) + 3, pLib->pLutAreas, sizeof(float) * (IF_MAX_LUTSIZE+1) );
+    memcpy( Vec_IntArray(p->vInts) + 3 + IF_MAX_LUTSIZE+1, pLib->pLutDelays, sizeof(float) * (IF_MAX_LUTSIZE+1) * (IF_MAX_LUTSIZE+1) );
+    p->vInts->nSize = 3 + nFloats;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the LUT library from the section.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static If_Lib_t * Io_SesReadLutLib( Io_Ses_t * p )
+{
+    If_Lib_t * pLib;
+    if ( p->nInts != 3 + (IF_MAX_LUTSIZE+1) * (IF_MAX_LUTSIZE+2) || !Io_SesStrIsOk(p, p->pInts[0]) || 
+         p->pInts[1] < 1 || p->pInts[1] > IF_MAX_LUTSIZE )
+    {
+        printf( "Io_SesReadLutLib(): The LUT library section is corrupted.\n" );
+        return NULL;
+    }
+    pLib = ABC_CALLOC( If_Lib_t, 1 );
+    pLib->pName         = Extra_UtilStrsav( Io_SesStr(p, p->pInts[0]) );
+    pLib->LutMax        = p->pInts[1];
+    pLib->fVarPinDelays = p->pInts[2];
+    memcpy( pLib->pLutAreas, p->pInts + 3, sizeof(float) * (IF_MAX_LUTSIZE+1) );
+    memcpy( pLib->pLutDelays, p->pInts + 3 + IF_MAX_LUTSIZE+1, sizeof(float) * (IF_MAX_LUTSIZE+1) * (IF_MAX_LUTSIZE+1) );
+    return pLib;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the section with the genlib library.]
+
+  Description [The library is saved as the GENLIB text with the numbers
+  printed in full precision, so that parsing it back gives the same gates.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Io_Ses_t * Io_SesDeriveGenlib( Mio_Library_t * pLib )
+{
+    char * pPhaseNames[3] = { "UNKNOWN", "INV", "NONINV" };
+    Io_Ses_t * p;
+    Vec_Str_t * vText;
+    Mio_Gate_t * pGate;
+    Mio_Pin_t * pPin;
+    char Buffer[1000];
+    vText = Vec_StrAlloc( 10000 );
+    Mio_LibraryForEachGate( pLib, pGate )
+    {
+        sprintf( Buffer, "GATE %s %.17g %s=%s;\n", Mio_GateReadName(pGate), Mio_GateReadArea(pGate),
+            Mio_GateReadOutName(pGate), Mio_GateReadForm(pGate) );
+        Vec_StrAppend( vText, Buffer );
+        Mio_GateForEachPin( pGate, pPin )
+        {
+            sprintf( Buffer, "PIN %s %s %.17g %.17g %.17g %.17g %.17g %.17g\n", Mio_PinReadName(pPin),
+                pPhaseNames[Mio_PinReadPhase(pPin)], Mio_PinReadInputLoad(pPin), Mio_PinReadMaxLoad(pPin),
+                Mio_PinReadDelayBlockRise(pPin), Mio_PinReadDelayFanoutRise(pPin),
+                Mio_PinReadDelayBlockFall(pPin), Mio_PinReadDelayFanoutFall(pPin) );
+            Vec_StrAppend( vText, Buffer );
+        }
+    }
+    Vec_StrPush( vText, '\0' );
+    p = Io_SesStart( IO_SES_GENLIB, 2 );
+    Vec_IntPush( p->vInts, Io_SesAddStr(p, Mio_LibraryReadName(pLib)) );
+    Vec_IntPush( p->vInts, Io_SesAddStr(p, Vec_StrArray(vText)) );
+    Vec_StrFree( vText );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the genlib library from the section.]
+
+  Description [The GENLIB text is parsed by the regular readers of the
+  standard-cell mappers, which take a file name.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_SesReadGenlib( Io_Ses_t * p, Mio_Library_t ** ppLib, Amap_Lib_t ** ppLib2 )
+{
+    FILE * pFile;
+    char * pFileName;
+    int fd, RetValue;
+    if ( p->nInts != 2 || !Io_SesStrIsOk(p, p->pInts[0]) || Io_SesStr(p, p->pInts[1]) == NULL )
+    {
+        printf( "Io_SesReadGenlib(): The genlib library section is corrupted.\n" );
+        return 0;
+    }
+    fd = Util_SignalTmpFile( "__abctmp_", ".genlib", &pFileName );
+    if ( fd == -1 )
+    {
+        printf( "Io_SesReadGenlib(): Cannot create a temporary file.\n" );
+        return 0;
+    }
+#ifdef WIN32
+    _close( fd );
+#else
+    close( fd );
+#endif
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Io_SesReadGenlib(): Cannot open the temporary file \"%s\".\n", pFileName );
+        Util_SignalTmpFileRemove( pFileName, 0 );
+        ABC_FREE( pFileName );
+        return 0;
+    }
+    RetValue = (fputs( Io_SesStr(p, p->pInts[1]), pFile ) >= 0);
+    RetValue &= (fclose( pFile ) == 0);
+    if ( !RetValue )
+    {
+        printf( "Io_SesReadGenlib(): Cannot write the temporary file \"%s\".\n", pFileName );
+        Util_SignalTmpFileRemove( pFileName, 0 );
+        ABC_FREE( pFileName );
+        return 0;
+    }
+    *ppLib  = Mio_LibraryRead( pFileName, NULL, 0 );
+    *ppLib2 = *ppLib ? Amap_LibReadAndPrepare( pFileName, 0, 0 ) : NULL;
+    Util_SignalTmpFileRemove( pFileName, 0 );
+    ABC_FREE( pFileName );
+    if ( *ppLib == NULL || *ppLib2 == NULL )
+    {
+        if ( *ppLib )
+            Mio_LibraryDelete( *ppLib );
+        *ppLib = NULL;
+        printf( "Io_SesReadGenlib(): Cannot parse the genlib library.\n" );
+        return 0;
+    }
+    Mio_LibrarySetName( *ppLib, Io_SesStr(p, p->pInts[0]) );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the section with the counter-example.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Io_Ses_t * Io_SesDeriveCex( Abc_Cex_t * pCex )
+{
+    Io_Ses_t * p;
+    int i, nWords = sizeof(Abc_Cex_t) / sizeof(int) + Abc_BitWordNum(pCex->nBits);
+    p = Io_SesStart( IO_SES_CEX, nWords );
+    for ( i = 0; i < nWords; i++ )
+        Vec_IntPush( p->vInts, ((int *)pCex)[i] );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the counter-example from the section.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Cex_t * Io_SesReadCex( Io_Ses_t * p )
+{
+    Abc_Cex_t * pCex = (Abc_Cex_t *)p->pInts;
+    int nHead = sizeof(Abc_Cex_t) / sizeof(int);
+    if ( p->nInts < nHead || pCex->iPo < 0 || pCex->iFrame < 0 || pCex->nRegs < 0 || pCex->nPis < 0 ||
+         pCex->nBits != pCex->nRegs + (ABC_INT64_T)pCex->nPis * (pCex->iFrame + 1) || 
+         p->nInts != nHead + Abc_BitWordNum(pCex->nBits) )
+    {
+        printf( "Io_SesReadCex(): The counter-example section is corrupted.\n" );
+        return NULL;
+    }
+    pCex = (Abc_Cex_t *)ABC_ALLOC( int, p->nInts );
+    memcpy( pCex, p->pInts, sizeof(int) * p->nInts );
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the session into a binary file.]
+
+  Description [Saves the current network, the AIG of the &-space,
+  the LUT and genlib libraries, and the counter-example, if present.]
+
+  SideEffects [Logic networks with BDDs or AIGs are converted into SOPs.]
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_WriteSession( Abc_Frame_t * pAbc, char * pFileName, int fVerbose )
+{
+    Io_SesHead_t Head;
+    Abc_Ntk_t * pNtk = pAbc->pNtkCur;
+    FILE * pFile;
+    int nSections = 0, Terminator[4] = {0}, RetValue;
+    int clk = clock();
+    if ( pNtk && !Abc_NtkIsStrash(pNtk) && !Abc_NtkIsLogic(pNtk) )
+    {
+        printf( "Io_WriteSession(): Saving netlists is not supported; use \"logic\" or \"strash\".\n" );
+        return 0;
+    }
+    if ( pNtk && Abc_NtkIsStrash(pNtk) && Abc_NtkGetChoiceNum(pNtk) )
+        printf( "Io_WriteSession(): Warning! Structural choices of the network are not saved.\n" );
+    if ( pNtk && Abc_NtkIsLogic(pNtk) && !Abc_NtkHasSop(pNtk) && !Abc_NtkHasMapping(pNtk) && !Abc_NtkToSop(pNtk, 0) )
+    {
+        printf( "Io_WriteSession(): Converting the network to SOPs has failed.\n" );
+        return 0;
+    }
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Io_WriteSession(): Cannot open the output file \"%s\".\n", pFileName );
+        return 0;
+    }
+    memset( &Head, 0, sizeof(Io_SesHead_t) );
+    strcpy( Head.Magic, "ABC-SES" );
+    Head.Version     = IO_SES_VERSION;
+    Head.ByteOrder   = IO_SES_BYTE_ORDER;
+    Head.nGiaObjSize = sizeof(Gia_Obj_t);
+    Head.nLutSizeMax = IF_MAX_LUTSIZE;
+    RetValue = (fwrite( &Head, sizeof(Io_SesHead_t), 1, pFile ) == 1);
+    if ( pAbc->pLibGen )
+        RetValue &= Io_SesWrite( pFile, Io_SesDeriveGenlib((Mio_Library_t *)pAbc->pLibGen) ), nSections++;
+    if ( pAbc->pLibLut )
+        RetValue &= Io_SesWrite( pFile, Io_SesDeriveLutLib((If_Lib_t *)pAbc->pLibLut) ), nSections++;
+    if ( pNtk )
+        RetValue &= Io_SesWrite( pFile, Io_SesDeriveNtk(pNtk) ), nSections++;
+    if ( pAbc->pGia )
+        RetValue &= Io_SesWrite( pFile, Io_SesDeriveGia(pAbc->pGia) ), nSections++;
+    if ( pAbc->pCex )
+        RetValue &= Io_SesWrite( pFile, Io_SesDeriveCex(pAbc->pCex) ), nSections++;
+    RetValue &= (fwrite( Terminator, sizeof(int), 4, pFile ) == 4);
+    RetValue &= (fclose( pFile ) == 0);
+    if ( !RetValue )
+    {
+        printf( "Io_WriteSession(): Writing the file \"%s\" has failed.\n", pFileName );
+        return 0;
+    }
+    if ( fVerbose )
+    {
+        printf( "Saved %d section(s) into file \"%s\" (%.2f MB).  ", nSections, pFileName, 1.0*Extra_FileSize(pFileName)/(1<<20) );
+        ABC_PRT( "Time", clock() - clk );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the session from a binary file.]
+
+  Description [Replaces the parts of the session present in the file.
+  All sections are restored before any of them is installed, so that
+  the session does not change if the file cannot be read completely.
+  The mapped network is restored using the genlib library of the file,
+  if present, which is installed temporarily for this purpose.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_ReadSession( Abc_Frame_t * pAbc, char * pFileName, int fVerbose )
+{
+    Io_SesHead_t * pHead;
+    Io_Ses_t Sec, * p = &Sec;
+    Mio_Library_t * pLibGen = NULL, * pLibGenOld;
+    Amap_Lib_t * pLibGen2 = NULL;
+    If_Lib_t * pLibLut = NULL;
+    Abc_Ntk_t * pNtk = NULL;
+    Gia_Man_t * pGia = NULL;
+    Abc_Cex_t * pCex = NULL;
+    char * pContents, * pCur;
+    size_t nFileSize;
+    int nSections = 0, RetValue = 1;
+    int clk = clock();
+    pContents = Gia_FileMap( pFileName, &nFileSize );
+    if ( pContents == NULL )
+        return 0;
+    pHead = (Io_SesHead_t *)pContents;
+    if ( nFileSize < sizeof(Io_SesHead_t) || strcmp(pHead->Magic, "ABC-SES") )
+    {
+        printf( "Io_ReadSession(): The file \"%s\" is not an ABC session.\n", pFileName );
+        Gia_FileUnmap( pContents, nFileSize );
+        return 0;
+    }
+    if ( pHead->Version != IO_SES_VERSION || pHead->ByteOrder != IO_SES_BYTE_ORDER ||
+         pHead->nGiaObjSize != (int)sizeof(Gia_Obj_t) || pHead->nLutSizeMax != IF_MAX_LUTSIZE )
+    {
+        printf( "Io_ReadSession(): The session in file \"%s\" was saved by an incompatible binary.\n", pFileName );
+        Gia_FileUnmap( pContents, nFileSize );
+        return 0;
+    }
+    memset( p, 0, sizeof(Io_Ses_t) );
+    for ( pCur = pContents + sizeof(Io_SesHead_t); RetValue; nSections++ )
+    {
+        if ( pCur + 4 * sizeof(int) > pContents + nFileSize )
+        {
+            printf( "Io_ReadSession(): The file \"%s\" is truncated.\n", pFileName );
+            RetValue = 0;
+            break;
+        }
+        p->Type  = ((int *)pCur)[0];
+        p->nInts = ((int *)pCur)[1];
+        p->nStrs = ((int *)pCur)[2];
+        if ( p->Type == IO_SES_NONE )
+            break;
+        pCur += 4 * sizeof(int);
+        if ( p->Type < 0 || p->Type >= IO_SES_VOID || p->nInts < 0 || p->nStrs < 0 || p->nStrs % sizeof(int) ||
+             (size_t)p->nInts * sizeof(int) + (size_t)p->nStrs > (size_t)(pContents + nFileSize - pCur) )
+        {
+            printf( "Io_ReadSession(): The file \"%s\" is corrupted.\n", pFileName );
+            RetValue = 0;
+            break;
+        }
+        p->pInts = (int *)pCur;
+        p->pStrs = (char *)(p->pInts + p->nInts);
+        pCur = p->pStrs + p->nStrs;
+        // the strings are zero-terminated, so the pool ends with zero
+        if ( p->nStrs > 0 && p->pStrs[p->nStrs-1] != '\0' )
+        {
+            printf( "Io_ReadSession(): The file \"%s\" is corrupted.\n", pFileName );
+            RetValue = 0;
+            break;
+        }
+        if ( (p->Type == IO_SES_GENLIB && pLibGen) || (p->Type == IO_SES_LUTLIB && pLibLut) || 
+             (p->Type == IO_SES_NTK && pNtk) || (p->Type == IO_SES_GIA && pGia) || (p->Type == IO_SES_CEX && pCex) )
+        {
+            printf( "Io_ReadSession(): The file \"%s\" contains a duplicated section.\n", pFileName );
+            RetValue = 0;
+            break;
+        }
+        if ( p->Type == IO_SES_GENLIB )
+            RetValue = Io_SesReadGenlib( p, &pLibGen, &pLibGen2 );
+        else if ( p->Type == IO_SES_LUTLIB )
+            RetValue = ((pLibLut = Io_SesReadLutLib( p )) != NULL);
+        else if ( p->Type == IO_SES_NTK )
+        {
+            // the mapped network refers to the genlib library of the frame
+            pLibGenOld = (Mio_Library_t *)Abc_FrameReadLibGen();
+            if ( pLibGen )
+                Abc_FrameSetLibGen( pLibGen );
+            RetValue = ((pNtk = Io_SesReadNtk( p )) != NULL);
+            Abc_FrameSetLibGen( pLibGenOld );
+        }
+        else if ( p->Type == IO_SES_GIA )
+            RetValue = ((pGia = Io_SesReadGia( p )) != NULL);
+        else if ( p->Type == IO_SES_CEX )
+            RetValue = ((pCex = Io_SesReadCex( p )) != NULL);
+    }
+    if ( !RetValue )
+    {
+        // the session is not changed
+        if ( pLibGen )
+            Mio_LibraryDelete( pLibGen );
+        if ( pLibGen2 )
+            Amap_LibFree( pLibGen2 );
+        if ( pLibLut )
+            If_LutLibFree( pLibLut );
+        if ( pNtk )
+            Abc_NtkDelete( pNtk );
+        if ( pGia )
+            Gia_ManStop( pGia );
+        ABC_FREE( pCex );
+        Gia_FileUnmap( pContents, nFileSize );
+        return 0;
+    }
+    // install the restored parts
+    if ( pLibGen )
+    {
+        // free the current superlib because it depends on the old Mio library
+        if ( Abc_FrameReadLibSuper() )
+        {
+            Map_SuperLibFree( (Map_SuperLib_t *)Abc_FrameReadLibSuper() );
+            Abc_FrameSetLibSuper( NULL );
+        }
+        Mio_LibraryDelete( (Mio_Library_t *)Abc_FrameReadLibGen() );
+        Abc_FrameSetLibGen( pLibGen );
+        Amap_LibFree( (Amap_Lib_t *)Abc_FrameReadLibGen2() );
+        Abc_FrameSetLibGen2( pLibGen2 );
+    }
+    if ( pLibLut )
+    {
+        If_LutLibFree( (If_Lib_t *)Abc_FrameReadLibLut() );
+        Abc_FrameSetLibLut( pLibLut );
+    }
+    if ( pNtk )
+    {
+        Abc_FrameReplaceCurrentNetwork( pAbc, pNtk );
+        Abc_FrameClearVerifStatus( pAbc );
+    }
+    if ( pGia )
+    {
+        if ( pAbc->pGia )
+            Gia_ManStop( pAbc->pGia );
+        pAbc->pGia = pGia;
+    }
+    if ( pCex )
+        Abc_FrameSetCex( pCex );
+    Gia_FileUnmap( pContents, nFileSize );
+    if ( fVerbose && RetValue )
+    {
+        printf( "Restored %d section(s) from file \"%s\" (%.2f MB).  ", nSections, pFileName, 1.0*nFileSize/(1<<20) );
+        ABC_PRT( "Time", clock() - clk );
+    }
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
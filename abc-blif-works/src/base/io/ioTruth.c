@@ -0,0 +1,511 @@
+/**CFile****************************************************************
+
+  FileName    [ioTruth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Reading and writing truth tables in the binary format.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: ioTruth.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "ioAbc.h"
+#include "gia.h"
+#include "zlib.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    The binary truth table file starts with a fixed header followed by
+    the truth tables of all functions, each stored as nWords 64-bit words
+    with minterm 0 in the least significant bit of the first word.
+    Functions of less than six variables occupy one word and are stored
+    replicated to fill it. The file is mapped into memory when reading;
+    the files with extension ".gz" are compressed and decompressed by zlib.
+*/
+
+#define IO_TT_VERSION    1
+#define IO_TT_BYTE_ORDER 0x01020304
+#define IO_TT_VAR_MAX    24
+
+typedef struct Io_TtHead_t_ Io_TtHead_t;
+struct Io_TtHead_t_
+{
+    char             Magic[8];      // "ABC-TT"
+    int              Version;       // format version
+    int              ByteOrder;     // detects the byte order of the writer
+    int              nVars;         // the number of variables
+    int              nFuncs;        // the number of functions
+    int              nWords;        // the number of words in each function
+    int              Reserved;      // reserved for the future use
+};
+
+static word s_Truths6[6] = {
+    0xAAAAAAAAAAAAAAAA,
+    0xCCCCCCCCCCCCCCCC,
+    0xF0F0F0F0F0F0F0F0,
+    0xFF00FF00FF00FF00,
+    0xFFFF0000FFFF0000,
+    0xFFFFFFFF00000000
+};
+
+static inline int Io_TtWordNum( int nVars ) { return nVars <= 6 ? 1 : (1 << (nVars - 6));  }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Replicates the truth tables of less than six variables.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_TtStretch( word * pTruths, int nVars, int nFuncs )
+{
+    int i, k;
+    if ( nVars >= 6 )
+        return;
+    for ( i = 0; i < nFuncs; i++ )
+        for ( k = nVars; k < 6; k++ )
+        {
+            pTruths[i] &= ~(~(word)0 << (1 << k));
+            pTruths[i] |= pTruths[i] << (1 << k);
+        }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the truth tables into the binary file.]
+
+  Description [The array contains nFuncs truth tables of nVars variables,
+  each occupying max(1, 2^(nVars-6)) words.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_WriteTruthBin( char * pFileName, word * pTruths, int nVars, int nFuncs )
+{
+    Io_TtHead_t Head;
+    word * pCopy = NULL;
+    int nWords = Io_TtWordNum( nVars );
+    int nBytes = sizeof(word) * nWords * nFuncs;
+    int fGzip = strlen(pFileName) > 3 && !strncmp( pFileName + strlen(pFileName) - 3, ".gz", 3 );
+    int RetValue = 1;
+    assert( nVars >= 0 && nVars <= IO_TT_VAR_MAX && nFuncs >= 0 );
+    assert( (double)sizeof(word) * nWords * nFuncs < (double)0x7FFFFFFF );
+    memset( &Head, 0, sizeof(Io_TtHead_t) );
+    strcpy( Head.Magic, "ABC-TT" );
+    Head.Version   = IO_TT_VERSION;
+    Head.ByteOrder = IO_TT_BYTE_ORDER;
+    Head.nVars     = nVars;
+    Head.nFuncs    = nFuncs;
+    Head.nWords    = nWords;
+    if ( nVars < 6 )
+    {
+        pCopy = ABC_ALLOC( word, nFuncs );
+        memcpy( pCopy, pTruths, sizeof(word) * nFuncs );
+        Io_TtStretch( pCopy, nVars, nFuncs );
+        pTruths = pCopy;
+    }
+    if ( fGzip )
+    {
+        gzFile pFile = gzopen( pFileName, "wb" );
+        if ( pFile == NULL )
+        {
+            printf( "Io_WriteTruthBin(): Cannot open the output file \"%s\".\n", pFileName );
+            ABC_FREE( pCopy );
+            return 0;
+        }
+        if ( gzwrite( pFile, &Head, sizeof(Io_TtHead_t) ) != (int)sizeof(Io_TtHead_t) ||
+             (nBytes > 0 && gzwrite( pFile, pTruths, nBytes ) != nBytes) )
+            RetValue = 0;
+        if ( gzclose( pFile ) != Z_OK )
+            RetValue = 0;
+    }
+    else
+    {
+        FILE * pFile = fopen( pFileName, "wb" );
+        if ( pFile == NULL )
+        {
+            printf( "Io_WriteTruthBin(): Cannot open the output file \"%s\".\n", pFileName );
+            ABC_FREE( pCopy );
+            return 0;
+        }
+        if ( fwrite( &Head, sizeof(Io_TtHead_t), 1, pFile ) != 1 ||
+             fwrite( pTruths, sizeof(word), nWords * nFuncs, pFile ) != (size_t)(nWords * nFuncs) )
+            RetValue = 0;
+        if ( fclose( pFile ) != 0 )
+            RetValue = 0;
+    }
+    ABC_FREE( pCopy );
+    if ( !RetValue )
+        printf( "Io_WriteTruthBin(): Writing the output file \"%s\" has failed.\n", pFileName );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the header of the binary truth table file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_TtCheckHead( Io_TtHead_t * pHead, char * pFileName )
+{
+    if ( strncmp( pHead->Magic, "ABC-TT", 8 ) )
+    {
+        printf( "Io_ReadTruthBin(): The file \"%s\" is not a binary truth table file.\n", pFileName );
+        return 0;
+    }
+    if ( pHead->ByteOrder != IO_TT_BYTE_ORDER )
+    {
+        printf( "Io_ReadTruthBin(): The file \"%s\" was written on a machine with a different byte order.\n", pFileName );
+        return 0;
+    }
+    if ( pHead->Version != IO_TT_VERSION )
+    {
+        printf( "Io_ReadTruthBin(): The file \"%s\" has unsupported version %d.\n", pFileName, pHead->Version );
+        return 0;
+    }
+    if ( pHead->nVars < 0 || pHead->nVars > IO_TT_VAR_MAX || pHead->nFuncs < 0 || pHead->nWords != Io_TtWordNum(pHead->nVars) ||
+         (double)sizeof(word) * pHead->nWords * pHead->nFuncs >= (double)0x7FFFFFFF )
+    {
+        printf( "Io_ReadTruthBin(): The header of the file \"%s\" is corrupted.\n", pFileName );
+        return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the truth tables from the binary file.]
+
+  Description [Returns the array of truth tables, which should be
+  deallocated by the user, and their number and support size.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word * Io_ReadTruthBin( char * pFileName, int * pnVars, int * pnFuncs )
+{
+    Io_TtHead_t Head;
+    word * pTruths = NULL;
+    double nBytes;
+    int fGzip = strlen(pFileName) > 3 && !strncmp( pFileName + strlen(pFileName) - 3, ".gz", 3 );
+    if ( fGzip )
+    {
+        gzFile pFile = gzopen( pFileName, "rb" );
+        if ( pFile == NULL )
+        {
+            printf( "Io_ReadTruthBin(): Cannot open the input file \"%s\".\n", pFileName );
+            return NULL;
+        }
+        if ( gzread( pFile, &Head, sizeof(Io_TtHead_t) ) != (int)sizeof(Io_TtHead_t) )
+            Head.Magic[0] = 0;
+        if ( !Io_TtCheckHead( &Head, pFileName ) )
+        {
+            gzclose( pFile );
+            return NULL;
+        }
+        nBytes = (double)sizeof(word) * Head.nWords * Head.nFuncs;
+        pTruths = ABC_ALLOC( word, Abc_MaxInt(1, Head.nWords * Head.nFuncs) );
+        if ( gzread( pFile, pTruths, (unsigned)nBytes ) != (int)nBytes )
+        {
+            printf( "Io_ReadTruthBin(): The file \"%s\" is truncated.\n", pFileName );
+            ABC_FREE( pTruths );
+        }
+        gzclose( pFile );
+    }
+    else
+    {
+        size_t nFileSize;
+        char * pContents = Gia_FileMap( pFileName, &nFileSize );
+        if ( pContents == NULL )
+            return NULL;
+        if ( nFileSize < sizeof(Io_TtHead_t) )
+            Head.Magic[0] = 0;
+        else
+            memcpy( &Head, pContents, sizeof(Io_TtHead_t) );
+        if ( !Io_TtCheckHead( &Head, pFileName ) )
+        {
+            Gia_FileUnmap( pContents, nFileSize );
+            return NULL;
+        }
+        nBytes = (double)sizeof(word) * Head.nWords * Head.nFuncs;
+        if ( (double)nFileSize < sizeof(Io_TtHead_t) + nBytes )
+            printf( "Io_ReadTruthBin(): The file \"%s\" is truncated.\n", pFileName );
+        else
+        {
+            pTruths = ABC_ALLOC( word, Abc_MaxInt(1, Head.nWords * Head.nFuncs) );
+            memcpy( pTruths, pContents + sizeof(Io_TtHead_t), (size_t)nBytes );
+        }
+        Gia_FileUnmap( pContents, nFileSize );
+    }
+    if ( pTruths == NULL )
+        return NULL;
+    if ( pnVars )
+        *pnVars = Head.nVars;
+    if ( pnFuncs )
+        *pnFuncs = Head.nFuncs;
+    return pTruths;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the AIG of the function using Shannon expansion.]
+
+  Description [The truth table of iVar variables is stored in nWords words.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Obj_t * Io_TtToAig6_rec( Abc_Ntk_t * pNtk, word t, int iVar )
+{
+    Abc_Obj_t * pRes0, * pRes1;
+    word c0, c1;
+    if ( t == 0 )
+        return Abc_ObjNot( Abc_AigConst1(pNtk) );
+    if ( ~t == 0 )
+        return Abc_AigConst1(pNtk);
+    assert( iVar > 0 );
+    for ( iVar--; iVar >= 0; iVar-- )
+    {
+        c0 = (t & ~s_Truths6[iVar]) | ((t & ~s_Truths6[iVar]) << (1 << iVar));
+        c1 = (t &  s_Truths6[iVar]) | ((t &  s_Truths6[iVar]) >> (1 << iVar));
+        if ( c0 != c1 )
+            break;
+    }
+    assert( iVar >= 0 );
+    pRes0 = Io_TtToAig6_rec( pNtk, c0, iVar );
+    pRes1 = Io_TtToAig6_rec( pNtk, c1, iVar );
+    return Abc_AigMux( (Abc_Aig_t *)pNtk->pManFunc, Abc_NtkPi(pNtk, iVar), pRes1, pRes0 );
+}
+static Abc_Obj_t * Io_TtToAig_rec( Abc_Ntk_t * pNtk, word * pTruth, int nWords, int iVar )
+{
+    Abc_Obj_t * pRes0, * pRes1;
+    int w;
+    if ( nWords == 1 )
+        return Io_TtToAig6_rec( pNtk, pTruth[0], 6 );
+    // skip the variables not in the support
+    while ( nWords > 1 && !memcmp( pTruth, pTruth + nWords/2, sizeof(word) * nWords/2 ) )
+        nWords /= 2, iVar--;
+    if ( nWords == 1 )
+        return Io_TtToAig6_rec( pNtk, pTruth[0], 6 );
+    // check for constants
+    for ( w = 0; w < nWords; w++ )
+        if ( pTruth[w] != 0 )
+            break;
+    if ( w == nWords )
+        return Abc_ObjNot( Abc_AigConst1(pNtk) );
+    for ( w = 0; w < nWords; w++ )
+        if ( ~pTruth[w] != 0 )
+            break;
+    if ( w == nWords )
+        return Abc_AigConst1(pNtk);
+    pRes0 = Io_TtToAig_rec( pNtk, pTruth, nWords/2, iVar-1 );
+    pRes1 = Io_TtToAig_rec( pNtk, pTruth + nWords/2, nWords/2, iVar-1 );
+    return Abc_AigMux( (Abc_Aig_t *)pNtk->pManFunc, Abc_NtkPi(pNtk, iVar-1), pRes1, pRes0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the strashed network implementing the truth tables.]
+
+  Description [The network has nVars primary inputs shared by the nFuncs
+  primary outputs.]
+
+  SideEffects [Replicates the truth tables of less than six variables.]
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_NtkFromTruthBin( word * pTruths, int nVars, int nFuncs )
+{
+    Abc_Ntk_t * pNtk;
+    Abc_Obj_t * pObj;
+    int nWords = Io_TtWordNum( nVars );
+    int i;
+    pNtk = Abc_NtkAlloc( ABC_NTK_STRASH, ABC_FUNC_AIG, 1 );
+    pNtk->pName = Extra_UtilStrsav( "truth" );
+    for ( i = 0; i < nVars; i++ )
+        Abc_NtkCreatePi( pNtk );
+    Io_TtStretch( pTruths, nVars, nFuncs );
+    for ( i = 0; i < nFuncs; i++ )
+    {
+        pObj = Abc_NtkCreatePo( pNtk );
+        Abc_ObjAddFanin( pObj, Io_TtToAig_rec( pNtk, pTruths + i * nWords, nWords, nVars ) );
+    }
+    Abc_NtkAddDummyPiNames( pNtk );
+    Abc_NtkAddDummyPoNames( pNtk );
+    if ( !Abc_NtkCheck( pNtk ) )
+    {
+        printf( "Io_NtkFromTruthBin(): Network check has failed.\n" );
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    return pNtk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the simulation slot of the node.]
+
+  Description [The slots are recycled after the last fanout of the node
+  is simulated, so the memory is proportional to the width of the AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word * Io_TtSimSlot( Vec_Wrd_t * vSims, Vec_Int_t * vSlots, Abc_Obj_t * pObj, int nWords )
+{
+    return Vec_WrdArray(vSims) + nWords * Vec_IntEntry( vSlots, pObj->Id );
+}
+static inline word * Io_TtSimAlloc( Vec_Wrd_t * vSims, Vec_Int_t * vSlots, Vec_Int_t * vFree, Abc_Obj_t * pObj, int nWords )
+{
+    int iSlot, w;
+    if ( Vec_IntSize(vFree) > 0 )
+        iSlot = Vec_IntPop( vFree );
+    else
+    {
+        iSlot = Vec_WrdSize(vSims) / nWords;
+        for ( w = 0; w < nWords; w++ )
+            Vec_WrdPush( vSims, 0 );
+    }
+    Vec_IntWriteEntry( vSlots, pObj->Id, iSlot );
+    return Io_TtSimSlot( vSims, vSlots, pObj, nWords );
+}
+static inline void Io_TtSimDeref( Vec_Int_t * vRefs, Vec_Int_t * vSlots, Vec_Int_t * vFree, Abc_Obj_t * pObj )
+{
+    if ( !Abc_ObjIsNode(pObj) )
+        return;
+    Vec_IntAddToEntry( vRefs, pObj->Id, -1 );
+    if ( Vec_IntEntry(vRefs, pObj->Id) == 0 )
+        Vec_IntPush( vFree, Vec_IntEntry(vSlots, pObj->Id) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the truth tables of the primary outputs.]
+
+  Description [Returns the array of truth tables in terms of the primary
+  inputs or NULL if the network is sequential or has too many inputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word * Io_NtkToTruthBin( Abc_Ntk_t * pNtk )
+{
+    Abc_Ntk_t * pAig;
+    Abc_Obj_t * pObj;
+    Vec_Ptr_t * vNodes;
+    Vec_Wrd_t * vSims;
+    Vec_Int_t * vSlots, * vRefs, * vFree;
+    word * pTruths, * pSim, * pSim0, * pSim1, Mask0, Mask1;
+    int nVars = Abc_NtkPiNum(pNtk);
+    int nWords = Io_TtWordNum( nVars );
+    int i, w;
+    if ( Abc_NtkLatchNum(pNtk) > 0 )
+    {
+        printf( "Io_NtkToTruthBin(): The network is sequential.\n" );
+        return NULL;
+    }
+    if ( nVars > IO_TT_VAR_MAX )
+    {
+        printf( "Io_NtkToTruthBin(): The number of inputs (%d) exceeds the limit (%d).\n", nVars, IO_TT_VAR_MAX );
+        return NULL;
+    }
+    pAig = Abc_NtkIsStrash(pNtk) ? pNtk : Abc_NtkStrash( pNtk, 0, 0, 0 );
+    if ( pAig == NULL )
+        return NULL;
+    // count the fanouts of the nodes, including the combinational outputs
+    vRefs  = Vec_IntStart( Abc_NtkObjNumMax(pAig) );
+    vSlots = Vec_IntStart( Abc_NtkObjNumMax(pAig) );
+    vFree  = Vec_IntAlloc( 100 );
+    vSims  = Vec_WrdAlloc( nWords * (Abc_NtkPiNum(pAig) + 100) );
+    Abc_AigForEachAnd( pAig, pObj, i )
+        Vec_IntWriteEntry( vRefs, pObj->Id, Abc_ObjFanoutNum(pObj) );
+    // assign the elementary truth tables
+    pSim = Io_TtSimAlloc( vSims, vSlots, vFree, Abc_AigConst1(pAig), nWords );
+    for ( w = 0; w < nWords; w++ )
+        pSim[w] = ~(word)0;
+    Abc_NtkForEachPi( pAig, pObj, i )
+    {
+        pSim = Io_TtSimAlloc( vSims, vSlots, vFree, pObj, nWords );
+        for ( w = 0; w < nWords; w++ )
+            pSim[w] = i < 6 ? s_Truths6[i] : (((w >> (i - 6)) & 1) ? ~(word)0 : 0);
+    }
+    // simulate the nodes in the topological order
+    vNodes = Abc_AigDfs( pAig, 0, 0 );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+    {
+        pSim  = Io_TtSimAlloc( vSims, vSlots, vFree, pObj, nWords );
+        pSim0 = Io_TtSimSlot( vSims, vSlots, Abc_ObjFanin0(pObj), nWords );
+        pSim1 = Io_TtSimSlot( vSims, vSlots, Abc_ObjFanin1(pObj), nWords );
+        Mask0 = Abc_ObjFaninC0(pObj) ? ~(word)0 : 0;
+        Mask1 = Abc_ObjFaninC1(pObj) ? ~(word)0 : 0;
+        for ( w = 0; w < nWords; w++ )
+            pSim[w] = (pSim0[w] ^ Mask0) & (pSim1[w] ^ Mask1);
+        Io_TtSimDeref( vRefs, vSlots, vFree, Abc_ObjFanin0(pObj) );
+        Io_TtSimDeref( vRefs, vSlots, vFree, Abc_ObjFanin1(pObj) );
+    }
+    Vec_PtrFree( vNodes );
+    // collect the truth tables of the outputs
+    pTruths = ABC_ALLOC( word, Abc_MaxInt(1, nWords * Abc_NtkPoNum(pAig)) );
+    Abc_NtkForEachPo( pAig, pObj, i )
+    {
+        pSim0 = Io_TtSimSlot( vSims, vSlots, Abc_ObjFanin0(pObj), nWords );
+        Mask0 = Abc_ObjFaninC0(pObj) ? ~(word)0 : 0;
+        for ( w = 0; w < nWords; w++ )
+            pTruths[i * nWords + w] = pSim0[w] ^ Mask0;
+    }
+    Io_TtStretch( pTruths, nVars, Abc_NtkPoNum(pAig) );
+    Vec_WrdFree( vSims );
+    Vec_IntFree( vSlots );
+    Vec_IntFree( vRefs );
+    Vec_IntFree( vFree );
+    if ( pAig != pNtk )
+        Abc_NtkDelete( pAig );
+    return pTruths;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -20,6 +20,9 @@
 
 #include "ioAbc.h"
 #include "main.h"
+#include "gia.h"
+
+#include <stdarg.h>
 
 ABC_NAMESPACE_IMPL_START
 
@@ -807,6 +810,204 @@ FILE * Io_FileOpen( const char * FileName, const char * PathVar, const char * Mo
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the buffered text output.]
+
+  Description [The text is collected in the buffer and passed in large
+  blocks to the chunked output stream of the AIGER writer. The stream 
+  writes the data on a background thread once the file gets large. 
+  Returns NULL if the file cannot be opened.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Io_Out_t * Io_OutStart( char * pFileName )
+{
+    Io_Out_t * p;
+    Gia_AigWr_t * pStream;
+    pStream = Gia_AigWrStart( pFileName );
+    if ( pStream == NULL )
+        return NULL;
+    p = ABC_CALLOC( Io_Out_t, 1 );
+    p->pStream = pStream;
+    p->pBuffer = ABC_ALLOC( char, IO_OUT_BUFFER );
+    p->pCur    = p->pBuffer;
+    p->pLimit  = p->pBuffer + IO_OUT_BUFFER;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Passes the collected text to the output stream.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Io_OutFlush( Io_Out_t * p )
+{
+    Gia_AigWrWrite( (Gia_AigWr_t *)p->pStream, p->pBuffer, p->pCur - p->pBuffer );
+    p->pCur = p->pBuffer;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the buffered text output.]
+
+  Description [Returns 1 if all text has been written successfully.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_OutStop( Io_Out_t * p )
+{
+    int RetValue;
+    Io_OutFlush( p );
+    RetValue = Gia_AigWrStop( (Gia_AigWr_t *)p->pStream );
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints formatted text into the buffered output.]
+
+  Description [The formats using only %s, %d, %c and %% conversions, with 
+  an optional field width (a number or '*') and the '-' or '0' flag, are
+  expanded directly into the buffer. Other formats (floating-point numbers,
+  etc) are printed using vsnprintf().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_OutPrintf( Io_Out_t * p, const char * pFormat, ... )
+{
+    char Digits[16], * pStr, * pTemp;
+    const char * pCur;
+    unsigned Value;
+    int Num, nSize, nWidth, nLength, fLeft, fZero, fPlain = 1;
+    va_list ap;
+    // check if the format has only plain conversions
+    for ( pCur = pFormat; *pCur && fPlain; pCur++ )
+    {
+        if ( *pCur != '%' )
+            continue;
+        if ( *++pCur == '-' || *pCur == '0' )
+            pCur++;
+        if ( *pCur == '*' )
+            pCur++;
+        while ( *pCur >= '0' && *pCur <= '9' )
+            pCur++;
+        // stop at the end of the format, which may follow a trailing '%'
+        if ( *pCur == 0 || strchr( "sdc%", *pCur ) == NULL )
+        {
+            fPlain = 0;
+            break;
+        }
+    }
+    if ( fPlain )
+    {
+        nSize = 0;
+        va_start( ap, pFormat );
+        for ( pCur = pFormat; *pCur; pCur++ )
+        {
+            if ( *pCur != '%' )
+            {
+                Io_OutChar( p, *pCur );
+                nSize++;
+                continue;
+            }
+            fLeft = (*++pCur == '-');
+            fZero = (*pCur == '0');
+            pCur += fLeft || fZero;
+            nWidth = 0;
+            if ( *pCur == '*' )
+            {
+                nWidth = va_arg( ap, int );
+                pCur++;
+            }
+            for ( ; *pCur >= '0' && *pCur <= '9'; pCur++ )
+                nWidth = 10 * nWidth + *pCur - '0';
+            if ( nWidth < 0 )
+                fLeft = 1, nWidth = -nWidth;
+            if ( *pCur == 's' )
+            {
+                pStr = va_arg( ap, char * );
+                if ( pStr == NULL )
+                    pStr = "(null)";
+            }
+            else if ( *pCur == 'd' )
+            {
+                Num   = va_arg( ap, int );
+                Value = Num < 0 ? 0 - (unsigned)Num : (unsigned)Num;
+                pStr  = Digits + 15;
+                *pStr = 0;
+                do {
+                    *--pStr = '0' + Value % 10;
+                } while ( Value /= 10 );
+                if ( Num < 0 )
+                    *--pStr = '-';
+            }
+            else if ( *pCur == 'c' )
+            {
+                Digits[0] = (char)va_arg( ap, int );
+                Digits[1] = 0;
+                pStr = Digits;
+            }
+            else
+                pStr = "%";
+            // write the text padded to the field width (%c may print '\0')
+            nLength = (*pCur == 'c') ? 1 : strlen( pStr );
+            nSize  += Abc_MaxInt( nLength, nWidth );
+            if ( fZero && !fLeft && *pCur == 'd' )
+            {
+                if ( *pStr == '-' )
+                    Io_OutChar( p, *pStr++ );
+                for ( ; nWidth > nLength; nWidth-- )
+                    Io_OutChar( p, '0' );
+            }
+            for ( ; !fLeft && nWidth > nLength; nWidth-- )
+                Io_OutChar( p, ' ' );
+            if ( *pCur == 'c' )
+                Io_OutChar( p, *pStr );
+            else
+                Io_OutStr( p, pStr );
+            for ( ; fLeft && nWidth > nLength; nWidth-- )
+                Io_OutChar( p, ' ' );
+        }
+        va_end( ap );
+        return nSize;
+    }
+    va_start( ap, pFormat );
+    nSize = vsnprintf( p->pCur, p->pLimit - p->pCur, pFormat, ap );
+    va_end( ap );
+    if ( nSize >= 0 && nSize < p->pLimit - p->pCur )
+    {
+        p->pCur += nSize;
+        return nSize;
+    }
+    // the text does not fit into the rest of the buffer
+    Io_OutFlush( p );
+    pTemp = ABC_ALLOC( char, nSize + 1 );
+    va_start( ap, pFormat );
+    vsnprintf( pTemp, nSize + 1, pFormat, ap );
+    va_end( ap );
+    Gia_AigWrWrite( (Gia_AigWr_t *)p->pStream, pTemp, nSize );
+    ABC_FREE( pTemp );
+    return nSize;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
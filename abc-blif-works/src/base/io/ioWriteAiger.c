@@ -23,6 +23,7 @@
 
 #include "bzlib.h"
 #include "ioAbc.h"
+#include "gia.h"
 
 #include <stdarg.h>
 #include "zlib.h"
@@ -387,183 +388,8 @@ void Io_WriteAiger_old( Abc_Ntk_t * pNtk, char * pFileName, int fWriteSymbols, i
 
   Synopsis    [Writes the AIG in the binary AIGER format.]
 
-  Description []
-  
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-void Io_WriteAigerGz( Abc_Ntk_t * pNtk, char * pFileName, int fWriteSymbols )
-{
-    ProgressBar * pProgress;
-    gzFile pFile;
-    Abc_Obj_t * pObj, * pDriver;
-    int i, nNodes, Pos, nBufferSize;
-    unsigned char * pBuffer;
-    unsigned uLit0, uLit1, uLit;
-
-    assert( Abc_NtkIsStrash(pNtk) );
-    // start the output stream
-    pFile = gzopen( pFileName, "wb" ); // if pFileName doesn't end in ".gz" then this acts as a passthrough to fopen
-    if ( pFile == NULL )
-    {
-        fprintf( stdout, "Io_WriteAigerGz(): Cannot open the output file \"%s\".\n", pFileName );
-        return;
-    }
-    Abc_NtkForEachLatch( pNtk, pObj, i )
-        if ( !Abc_LatchIsInit0(pObj) )
-        {
-            fprintf( stdout, "Io_WriteAigerGz(): Cannot write AIGER format with non-0 latch init values. Run \"zero\".\n" );
-            return;
-        }
-
-    // set the node numbers to be used in the output file
-    nNodes = 0;
-    Io_ObjSetAigerNum( Abc_AigConst1(pNtk), nNodes++ );
-    Abc_NtkForEachCi( pNtk, pObj, i )
-        Io_ObjSetAigerNum( pObj, nNodes++ );
-    Abc_AigForEachAnd( pNtk, pObj, i )
-        Io_ObjSetAigerNum( pObj, nNodes++ );
-
-    // write the header "M I L O A" where M = I + L + A
-    gzprintf( pFile, "aig %u %u %u %u %u\n", 
-              Abc_NtkPiNum(pNtk) + Abc_NtkLatchNum(pNtk) + Abc_NtkNodeNum(pNtk), 
-              Abc_NtkPiNum(pNtk),
-              Abc_NtkLatchNum(pNtk),
-              Abc_NtkPoNum(pNtk),
-              Abc_NtkNodeNum(pNtk) );
-
-    // if the driver node is a constant, we need to complement the literal below
-    // because, in the AIGER format, literal 0/1 is represented as number 0/1
-    // while, in ABC, constant 1 node has number 0 and so literal 0/1 will be 1/0
-
-    // write latch drivers
-    Abc_NtkForEachLatchInput( pNtk, pObj, i )
-    {
-        pDriver = Abc_ObjFanin0(pObj);
-        gzprintf( pFile, "%u\n", Io_ObjMakeLit( Io_ObjAigerNum(pDriver), Abc_ObjFaninC0(pObj) ^ (Io_ObjAigerNum(pDriver) == 0) ) );
-    }
-
-    // write PO drivers
-    Abc_NtkForEachPo( pNtk, pObj, i )
-    {
-        pDriver = Abc_ObjFanin0(pObj);
-        gzprintf( pFile, "%u\n", Io_ObjMakeLit( Io_ObjAigerNum(pDriver), Abc_ObjFaninC0(pObj) ^ (Io_ObjAigerNum(pDriver) == 0) ) );
-    }
-
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 6 * Abc_NtkNodeNum(pNtk) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    pProgress = Extra_ProgressBarStart( stdout, Abc_NtkObjNumMax(pNtk) );
-    Abc_AigForEachAnd( pNtk, pObj, i )
-    {
-        Extra_ProgressBarUpdate( pProgress, i, NULL );
-        uLit  = Io_ObjMakeLit( Io_ObjAigerNum(pObj), 0 );
-        uLit0 = Io_ObjMakeLit( Io_ObjAigerNum(Abc_ObjFanin0(pObj)), Abc_ObjFaninC0(pObj) );
-        uLit1 = Io_ObjMakeLit( Io_ObjAigerNum(Abc_ObjFanin1(pObj)), Abc_ObjFaninC1(pObj) );
-        assert( uLit0 < uLit1 );
-        Pos = Io_WriteAigerEncode( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Io_WriteAigerEncode( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
-        {
-            printf( "Io_WriteAiger(): AIGER generation has failed because the allocated buffer is too small.\n" );
-	        gzclose( pFile );
-            return;
-        }
-    }
-    assert( Pos < nBufferSize );
-    Extra_ProgressBarStop( pProgress );
-
-    // write the buffer
-    gzwrite(pFile, pBuffer, Pos);
-    ABC_FREE( pBuffer );
-
-    // write the symbol table
-    if ( fWriteSymbols )
-    {
-        // write PIs
-        Abc_NtkForEachPi( pNtk, pObj, i )
-            gzprintf( pFile, "i%d %s\n", i, Abc_ObjName(pObj) );
-        // write latches
-        Abc_NtkForEachLatch( pNtk, pObj, i )
-            gzprintf( pFile, "l%d %s\n", i, Abc_ObjName(Abc_ObjFanout0(pObj)) );
-        // write POs
-        Abc_NtkForEachPo( pNtk, pObj, i )
-            gzprintf( pFile, "o%d %s\n", i, Abc_ObjName(pObj) );
-    }
-
-    // write the comment
-    gzprintf( pFile, "c\n" );
-    if ( pNtk->pName && strlen(pNtk->pName) > 0 )
-        gzprintf( pFile, ".model %s\n", pNtk->pName );
-    gzprintf( pFile, "This file was produced by ABC on %s\n", Extra_TimeStamp() );
-    gzprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
-	gzclose( pFile );
-}
-
- 
-/**Function*************************************************************
-
-  Synopsis    [Procedure to write data into BZ2 file.]
-
-  Description [Based on the vsnprintf() man page.]
-               
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-typedef struct bz2file {
-  FILE   * f;
-  BZFILE * b;
-  char   * buf;
-  int      nBytes;
-  int      nBytesMax;
-} bz2file;
-
-int fprintfBz2Aig( bz2file * b, char * fmt, ... ) {
-    if (b->b) {
-        char * newBuf;
-        int bzError;
-        va_list ap;
-        while (1) {
-            va_start(ap,fmt);
-            b->nBytes = vsnprintf(b->buf,b->nBytesMax,fmt,ap);
-            va_end(ap);
-            if (b->nBytes > -1 && b->nBytes < b->nBytesMax)
-                break;
-            if (b->nBytes > -1)
-                b->nBytesMax = b->nBytes + 1;
-            else
-                b->nBytesMax *= 2;
-            if ((newBuf = ABC_REALLOC( char,b->buf,b->nBytesMax )) == NULL)
-                return -1;
-            else
-                b->buf = newBuf;
-        }
-        BZ2_bzWrite( &bzError, b->b, b->buf, b->nBytes );
-        if (bzError == BZ_IO_ERROR) {
-            fprintf( stdout, "Ioa_WriteBlif(): I/O error writing to compressed stream.\n" );
-            return -1;
-        }
-        return b->nBytes;
-    } else {
-        int n;
-        va_list ap;
-        va_start(ap,fmt);
-        n = vfprintf( b->f, fmt, ap);
-        va_end(ap);
-        return n;
-    }
-}
-
-/**Function*************************************************************
-
-  Synopsis    [Writes the AIG in the binary AIGER format.]
-
-  Description []
+  Description [The AIG is encoded directly into the output stream, which
+  is compressed if the file name ends in ".gz" or ".bz2".]
   
   SideEffects []
 
@@ -573,12 +399,10 @@ int fprintfBz2Aig( bz2file * b, char * fmt, ... ) {
 void Io_WriteAiger( Abc_Ntk_t * pNtk, char * pFileName, int fWriteSymbols, int fCompact )
 {
     ProgressBar * pProgress;
-//    FILE * pFile;
+    Gia_AigWr_t * pFile;
     Abc_Obj_t * pObj, * pDriver;
-    int i, nNodes, nBufferSize, bzError, Pos;
-    unsigned char * pBuffer;
+    int i, nNodes;
     unsigned uLit0, uLit1, uLit;
-    bz2file b;
 
     // check that the network is valid
     assert( Abc_NtkIsStrash(pNtk) );
@@ -589,35 +413,13 @@ void Io_WriteAiger( Abc_Ntk_t * pNtk, char * pFileName, int fWriteSymbols, int f
             return;
         }
 
-    // write the GZ file
-    if (!strncmp(pFileName+strlen(pFileName)-3,".gz",3)) 
-    {
-        Io_WriteAigerGz( pNtk, pFileName, fWriteSymbols );
-        return;
-    }
-
-    memset(&b,0,sizeof(b));
-    b.nBytesMax = (1<<12);
-    b.buf = ABC_ALLOC( char,b.nBytesMax );
-
     // start the output stream
-    b.f = fopen( pFileName, "wb" ); 
-    if ( b.f == NULL )
+    pFile = Gia_AigWrStart( pFileName );
+    if ( pFile == NULL )
     {
-        fprintf( stdout, "Ioa_WriteBlif(): Cannot open the output file \"%s\".\n", pFileName );
-        ABC_FREE(b.buf);
+        fprintf( stdout, "Io_WriteAiger(): Cannot open the output file \"%s\".\n", pFileName );
         return;
     }
-    if (!strncmp(pFileName+strlen(pFileName)-4,".bz2",4)) {
-        b.b = BZ2_bzWriteOpen( &bzError, b.f, 9, 0, 0 );
-        if ( bzError != BZ_OK ) {
-            BZ2_bzWriteClose( &bzError, b.b, 0, NULL, NULL );
-            fprintf( stdout, "Ioa_WriteBlif(): Cannot start compressed stream.\n" );
-            fclose( b.f );
-            ABC_FREE(b.buf);
-            return;
-        }
-    }
 
     // set the node numbers to be used in the output file
     nNodes = 0;
@@ -628,7 +430,7 @@ void Io_WriteAiger( Abc_Ntk_t * pNtk, char * pFileName, int fWriteSymbols, int f
         Io_ObjSetAigerNum( pObj, nNodes++ );
 
     // write the header "M I L O A" where M = I + L + A
-    fprintfBz2Aig( &b, "aig%s %u %u %u %u %u\n", 
+    Gia_AigWrPrintf( pFile, "aig%s %u %u %u %u %u\n", 
         fCompact? "2" : "",
         Abc_NtkPiNum(pNtk) + Abc_NtkLatchNum(pNtk) + Abc_NtkNodeNum(pNtk), 
         Abc_NtkPiNum(pNtk),
@@ -646,40 +448,25 @@ void Io_WriteAiger( Abc_Ntk_t * pNtk, char * pFileName, int fWriteSymbols, int f
         Abc_NtkForEachLatchInput( pNtk, pObj, i )
         {
             pDriver = Abc_ObjFanin0(pObj);
-            fprintfBz2Aig( &b, "%u\n", Io_ObjMakeLit( Io_ObjAigerNum(pDriver), Abc_ObjFaninC0(pObj) ^ (Io_ObjAigerNum(pDriver) == 0) ) );
+            Gia_AigWrPrintf( pFile, "%u\n", Io_ObjMakeLit( Io_ObjAigerNum(pDriver), Abc_ObjFaninC0(pObj) ^ (Io_ObjAigerNum(pDriver) == 0) ) );
         }
         // write PO drivers
         Abc_NtkForEachPo( pNtk, pObj, i )
         {
             pDriver = Abc_ObjFanin0(pObj);
-            fprintfBz2Aig( &b, "%u\n", Io_ObjMakeLit( Io_ObjAigerNum(pDriver), Abc_ObjFaninC0(pObj) ^ (Io_ObjAigerNum(pDriver) == 0) ) );
+            Gia_AigWrPrintf( pFile, "%u\n", Io_ObjMakeLit( Io_ObjAigerNum(pDriver), Abc_ObjFaninC0(pObj) ^ (Io_ObjAigerNum(pDriver) == 0) ) );
         }
     }
     else
     {
         Vec_Int_t * vLits = Io_WriteAigerLiterals( pNtk );
         Vec_Str_t * vBinary = Io_WriteEncodeLiterals( vLits );
-        if ( !b.b )
-            fwrite( Vec_StrArray(vBinary), 1, Vec_StrSize(vBinary), b.f );
-        else
-        {
-            BZ2_bzWrite( &bzError, b.b, Vec_StrArray(vBinary), Vec_StrSize(vBinary) );
-            if (bzError == BZ_IO_ERROR) {
-                fprintf( stdout, "Io_WriteAiger(): I/O error writing to compressed stream.\n" );
-                fclose( b.f );
-                ABC_FREE(b.buf);
-                Vec_StrFree( vBinary );
-                return;
-            }
-        }
+        Gia_AigWrWrite( pFile, Vec_StrArray(vBinary), Vec_StrSize(vBinary) );
         Vec_StrFree( vBinary );
         Vec_IntFree( vLits );
     }
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 6 * Abc_NtkNodeNum(pNtk) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+    // write the nodes
     pProgress = Extra_ProgressBarStart( stdout, Abc_NtkObjNumMax(pNtk) );
     Abc_AigForEachAnd( pNtk, pObj, i )
     {
@@ -688,68 +475,35 @@ void Io_WriteAiger( Abc_Ntk_t * pNtk, char * pFileName, int fWriteSymbols, int f
         uLit0 = Io_ObjMakeLit( Io_ObjAigerNum(Abc_ObjFanin0(pObj)), Abc_ObjFaninC0(pObj) );
         uLit1 = Io_ObjMakeLit( Io_ObjAigerNum(Abc_ObjFanin1(pObj)), Abc_ObjFaninC1(pObj) );
         assert( uLit0 < uLit1 );
-        Pos = Io_WriteAigerEncode( pBuffer, Pos, (unsigned)(uLit  - uLit1) );
-        Pos = Io_WriteAigerEncode( pBuffer, Pos, (unsigned)(uLit1 - uLit0) );
-        if ( Pos > nBufferSize - 10 )
-        {
-            printf( "Io_WriteAiger(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( b.f );
-            ABC_FREE(b.buf);
-            Extra_ProgressBarStop( pProgress );
-            return;
-        }
+        Gia_AigWrEncode( pFile, (unsigned)(uLit  - uLit1) );
+        Gia_AigWrEncode( pFile, (unsigned)(uLit1 - uLit0) );
     }
-    assert( Pos < nBufferSize );
     Extra_ProgressBarStop( pProgress );
 
-    // write the buffer
-    if ( !b.b )
-        fwrite( pBuffer, 1, Pos, b.f );
-    else
-    {
-        BZ2_bzWrite( &bzError, b.b, pBuffer, Pos );
-        if (bzError == BZ_IO_ERROR) {
-            fprintf( stdout, "Io_WriteAiger(): I/O error writing to compressed stream.\n" );
-            fclose( b.f );
-            ABC_FREE(b.buf);
-            return;
-        }
-    }
-    ABC_FREE( pBuffer );
-
     // write the symbol table
     if ( fWriteSymbols )
     {
         // write PIs
         Abc_NtkForEachPi( pNtk, pObj, i )
-            fprintfBz2Aig( &b, "i%d %s\n", i, Abc_ObjName(pObj) );
+            Gia_AigWrPrintf( pFile, "i%d %s\n", i, Abc_ObjName(pObj) );
         // write latches
         Abc_NtkForEachLatch( pNtk, pObj, i )
-            fprintfBz2Aig( &b, "l%d %s\n", i, Abc_ObjName(Abc_ObjFanout0(pObj)) );
+            Gia_AigWrPrintf( pFile, "l%d %s\n", i, Abc_ObjName(Abc_ObjFanout0(pObj)) );
         // write POs
         Abc_NtkForEachPo( pNtk, pObj, i )
-            fprintfBz2Aig( &b, "o%d %s\n", i, Abc_ObjName(pObj) );
+            Gia_AigWrPrintf( pFile, "o%d %s\n", i, Abc_ObjName(pObj) );
     }
 
     // write the comment
-    fprintfBz2Aig( &b, "c" );
+    Gia_AigWrPrintf( pFile, "c" );
     if ( pNtk->pName && strlen(pNtk->pName) > 0 )
-        fprintfBz2Aig( &b, "\n%s%c", pNtk->pName, '\0' );
-    fprintfBz2Aig( &b, "\nThis file was written by ABC on %s\n", Extra_TimeStamp() );
-    fprintfBz2Aig( &b, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+        Gia_AigWrPrintf( pFile, "\n%s%c", pNtk->pName, '\0' );
+    Gia_AigWrPrintf( pFile, "\nThis file was written by ABC on %s\n", Extra_TimeStamp() );
+    Gia_AigWrPrintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
 
     // close the file
-    if (b.b) {
-        BZ2_bzWriteClose( &bzError, b.b, 0, NULL, NULL );
-        if (bzError == BZ_IO_ERROR) {
-            fprintf( stdout, "Io_WriteAiger(): I/O error closing compressed stream.\n" );
-            fclose( b.f );
-            ABC_FREE(b.buf);
-            return;
-        }
-    }
-    fclose( b.f );
-    ABC_FREE(b.buf);
+    if ( !Gia_AigWrStop( pFile ) )
+        fprintf( stdout, "Io_WriteAiger(): I/O error writing the output file \"%s\".\n", pFileName );
 }
 
 
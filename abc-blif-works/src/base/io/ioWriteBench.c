@@ -29,11 +29,11 @@ ABC_NAMESPACE_IMPL_START
 
 static int Io_WriteBenchCheckNames( Abc_Ntk_t * pNtk );
 
-static int Io_WriteBenchOne( FILE * pFile, Abc_Ntk_t * pNtk );
-static int Io_WriteBenchOneNode( FILE * pFile, Abc_Obj_t * pNode );
+static int Io_WriteBenchOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static int Io_WriteBenchOneNode( Io_Out_t * pFile, Abc_Obj_t * pNode );
 
-static int Io_WriteBenchLutOne( FILE * pFile, Abc_Ntk_t * pNtk );
-static int Io_WriteBenchLutOneNode( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t * vTruth );
+static int Io_WriteBenchLutOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static int Io_WriteBenchLutOneNode( Io_Out_t * pFile, Abc_Obj_t * pNode, Vec_Int_t * vTruth );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -53,20 +53,20 @@ static int Io_WriteBenchLutOneNode( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t *
 int Io_WriteBench( Abc_Ntk_t * pNtk, const char * pFileName )
 {
     Abc_Ntk_t * pExdc;
-    FILE * pFile;
+    Io_Out_t * pFile;
     assert( Abc_NtkIsSopNetlist(pNtk) );
     if ( !Io_WriteBenchCheckNames(pNtk) )
     {
         fprintf( stdout, "Io_WriteBench(): Signal names in this benchmark contain parantheses making them impossible to reproduce in the BENCH format. Use \"short_names\".\n" );
         return 0;
     }
-    pFile = fopen( pFileName, "w" );
+    pFile = Io_OutStart( (char *)pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Io_WriteBench(): Cannot open the output file.\n" );
         return 0;
     }
-    fprintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    Io_OutPrintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
     // write the network
     Io_WriteBenchOne( pFile, pNtk );
     // write EXDC network if it exists
@@ -74,7 +74,11 @@ int Io_WriteBench( Abc_Ntk_t * pNtk, const char * pFileName )
     if ( pExdc )
         printf( "Io_WriteBench: EXDC is not written (warning).\n" );
     // finalize the file
-    fclose( pFile );
+    if ( !Io_OutStop( pFile ) )
+    {
+        fprintf( stdout, "Io_WriteBench(): Writing the output file \"%s\" has failed.\n", pFileName );
+        return 0;
+    }
     return 1;
 }
 
@@ -89,7 +93,7 @@ int Io_WriteBench( Abc_Ntk_t * pNtk, const char * pFileName )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_WriteBenchOne( FILE * pFile, Abc_Ntk_t * pNtk )
+int Io_WriteBenchOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     ProgressBar * pProgress;
     Abc_Obj_t * pNode;
@@ -97,11 +101,11 @@ int Io_WriteBenchOne( FILE * pFile, Abc_Ntk_t * pNtk )
 
     // write the PIs/POs/latches
     Abc_NtkForEachPi( pNtk, pNode, i )
-        fprintf( pFile, "INPUT(%s)\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+        Io_OutPrintf( pFile, "INPUT(%s)\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
     Abc_NtkForEachPo( pNtk, pNode, i )
-        fprintf( pFile, "OUTPUT(%s)\n", Abc_ObjName(Abc_ObjFanin0(pNode)) );
+        Io_OutPrintf( pFile, "OUTPUT(%s)\n", Abc_ObjName(Abc_ObjFanin0(pNode)) );
     Abc_NtkForEachLatch( pNtk, pNode, i )
-        fprintf( pFile, "%-11s = DFF(%s)\n", 
+        Io_OutPrintf( pFile, "%-11s = DFF(%s)\n", 
             Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pNode))), Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin0(pNode))) );
 
     // write internal nodes
@@ -127,7 +131,7 @@ int Io_WriteBenchOne( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_WriteBenchOneNode( FILE * pFile, Abc_Obj_t * pNode )
+int Io_WriteBenchOneNode( Io_Out_t * pFile, Abc_Obj_t * pNode )
 {
     int nFanins;
 
@@ -136,27 +140,27 @@ int Io_WriteBenchOneNode( FILE * pFile, Abc_Obj_t * pNode )
     if ( nFanins == 0 )
     {   // write the constant 1 node
         assert( Abc_NodeIsConst1(pNode) );
-        fprintf( pFile, "%-11s",          Abc_ObjName(Abc_ObjFanout0(pNode)) );
-        fprintf( pFile, " = vdd\n" );
+        Io_OutPrintf( pFile, "%-11s",          Abc_ObjName(Abc_ObjFanout0(pNode)) );
+        Io_OutStr( pFile, " = vdd\n" );
     }
     else if ( nFanins == 1 )
     {   // write the interver/buffer
         if ( Abc_NodeIsBuf(pNode) )
         {
-            fprintf( pFile, "%-11s = BUFF(",  Abc_ObjName(Abc_ObjFanout0(pNode)) );
-            fprintf( pFile, "%s)\n",          Abc_ObjName(Abc_ObjFanin0(pNode)) );
+            Io_OutPrintf( pFile, "%-11s = BUFF(",  Abc_ObjName(Abc_ObjFanout0(pNode)) );
+            Io_OutPrintf( pFile, "%s)\n",          Abc_ObjName(Abc_ObjFanin0(pNode)) );
         }
         else
         {
-            fprintf( pFile, "%-11s = NOT(",   Abc_ObjName(Abc_ObjFanout0(pNode)) );
-            fprintf( pFile, "%s)\n",          Abc_ObjName(Abc_ObjFanin0(pNode)) );
+            Io_OutPrintf( pFile, "%-11s = NOT(",   Abc_ObjName(Abc_ObjFanout0(pNode)) );
+            Io_OutPrintf( pFile, "%s)\n",          Abc_ObjName(Abc_ObjFanin0(pNode)) );
         }
     }
     else
     {   // write the AND gate
-        fprintf( pFile, "%-11s",       Abc_ObjName(Abc_ObjFanout0(pNode)) );
-        fprintf( pFile, " = AND(%s, ", Abc_ObjName(Abc_ObjFanin0(pNode)) );
-        fprintf( pFile, "%s)\n",       Abc_ObjName(Abc_ObjFanin1(pNode)) );
+        Io_OutPrintf( pFile, "%-11s",       Abc_ObjName(Abc_ObjFanout0(pNode)) );
+        Io_OutPrintf( pFile, " = AND(%s, ", Abc_ObjName(Abc_ObjFanin0(pNode)) );
+        Io_OutPrintf( pFile, "%s)\n",       Abc_ObjName(Abc_ObjFanin1(pNode)) );
     }
     return 1;
 }
@@ -175,20 +179,20 @@ int Io_WriteBenchOneNode( FILE * pFile, Abc_Obj_t * pNode )
 int Io_WriteBenchLut( Abc_Ntk_t * pNtk, char * pFileName )
 {
     Abc_Ntk_t * pExdc;
-    FILE * pFile;
+    Io_Out_t * pFile;
     assert( Abc_NtkIsAigNetlist(pNtk) );
     if ( !Io_WriteBenchCheckNames(pNtk) )
     {
         fprintf( stdout, "Io_WriteBenchLut(): Signal names in this benchmark contain parantheses making them impossible to reproduce in the BENCH format. Use \"short_names\".\n" );
         return 0;
     }
-    pFile = fopen( pFileName, "w" );
+    pFile = Io_OutStart( (char *)pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Io_WriteBench(): Cannot open the output file.\n" );
         return 0;
     }
-    fprintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    Io_OutPrintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
     // write the network
     Io_WriteBenchLutOne( pFile, pNtk );
     // write EXDC network if it exists
@@ -196,7 +200,11 @@ int Io_WriteBenchLut( Abc_Ntk_t * pNtk, char * pFileName )
     if ( pExdc )
         printf( "Io_WriteBench: EXDC is not written (warning).\n" );
     // finalize the file
-    fclose( pFile );
+    if ( !Io_OutStop( pFile ) )
+    {
+        fprintf( stdout, "Io_WriteBenchLut(): Writing the output file \"%s\" has failed.\n", pFileName );
+        return 0;
+    }
     return 1;
 }
 
@@ -211,7 +219,7 @@ int Io_WriteBenchLut( Abc_Ntk_t * pNtk, char * pFileName )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_WriteBenchLutOne( FILE * pFile, Abc_Ntk_t * pNtk )
+int Io_WriteBenchLutOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     ProgressBar * pProgress;
     Abc_Obj_t * pNode;
@@ -220,11 +228,11 @@ int Io_WriteBenchLutOne( FILE * pFile, Abc_Ntk_t * pNtk )
 
     // write the PIs/POs/latches
     Abc_NtkForEachPi( pNtk, pNode, i )
-        fprintf( pFile, "INPUT(%s)\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+        Io_OutPrintf( pFile, "INPUT(%s)\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
     Abc_NtkForEachPo( pNtk, pNode, i )
-        fprintf( pFile, "OUTPUT(%s)\n", Abc_ObjName(Abc_ObjFanin0(pNode)) );
+        Io_OutPrintf( pFile, "OUTPUT(%s)\n", Abc_ObjName(Abc_ObjFanin0(pNode)) );
     Abc_NtkForEachLatch( pNtk, pNode, i )
-        fprintf( pFile, "%-11s = DFFRSE( %s, gnd, gnd, gnd, gnd )\n", 
+        Io_OutPrintf( pFile, "%-11s = DFFRSE( %s, gnd, gnd, gnd, gnd )\n", 
             Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pNode))), Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin0(pNode))) );
 //Abc_NtkLevel(pNtk);
     // write internal nodes
@@ -252,10 +260,11 @@ int Io_WriteBenchLutOne( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_WriteBenchLutOneNode( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t * vTruth )
+int Io_WriteBenchLutOneNode( Io_Out_t * pFile, Abc_Obj_t * pNode, Vec_Int_t * vTruth )
 {
     Abc_Obj_t * pFanin;
     unsigned * pTruth;
+    char Buffer[100];
     int i, nFanins;
     assert( Abc_ObjIsNode(pNode) );
     nFanins = Abc_ObjFaninNum(pNode);
@@ -267,25 +276,26 @@ int Io_WriteBenchLutOneNode( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t * vTruth
     // consider simple cases
     if ( Extra_TruthIsConst0(pTruth, nFanins) )
     {
-        fprintf( pFile, "%-11s = gnd\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+        Io_OutPrintf( pFile, "%-11s = gnd\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
         return 1;
     }
     if ( Extra_TruthIsConst1(pTruth, nFanins) )
     {
-        fprintf( pFile, "%-11s = vdd\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+        Io_OutPrintf( pFile, "%-11s = vdd\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
         return 1;
     }
     if ( nFanins == 1 )
     {
-        fprintf( pFile, "%-11s = LUT 0x%d ( %s )\n",  
+        Io_OutPrintf( pFile, "%-11s = LUT 0x%d ( %s )\n",  
             Abc_ObjName(Abc_ObjFanout0(pNode)), 
             Abc_NodeIsBuf(pNode)? 2 : 1,
             Abc_ObjName(Abc_ObjFanin0(pNode)) );
         return 1;
     }
     // write it in the hexadecimal form
-    fprintf( pFile, "%-11s = LUT 0x",  Abc_ObjName(Abc_ObjFanout0(pNode)) );
-    Extra_PrintHexadecimal( pFile, pTruth, nFanins );
+    Io_OutPrintf( pFile, "%-11s = LUT 0x",  Abc_ObjName(Abc_ObjFanout0(pNode)) );
+    Extra_PrintHexadecimalString( Buffer, pTruth, nFanins );
+    Io_OutStr( pFile, Buffer );
 /*
     {
 extern void Kit_DsdTest( unsigned * pTruth, int nVars );
@@ -300,10 +310,10 @@ Kit_DsdTest( pTruth, nFanins );
     }
 */
     // write the fanins
-    fprintf( pFile, " (" );
+    Io_OutStr( pFile, " (" );
     Abc_ObjForEachFanin( pNode, pFanin, i )
-        fprintf( pFile, " %s%s", Abc_ObjName(pFanin), ((i==nFanins-1)? "" : ",") );
-    fprintf( pFile, " )\n" );
+        Io_OutPrintf( pFile, " %s%s", Abc_ObjName(pFanin), ((i==nFanins-1)? "" : ",") );
+    Io_OutStr( pFile, " )\n" );
     return 1;
 }
 
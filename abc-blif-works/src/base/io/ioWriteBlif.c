@@ -30,16 +30,16 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static void Io_NtkWrite( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq );
-static void Io_NtkWriteOne( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq );
-static void Io_NtkWritePis( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches );
-static void Io_NtkWritePos( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches );
-static void Io_NtkWriteSubckt( FILE * pFile, Abc_Obj_t * pNode );
-static void Io_NtkWriteAsserts( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteNodeGate( FILE * pFile, Abc_Obj_t * pNode, int Length );
-static void Io_NtkWriteNodeFanins( FILE * pFile, Abc_Obj_t * pNode );
-static void Io_NtkWriteNode( FILE * pFile, Abc_Obj_t * pNode, int Length );
-static void Io_NtkWriteLatch( FILE * pFile, Abc_Obj_t * pLatch );
+static void Io_NtkWrite( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq );
+static void Io_NtkWriteOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq );
+static void Io_NtkWritePis( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int fWriteLatches );
+static void Io_NtkWritePos( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int fWriteLatches );
+static void Io_NtkWriteSubckt( Io_Out_t * pFile, Abc_Obj_t * pNode );
+static void Io_NtkWriteAsserts( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteNodeGate( Io_Out_t * pFile, Abc_Obj_t * pNode, int Length );
+static void Io_NtkWriteNodeFanins( Io_Out_t * pFile, Abc_Obj_t * pNode );
+static void Io_NtkWriteNode( Io_Out_t * pFile, Abc_Obj_t * pNode, int Length );
+static void Io_NtkWriteLatch( Io_Out_t * pFile, Abc_Obj_t * pLatch );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -83,18 +83,18 @@ void Io_WriteBlifLogic( Abc_Ntk_t * pNtk, char * FileName, int fWriteLatches )
 ***********************************************************************/
 void Io_WriteBlif( Abc_Ntk_t * pNtk, char * FileName, int fWriteLatches, int fBb2Wb, int fSeq )
 {
-    FILE * pFile;
+    Io_Out_t * pFile;
     Abc_Ntk_t * pNtkTemp;
     int i;
     assert( Abc_NtkIsNetlist(pNtk) );
     // start writing the file
-    pFile = fopen( FileName, "w" );
+    pFile = Io_OutStart( FileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Io_WriteBlif(): Cannot open the output file.\n" );
         return;
     }
-    fprintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    Io_OutPrintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
     // write the master network
     Io_NtkWrite( pFile, pNtk, fWriteLatches, fBb2Wb, fSeq );
     // make sure there is no logic hierarchy
@@ -106,11 +106,12 @@ void Io_WriteBlif( Abc_Ntk_t * pNtk, char * FileName, int fWriteLatches, int fBb
         {
             if ( pNtkTemp == pNtk )
                 continue;
-            fprintf( pFile, "\n\n" );
+            Io_OutStr( pFile, "\n\n" );
             Io_NtkWrite( pFile, pNtkTemp, fWriteLatches, fBb2Wb, fSeq );
         }
     }
-    fclose( pFile );
+    if ( !Io_OutStop( pFile ) )
+        fprintf( stdout, "Io_WriteBlif(): Writing the output file \"%s\" has failed.\n", FileName );
 }
 
 /**Function*************************************************************
@@ -124,24 +125,24 @@ void Io_WriteBlif( Abc_Ntk_t * pNtk, char * FileName, int fWriteLatches, int fBb
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWrite( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq )
+void Io_NtkWrite( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq )
 {
     Abc_Ntk_t * pExdc;
     assert( Abc_NtkIsNetlist(pNtk) );
     // write the model name
-    fprintf( pFile, ".model %s\n", Abc_NtkName(pNtk) );
+    Io_OutPrintf( pFile, ".model %s\n", Abc_NtkName(pNtk) );
     // write the network
     Io_NtkWriteOne( pFile, pNtk, fWriteLatches, fBb2Wb, fSeq );
     // write EXDC network if it exists
     pExdc = Abc_NtkExdc( pNtk );
     if ( pExdc )
     {
-        fprintf( pFile, "\n" );
-        fprintf( pFile, ".exdc\n" );
+        Io_OutChar( pFile, '\n' );
+        Io_OutStr( pFile, ".exdc\n" );
         Io_NtkWriteOne( pFile, pExdc, fWriteLatches, fBb2Wb, fSeq );
     }
     // finalize the file
-    fprintf( pFile, ".end\n" );
+    Io_OutStr( pFile, ".end\n" );
 }
 
 /**Function*************************************************************
@@ -155,33 +156,33 @@ void Io_NtkWrite( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb,
   SeeAlso     [] 
 
 ***********************************************************************/
-void Io_NtkWriteConvertedBox( FILE * pFile, Abc_Ntk_t * pNtk, int fSeq )
+void Io_NtkWriteConvertedBox( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int fSeq )
 {
     Abc_Obj_t * pObj;
     int i, v;
     if ( fSeq )
     {
-        fprintf( pFile, ".attrib white box seq\n" );
+        Io_OutStr( pFile, ".attrib white box seq\n" );
     }
     else
     {
-        fprintf( pFile, ".attrib white box comb\n" );
-        fprintf( pFile, ".delay 1\n" );
+        Io_OutStr( pFile, ".attrib white box comb\n" );
+        Io_OutStr( pFile, ".delay 1\n" );
     }
     Abc_NtkForEachPo( pNtk, pObj, i )
     { 
         // write the .names line
-        fprintf( pFile, ".names" );
+        Io_OutStr( pFile, ".names" );
         Io_NtkWritePis( pFile, pNtk, 1 );
         if ( fSeq )
-            fprintf( pFile, " %s_in\n", Abc_ObjName(Abc_ObjFanin0(pObj)) );
+            Io_OutPrintf( pFile, " %s_in\n", Abc_ObjName(Abc_ObjFanin0(pObj)) );
         else
-            fprintf( pFile, " %s\n", Abc_ObjName(Abc_ObjFanin0(pObj)) );
+            Io_OutPrintf( pFile, " %s\n", Abc_ObjName(Abc_ObjFanin0(pObj)) );
         for ( v = 0; v < Abc_NtkPiNum(pNtk); v++ )
-            fprintf( pFile, "1" );
-        fprintf( pFile, " 1\n" );
+            Io_OutChar( pFile, '1' );
+        Io_OutStr( pFile, " 1\n" );
         if ( fSeq )
-            fprintf( pFile, ".latch %s_in %s 1\n", Abc_ObjName(Abc_ObjFanin0(pObj)), Abc_ObjName(Abc_ObjFanin0(pObj)) );
+            Io_OutPrintf( pFile, ".latch %s_in %s 1\n", Abc_ObjName(Abc_ObjFanin0(pObj)), Abc_ObjName(Abc_ObjFanin0(pObj)) );
     }
 }
 
@@ -196,21 +197,21 @@ void Io_NtkWriteConvertedBox( FILE * pFile, Abc_Ntk_t * pNtk, int fSeq )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteOne( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq )
+void Io_NtkWriteOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq )
 {
     ProgressBar * pProgress;
     Abc_Obj_t * pNode, * pLatch;
     int i, Length;
 
     // write the PIs
-    fprintf( pFile, ".inputs" );
+    Io_OutStr( pFile, ".inputs" );
     Io_NtkWritePis( pFile, pNtk, fWriteLatches );
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
 
     // write the POs
-    fprintf( pFile, ".outputs" );
+    Io_OutStr( pFile, ".outputs" );
     Io_NtkWritePos( pFile, pNtk, fWriteLatches );
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
 
     // write the blackbox
     if ( Abc_NtkHasBlackbox( pNtk ) )
@@ -218,7 +219,7 @@ void Io_NtkWriteOne( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2
         if ( fBb2Wb )
             Io_NtkWriteConvertedBox( pFile, pNtk, fSeq );
         else
-            fprintf( pFile, ".blackbox\n" );
+            Io_OutStr( pFile, ".blackbox\n" );
         return;
     }
 
@@ -228,20 +229,20 @@ void Io_NtkWriteOne( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2
     // write the latches
     if ( fWriteLatches && !Abc_NtkIsComb(pNtk) )
     {
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
         Abc_NtkForEachLatch( pNtk, pLatch, i )
             Io_NtkWriteLatch( pFile, pLatch );
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
     }
 
     // write the subcircuits
     assert( Abc_NtkWhiteboxNum(pNtk) == 0 );
     if ( Abc_NtkBlackboxNum(pNtk) > 0 )
     {
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
         Abc_NtkForEachBlackbox( pNtk, pNode, i )
             Io_NtkWriteSubckt( pFile, pNode );
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
     }
 
     // write each internal node
@@ -267,7 +268,7 @@ void Io_NtkWriteOne( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWritePis( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
+void Io_NtkWritePis( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
 {
     Abc_Obj_t * pTerm, * pNet;
     int LineLength;
@@ -287,12 +288,12 @@ void Io_NtkWritePis( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
             AddedLength = strlen(Abc_ObjName(pNet)) + 1;
             if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
             { // write the line extender
-                fprintf( pFile, " \\\n" );
+                Io_OutStr( pFile, " \\\n" );
                 // reset the line length
                 LineLength  = 0;
                 NameCounter = 0;
             }
-            fprintf( pFile, " %s", Abc_ObjName(pNet) );
+            Io_OutPrintf( pFile, " %s", Abc_ObjName(pNet) );
             LineLength += AddedLength;
             NameCounter++;
         }
@@ -306,12 +307,12 @@ void Io_NtkWritePis( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
             AddedLength = strlen(Abc_ObjName(pNet)) + 1;
             if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
             { // write the line extender
-                fprintf( pFile, " \\\n" );
+                Io_OutStr( pFile, " \\\n" );
                 // reset the line length
                 LineLength  = 0;
                 NameCounter = 0;
             }
-            fprintf( pFile, " %s", Abc_ObjName(pNet) );
+            Io_OutPrintf( pFile, " %s", Abc_ObjName(pNet) );
             LineLength += AddedLength;
             NameCounter++;
         }
@@ -329,7 +330,7 @@ void Io_NtkWritePis( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWritePos( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
+void Io_NtkWritePos( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
 {
     Abc_Obj_t * pTerm, * pNet;
     int LineLength;
@@ -346,7 +347,7 @@ void Io_NtkWritePos( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
         {
             if ( i && i == pNtk->nRealPos )
             {
-                fprintf( pFile, "\n.outputs" );
+                Io_OutStr( pFile, "\n.outputs" );
                 LineLength  = 8;
                 NameCounter = 0;
             }
@@ -355,12 +356,12 @@ void Io_NtkWritePos( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
             AddedLength = strlen(Abc_ObjName(pNet)) + 1;
             if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
             { // write the line extender
-                fprintf( pFile, " \\\n" );
+                Io_OutStr( pFile, " \\\n" );
                 // reset the line length
                 LineLength  = 0;
                 NameCounter = 0;
             }
-            fprintf( pFile, " %s", Abc_ObjName(pNet) );
+            Io_OutPrintf( pFile, " %s", Abc_ObjName(pNet) );
             LineLength += AddedLength;
             NameCounter++;
         }
@@ -374,12 +375,12 @@ void Io_NtkWritePos( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
             AddedLength = strlen(Abc_ObjName(pNet)) + 1;
             if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
             { // write the line extender
-                fprintf( pFile, " \\\n" );
+                Io_OutStr( pFile, " \\\n" );
                 // reset the line length
                 LineLength  = 0;
                 NameCounter = 0;
             }
-            fprintf( pFile, " %s", Abc_ObjName(pNet) );
+            Io_OutPrintf( pFile, " %s", Abc_ObjName(pNet) );
             LineLength += AddedLength;
             NameCounter++;
         }
@@ -397,28 +398,28 @@ void Io_NtkWritePos( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteSubckt( FILE * pFile, Abc_Obj_t * pNode )
+void Io_NtkWriteSubckt( Io_Out_t * pFile, Abc_Obj_t * pNode )
 {
     Abc_Ntk_t * pModel = (Abc_Ntk_t *)pNode->pData;
     Abc_Obj_t * pTerm;
     int i;
     // write the subcircuit
 //    fprintf( pFile, ".subckt %s %s", Abc_NtkName(pModel), Abc_ObjName(pNode) );
-    fprintf( pFile, ".subckt %s", Abc_NtkName(pModel) );
+    Io_OutPrintf( pFile, ".subckt %s", Abc_NtkName(pModel) );
     // write pairs of the formal=actual names
     Abc_NtkForEachPi( pModel, pTerm, i )
     {
-        fprintf( pFile, " %s", Abc_ObjName(Abc_ObjFanout0(pTerm)) );
+        Io_OutPrintf( pFile, " %s", Abc_ObjName(Abc_ObjFanout0(pTerm)) );
         pTerm = Abc_ObjFanin( pNode, i );
-        fprintf( pFile, "=%s", Abc_ObjName(Abc_ObjFanin0(pTerm)) );
+        Io_OutPrintf( pFile, "=%s", Abc_ObjName(Abc_ObjFanin0(pTerm)) );
     }
     Abc_NtkForEachPo( pModel, pTerm, i )
     {
-        fprintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin0(pTerm)) );
+        Io_OutPrintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin0(pTerm)) );
         pTerm = Abc_ObjFanout( pNode, i );
-        fprintf( pFile, "=%s", Abc_ObjName(Abc_ObjFanout0(pTerm)) );
+        Io_OutPrintf( pFile, "=%s", Abc_ObjName(Abc_ObjFanout0(pTerm)) );
     }
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
 }
 
 /**Function*************************************************************
@@ -432,7 +433,7 @@ void Io_NtkWriteSubckt( FILE * pFile, Abc_Obj_t * pNode )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteLatch( FILE * pFile, Abc_Obj_t * pLatch )
+void Io_NtkWriteLatch( Io_Out_t * pFile, Abc_Obj_t * pLatch )
 {
     Abc_Obj_t * pNetLi, * pNetLo;
     int Reset;
@@ -440,10 +441,10 @@ void Io_NtkWriteLatch( FILE * pFile, Abc_Obj_t * pLatch )
     pNetLo = Abc_ObjFanout0( Abc_ObjFanout0(pLatch) );
     Reset  = (int)(ABC_PTRUINT_T)Abc_ObjData( pLatch );
     // write the latch line
-    fprintf( pFile, ".latch" );
-    fprintf( pFile, " %10s",    Abc_ObjName(pNetLi) );
-    fprintf( pFile, " %10s",    Abc_ObjName(pNetLo) );
-    fprintf( pFile, "  %d\n",   Reset-1 );
+    Io_OutStr( pFile, ".latch" );
+    Io_OutPrintf( pFile, " %10s",    Abc_ObjName(pNetLi) );
+    Io_OutPrintf( pFile, " %10s",    Abc_ObjName(pNetLo) );
+    Io_OutPrintf( pFile, "  %d\n",   Reset-1 );
 }
 
 
@@ -458,23 +459,23 @@ void Io_NtkWriteLatch( FILE * pFile, Abc_Obj_t * pLatch )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteNode( FILE * pFile, Abc_Obj_t * pNode, int Length )
+void Io_NtkWriteNode( Io_Out_t * pFile, Abc_Obj_t * pNode, int Length )
 {
     if ( Abc_NtkHasMapping(pNode->pNtk) )
     {
         // write the .gate line
-        fprintf( pFile, ".gate" );
+        Io_OutStr( pFile, ".gate" );
         Io_NtkWriteNodeGate( pFile, pNode, Length );
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
     }
     else
     {
         // write the .names line
-        fprintf( pFile, ".names" );
+        Io_OutStr( pFile, ".names" );
         Io_NtkWriteNodeFanins( pFile, pNode );
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
         // write the cubes
-        fprintf( pFile, "%s", (char*)Abc_ObjData(pNode) );
+        Io_OutStr( pFile, (char*)Abc_ObjData(pNode) );
     }
 }
 
@@ -489,17 +490,21 @@ void Io_NtkWriteNode( FILE * pFile, Abc_Obj_t * pNode, int Length )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteNodeGate( FILE * pFile, Abc_Obj_t * pNode, int Length )
+void Io_NtkWriteNodeGate( Io_Out_t * pFile, Abc_Obj_t * pNode, int Length )
 {
     Mio_Gate_t * pGate = (Mio_Gate_t *)pNode->pData;
     Mio_Pin_t * pGatePin;
-    int i;
-    // write the node
-    fprintf( pFile, " %-*s ", Length, Mio_GateReadName(pGate) );
+    int i, k;
+    // write the node (the gate name is padded to the longest name)
+    Io_OutChar( pFile, ' ' );
+    Io_OutStr( pFile, Mio_GateReadName(pGate) );
+    for ( k = strlen(Mio_GateReadName(pGate)); k < Length; k++ )
+        Io_OutChar( pFile, ' ' );
+    Io_OutChar( pFile, ' ' );
     for ( pGatePin = Mio_GateReadPins(pGate), i = 0; pGatePin; pGatePin = Mio_PinReadNext(pGatePin), i++ )
-        fprintf( pFile, "%s=%s ", Mio_PinReadName(pGatePin), Abc_ObjName( Abc_ObjFanin(pNode,i) ) );
+        Io_OutPrintf( pFile, "%s=%s ", Mio_PinReadName(pGatePin), Abc_ObjName( Abc_ObjFanin(pNode,i) ) );
     assert ( i == Abc_ObjFaninNum(pNode) );
-    fprintf( pFile, "%s=%s", Mio_GateReadOutName(pGate), Abc_ObjName( Abc_ObjFanout0(pNode) ) );
+    Io_OutPrintf( pFile, "%s=%s", Mio_GateReadOutName(pGate), Abc_ObjName( Abc_ObjFanout0(pNode) ) );
 }
 
 /**Function*************************************************************
@@ -513,7 +518,7 @@ void Io_NtkWriteNodeGate( FILE * pFile, Abc_Obj_t * pNode, int Length )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteNodeFanins( FILE * pFile, Abc_Obj_t * pNode )
+void Io_NtkWriteNodeFanins( Io_Out_t * pFile, Abc_Obj_t * pNode )
 {
     Abc_Obj_t * pNet;
     int LineLength;
@@ -532,12 +537,12 @@ void Io_NtkWriteNodeFanins( FILE * pFile, Abc_Obj_t * pNode )
         AddedLength = strlen(pName) + 1;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, " \\\n" );
+            Io_OutStr( pFile, " \\\n" );
             // reset the line length
             LineLength  = 0;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s", pName );
+        Io_OutPrintf( pFile, " %s", pName );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -548,12 +553,12 @@ void Io_NtkWriteNodeFanins( FILE * pFile, Abc_Obj_t * pNode )
     AddedLength = strlen(pName) + 1;
     if ( NameCounter && LineLength + AddedLength > 75 )
     { // write the line extender
-        fprintf( pFile, " \\\n" );
+        Io_OutStr( pFile, " \\\n" );
         // reset the line length
         LineLength  = 0;
         NameCounter = 0;
     }
-    fprintf( pFile, " %s", pName );
+    Io_OutPrintf( pFile, " %s", pName );
 }
 
 /**Function*************************************************************
@@ -567,7 +572,7 @@ void Io_NtkWriteNodeFanins( FILE * pFile, Abc_Obj_t * pNode )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteTimingInfo( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_WriteTimingInfo( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pNode;
     Abc_Time_t * pTime, * pTimeDef;
@@ -577,14 +582,14 @@ void Io_WriteTimingInfo( FILE * pFile, Abc_Ntk_t * pNtk )
         return;
 
     pTimeDef = Abc_NtkReadDefaultArrival( pNtk );
-    fprintf( pFile, ".default_input_arrival %g %g\n", pTimeDef->Rise, pTimeDef->Fall );
+    Io_OutPrintf( pFile, ".default_input_arrival %g %g\n", pTimeDef->Rise, pTimeDef->Fall );
     Abc_NtkForEachPi( pNtk, pNode, i )
     {
         pTime = Abc_NodeReadArrival(pNode);
         if ( pTime->Rise == pTimeDef->Rise && pTime->Fall == pTimeDef->Fall )
             continue;
 //        fprintf( pFile, ".input_arrival %s %g %g\n", Abc_ObjName(pNode), pTime->Rise, pTime->Fall );
-        fprintf( pFile, ".input_arrival %s %g %g\n", Abc_ObjName(Abc_ObjFanout0(pNode)), pTime->Rise, pTime->Fall );
+        Io_OutPrintf( pFile, ".input_arrival %s %g %g\n", Abc_ObjName(Abc_ObjFanout0(pNode)), pTime->Rise, pTime->Fall );
     }
 }
 
@@ -676,7 +681,7 @@ char * Io_NtkDeriveSop( Mem_Flex_t * pMem, unsigned uTruth, int nVars, Vec_Int_t
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteNodeInt( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t * vCover )
+void Io_NtkWriteNodeInt( Io_Out_t * pFile, Abc_Obj_t * pNode, Vec_Int_t * vCover )
 {
     Abc_Obj_t * pNet;
     int i, nVars = Abc_ObjFaninNum(pNode);
@@ -686,17 +691,17 @@ void Io_NtkWriteNodeInt( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t * vCover )
         return;
     }
 
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
     if ( nVars <= 4 )
     {
         // write the .names line
-        fprintf( pFile, ".names" );
+        Io_OutStr( pFile, ".names" );
         Abc_ObjForEachFanin( pNode, pNet, i )
-            fprintf( pFile, " %s", Abc_ObjName(pNet) );
+            Io_OutPrintf( pFile, " %s", Abc_ObjName(pNet) );
         // get the output name
-        fprintf( pFile, " %s\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+        Io_OutPrintf( pFile, " %s\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
         // write the cubes
-        fprintf( pFile, "%s", (char*)Abc_ObjData(pNode) );
+        Io_OutStr( pFile, (char*)Abc_ObjData(pNode) );
     }
     else
     {
@@ -743,22 +748,22 @@ void Io_NtkWriteNodeInt( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t * vCover )
             assert( nVarsMin[0] < 5 );
             assert( nVarsMin[1] < 5 );
             // write MUX
-            fprintf( pFile, ".names" );
-            fprintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin(pNode,iVar)) );
-            fprintf( pFile, " %s_cascade0", Abc_ObjName(Abc_ObjFanout0(pNode)) );
-            fprintf( pFile, " %s_cascade1", Abc_ObjName(Abc_ObjFanout0(pNode)) );
-            fprintf( pFile, " %s\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
-            fprintf( pFile, "1-1 1\n01- 1\n" );
+            Io_OutStr( pFile, ".names" );
+            Io_OutPrintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin(pNode,iVar)) );
+            Io_OutPrintf( pFile, " %s_cascade0", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+            Io_OutPrintf( pFile, " %s_cascade1", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+            Io_OutPrintf( pFile, " %s\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+            Io_OutStr( pFile, "1-1 1\n01- 1\n" );
             // write cofactors
             for ( c = 0; c < 2; c++ )
             {
                 pSop = Io_NtkDeriveSop( (Mem_Flex_t *)Abc_ObjNtk(pNode)->pManFunc, 
                     (unsigned)(nVars == 7 ? Cofs7[c][0] : Cofs6[c]), nVarsMin[c], vCover );
-                fprintf( pFile, ".names" );
+                Io_OutStr( pFile, ".names" );
                 for ( i = 0; i < nVarsMin[c]; i++ )
-                    fprintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin(pNode,pVars[c][i])) );
-                fprintf( pFile, " %s_cascade%d\n", Abc_ObjName(Abc_ObjFanout0(pNode)), c );
-                fprintf( pFile, "%s", pSop );
+                    Io_OutPrintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin(pNode,pVars[c][i])) );
+                Io_OutPrintf( pFile, " %s_cascade%d\n", Abc_ObjName(Abc_ObjFanout0(pNode)), c );
+                Io_OutStr( pFile, pSop );
             }
             return;
         }
@@ -795,18 +800,18 @@ void Io_NtkWriteNodeInt( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t * vCover )
             Cofs6[c] = If_Dec6MinimumBase( uTruth7[c], pVars[c], 4, &nVarsMin[c] );
 
             // write the nodes
-            fprintf( pFile, ".names" );
+            Io_OutStr( pFile, ".names" );
             for ( i = 0; i < nVarsMin[c]; i++ )
                 if ( pVars[c][i] == 7 )
-                    fprintf( pFile, " %s_cascade", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+                    Io_OutPrintf( pFile, " %s_cascade", Abc_ObjName(Abc_ObjFanout0(pNode)) );
                 else
-                    fprintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin(pNode,pVars[c][i])) );
-                fprintf( pFile, " %s%s\n", Abc_ObjName(Abc_ObjFanout0(pNode)), c? "" : "_cascade" );
+                    Io_OutPrintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin(pNode,pVars[c][i])) );
+                Io_OutPrintf( pFile, " %s%s\n", Abc_ObjName(Abc_ObjFanout0(pNode)), c? "" : "_cascade" );
 
             // write SOP
             pSop = Io_NtkDeriveSop( (Mem_Flex_t *)Abc_ObjNtk(pNode)->pManFunc, 
                 (unsigned)Cofs6[c], nVarsMin[c], vCover );
-            fprintf( pFile, "%s", pSop );
+            Io_OutStr( pFile, pSop );
         }
     }
 }
@@ -824,44 +829,45 @@ void Io_NtkWriteNodeInt( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t * vCover )
 ***********************************************************************/
 void Io_WriteBlifInt( Abc_Ntk_t * pNtk, char * FileName )
 {
-    FILE * pFile;
+    Io_Out_t * pFile;
     Vec_Int_t * vCover;
     Abc_Obj_t * pNode, * pLatch;
     int i;
     assert( Abc_NtkIsNetlist(pNtk) );
     // start writing the file
-    pFile = fopen( FileName, "w" );
+    pFile = Io_OutStart( FileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Io_WriteBlifInt(): Cannot open the output file.\n" );
         return;
     }
-    fprintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    Io_OutPrintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
     // write the model name
-    fprintf( pFile, ".model %s\n", Abc_NtkName(pNtk) );
+    Io_OutPrintf( pFile, ".model %s\n", Abc_NtkName(pNtk) );
     // write the PIs
-    fprintf( pFile, ".inputs" );
+    Io_OutStr( pFile, ".inputs" );
     Io_NtkWritePis( pFile, pNtk, 1 );
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
     // write the POs
-    fprintf( pFile, ".outputs" );
+    Io_OutStr( pFile, ".outputs" );
     Io_NtkWritePos( pFile, pNtk, 1 );
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
     // write the latches
     if ( Abc_NtkLatchNum(pNtk) )
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
     Abc_NtkForEachLatch( pNtk, pLatch, i )
         Io_NtkWriteLatch( pFile, pLatch );
     if ( Abc_NtkLatchNum(pNtk) )
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
     // write each internal node
     vCover = Vec_IntAlloc( (1<<16) );
     Abc_NtkForEachNode( pNtk, pNode, i )
         Io_NtkWriteNodeInt( pFile, pNode, vCover );
     Vec_IntFree( vCover );
     // write the end
-    fprintf( pFile, ".end\n\n" );
-    fclose( pFile );
+    Io_OutStr( pFile, ".end\n\n" );
+    if ( !Io_OutStop( pFile ) )
+        fprintf( stdout, "Io_WriteBlifInt(): Writing the output file \"%s\" has failed.\n", FileName );
 }
 
 /**Function*************************************************************
@@ -29,16 +29,16 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static void Io_NtkWriteBlifMv( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteBlifMvOne( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteBlifMvPis( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteBlifMvPos( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteBlifMvAsserts( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteBlifMvNodeFanins( FILE * pFile, Abc_Obj_t * pNode );
-static void Io_NtkWriteBlifMvNode( FILE * pFile, Abc_Obj_t * pNode );
-static void Io_NtkWriteBlifMvLatch( FILE * pFile, Abc_Obj_t * pLatch );
-static void Io_NtkWriteBlifMvSubckt( FILE * pFile, Abc_Obj_t * pNode );
-static void Io_NtkWriteBlifMvValues( FILE * pFile, Abc_Obj_t * pNode );
+static void Io_NtkWriteBlifMv( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteBlifMvOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteBlifMvPis( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteBlifMvPos( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteBlifMvAsserts( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteBlifMvNodeFanins( Io_Out_t * pFile, Abc_Obj_t * pNode );
+static void Io_NtkWriteBlifMvNode( Io_Out_t * pFile, Abc_Obj_t * pNode );
+static void Io_NtkWriteBlifMvLatch( Io_Out_t * pFile, Abc_Obj_t * pLatch );
+static void Io_NtkWriteBlifMvSubckt( Io_Out_t * pFile, Abc_Obj_t * pNode );
+static void Io_NtkWriteBlifMvValues( Io_Out_t * pFile, Abc_Obj_t * pNode );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -57,19 +57,19 @@ static void Io_NtkWriteBlifMvValues( FILE * pFile, Abc_Obj_t * pNode );
 ***********************************************************************/
 void Io_WriteBlifMv( Abc_Ntk_t * pNtk, char * FileName )
 {
-    FILE * pFile;
+    Io_Out_t * pFile;
     Abc_Ntk_t * pNtkTemp;
     int i;
     assert( Abc_NtkIsNetlist(pNtk) );
     assert( Abc_NtkHasBlifMv(pNtk) );
     // start writing the file
-    pFile = fopen( FileName, "w" );
+    pFile = Io_OutStart( FileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Io_WriteBlifMv(): Cannot open the output file.\n" );
         return;
     }
-    fprintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    Io_OutPrintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
     // write the master network
     Io_NtkWriteBlifMv( pFile, pNtk );
     // write the remaining networks
@@ -79,11 +79,12 @@ void Io_WriteBlifMv( Abc_Ntk_t * pNtk, char * FileName )
         {
             if ( pNtkTemp == pNtk )
                 continue;
-            fprintf( pFile, "\n\n" );
+            Io_OutStr( pFile, "\n\n" );
             Io_NtkWriteBlifMv( pFile, pNtkTemp );
         }
     }
-    fclose( pFile );
+    if ( !Io_OutStop( pFile ) )
+        fprintf( stdout, "Io_WriteBlifMv(): Writing the output file \"%s\" has failed.\n", FileName );
 }
 
 /**Function*************************************************************
@@ -97,18 +98,18 @@ void Io_WriteBlifMv( Abc_Ntk_t * pNtk, char * FileName )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteBlifMv( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_NtkWriteBlifMv( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     assert( Abc_NtkIsNetlist(pNtk) );
     // write the model name
-    fprintf( pFile, ".model %s\n", Abc_NtkName(pNtk) );
+    Io_OutPrintf( pFile, ".model %s\n", Abc_NtkName(pNtk) );
     // write the network
     Io_NtkWriteBlifMvOne( pFile, pNtk );
     // write EXDC network if it exists
     if ( Abc_NtkExdc(pNtk) )
         printf( "Io_NtkWriteBlifMv(): EXDC is not written.\n" );
     // finalize the file
-    fprintf( pFile, ".end\n\n\n" );
+    Io_OutStr( pFile, ".end\n\n\n" );
 }
 
 /**Function*************************************************************
@@ -122,35 +123,35 @@ void Io_NtkWriteBlifMv( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteBlifMvOne( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_NtkWriteBlifMvOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     ProgressBar * pProgress;
     Abc_Obj_t * pNode, * pTerm, * pLatch;
     int i;
 
     // write the PIs
-    fprintf( pFile, ".inputs" );
+    Io_OutStr( pFile, ".inputs" );
     Io_NtkWriteBlifMvPis( pFile, pNtk );
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
 
     // write the POs
-    fprintf( pFile, ".outputs" );
+    Io_OutStr( pFile, ".outputs" );
     Io_NtkWriteBlifMvPos( pFile, pNtk );
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
 
     // write the MV directives
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
     Abc_NtkForEachCi( pNtk, pTerm, i )
         if ( Abc_ObjMvVarNum(Abc_ObjFanout0(pTerm)) > 2 )
-            fprintf( pFile, ".mv %s %d\n", Abc_ObjName(Abc_ObjFanout0(pTerm)), Abc_ObjMvVarNum(Abc_ObjFanout0(pTerm)) );
+            Io_OutPrintf( pFile, ".mv %s %d\n", Abc_ObjName(Abc_ObjFanout0(pTerm)), Abc_ObjMvVarNum(Abc_ObjFanout0(pTerm)) );
     Abc_NtkForEachCo( pNtk, pTerm, i )
         if ( Abc_ObjMvVarNum(Abc_ObjFanin0(pTerm)) > 2 )
-            fprintf( pFile, ".mv %s %d\n", Abc_ObjName(Abc_ObjFanin0(pTerm)), Abc_ObjMvVarNum(Abc_ObjFanin0(pTerm)) );
+            Io_OutPrintf( pFile, ".mv %s %d\n", Abc_ObjName(Abc_ObjFanin0(pTerm)), Abc_ObjMvVarNum(Abc_ObjFanin0(pTerm)) );
 
     // write the blackbox
     if ( Abc_NtkHasBlackbox( pNtk ) )
     {
-        fprintf( pFile, ".blackbox\n" );
+        Io_OutStr( pFile, ".blackbox\n" );
         return;
     }
 
@@ -160,32 +161,32 @@ void Io_NtkWriteBlifMvOne( FILE * pFile, Abc_Ntk_t * pNtk )
     // write the latches
     if ( !Abc_NtkIsComb(pNtk) )
     {
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
         Abc_NtkForEachLatch( pNtk, pLatch, i )
             Io_NtkWriteBlifMvLatch( pFile, pLatch );
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
     }
 /*
     // write the subcircuits
     assert( Abc_NtkWhiteboxNum(pNtk) == 0 );
     if ( Abc_NtkBlackboxNum(pNtk) > 0 )
     {
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
         Abc_NtkForEachBlackbox( pNtk, pNode, i )
             Io_NtkWriteBlifMvSubckt( pFile, pNode );
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
     }
 */
     if ( Abc_NtkBlackboxNum(pNtk) > 0 || Abc_NtkWhiteboxNum(pNtk) > 0 )
     {
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
         Abc_NtkForEachBox( pNtk, pNode, i )
         {
             if ( Abc_ObjIsLatch(pNode) )
                 continue;
             Io_NtkWriteBlifMvSubckt( pFile, pNode );
         }
-        fprintf( pFile, "\n" );
+        Io_OutChar( pFile, '\n' );
     }
 
     // write each internal node
@@ -210,7 +211,7 @@ void Io_NtkWriteBlifMvOne( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteBlifMvPis( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_NtkWriteBlifMvPis( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pTerm, * pNet;
     int LineLength;
@@ -228,12 +229,12 @@ void Io_NtkWriteBlifMvPis( FILE * pFile, Abc_Ntk_t * pNtk )
         AddedLength = strlen(Abc_ObjName(pNet)) + 1;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, " \\\n" );
+            Io_OutStr( pFile, " \\\n" );
             // reset the line length
             LineLength  = 0;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s", Abc_ObjName(pNet) );
+        Io_OutPrintf( pFile, " %s", Abc_ObjName(pNet) );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -250,7 +251,7 @@ void Io_NtkWriteBlifMvPis( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteBlifMvPos( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_NtkWriteBlifMvPos( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pTerm, * pNet;
     int LineLength;
@@ -268,12 +269,12 @@ void Io_NtkWriteBlifMvPos( FILE * pFile, Abc_Ntk_t * pNtk )
         AddedLength = strlen(Abc_ObjName(pNet)) + 1;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, " \\\n" );
+            Io_OutStr( pFile, " \\\n" );
             // reset the line length
             LineLength  = 0;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s", Abc_ObjName(pNet) );
+        Io_OutPrintf( pFile, " %s", Abc_ObjName(pNet) );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -290,7 +291,7 @@ void Io_NtkWriteBlifMvPos( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteBlifMvLatch( FILE * pFile, Abc_Obj_t * pLatch )
+void Io_NtkWriteBlifMvLatch( Io_Out_t * pFile, Abc_Obj_t * pLatch )
 {
     Abc_Obj_t * pNetLi, * pNetLo;
     int Reset;
@@ -298,13 +299,13 @@ void Io_NtkWriteBlifMvLatch( FILE * pFile, Abc_Obj_t * pLatch )
     pNetLo = Abc_ObjFanout0( Abc_ObjFanout0(pLatch) );
     Reset  = (int)(ABC_PTRUINT_T)Abc_ObjData( pLatch );
     // write the latch line
-    fprintf( pFile, ".latch" );
-    fprintf( pFile, " %10s",    Abc_ObjName(pNetLi) );
-    fprintf( pFile, " %10s",    Abc_ObjName(pNetLo) );
-    fprintf( pFile, "\n" );
+    Io_OutStr( pFile, ".latch" );
+    Io_OutPrintf( pFile, " %10s",    Abc_ObjName(pNetLi) );
+    Io_OutPrintf( pFile, " %10s",    Abc_ObjName(pNetLo) );
+    Io_OutChar( pFile, '\n' );
     // write the reset node
-    fprintf( pFile, ".reset %s\n", Abc_ObjName(pNetLo) );
-    fprintf( pFile, "%d\n", Reset-1 );
+    Io_OutPrintf( pFile, ".reset %s\n", Abc_ObjName(pNetLo) );
+    Io_OutPrintf( pFile, "%d\n", Reset-1 );
 }
 
 /**Function*************************************************************
@@ -318,35 +319,35 @@ void Io_NtkWriteBlifMvLatch( FILE * pFile, Abc_Obj_t * pLatch )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteBlifMvSubckt( FILE * pFile, Abc_Obj_t * pNode )
+void Io_NtkWriteBlifMvSubckt( Io_Out_t * pFile, Abc_Obj_t * pNode )
 {
     Abc_Ntk_t * pModel = (Abc_Ntk_t *)pNode->pData;
     Abc_Obj_t * pTerm;
     int i;
     // write the MV directives
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
     Abc_ObjForEachFanin( pNode, pTerm, i )
         if ( Abc_ObjMvVarNum(pTerm) > 2 )
-            fprintf( pFile, ".mv %s %d\n", Abc_ObjName(pTerm), Abc_ObjMvVarNum(pTerm) );
+            Io_OutPrintf( pFile, ".mv %s %d\n", Abc_ObjName(pTerm), Abc_ObjMvVarNum(pTerm) );
     Abc_ObjForEachFanout( pNode, pTerm, i )
         if ( Abc_ObjMvVarNum(pTerm) > 2 )
-            fprintf( pFile, ".mv %s %d\n", Abc_ObjName(pTerm), Abc_ObjMvVarNum(pTerm) );
+            Io_OutPrintf( pFile, ".mv %s %d\n", Abc_ObjName(pTerm), Abc_ObjMvVarNum(pTerm) );
     // write the subcircuit
-    fprintf( pFile, ".subckt %s %s", Abc_NtkName(pModel), Abc_ObjName(pNode) );
+    Io_OutPrintf( pFile, ".subckt %s %s", Abc_NtkName(pModel), Abc_ObjName(pNode) );
     // write pairs of the formal=actual names
     Abc_NtkForEachPi( pModel, pTerm, i )
     {
-        fprintf( pFile, " %s", Abc_ObjName(Abc_ObjFanout0(pTerm)) );
+        Io_OutPrintf( pFile, " %s", Abc_ObjName(Abc_ObjFanout0(pTerm)) );
         pTerm = Abc_ObjFanin( pNode, i );
-        fprintf( pFile, "=%s", Abc_ObjName(Abc_ObjFanin0(pTerm)) );
+        Io_OutPrintf( pFile, "=%s", Abc_ObjName(Abc_ObjFanin0(pTerm)) );
     }
     Abc_NtkForEachPo( pModel, pTerm, i )
     {
-        fprintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin0(pTerm)) );
+        Io_OutPrintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin0(pTerm)) );
         pTerm = Abc_ObjFanout( pNode, i );
-        fprintf( pFile, "=%s", Abc_ObjName(Abc_ObjFanout0(pTerm)) );
+        Io_OutPrintf( pFile, "=%s", Abc_ObjName(Abc_ObjFanout0(pTerm)) );
     }
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
 }
 
 
@@ -361,20 +362,20 @@ void Io_NtkWriteBlifMvSubckt( FILE * pFile, Abc_Obj_t * pNode )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteBlifMvNode( FILE * pFile, Abc_Obj_t * pNode )
+void Io_NtkWriteBlifMvNode( Io_Out_t * pFile, Abc_Obj_t * pNode )
 {
     Abc_Obj_t * pFanin;
     char * pCur;
     int nValues, iFanin, i;
 
     // write .mv directives for the fanins
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
     Abc_ObjForEachFanin( pNode, pFanin, i )
     {
 //        nValues = atoi(pCur);
         nValues = Abc_ObjMvVarNum( pFanin );
         if ( nValues > 2 )
-            fprintf( pFile, ".mv %s %d\n", Abc_ObjName(pFanin), nValues );
+            Io_OutPrintf( pFile, ".mv %s %d\n", Abc_ObjName(pFanin), nValues );
 //        while ( *pCur++ != ' ' );
     }
 
@@ -382,30 +383,30 @@ void Io_NtkWriteBlifMvNode( FILE * pFile, Abc_Obj_t * pNode )
 //    nValues = atoi(pCur);
     nValues = Abc_ObjMvVarNum( Abc_ObjFanout0(pNode) );
     if ( nValues > 2 )
-        fprintf( pFile, ".mv %s %d\n", Abc_ObjName(Abc_ObjFanout0(pNode)), nValues );
+        Io_OutPrintf( pFile, ".mv %s %d\n", Abc_ObjName(Abc_ObjFanout0(pNode)), nValues );
 //    while ( *pCur++ != '\n' );
 
     // write the .names line
-    fprintf( pFile, ".table" );
+    Io_OutStr( pFile, ".table" );
     Io_NtkWriteBlifMvNodeFanins( pFile, pNode );
-    fprintf( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
 
     // write the cubes
     pCur = (char *)Abc_ObjData(pNode);
     if ( *pCur == 'd' )
     {
-        fprintf( pFile, ".default " );
+        Io_OutStr( pFile, ".default " );
         pCur++;
     }
     // write the literals
     for ( ; *pCur; pCur++ )
     {
-        fprintf( pFile, "%c", *pCur );
+        Io_OutPrintf( pFile, "%c", *pCur );
         if ( *pCur != '=' )
             continue;
         // get the number
         iFanin = atoi( pCur+1 );
-        fprintf( pFile, "%s", Abc_ObjName(Abc_ObjFanin(pNode,iFanin)) );
+        Io_OutStr( pFile, Abc_ObjName(Abc_ObjFanin(pNode,iFanin)) );
         // scroll on to the next symbol
         while ( *pCur != ' ' && *pCur != '\n' )
             pCur++;
@@ -424,7 +425,7 @@ void Io_NtkWriteBlifMvNode( FILE * pFile, Abc_Obj_t * pNode )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteBlifMvNodeFanins( FILE * pFile, Abc_Obj_t * pNode )
+void Io_NtkWriteBlifMvNodeFanins( Io_Out_t * pFile, Abc_Obj_t * pNode )
 {
     Abc_Obj_t * pNet;
     int LineLength;
@@ -443,12 +444,12 @@ void Io_NtkWriteBlifMvNodeFanins( FILE * pFile, Abc_Obj_t * pNode )
         AddedLength = strlen(pName) + 1;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, " \\\n" );
+            Io_OutStr( pFile, " \\\n" );
             // reset the line length
             LineLength  = 0;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s", pName );
+        Io_OutPrintf( pFile, " %s", pName );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -459,12 +460,12 @@ void Io_NtkWriteBlifMvNodeFanins( FILE * pFile, Abc_Obj_t * pNode )
     AddedLength = strlen(pName) + 1;
     if ( NameCounter && LineLength + AddedLength > 75 )
     { // write the line extender
-        fprintf( pFile, " \\\n" );
+        Io_OutStr( pFile, " \\\n" );
         // reset the line length
         LineLength  = 0;
         NameCounter = 0;
     }
-    fprintf( pFile, " %s", pName );
+    Io_OutPrintf( pFile, " %s", pName );
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -34,16 +34,16 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static unsigned Io_NtkWriteNodes( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWritePiPoNodes( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteLatchNode( FILE * pFile, Abc_Obj_t * pLatch, int NodesOrPl );
-static unsigned Io_NtkWriteIntNode( FILE * pFile, Abc_Obj_t * pNode, int NodesOrPl );
-static unsigned Io_NtkWriteNodeGate( FILE * pFile, Abc_Obj_t * pNode );
-static void Io_NtkWriteNets( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteIntNet( FILE * pFile, Abc_Obj_t * pNode );
-static void Io_NtkBuildLayout( FILE * pFile1, FILE *pFile2, Abc_Ntk_t * pNtk, double aspectRatio, double whiteSpace, unsigned coreCellArea );
-static void Io_NtkWriteScl( FILE * pFile, unsigned numCoreRows, double layoutWidth );
-static void Io_NtkWritePl( FILE * pFile, Abc_Ntk_t * pNtk, unsigned numTerms, double layoutHeight, double layoutWidth );
+static unsigned Io_NtkWriteNodes( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWritePiPoNodes( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteLatchNode( Io_Out_t * pFile, Abc_Obj_t * pLatch, int NodesOrPl );
+static unsigned Io_NtkWriteIntNode( Io_Out_t * pFile, Abc_Obj_t * pNode, int NodesOrPl );
+static unsigned Io_NtkWriteNodeGate( Io_Out_t * pFile, Abc_Obj_t * pNode );
+static void Io_NtkWriteNets( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteIntNet( Io_Out_t * pFile, Abc_Obj_t * pNode );
+static void Io_NtkBuildLayout( Io_Out_t * pFile1, Io_Out_t *pFile2, Abc_Ntk_t * pNtk, double aspectRatio, double whiteSpace, unsigned coreCellArea );
+static void Io_NtkWriteScl( Io_Out_t * pFile, unsigned numCoreRows, double layoutWidth );
+static void Io_NtkWritePl( Io_Out_t * pFile, Abc_Ntk_t * pNtk, unsigned numTerms, double layoutHeight, double layoutWidth );
 static Vec_Ptr_t * Io_NtkOrderingPads( Abc_Ntk_t * pNtk, Vec_Ptr_t * vTerms ); 
 static Abc_Obj_t * Io_NtkBfsPads( Abc_Ntk_t * pNtk, Abc_Obj_t * pCurrEntry, unsigned numTerms, int * pOrdered );
 static int Abc_NodeIsNand2( Abc_Obj_t * pNode );
@@ -98,32 +98,35 @@ void Io_WriteBookLogic( Abc_Ntk_t * pNtk, char * FileName )
 void Io_WriteBook( Abc_Ntk_t * pNtk, char * FileName )
 {
 
-    FILE * pFileNodes, * pFileNets, * pFileAux;
-    FILE * pFileScl, * pFilePl, * pFileWts;
+    Io_Out_t * pFileNodes, * pFileNets, * pFileAux;
+    Io_Out_t * pFileScl, * pFilePl, * pFileWts;
     char * FileExt = ABC_CALLOC( char, strlen(FileName)+7 );
     unsigned coreCellArea=0;
     Abc_Ntk_t * pExdc, * pNtkTemp;
-    int i;
+    int i, RetValue = 1;
 
     assert( Abc_NtkIsNetlist(pNtk) );
     // start writing the files
     strcpy(FileExt, FileName);
-    pFileNodes = fopen( strcat(FileExt,".nodes"), "w" );
+    pFileNodes = Io_OutStart( strcat(FileExt,".nodes") );
     strcpy(FileExt, FileName);
-    pFileNets  = fopen( strcat(FileExt,".nets"), "w" );
+    pFileNets  = Io_OutStart( strcat(FileExt,".nets") );
     strcpy(FileExt, FileName);
-    pFileAux   = fopen( strcat(FileExt,".aux"), "w" );
+    pFileAux   = Io_OutStart( strcat(FileExt,".aux") );
 
 		// write the aux file
     if ( (pFileNodes == NULL) || (pFileNets == NULL) || (pFileAux == NULL) )
     {
-        fclose( pFileAux );
+        if ( pFileNodes ) Io_OutStop( pFileNodes );
+        if ( pFileNets )  Io_OutStop( pFileNets );
+        if ( pFileAux )   Io_OutStop( pFileAux );
         fprintf( stdout, "Io_WriteBook(): Cannot open the output files.\n" );
+        ABC_FREE( FileExt );
         return;
     }
-    fprintf( pFileAux, "RowBasedPlacement : %s.nodes %s.nets %s.scl %s.pl %s.wts", 
+    Io_OutPrintf( pFileAux, "RowBasedPlacement : %s.nodes %s.nets %s.scl %s.pl %s.wts", 
 	     FileName, FileName, FileName, FileName, FileName );
-    fclose( pFileAux );
+    RetValue &= Io_OutStop( pFileAux );
 
     // write the master network
     coreCellArea+=Io_NtkWriteNodes( pFileNodes, pNtk );
@@ -151,21 +154,33 @@ void Io_WriteBook( Abc_Ntk_t * pNtk, char * FileName )
             Io_NtkWriteNets( pFileNets, pNtkTemp );
         }
     }
-    fclose( pFileNodes );
-    fclose( pFileNets );
+    RetValue &= Io_OutStop( pFileNodes );
+    RetValue &= Io_OutStop( pFileNets );
 
     strcpy(FileExt, FileName);
-    pFileScl = fopen( strcat(FileExt,".scl"), "w" );
+    pFileScl = Io_OutStart( strcat(FileExt,".scl") );
     strcpy(FileExt, FileName);
-    pFilePl  = fopen( strcat(FileExt,".pl"), "w" );
+    pFilePl  = Io_OutStart( strcat(FileExt,".pl") );
     strcpy(FileExt, FileName);
-    pFileWts   = fopen( strcat(FileExt,".wts"), "w" );
+    pFileWts   = Io_OutStart( strcat(FileExt,".wts") );
     ABC_FREE(FileExt);
+    if ( (pFileScl == NULL) || (pFilePl == NULL) || (pFileWts == NULL) )
+    {
+        if ( pFileScl ) Io_OutStop( pFileScl );
+        if ( pFilePl )  Io_OutStop( pFilePl );
+        if ( pFileWts ) Io_OutStop( pFileWts );
+        fprintf( stdout, "Io_WriteBook(): Cannot open the output files.\n" );
+        if ( !RetValue )
+            fprintf( stdout, "Io_WriteBook(): Writing the output files \"%s.*\" has failed.\n", FileName );
+        return;
+    }
 
     Io_NtkBuildLayout( pFileScl, pFilePl, pNtk, 1.0, 10, coreCellArea );
-    fclose( pFileScl );
-    fclose( pFilePl );
-    fclose( pFileWts );
+    RetValue &= Io_OutStop( pFileScl );
+    RetValue &= Io_OutStop( pFilePl );
+    RetValue &= Io_OutStop( pFileWts );
+    if ( !RetValue )
+        fprintf( stdout, "Io_WriteBook(): Writing the output files \"%s.*\" has failed.\n", FileName );
 }
 
 /**Function*************************************************************
@@ -179,7 +194,7 @@ void Io_WriteBook( Abc_Ntk_t * pNtk, char * FileName )
   SeeAlso     []
 
 ***********************************************************************/
-unsigned Io_NtkWriteNodes( FILE * pFile, Abc_Ntk_t * pNtk )
+unsigned Io_NtkWriteNodes( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     ProgressBar * pProgress;
     Abc_Obj_t * pLatch, * pNode;
@@ -192,9 +207,9 @@ unsigned Io_NtkWriteNodes( FILE * pFile, Abc_Ntk_t * pNtk )
     numNodes=numTerms+Abc_NtkNodeNum(pNtk)+Abc_NtkLatchNum(pNtk);
     printf("NumNodes : %d\t", numNodes );
     printf("NumTerminals : %d\n", numTerms );
-    fprintf( pFile, "UCLA    nodes    1.0\n");
-    fprintf( pFile, "NumNodes : %d\n", numNodes );
-    fprintf( pFile, "NumTerminals : %d\n", numTerms );
+    Io_OutPrintf( pFile, "UCLA    nodes    1.0\n");
+    Io_OutPrintf( pFile, "NumNodes : %d\n", numNodes );
+    Io_OutPrintf( pFile, "NumTerminals : %d\n", numTerms );
     // write the PI/POs
     Io_NtkWritePiPoNodes( pFile, pNtk );
     // write the latches
@@ -226,7 +241,7 @@ unsigned Io_NtkWriteNodes( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWritePiPoNodes( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_NtkWritePiPoNodes( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pTerm, * pNet;
     int i;
@@ -234,17 +249,17 @@ void Io_NtkWritePiPoNodes( FILE * pFile, Abc_Ntk_t * pNtk )
     Abc_NtkForEachPi( pNtk, pTerm, i )
     {
     	pNet = Abc_ObjFanout0(pTerm);
-	fprintf( pFile, "i%s_input\t", Abc_ObjName(pNet) ); 
-	fprintf( pFile, "terminal ");
-	fprintf( pFile, " %d %d\n", termWidth, termHeight );
+	Io_OutPrintf( pFile, "i%s_input\t", Abc_ObjName(pNet) ); 
+	Io_OutPrintf( pFile, "terminal ");
+	Io_OutPrintf( pFile, " %d %d\n", termWidth, termHeight );
     }
 	
     Abc_NtkForEachPo( pNtk, pTerm, i )
     {
 	pNet = Abc_ObjFanin0(pTerm);
-	fprintf( pFile, "o%s_output\t", Abc_ObjName(pNet) ); 
-	fprintf( pFile, "terminal ");
-	fprintf( pFile, " %d %d\n", termWidth, termHeight );
+	Io_OutPrintf( pFile, "o%s_output\t", Abc_ObjName(pNet) ); 
+	Io_OutPrintf( pFile, "terminal ");
+	Io_OutPrintf( pFile, " %d %d\n", termWidth, termHeight );
     }
 }
 
@@ -259,16 +274,16 @@ void Io_NtkWritePiPoNodes( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteLatchNode( FILE * pFile, Abc_Obj_t * pLatch, int NodesOrPl )
+void Io_NtkWriteLatchNode( Io_Out_t * pFile, Abc_Obj_t * pLatch, int NodesOrPl )
 {
     Abc_Obj_t * pNetLi, * pNetLo;
     
     pNetLi = Abc_ObjFanin0( Abc_ObjFanin0(pLatch) );
     pNetLo = Abc_ObjFanout0( Abc_ObjFanout0(pLatch) );
 	/// write the latch line
-    fprintf( pFile, "%s_%s_latch\t", Abc_ObjName(pNetLi), Abc_ObjName(pNetLo) );
+    Io_OutPrintf( pFile, "%s_%s_latch\t", Abc_ObjName(pNetLi), Abc_ObjName(pNetLo) );
     if (NodesOrPl == NODES)
-        fprintf( pFile, " %d %d\n", 6, 1 );
+        Io_OutPrintf( pFile, " %d %d\n", 6, 1 );
 }
 
 /**Function*************************************************************
@@ -282,7 +297,7 @@ void Io_NtkWriteLatchNode( FILE * pFile, Abc_Obj_t * pLatch, int NodesOrPl )
   SeeAlso     []
 
 ***********************************************************************/
-unsigned Io_NtkWriteIntNode( FILE * pFile, Abc_Obj_t * pNode, int NodesOrPl )
+unsigned Io_NtkWriteIntNode( Io_Out_t * pFile, Abc_Obj_t * pNode, int NodesOrPl )
 {
     unsigned sizex=0, sizey=coreHeight, isize=0;
     //double nx, ny, xstep, ystep;	
@@ -295,10 +310,10 @@ unsigned Io_NtkWriteIntNode( FILE * pFile, Abc_Obj_t * pNode, int NodesOrPl )
     else
     {
 	Abc_ObjForEachFanin( pNode, pNeti, i )
-	    fprintf( pFile, "%s_", Abc_ObjName(pNeti) );
+	    Io_OutPrintf( pFile, "%s_", Abc_ObjName(pNeti) );
 	Abc_ObjForEachFanout( pNode, pNeto, i )
-	    fprintf( pFile, "%s_", Abc_ObjName(pNeto) );	
-	fprintf( pFile, "name\t" );
+	    Io_OutPrintf( pFile, "%s_", Abc_ObjName(pNeto) );	
+	Io_OutPrintf( pFile, "name\t" );
 	
 	if(NodesOrPl == NODES)
 	{
@@ -328,7 +343,7 @@ unsigned Io_NtkWriteIntNode( FILE * pFile, Abc_Obj_t * pNode, int NodesOrPl )
     }
     if(NodesOrPl == NODES)
     {
-	fprintf( pFile, " %d %d\n", sizex, sizey );
+	Io_OutPrintf( pFile, " %d %d\n", sizex, sizey );
 
     // Equally place pins. Size pins needs /  isize+#output+1
 	isize= isize + Abc_ObjFanoutNum(pNode) + 1;
@@ -372,16 +387,16 @@ unsigned Io_NtkWriteIntNode( FILE * pFile, Abc_Obj_t * pNode, int NodesOrPl )
   SeeAlso     []
 
 ***********************************************************************/
-unsigned Io_NtkWriteNodeGate( FILE * pFile, Abc_Obj_t * pNode )
+unsigned Io_NtkWriteNodeGate( Io_Out_t * pFile, Abc_Obj_t * pNode )
 {
     Mio_Gate_t * pGate = (Mio_Gate_t *)pNode->pData;
     Mio_Pin_t * pGatePin;
     int i;
     // write the node gate
     for ( pGatePin = Mio_GateReadPins(pGate), i = 0; pGatePin; pGatePin = Mio_PinReadNext(pGatePin), i++ )
-        fprintf( pFile, "%s_", Abc_ObjName( Abc_ObjFanin(pNode,i) ) );
+        Io_OutPrintf( pFile, "%s_", Abc_ObjName( Abc_ObjFanin(pNode,i) ) );
     assert ( i == Abc_ObjFaninNum(pNode) );
-    fprintf( pFile, "%s_%s\t", Abc_ObjName( Abc_ObjFanout0(pNode) ), Mio_GateReadName(pGate) );
+    Io_OutPrintf( pFile, "%s_%s\t", Abc_ObjName( Abc_ObjFanout0(pNode) ), Mio_GateReadName(pGate) );
     return Mio_GateReadArea(pGate);
 }
 
@@ -396,7 +411,7 @@ unsigned Io_NtkWriteNodeGate( FILE * pFile, Abc_Obj_t * pNode )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteNets( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_NtkWriteNets( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     ProgressBar * pProgress;
     Abc_Obj_t * pNet;
@@ -409,9 +424,9 @@ void Io_NtkWriteNets( FILE * pFile, Abc_Ntk_t * pNtk )
     numPin+=Abc_ObjFaninNum(pNet)+Abc_ObjFanoutNum(pNet);
     printf( "NumNets  : %d\t", Abc_NtkNetNum(pNtk) );
     printf( "NumPins      : %d\n\n", numPin );
-    fprintf( pFile, "UCLA    nets    1.0\n");
-    fprintf( pFile, "NumNets : %d\n", Abc_NtkNetNum(pNtk) );
-    fprintf( pFile, "NumPins : %d\n", numPin );
+    Io_OutPrintf( pFile, "UCLA    nets    1.0\n");
+    Io_OutPrintf( pFile, "NumNets : %d\n", Abc_NtkNetNum(pNtk) );
+    Io_OutPrintf( pFile, "NumPins : %d\n", numPin );
 
     // write nets
     pProgress = Extra_ProgressBarStart( stdout, Abc_NtkNetNum(pNtk) );
@@ -434,7 +449,7 @@ void Io_NtkWriteNets( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteIntNet( FILE * pFile, Abc_Obj_t * pNet )
+void Io_NtkWriteIntNet( Io_Out_t * pFile, Abc_Obj_t * pNet )
 {
     Abc_Obj_t * pFanin, * pFanout;
     Abc_Obj_t * pNeti, * pNeto;
@@ -442,11 +457,11 @@ void Io_NtkWriteIntNet( FILE * pFile, Abc_Obj_t * pNet )
     int i, j;
     int NetDegree=Abc_ObjFaninNum(pNet)+Abc_ObjFanoutNum(pNet);
 
-    fprintf( pFile, "NetDegree\t:\t\t%d\t\t%s\n", NetDegree, Abc_ObjName(Abc_ObjFanin0(pNet)) );
+    Io_OutPrintf( pFile, "NetDegree\t:\t\t%d\t\t%s\n", NetDegree, Abc_ObjName(Abc_ObjFanin0(pNet)) );
 
     pFanin=Abc_ObjFanin0(pNet);
     if ( Abc_ObjIsPi(pFanin) )
-	fprintf( pFile, "i%s_input I\n", Abc_ObjName(pNet) );
+	Io_OutPrintf( pFile, "i%s_input I\n", Abc_ObjName(pNet) );
     else 
     {
 	if(!Abc_NtkIsComb(pNet->pNtk) && Abc_ObjFaninNum(pFanin) && Abc_ObjIsLatch(Abc_ObjFanin0(pFanin)) )
@@ -454,27 +469,27 @@ void Io_NtkWriteIntNet( FILE * pFile, Abc_Obj_t * pNet )
 	    pLatch=Abc_ObjFanin0(pFanin);
 	    pNetLi=Abc_ObjFanin0(Abc_ObjFanin0(pLatch));
 	    pNetLo=Abc_ObjFanout0(Abc_ObjFanout0(pLatch));
-	    fprintf( pFile, "%s_%s_latch I : ", Abc_ObjName(pNetLi), Abc_ObjName(pNetLo) );
+	    Io_OutPrintf( pFile, "%s_%s_latch I : ", Abc_ObjName(pNetLi), Abc_ObjName(pNetLo) );
 	}
 	else
 	{
 	    Abc_ObjForEachFanin( pFanin, pNeti, j )
-	    fprintf( pFile, "%s_", Abc_ObjName(pNeti) );
+	    Io_OutPrintf( pFile, "%s_", Abc_ObjName(pNeti) );
 	    Abc_ObjForEachFanout( pFanin, pNeto, j )
-	    fprintf( pFile, "%s_", Abc_ObjName(pNeto) );	
+	    Io_OutPrintf( pFile, "%s_", Abc_ObjName(pNeto) );	
 	    if ( Abc_NtkHasMapping(pNet->pNtk) )
-		fprintf( pFile, "%s : ", Mio_GateReadName((Mio_Gate_t *)pFanin->pData) ); 
+		Io_OutPrintf( pFile, "%s : ", Mio_GateReadName((Mio_Gate_t *)pFanin->pData) ); 
 	    else
-		fprintf( pFile, "name I : " );								
+		Io_OutPrintf( pFile, "name I : " );								
 	}
 	// offsets are simlply 0.00 0.00 at the moment
-	fprintf( pFile, "%.2f %.2f\n", .0, .0 );
+	Io_OutPrintf( pFile, "%.2f %.2f\n", .0, .0 );
     }
 
     Abc_ObjForEachFanout( pNet, pFanout, i )
     {
 	if ( Abc_ObjIsPo(pFanout) )
-	    fprintf( pFile, "o%s_output O\n", Abc_ObjName(pNet) );
+	    Io_OutPrintf( pFile, "o%s_output O\n", Abc_ObjName(pNet) );
 	else
 	{
 	    if(!Abc_NtkIsComb(pNet->pNtk) && Abc_ObjFanoutNum(pFanout) && Abc_ObjIsLatch( Abc_ObjFanout0(pFanout) ) )
@@ -482,21 +497,21 @@ void Io_NtkWriteIntNet( FILE * pFile, Abc_Obj_t * pNet )
 		pLatch=Abc_ObjFanout0(pFanout);
 		pNetLi=Abc_ObjFanin0(Abc_ObjFanin0(pLatch));
 		pNetLo=Abc_ObjFanout0(Abc_ObjFanout0(pLatch));
-		fprintf( pFile, "%s_%s_latch O : ", Abc_ObjName(pNetLi), Abc_ObjName(pNetLo) );
+		Io_OutPrintf( pFile, "%s_%s_latch O : ", Abc_ObjName(pNetLi), Abc_ObjName(pNetLo) );
 	    }
 	    else
 	    {
 		Abc_ObjForEachFanin( pFanout, pNeti, j )
-		fprintf( pFile, "%s_", Abc_ObjName(pNeti) );
+		Io_OutPrintf( pFile, "%s_", Abc_ObjName(pNeti) );
 		Abc_ObjForEachFanout( pFanout, pNeto, j )
-		fprintf( pFile, "%s_", Abc_ObjName(pNeto) );	
+		Io_OutPrintf( pFile, "%s_", Abc_ObjName(pNeto) );	
 		if ( Abc_NtkHasMapping(pNet->pNtk) )
-		    fprintf( pFile, "%s : ", Mio_GateReadName((Mio_Gate_t *)pFanout->pData) ); 
+		    Io_OutPrintf( pFile, "%s : ", Mio_GateReadName((Mio_Gate_t *)pFanout->pData) ); 
 		else
-		    fprintf( pFile, "name O : " );
+		    Io_OutPrintf( pFile, "name O : " );
 	    }
 	// offsets are simlply 0.00 0.00 at the moment
-	fprintf( pFile, "%.2f %.2f\n", .0, .0 );
+	Io_OutPrintf( pFile, "%.2f %.2f\n", .0, .0 );
 	}
     }
 }
@@ -512,7 +527,7 @@ void Io_NtkWriteIntNet( FILE * pFile, Abc_Obj_t * pNet )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkBuildLayout( FILE * pFileScl, FILE * pFilePl, Abc_Ntk_t * pNtk, double aspectRatio, double whiteSpace, unsigned coreCellArea )
+void Io_NtkBuildLayout( Io_Out_t * pFileScl, Io_Out_t * pFilePl, Abc_Ntk_t * pNtk, double aspectRatio, double whiteSpace, unsigned coreCellArea )
 {
     unsigned numCoreCells=Abc_NtkNodeNum(pNtk)+Abc_NtkLatchNum(pNtk);
     double targetLayoutArea = coreCellArea/(1.0-(whiteSpace/100.0));
@@ -551,7 +566,7 @@ void Io_NtkBuildLayout( FILE * pFileScl, FILE * pFilePl, Abc_Ntk_t * pNtk, doubl
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteScl( FILE * pFile, unsigned numCoreRows, double layoutWidth )
+void Io_NtkWriteScl( Io_Out_t * pFile, unsigned numCoreRows, double layoutWidth )
 {
     int origin_y=0;
     char * rowOrients[2] = {"N", "FS"};
@@ -561,22 +576,22 @@ void Io_NtkWriteScl( FILE * pFile, unsigned numCoreRows, double layoutWidth )
 		
     unsigned rowId;
     // write the forehead
-    fprintf( pFile, "UCLA    scl    1.0\n\n" );
-    fprintf( pFile, "Numrows : %d\n\n", numCoreRows );
+    Io_OutPrintf( pFile, "UCLA    scl    1.0\n\n" );
+    Io_OutPrintf( pFile, "Numrows : %d\n\n", numCoreRows );
 
     for( rowId=0 ; rowId<numCoreRows ; rowId++, origin_y += coreHeight )
     {
-	fprintf( pFile, "CoreRow Horizontal\n" );
-	fprintf( pFile, " Coordinate   : \t%d\n", origin_y);
-	fprintf( pFile, " Height       : \t%d\n", coreHeight);
-	fprintf( pFile, " Sitewidth    : \t%d\n", (unsigned)sitewidth );
-	fprintf( pFile, " Sitespacing  : \t%d\n", (unsigned)spacing );
-	fprintf( pFile, " Siteorient   : \t%s\n", rowOrients[rowId%2] );
+	Io_OutPrintf( pFile, "CoreRow Horizontal\n" );
+	Io_OutPrintf( pFile, " Coordinate   : \t%d\n", origin_y);
+	Io_OutPrintf( pFile, " Height       : \t%d\n", coreHeight);
+	Io_OutPrintf( pFile, " Sitewidth    : \t%d\n", (unsigned)sitewidth );
+	Io_OutPrintf( pFile, " Sitespacing  : \t%d\n", (unsigned)spacing );
+	Io_OutPrintf( pFile, " Siteorient   : \t%s\n", rowOrients[rowId%2] );
 	//if( coreRow[i].site.symmetry.rot90 || coreRow[i].site.symmetry.y || coreRow[i].site.symmetry.x )
-	fprintf( pFile, " Sitesymmetry : \t%c\n", symmetry );
-	//else fprintf( pFile, "Sitesymmetry			: \t\t\t1\n" );
-	fprintf( pFile, " SubrowOrigin : \t%d Numsites :	\t%d\n", 0, (unsigned)layoutWidth );
-	fprintf( pFile, "End\n" );
+	Io_OutPrintf( pFile, " Sitesymmetry : \t%c\n", symmetry );
+	//else Io_OutPrintf( pFile, "Sitesymmetry			: \t\t\t1\n" );
+	Io_OutPrintf( pFile, " SubrowOrigin : \t%d Numsites :	\t%d\n", 0, (unsigned)layoutWidth );
+	Io_OutPrintf( pFile, "End\n" );
     }
 }
 
@@ -591,7 +606,7 @@ void Io_NtkWriteScl( FILE * pFile, unsigned numCoreRows, double layoutWidth )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWritePl( FILE * pFile, Abc_Ntk_t * pNtk, unsigned numTerms, double layoutWidth, double layoutHeight )
+void Io_NtkWritePl( Io_Out_t * pFile, Abc_Ntk_t * pNtk, unsigned numTerms, double layoutWidth, double layoutHeight )
 {
     Abc_Obj_t * pTerm, * pLatch, * pNode;
     Vec_Ptr_t * vTerms = Vec_PtrAlloc ( numTerms ); 
@@ -623,7 +638,7 @@ void Io_NtkWritePl( FILE * pFile, Abc_Ntk_t * pNtk, unsigned numTerms, double la
     printf( "  Left:    %d\n", termsOnLeft );
     printf( "  Right:   %d\n", termsOnRight );
 
-    fprintf( pFile, "UCLA    pl    1.0\n\n" );
+    Io_OutPrintf( pFile, "UCLA    pl    1.0\n\n" );
 
     nextLoc_x = floor(.0);
     nextLoc_y = ceil(layoutHeight + 2*coreHeight);
@@ -632,12 +647,12 @@ void Io_NtkWritePl( FILE * pFile, Abc_Ntk_t * pNtk, unsigned numTerms, double la
     {
 	pTerm = (Abc_Obj_t *)Vec_PtrEntry( vOrderedTerms, t );
 	if( Abc_ObjIsPi(pTerm) )
-	    fprintf( pFile, "i%s_input\t\t", Abc_ObjName(Abc_ObjFanout0(pTerm)) ); 
+	    Io_OutPrintf( pFile, "i%s_input\t\t", Abc_ObjName(Abc_ObjFanout0(pTerm)) ); 
 	else
-	    fprintf( pFile, "o%s_output\t\t", Abc_ObjName(Abc_ObjFanin0(pTerm)) ); 
+	    Io_OutPrintf( pFile, "o%s_output\t\t", Abc_ObjName(Abc_ObjFanin0(pTerm)) ); 
 	if( t && Abc_Rint(nextLoc_x) < Abc_Rint(nextLoc_x-delta)+termWidth )
 	    nextLoc_x++;
-	fprintf( pFile, "%d\t\t%d\t: %s /FIXED\n", (int)Abc_Rint(nextLoc_x), (int)Abc_Rint(nextLoc_y), "FS" );	
+	Io_OutPrintf( pFile, "%d\t\t%d\t: %s /FIXED\n", (int)Abc_Rint(nextLoc_x), (int)Abc_Rint(nextLoc_y), "FS" );	
 	nextLoc_x += delta;
     }
 
@@ -648,12 +663,12 @@ void Io_NtkWritePl( FILE * pFile, Abc_Ntk_t * pNtk, unsigned numTerms, double la
     {
 	pTerm = (Abc_Obj_t *)Vec_PtrEntry( vOrderedTerms, t );
 	if( Abc_ObjIsPi(pTerm) )
-	    fprintf( pFile, "i%s_input\t\t", Abc_ObjName(Abc_ObjFanout0(pTerm)) ); 
+	    Io_OutPrintf( pFile, "i%s_input\t\t", Abc_ObjName(Abc_ObjFanout0(pTerm)) ); 
 	else
-	    fprintf( pFile, "o%s_output\t\t", Abc_ObjName(Abc_ObjFanin0(pTerm)) ); 
+	    Io_OutPrintf( pFile, "o%s_output\t\t", Abc_ObjName(Abc_ObjFanin0(pTerm)) ); 
 	if( t!=termsOnTop && Abc_Rint(nextLoc_x) < Abc_Rint(nextLoc_x-delta)+termWidth )
 	    nextLoc_x++;
-	fprintf( pFile, "%d\t\t%d\t: %s /FIXED\n", (int)Abc_Rint(nextLoc_x), (int)Abc_Rint(nextLoc_y), "N" );	
+	Io_OutPrintf( pFile, "%d\t\t%d\t: %s /FIXED\n", (int)Abc_Rint(nextLoc_x), (int)Abc_Rint(nextLoc_y), "N" );	
 	nextLoc_x     += delta;
     }
 
@@ -664,12 +679,12 @@ void Io_NtkWritePl( FILE * pFile, Abc_Ntk_t * pNtk, unsigned numTerms, double la
     {
 	pTerm = (Abc_Obj_t *)Vec_PtrEntry( vOrderedTerms, t );
 	if( Abc_ObjIsPi(pTerm) )
-	    fprintf( pFile, "i%s_input\t\t", Abc_ObjName(Abc_ObjFanout0(pTerm)) ); 
+	    Io_OutPrintf( pFile, "i%s_input\t\t", Abc_ObjName(Abc_ObjFanout0(pTerm)) ); 
 	else
-	    fprintf( pFile, "o%s_output\t\t", Abc_ObjName(Abc_ObjFanin0(pTerm)) ); 
+	    Io_OutPrintf( pFile, "o%s_output\t\t", Abc_ObjName(Abc_ObjFanin0(pTerm)) ); 
 	if( Abc_Rint(nextLoc_y) < Abc_Rint(nextLoc_y-delta)+termHeight )
 	    nextLoc_y++;
-	fprintf( pFile, "%d\t\t%d\t: %s /FIXED\n", (int)Abc_Rint(nextLoc_x), (int)Abc_Rint(nextLoc_y), "E" );	
+	Io_OutPrintf( pFile, "%d\t\t%d\t: %s /FIXED\n", (int)Abc_Rint(nextLoc_x), (int)Abc_Rint(nextLoc_y), "E" );	
 	nextLoc_y     += delta;
     }
 
@@ -680,12 +695,12 @@ void Io_NtkWritePl( FILE * pFile, Abc_Ntk_t * pNtk, unsigned numTerms, double la
     {
        	pTerm = (Abc_Obj_t *)Vec_PtrEntry( vOrderedTerms, t );
 	if( Abc_ObjIsPi(pTerm) )
-	    fprintf( pFile, "i%s_input\t\t", Abc_ObjName(Abc_ObjFanout0(pTerm)) ); 
+	    Io_OutPrintf( pFile, "i%s_input\t\t", Abc_ObjName(Abc_ObjFanout0(pTerm)) ); 
 	else
-	    fprintf( pFile, "o%s_output\t\t", Abc_ObjName(Abc_ObjFanin0(pTerm)) ); 
+	    Io_OutPrintf( pFile, "o%s_output\t\t", Abc_ObjName(Abc_ObjFanin0(pTerm)) ); 
 	if( Abc_Rint(nextLoc_y) < Abc_Rint(nextLoc_y-delta)+termHeight )
 	    nextLoc_y++;
-	fprintf( pFile, "%d\t\t%d\t: %s /FIXED\n", (int)Abc_Rint(nextLoc_x), (int)Abc_Rint(nextLoc_y), "FW" );	
+	Io_OutPrintf( pFile, "%d\t\t%d\t: %s /FIXED\n", (int)Abc_Rint(nextLoc_x), (int)Abc_Rint(nextLoc_y), "FW" );	
 	nextLoc_y     += delta;
     }
 
@@ -693,13 +708,13 @@ void Io_NtkWritePl( FILE * pFile, Abc_Ntk_t * pNtk, unsigned numTerms, double la
 	Abc_NtkForEachLatch( pNtk, pLatch, i )
 	{
 	    Io_NtkWriteLatchNode( pFile, pLatch, PL );
-	    fprintf( pFile, "\t%d\t\t%d\t: %s\n", 0, 0, "N" );	
+	    Io_OutPrintf( pFile, "\t%d\t\t%d\t: %s\n", 0, 0, "N" );	
 	}
     
     Abc_NtkForEachNode( pNtk, pNode, i )
     {
 	Io_NtkWriteIntNode( pFile, pNode, PL );
-	fprintf( pFile, "\t%d\t\t%d\t: %s\n", 0, 0, "N" );	
+	Io_OutPrintf( pFile, "\t%d\t\t%d\t: %s\n", 0, 0, "N" );	
     }
 }
 
@@ -70,7 +70,7 @@ void Io_WriteDot( Abc_Ntk_t * pNtk, char * FileName )
 ***********************************************************************/
 void Io_WriteDotNtk( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesShow, char * pFileName, int fGateNames, int fUseReverse )
 {
-    FILE * pFile;
+    Io_Out_t * pFile;
     Abc_Obj_t * pNode, * pFanin;
     char * pSopString;
     int LevelMin, LevelMax, fHasCos, Level, i, k, fHasBdds, fCompl;
@@ -91,7 +91,7 @@ void Io_WriteDotNtk( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
     }
 
     // start the stream
-    if ( (pFile = fopen( pFileName, "w" )) == NULL )
+    if ( (pFile = Io_OutStart( pFileName )) == NULL )
     {
         fprintf( stdout, "Cannot open the intermediate file \"%s\".\n", pFileName );
         return;
@@ -154,128 +154,128 @@ void Io_WriteDotNtk( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
     }
 
     // write the DOT header
-    fprintf( pFile, "# %s\n",  "Network structure generated by ABC" );
-    fprintf( pFile, "\n" );
-    fprintf( pFile, "digraph network {\n" );
-    fprintf( pFile, "size = \"7.5,10\";\n" );
-//    fprintf( pFile, "size = \"10,8.5\";\n" );
-//    fprintf( pFile, "size = \"14,11\";\n" );
-//    fprintf( pFile, "page = \"8,11\";\n" );
-//  fprintf( pFile, "ranksep = 0.5;\n" );
-//  fprintf( pFile, "nodesep = 0.5;\n" );
-    fprintf( pFile, "center = true;\n" );
-//    fprintf( pFile, "orientation = landscape;\n" );
-//  fprintf( pFile, "edge [fontsize = 10];\n" );
-//  fprintf( pFile, "edge [dir = none];\n" );
-    fprintf( pFile, "edge [dir = back];\n" );
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "# %s\n",  "Network structure generated by ABC" );
+    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "digraph network {\n" );
+    Io_OutPrintf( pFile, "size = \"7.5,10\";\n" );
+//    Io_OutPrintf( pFile, "size = \"10,8.5\";\n" );
+//    Io_OutPrintf( pFile, "size = \"14,11\";\n" );
+//    Io_OutPrintf( pFile, "page = \"8,11\";\n" );
+//  Io_OutPrintf( pFile, "ranksep = 0.5;\n" );
+//  Io_OutPrintf( pFile, "nodesep = 0.5;\n" );
+    Io_OutPrintf( pFile, "center = true;\n" );
+//    Io_OutPrintf( pFile, "orientation = landscape;\n" );
+//  Io_OutPrintf( pFile, "edge [fontsize = 10];\n" );
+//  Io_OutPrintf( pFile, "edge [dir = none];\n" );
+    Io_OutPrintf( pFile, "edge [dir = back];\n" );
+    Io_OutPrintf( pFile, "\n" );
 
     // labels on the left of the picture
-    fprintf( pFile, "{\n" );
-    fprintf( pFile, "  node [shape = plaintext];\n" );
-    fprintf( pFile, "  edge [style = invis];\n" );
-    fprintf( pFile, "  LevelTitle1 [label=\"\"];\n" );
-    fprintf( pFile, "  LevelTitle2 [label=\"\"];\n" );
+    Io_OutPrintf( pFile, "{\n" );
+    Io_OutPrintf( pFile, "  node [shape = plaintext];\n" );
+    Io_OutPrintf( pFile, "  edge [style = invis];\n" );
+    Io_OutPrintf( pFile, "  LevelTitle1 [label=\"\"];\n" );
+    Io_OutPrintf( pFile, "  LevelTitle2 [label=\"\"];\n" );
     // generate node names with labels
     for ( Level = LevelMax; Level >= LevelMin; Level-- )
     {
         // the visible node name
-        fprintf( pFile, "  Level%d", Level );
-        fprintf( pFile, " [label = " );
+        Io_OutPrintf( pFile, "  Level%d", Level );
+        Io_OutPrintf( pFile, " [label = " );
         // label name
-        fprintf( pFile, "\"" );
-        fprintf( pFile, "\"" );
-        fprintf( pFile, "];\n" );
+        Io_OutPrintf( pFile, "\"" );
+        Io_OutPrintf( pFile, "\"" );
+        Io_OutPrintf( pFile, "];\n" );
     }
 
     // genetate the sequence of visible/invisible nodes to mark levels
-    fprintf( pFile, "  LevelTitle1 ->  LevelTitle2 ->" );
+    Io_OutPrintf( pFile, "  LevelTitle1 ->  LevelTitle2 ->" );
     for ( Level = LevelMax; Level >= LevelMin; Level-- )
     {
         // the visible node name
-        fprintf( pFile, "  Level%d",  Level );
+        Io_OutPrintf( pFile, "  Level%d",  Level );
         // the connector
         if ( Level != LevelMin )
-            fprintf( pFile, " ->" );
+            Io_OutPrintf( pFile, " ->" );
         else
-            fprintf( pFile, ";" );
+            Io_OutPrintf( pFile, ";" );
     }
-    fprintf( pFile, "\n" );
-    fprintf( pFile, "}" );
-    fprintf( pFile, "\n" );
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "}" );
+    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
 
     // generate title box on top
-    fprintf( pFile, "{\n" );
-    fprintf( pFile, "  rank = same;\n" );
-    fprintf( pFile, "  LevelTitle1;\n" );
-    fprintf( pFile, "  title1 [shape=plaintext,\n" );
-    fprintf( pFile, "          fontsize=20,\n" );
-    fprintf( pFile, "          fontname = \"Times-Roman\",\n" );
-    fprintf( pFile, "          label=\"" );
-    fprintf( pFile, "%s", "Network structure visualized by ABC" );
-    fprintf( pFile, "\\n" );
-    fprintf( pFile, "Benchmark \\\"%s\\\". ", pNtk->pName );
-    fprintf( pFile, "Time was %s. ",  Extra_TimeStamp() );
-    fprintf( pFile, "\"\n" );
-    fprintf( pFile, "         ];\n" );
-    fprintf( pFile, "}" );
-    fprintf( pFile, "\n" );
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "{\n" );
+    Io_OutPrintf( pFile, "  rank = same;\n" );
+    Io_OutPrintf( pFile, "  LevelTitle1;\n" );
+    Io_OutPrintf( pFile, "  title1 [shape=plaintext,\n" );
+    Io_OutPrintf( pFile, "          fontsize=20,\n" );
+    Io_OutPrintf( pFile, "          fontname = \"Times-Roman\",\n" );
+    Io_OutPrintf( pFile, "          label=\"" );
+    Io_OutPrintf( pFile, "%s", "Network structure visualized by ABC" );
+    Io_OutPrintf( pFile, "\\n" );
+    Io_OutPrintf( pFile, "Benchmark \\\"%s\\\". ", pNtk->pName );
+    Io_OutPrintf( pFile, "Time was %s. ",  Extra_TimeStamp() );
+    Io_OutPrintf( pFile, "\"\n" );
+    Io_OutPrintf( pFile, "         ];\n" );
+    Io_OutPrintf( pFile, "}" );
+    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
 
     // generate statistics box
-    fprintf( pFile, "{\n" );
-    fprintf( pFile, "  rank = same;\n" );
-    fprintf( pFile, "  LevelTitle2;\n" );
-    fprintf( pFile, "  title2 [shape=plaintext,\n" );
-    fprintf( pFile, "          fontsize=18,\n" );
-    fprintf( pFile, "          fontname = \"Times-Roman\",\n" );
-    fprintf( pFile, "          label=\"" );
+    Io_OutPrintf( pFile, "{\n" );
+    Io_OutPrintf( pFile, "  rank = same;\n" );
+    Io_OutPrintf( pFile, "  LevelTitle2;\n" );
+    Io_OutPrintf( pFile, "  title2 [shape=plaintext,\n" );
+    Io_OutPrintf( pFile, "          fontsize=18,\n" );
+    Io_OutPrintf( pFile, "          fontname = \"Times-Roman\",\n" );
+    Io_OutPrintf( pFile, "          label=\"" );
     if ( Abc_NtkObjNum(pNtk) == Vec_PtrSize(vNodes) )
-        fprintf( pFile, "The network contains %d logic nodes and %d latches.", Abc_NtkNodeNum(pNtk), Abc_NtkLatchNum(pNtk) );
+        Io_OutPrintf( pFile, "The network contains %d logic nodes and %d latches.", Abc_NtkNodeNum(pNtk), Abc_NtkLatchNum(pNtk) );
     else
-        fprintf( pFile, "The set contains %d logic nodes and spans %d levels.", Abc_NtkCountLogicNodes(vNodes), LevelMax - LevelMin + 1 );
-    fprintf( pFile, "\\n" );
-    fprintf( pFile, "\"\n" );
-    fprintf( pFile, "         ];\n" );
-    fprintf( pFile, "}" );
-    fprintf( pFile, "\n" );
-    fprintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "The set contains %d logic nodes and spans %d levels.", Abc_NtkCountLogicNodes(vNodes), LevelMax - LevelMin + 1 );
+    Io_OutPrintf( pFile, "\\n" );
+    Io_OutPrintf( pFile, "\"\n" );
+    Io_OutPrintf( pFile, "         ];\n" );
+    Io_OutPrintf( pFile, "}" );
+    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
 
     // generate the POs
     if ( fHasCos )
     {
-        fprintf( pFile, "{\n" );
-        fprintf( pFile, "  rank = same;\n" );
+        Io_OutPrintf( pFile, "{\n" );
+        Io_OutPrintf( pFile, "  rank = same;\n" );
         // the labeling node of this level
-        fprintf( pFile, "  Level%d;\n",  LevelMax );
+        Io_OutPrintf( pFile, "  Level%d;\n",  LevelMax );
         // generate the PO nodes
         Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pNode, i )
         {
             if ( !Abc_ObjIsCo(pNode) )
                 continue;
-            fprintf( pFile, "  Node%d [label = \"%s%s\"", 
+            Io_OutPrintf( pFile, "  Node%d [label = \"%s%s\"", 
                 pNode->Id, 
                 (Abc_ObjIsBi(pNode)? Abc_ObjName(Abc_ObjFanout0(pNode)):Abc_ObjName(pNode)), 
                 (Abc_ObjIsBi(pNode)? "_in":"") );
-            fprintf( pFile, ", shape = %s", (Abc_ObjIsBi(pNode)? "box":"invtriangle") );
+            Io_OutPrintf( pFile, ", shape = %s", (Abc_ObjIsBi(pNode)? "box":"invtriangle") );
             if ( pNode->fMarkB )
-                fprintf( pFile, ", style = filled" );
-            fprintf( pFile, ", color = coral, fillcolor = coral" );
-            fprintf( pFile, "];\n" );
+                Io_OutPrintf( pFile, ", style = filled" );
+            Io_OutPrintf( pFile, ", color = coral, fillcolor = coral" );
+            Io_OutPrintf( pFile, "];\n" );
         }
-        fprintf( pFile, "}" );
-        fprintf( pFile, "\n" );
-        fprintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "}" );
+        Io_OutPrintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "\n" );
     }
 
     // generate nodes of each rank
     for ( Level = LevelMax - fHasCos; Level >= LevelMin && Level > 0; Level-- )
     {
-        fprintf( pFile, "{\n" );
-        fprintf( pFile, "  rank = same;\n" );
+        Io_OutPrintf( pFile, "{\n" );
+        Io_OutPrintf( pFile, "  rank = same;\n" );
         // the labeling node of this level
-        fprintf( pFile, "  Level%d;\n",  Level );
+        Io_OutPrintf( pFile, "  Level%d;\n",  Level );
         Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pNode, i )
         {
             if ( (int)pNode->Level != Level )
@@ -295,7 +295,7 @@ void Io_WriteDotNtk( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
             Vec_PtrFree( vSupp ); 
 */
 
-//            fprintf( pFile, "  Node%d [label = \"%d\"", pNode->Id, pNode->Id );
+//            Io_OutPrintf( pFile, "  Node%d [label = \"%d\"", pNode->Id, pNode->Id );
             if ( Abc_NtkIsStrash(pNtk) )
                 pSopString = "";
             else if ( Abc_NtkHasMapping(pNtk) && fGateNames )
@@ -304,28 +304,28 @@ void Io_WriteDotNtk( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
                 pSopString = Abc_NtkPrintSop(Mio_GateReadSop((Mio_Gate_t *)pNode->pData));
             else
                 pSopString = Abc_NtkPrintSop((char *)pNode->pData);
-            fprintf( pFile, "  Node%d [label = \"%d\\n%s\"", pNode->Id, pNode->Id, pSopString );
-//            fprintf( pFile, "  Node%d [label = \"%d\\n%s\"", pNode->Id, 
+            Io_OutPrintf( pFile, "  Node%d [label = \"%d\\n%s\"", pNode->Id, pNode->Id, pSopString );
+//            Io_OutPrintf( pFile, "  Node%d [label = \"%d\\n%s\"", pNode->Id, 
 //                SuppSize, 
 //                pSopString );
 
-            fprintf( pFile, ", shape = ellipse" );
+            Io_OutPrintf( pFile, ", shape = ellipse" );
             if ( pNode->fMarkB )
-                fprintf( pFile, ", style = filled" );
-            fprintf( pFile, "];\n" );
+                Io_OutPrintf( pFile, ", style = filled" );
+            Io_OutPrintf( pFile, "];\n" );
         }
-        fprintf( pFile, "}" );
-        fprintf( pFile, "\n" );
-        fprintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "}" );
+        Io_OutPrintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "\n" );
     }
 
     // generate the PI nodes if any
     if ( LevelMin == 0 )
     {
-        fprintf( pFile, "{\n" );
-        fprintf( pFile, "  rank = same;\n" );
+        Io_OutPrintf( pFile, "{\n" );
+        Io_OutPrintf( pFile, "  rank = same;\n" );
         // the labeling node of this level
-        fprintf( pFile, "  Level%d;\n",  LevelMin );
+        Io_OutPrintf( pFile, "  Level%d;\n",  LevelMin );
         // generate the PO nodes
         Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pNode, i )
         {
@@ -334,36 +334,36 @@ void Io_WriteDotNtk( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
                 // check if the costant node is present
                 if ( Abc_ObjFaninNum(pNode) == 0 && Abc_ObjFanoutNum(pNode) > 0 )
                 {
-                    fprintf( pFile, "  Node%d [label = \"Const%d\"", pNode->Id, Abc_NtkIsStrash(pNode->pNtk) || Abc_NodeIsConst1(pNode) );
-                    fprintf( pFile, ", shape = ellipse" );
+                    Io_OutPrintf( pFile, "  Node%d [label = \"Const%d\"", pNode->Id, Abc_NtkIsStrash(pNode->pNtk) || Abc_NodeIsConst1(pNode) );
+                    Io_OutPrintf( pFile, ", shape = ellipse" );
                     if ( pNode->fMarkB )
-                        fprintf( pFile, ", style = filled" );
-                    fprintf( pFile, ", color = coral, fillcolor = coral" );
-                    fprintf( pFile, "];\n" );
+                        Io_OutPrintf( pFile, ", style = filled" );
+                    Io_OutPrintf( pFile, ", color = coral, fillcolor = coral" );
+                    Io_OutPrintf( pFile, "];\n" );
                 }
                 continue;
             }
-            fprintf( pFile, "  Node%d [label = \"%s\"", 
+            Io_OutPrintf( pFile, "  Node%d [label = \"%s\"", 
                 pNode->Id, 
                 (Abc_ObjIsBo(pNode)? Abc_ObjName(Abc_ObjFanin0(pNode)):Abc_ObjName(pNode)) );
-            fprintf( pFile, ", shape = %s", (Abc_ObjIsBo(pNode)? "box":"triangle") );
+            Io_OutPrintf( pFile, ", shape = %s", (Abc_ObjIsBo(pNode)? "box":"triangle") );
             if ( pNode->fMarkB )
-                fprintf( pFile, ", style = filled" );
-            fprintf( pFile, ", color = coral, fillcolor = coral" );
-            fprintf( pFile, "];\n" );
+                Io_OutPrintf( pFile, ", style = filled" );
+            Io_OutPrintf( pFile, ", color = coral, fillcolor = coral" );
+            Io_OutPrintf( pFile, "];\n" );
         }
-        fprintf( pFile, "}" );
-        fprintf( pFile, "\n" );
-        fprintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "}" );
+        Io_OutPrintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "\n" );
     }
 
     // generate invisible edges from the square down
-    fprintf( pFile, "title1 -> title2 [style = invis];\n" );
+    Io_OutPrintf( pFile, "title1 -> title2 [style = invis];\n" );
     Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pNode, i )
     {
         if ( (int)pNode->Level != LevelMax )
             continue;
-        fprintf( pFile, "title2 -> Node%d [style = invis];\n", pNode->Id );
+        Io_OutPrintf( pFile, "title2 -> Node%d [style = invis];\n", pNode->Id );
     }
 
     // generate edges
@@ -379,20 +379,21 @@ void Io_WriteDotNtk( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
             if ( Abc_NtkIsStrash(pNtk) )
                 fCompl = Abc_ObjFaninC(pNode, k);
             // generate the edge from this node to the next
-            fprintf( pFile, "Node%d",  pNode->Id );
-            fprintf( pFile, " -> " );
-            fprintf( pFile, "Node%d",  pFanin->Id );
-            fprintf( pFile, " [style = %s", fCompl? "dotted" : "bold" );
-//            fprintf( pFile, ", label = \"%c\"", 'a' + k );
-            fprintf( pFile, "]" );
-            fprintf( pFile, ";\n" );
+            Io_OutPrintf( pFile, "Node%d",  pNode->Id );
+            Io_OutPrintf( pFile, " -> " );
+            Io_OutPrintf( pFile, "Node%d",  pFanin->Id );
+            Io_OutPrintf( pFile, " [style = %s", fCompl? "dotted" : "bold" );
+//            Io_OutPrintf( pFile, ", label = \"%c\"", 'a' + k );
+            Io_OutPrintf( pFile, "]" );
+            Io_OutPrintf( pFile, ";\n" );
         }
     }
 
-    fprintf( pFile, "}" );
-    fprintf( pFile, "\n" );
-    fprintf( pFile, "\n" );
-    fclose( pFile );
+    Io_OutPrintf( pFile, "}" );
+    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
+    if ( !Io_OutStop( pFile ) )
+        fprintf( stdout, "Io_WriteDotNtk(): Writing the output file \"%s\" has failed.\n", pFileName );
 
     // unmark the nodes from the set
     Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pNode, i )
@@ -421,7 +422,7 @@ void Io_WriteDotNtk( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
 ***********************************************************************/
 void Io_WriteDotSeq( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesShow, char * pFileName, int fGateNames, int fUseReverse )
 {
-    FILE * pFile;
+    Io_Out_t * pFile;
     Abc_Obj_t * pNode, * pFanin;
     char * pSopString;
     int LevelMin, LevelMax, fHasCos, Level, i, k, fHasBdds, fCompl;
@@ -442,7 +443,7 @@ void Io_WriteDotSeq( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
     }
 
     // start the stream
-    if ( (pFile = fopen( pFileName, "w" )) == NULL )
+    if ( (pFile = Io_OutStart( pFileName )) == NULL )
     {
         fprintf( stdout, "Cannot open the intermediate file \"%s\".\n", pFileName );
         return;
@@ -505,130 +506,130 @@ void Io_WriteDotSeq( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
     }
 
     // write the DOT header
-    fprintf( pFile, "# %s\n",  "Network structure generated by ABC" );
-    fprintf( pFile, "\n" );
-    fprintf( pFile, "digraph network {\n" );
-    fprintf( pFile, "size = \"7.5,10\";\n" );
-//    fprintf( pFile, "size = \"10,8.5\";\n" );
-//    fprintf( pFile, "size = \"14,11\";\n" );
-//    fprintf( pFile, "page = \"8,11\";\n" );
-//  fprintf( pFile, "ranksep = 0.5;\n" );
-//  fprintf( pFile, "nodesep = 0.5;\n" );
-    fprintf( pFile, "center = true;\n" );
-//    fprintf( pFile, "orientation = landscape;\n" );
-//  fprintf( pFile, "edge [fontsize = 10];\n" );
-//  fprintf( pFile, "edge [dir = none];\n" );
-    fprintf( pFile, "edge [dir = back];\n" );
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "# %s\n",  "Network structure generated by ABC" );
+    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "digraph network {\n" );
+    Io_OutPrintf( pFile, "size = \"7.5,10\";\n" );
+//    Io_OutPrintf( pFile, "size = \"10,8.5\";\n" );
+//    Io_OutPrintf( pFile, "size = \"14,11\";\n" );
+//    Io_OutPrintf( pFile, "page = \"8,11\";\n" );
+//  Io_OutPrintf( pFile, "ranksep = 0.5;\n" );
+//  Io_OutPrintf( pFile, "nodesep = 0.5;\n" );
+    Io_OutPrintf( pFile, "center = true;\n" );
+//    Io_OutPrintf( pFile, "orientation = landscape;\n" );
+//  Io_OutPrintf( pFile, "edge [fontsize = 10];\n" );
+//  Io_OutPrintf( pFile, "edge [dir = none];\n" );
+    Io_OutPrintf( pFile, "edge [dir = back];\n" );
+    Io_OutPrintf( pFile, "\n" );
 
     // labels on the left of the picture
-    fprintf( pFile, "{\n" );
-    fprintf( pFile, "  node [shape = plaintext];\n" );
-    fprintf( pFile, "  edge [style = invis];\n" );
-    fprintf( pFile, "  LevelTitle1 [label=\"\"];\n" );
-    fprintf( pFile, "  LevelTitle2 [label=\"\"];\n" );
+    Io_OutPrintf( pFile, "{\n" );
+    Io_OutPrintf( pFile, "  node [shape = plaintext];\n" );
+    Io_OutPrintf( pFile, "  edge [style = invis];\n" );
+    Io_OutPrintf( pFile, "  LevelTitle1 [label=\"\"];\n" );
+    Io_OutPrintf( pFile, "  LevelTitle2 [label=\"\"];\n" );
     // generate node names with labels
     for ( Level = LevelMax; Level >= LevelMin; Level-- )
     {
         // the visible node name
-        fprintf( pFile, "  Level%d", Level );
-        fprintf( pFile, " [label = " );
+        Io_OutPrintf( pFile, "  Level%d", Level );
+        Io_OutPrintf( pFile, " [label = " );
         // label name
-        fprintf( pFile, "\"" );
-        fprintf( pFile, "\"" );
-        fprintf( pFile, "];\n" );
+        Io_OutPrintf( pFile, "\"" );
+        Io_OutPrintf( pFile, "\"" );
+        Io_OutPrintf( pFile, "];\n" );
     }
 
     // genetate the sequence of visible/invisible nodes to mark levels
-    fprintf( pFile, "  LevelTitle1 ->  LevelTitle2 ->" );
+    Io_OutPrintf( pFile, "  LevelTitle1 ->  LevelTitle2 ->" );
     for ( Level = LevelMax; Level >= LevelMin; Level-- )
     {
         // the visible node name
-        fprintf( pFile, "  Level%d",  Level );
+        Io_OutPrintf( pFile, "  Level%d",  Level );
         // the connector
         if ( Level != LevelMin )
-            fprintf( pFile, " ->" );
+            Io_OutPrintf( pFile, " ->" );
         else
-            fprintf( pFile, ";" );
+            Io_OutPrintf( pFile, ";" );
     }
-    fprintf( pFile, "\n" );
-    fprintf( pFile, "}" );
-    fprintf( pFile, "\n" );
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "}" );
+    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
 
     // generate title box on top
-    fprintf( pFile, "{\n" );
-    fprintf( pFile, "  rank = same;\n" );
-    fprintf( pFile, "  LevelTitle1;\n" );
-    fprintf( pFile, "  title1 [shape=plaintext,\n" );
-    fprintf( pFile, "          fontsize=20,\n" );
-    fprintf( pFile, "          fontname = \"Times-Roman\",\n" );
-    fprintf( pFile, "          label=\"" );
-    fprintf( pFile, "%s", "Network structure visualized by ABC" );
-    fprintf( pFile, "\\n" );
-    fprintf( pFile, "Benchmark \\\"%s\\\". ", pNtk->pName );
-    fprintf( pFile, "Time was %s. ",  Extra_TimeStamp() );
-    fprintf( pFile, "\"\n" );
-    fprintf( pFile, "         ];\n" );
-    fprintf( pFile, "}" );
-    fprintf( pFile, "\n" );
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "{\n" );
+    Io_OutPrintf( pFile, "  rank = same;\n" );
+    Io_OutPrintf( pFile, "  LevelTitle1;\n" );
+    Io_OutPrintf( pFile, "  title1 [shape=plaintext,\n" );
+    Io_OutPrintf( pFile, "          fontsize=20,\n" );
+    Io_OutPrintf( pFile, "          fontname = \"Times-Roman\",\n" );
+    Io_OutPrintf( pFile, "          label=\"" );
+    Io_OutPrintf( pFile, "%s", "Network structure visualized by ABC" );
+    Io_OutPrintf( pFile, "\\n" );
+    Io_OutPrintf( pFile, "Benchmark \\\"%s\\\". ", pNtk->pName );
+    Io_OutPrintf( pFile, "Time was %s. ",  Extra_TimeStamp() );
+    Io_OutPrintf( pFile, "\"\n" );
+    Io_OutPrintf( pFile, "         ];\n" );
+    Io_OutPrintf( pFile, "}" );
+    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
 
     // generate statistics box
-    fprintf( pFile, "{\n" );
-    fprintf( pFile, "  rank = same;\n" );
-    fprintf( pFile, "  LevelTitle2;\n" );
-    fprintf( pFile, "  title2 [shape=plaintext,\n" );
-    fprintf( pFile, "          fontsize=18,\n" );
-    fprintf( pFile, "          fontname = \"Times-Roman\",\n" );
-    fprintf( pFile, "          label=\"" );
+    Io_OutPrintf( pFile, "{\n" );
+    Io_OutPrintf( pFile, "  rank = same;\n" );
+    Io_OutPrintf( pFile, "  LevelTitle2;\n" );
+    Io_OutPrintf( pFile, "  title2 [shape=plaintext,\n" );
+    Io_OutPrintf( pFile, "          fontsize=18,\n" );
+    Io_OutPrintf( pFile, "          fontname = \"Times-Roman\",\n" );
+    Io_OutPrintf( pFile, "          label=\"" );
     if ( Abc_NtkObjNum(pNtk) == Vec_PtrSize(vNodes) )
-        fprintf( pFile, "The network contains %d logic nodes and %d latches.", Abc_NtkNodeNum(pNtk), Abc_NtkLatchNum(pNtk) );
+        Io_OutPrintf( pFile, "The network contains %d logic nodes and %d latches.", Abc_NtkNodeNum(pNtk), Abc_NtkLatchNum(pNtk) );
     else
-        fprintf( pFile, "The set contains %d logic nodes and spans %d levels.", Abc_NtkCountLogicNodes(vNodes), LevelMax - LevelMin + 1 );
-    fprintf( pFile, "\\n" );
-    fprintf( pFile, "\"\n" );
-    fprintf( pFile, "         ];\n" );
-    fprintf( pFile, "}" );
-    fprintf( pFile, "\n" );
-    fprintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "The set contains %d logic nodes and spans %d levels.", Abc_NtkCountLogicNodes(vNodes), LevelMax - LevelMin + 1 );
+    Io_OutPrintf( pFile, "\\n" );
+    Io_OutPrintf( pFile, "\"\n" );
+    Io_OutPrintf( pFile, "         ];\n" );
+    Io_OutPrintf( pFile, "}" );
+    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
 
     // generate the POs
     if ( fHasCos )
     {
-        fprintf( pFile, "{\n" );
-        fprintf( pFile, "  rank = same;\n" );
+        Io_OutPrintf( pFile, "{\n" );
+        Io_OutPrintf( pFile, "  rank = same;\n" );
         // the labeling node of this level
-        fprintf( pFile, "  Level%d;\n",  LevelMax );
+        Io_OutPrintf( pFile, "  Level%d;\n",  LevelMax );
         // generate the PO nodes
         Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pNode, i )
         {
             if ( !Abc_ObjIsPo(pNode) )
                 continue;
-            fprintf( pFile, "  Node%d [label = \"%s\"", pNode->Id, Abc_ObjName(pNode) );
-            fprintf( pFile, ", shape = %s", "invtriangle" );
+            Io_OutPrintf( pFile, "  Node%d [label = \"%s\"", pNode->Id, Abc_ObjName(pNode) );
+            Io_OutPrintf( pFile, ", shape = %s", "invtriangle" );
             if ( pNode->fMarkB )
-                fprintf( pFile, ", style = filled" );
-            fprintf( pFile, ", color = coral, fillcolor = coral" );
-            fprintf( pFile, "];\n" );
+                Io_OutPrintf( pFile, ", style = filled" );
+            Io_OutPrintf( pFile, ", color = coral, fillcolor = coral" );
+            Io_OutPrintf( pFile, "];\n" );
         }
-        fprintf( pFile, "}" );
-        fprintf( pFile, "\n" );
-        fprintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "}" );
+        Io_OutPrintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "\n" );
     }
 
     // generate nodes of each rank
     for ( Level = LevelMax - fHasCos; Level >= LevelMin && Level > 0; Level-- )
     {
-        fprintf( pFile, "{\n" );
-        fprintf( pFile, "  rank = same;\n" );
+        Io_OutPrintf( pFile, "{\n" );
+        Io_OutPrintf( pFile, "  rank = same;\n" );
         // the labeling node of this level
-        fprintf( pFile, "  Level%d;\n",  Level );
+        Io_OutPrintf( pFile, "  Level%d;\n",  Level );
         Abc_NtkForEachNode( pNtk, pNode, i )
         {
             if ( (int)pNode->Level != Level )
                 continue;
-//            fprintf( pFile, "  Node%d [label = \"%d\"", pNode->Id, pNode->Id );
+//            Io_OutPrintf( pFile, "  Node%d [label = \"%d\"", pNode->Id, pNode->Id );
             if ( Abc_NtkIsStrash(pNtk) )
                 pSopString = "";
             else if ( Abc_NtkHasMapping(pNtk) && fGateNames )
@@ -637,25 +638,25 @@ void Io_WriteDotSeq( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
                 pSopString = Abc_NtkPrintSop(Mio_GateReadSop((Mio_Gate_t *)pNode->pData));
             else
                 pSopString = Abc_NtkPrintSop((char *)pNode->pData);
-            fprintf( pFile, "  Node%d [label = \"%d\\n%s\"", pNode->Id, pNode->Id, pSopString );
+            Io_OutPrintf( pFile, "  Node%d [label = \"%d\\n%s\"", pNode->Id, pNode->Id, pSopString );
 
-            fprintf( pFile, ", shape = ellipse" );
+            Io_OutPrintf( pFile, ", shape = ellipse" );
             if ( pNode->fMarkB )
-                fprintf( pFile, ", style = filled" );
-            fprintf( pFile, "];\n" );
+                Io_OutPrintf( pFile, ", style = filled" );
+            Io_OutPrintf( pFile, "];\n" );
         }
-        fprintf( pFile, "}" );
-        fprintf( pFile, "\n" );
-        fprintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "}" );
+        Io_OutPrintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "\n" );
     }
 
     // generate the PI nodes if any
     if ( LevelMin == 0 )
     {
-        fprintf( pFile, "{\n" );
-        fprintf( pFile, "  rank = same;\n" );
+        Io_OutPrintf( pFile, "{\n" );
+        Io_OutPrintf( pFile, "  rank = same;\n" );
         // the labeling node of this level
-        fprintf( pFile, "  Level%d;\n",  LevelMin );
+        Io_OutPrintf( pFile, "  Level%d;\n",  LevelMin );
         // generate the PO nodes
         Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pNode, i )
         {
@@ -666,52 +667,52 @@ void Io_WriteDotSeq( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
                 // check if the costant node is present
                 if ( Abc_ObjFaninNum(pNode) == 0 && Abc_ObjFanoutNum(pNode) > 0 )
                 {
-                    fprintf( pFile, "  Node%d [label = \"Const1\"", pNode->Id );
-                    fprintf( pFile, ", shape = ellipse" );
+                    Io_OutPrintf( pFile, "  Node%d [label = \"Const1\"", pNode->Id );
+                    Io_OutPrintf( pFile, ", shape = ellipse" );
                     if ( pNode->fMarkB )
-                        fprintf( pFile, ", style = filled" );
-                    fprintf( pFile, ", color = coral, fillcolor = coral" );
-                    fprintf( pFile, "];\n" );
+                        Io_OutPrintf( pFile, ", style = filled" );
+                    Io_OutPrintf( pFile, ", color = coral, fillcolor = coral" );
+                    Io_OutPrintf( pFile, "];\n" );
                 }
                 continue;
             }
-            fprintf( pFile, "  Node%d [label = \"%s\"", pNode->Id, Abc_ObjName(pNode) );
-            fprintf( pFile, ", shape = %s", "triangle" );
+            Io_OutPrintf( pFile, "  Node%d [label = \"%s\"", pNode->Id, Abc_ObjName(pNode) );
+            Io_OutPrintf( pFile, ", shape = %s", "triangle" );
             if ( pNode->fMarkB )
-                fprintf( pFile, ", style = filled" );
-            fprintf( pFile, ", color = coral, fillcolor = coral" );
-            fprintf( pFile, "];\n" );
+                Io_OutPrintf( pFile, ", style = filled" );
+            Io_OutPrintf( pFile, ", color = coral, fillcolor = coral" );
+            Io_OutPrintf( pFile, "];\n" );
         }
-        fprintf( pFile, "}" );
-        fprintf( pFile, "\n" );
-        fprintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "}" );
+        Io_OutPrintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "\n" );
     }
 
-//    fprintf( pFile, "{\n" );
+//    Io_OutPrintf( pFile, "{\n" );
     Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pNode, i )
     {
         if ( !Abc_ObjIsLatch(pNode) )
             continue;
-        fprintf( pFile, "Node%d [label = \"%s\"", pNode->Id, Abc_ObjName(pNode) );
-        fprintf( pFile, ", shape = box" );
+        Io_OutPrintf( pFile, "Node%d [label = \"%s\"", pNode->Id, Abc_ObjName(pNode) );
+        Io_OutPrintf( pFile, ", shape = box" );
         if ( pNode->fMarkB )
-            fprintf( pFile, ", style = filled" );
-        fprintf( pFile, ", color = coral, fillcolor = coral" );
-        fprintf( pFile, "];\n" );
+            Io_OutPrintf( pFile, ", style = filled" );
+        Io_OutPrintf( pFile, ", color = coral, fillcolor = coral" );
+        Io_OutPrintf( pFile, "];\n" );
     }
-//    fprintf( pFile, "}" );
-//    fprintf( pFile, "\n" );
-    fprintf( pFile, "\n" );
+//    Io_OutPrintf( pFile, "}" );
+//    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
 
     // generate invisible edges from the square down
-    fprintf( pFile, "title1 -> title2 [style = invis];\n" );
+    Io_OutPrintf( pFile, "title1 -> title2 [style = invis];\n" );
     Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pNode, i )
     {
         if ( (int)pNode->Level != LevelMax )
             continue;
         if ( !Abc_ObjIsPo(pNode) )
             continue;
-        fprintf( pFile, "title2 -> Node%d [style = invis];\n", pNode->Id );
+        Io_OutPrintf( pFile, "title2 -> Node%d [style = invis];\n", pNode->Id );
     }
 
     // generate edges
@@ -737,20 +738,21 @@ void Io_WriteDotSeq( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
                 continue;
 
             // generate the edge from this node to the next
-            fprintf( pFile, "Node%d",  pNode->Id );
-            fprintf( pFile, " -> " );
-            fprintf( pFile, "Node%d",  pFanin->Id );
-            fprintf( pFile, " [style = %s", fCompl? "dotted" : "bold" );
-//            fprintf( pFile, ", label = \"%c\"", 'a' + k );
-            fprintf( pFile, "]" );
-            fprintf( pFile, ";\n" );
+            Io_OutPrintf( pFile, "Node%d",  pNode->Id );
+            Io_OutPrintf( pFile, " -> " );
+            Io_OutPrintf( pFile, "Node%d",  pFanin->Id );
+            Io_OutPrintf( pFile, " [style = %s", fCompl? "dotted" : "bold" );
+//            Io_OutPrintf( pFile, ", label = \"%c\"", 'a' + k );
+            Io_OutPrintf( pFile, "]" );
+            Io_OutPrintf( pFile, ";\n" );
         }
     }
 
-    fprintf( pFile, "}" );
-    fprintf( pFile, "\n" );
-    fprintf( pFile, "\n" );
-    fclose( pFile );
+    Io_OutPrintf( pFile, "}" );
+    Io_OutPrintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
+    if ( !Io_OutStop( pFile ) )
+        fprintf( stdout, "Io_WriteDotSeq(): Writing the output file \"%s\" has failed.\n", pFileName );
 
     // unmark the nodes from the set
     Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pNode, i )
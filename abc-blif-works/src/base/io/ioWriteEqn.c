@@ -27,9 +27,10 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static void Io_NtkWriteEqnOne( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteEqnCis( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteEqnCos( FILE * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteEqnOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteEqnCis( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteEqnCos( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteEqnHop( Io_Out_t * pFile, Hop_Obj_t * pObj, Vec_Vec_t * vLevels, int Level );
 static int Io_NtkWriteEqnCheck( Abc_Ntk_t * pNtk );
 
 ////////////////////////////////////////////////////////////////////////
@@ -49,7 +50,7 @@ static int Io_NtkWriteEqnCheck( Abc_Ntk_t * pNtk );
 ***********************************************************************/
 void Io_WriteEqn( Abc_Ntk_t * pNtk, char * pFileName )
 {
-    FILE * pFile;
+    Io_Out_t * pFile;
 
     assert( Abc_NtkIsAigNetlist(pNtk) );
     if ( Abc_NtkLatchNum(pNtk) > 0 )
@@ -60,18 +61,19 @@ void Io_WriteEqn( Abc_Ntk_t * pNtk, char * pFileName )
         return;
 
     // start the output stream
-    pFile = fopen( pFileName, "w" );
+    pFile = Io_OutStart( pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Io_WriteEqn(): Cannot open the output file \"%s\".\n", pFileName );
         return;
     }
-    fprintf( pFile, "# Equations for \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    Io_OutPrintf( pFile, "# Equations for \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
 
     // write the equations for the network
     Io_NtkWriteEqnOne( pFile, pNtk );
-	fprintf( pFile, "\n" );
-	fclose( pFile );
+	Io_OutChar( pFile, '\n' );
+	if ( !Io_OutStop( pFile ) )
+		fprintf( stdout, "Io_WriteEqn(): Writing the output file \"%s\" has failed.\n", pFileName );
 }
 
 /**Function*************************************************************
@@ -85,7 +87,7 @@ void Io_WriteEqn( Abc_Ntk_t * pNtk, char * pFileName )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteEqnOne( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_NtkWriteEqnOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     Vec_Vec_t * vLevels;
     ProgressBar * pProgress;
@@ -93,14 +95,14 @@ void Io_NtkWriteEqnOne( FILE * pFile, Abc_Ntk_t * pNtk )
     int i, k;
 
     // write the PIs
-    fprintf( pFile, "INORDER =" );
+    Io_OutStr( pFile, "INORDER =" );
     Io_NtkWriteEqnCis( pFile, pNtk );
-    fprintf( pFile, ";\n" );
+    Io_OutStr( pFile, ";\n" );
 
     // write the POs
-    fprintf( pFile, "OUTORDER =" );
+    Io_OutStr( pFile, "OUTORDER =" );
     Io_NtkWriteEqnCos( pFile, pNtk );
-    fprintf( pFile, ";\n" );
+    Io_OutStr( pFile, ";\n" );
 
     // write each internal node
     vLevels = Vec_VecAlloc( 10 );
@@ -108,19 +110,68 @@ void Io_NtkWriteEqnOne( FILE * pFile, Abc_Ntk_t * pNtk )
     Abc_NtkForEachNode( pNtk, pNode, i )
     {
         Extra_ProgressBarUpdate( pProgress, i, NULL );
-        fprintf( pFile, "%s = ", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+        Io_OutPrintf( pFile, "%s = ", Abc_ObjName(Abc_ObjFanout0(pNode)) );
         // set the input names
         Abc_ObjForEachFanin( pNode, pFanin, k )
             Hop_IthVar((Hop_Man_t *)pNtk->pManFunc, k)->pData = Abc_ObjName(pFanin);
         // write the formula
-        Hop_ObjPrintEqn( pFile, (Hop_Obj_t *)pNode->pData, vLevels, 0 );
-        fprintf( pFile, ";\n" );
+        Io_NtkWriteEqnHop( pFile, (Hop_Obj_t *)pNode->pData, vLevels, 0 );
+        Io_OutStr( pFile, ";\n" );
     }
     Extra_ProgressBarStop( pProgress );
     Vec_VecFree( vLevels );
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Writes Eqn formula for the AIG rooted at this node.]
+
+  Description [Same as Hop_ObjPrintEqn() but writes into the buffered
+  output. The formula is in terms of PIs, which should have their names 
+  assigned in pObj->pData fields.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Io_NtkWriteEqnHop( Io_Out_t * pFile, Hop_Obj_t * pObj, Vec_Vec_t * vLevels, int Level )
+{
+    Vec_Ptr_t * vSuper;
+    Hop_Obj_t * pFanin;
+    int fCompl, i;
+    // store the complemented attribute
+    fCompl = Hop_IsComplement(pObj);
+    pObj = Hop_Regular(pObj);
+    // constant case
+    if ( Hop_ObjIsConst1(pObj) )
+    {
+        Io_OutChar( pFile, fCompl? '0' : '1' );
+        return;
+    }
+    // PI case
+    if ( Hop_ObjIsPi(pObj) )
+    {
+        if ( fCompl )
+            Io_OutChar( pFile, '!' );
+        Io_OutStr( pFile, (char*)pObj->pData );
+        return;
+    }
+    // AND case
+    Vec_VecExpand( vLevels, Level );
+    vSuper = Vec_VecEntry(vLevels, Level);
+    Hop_ObjCollectMulti( pObj, vSuper );
+    Io_OutStr( pFile, (Level==0? "" : "(") );
+    Vec_PtrForEachEntry( Hop_Obj_t *, vSuper, pFanin, i )
+    {
+        Io_NtkWriteEqnHop( pFile, Hop_NotCond(pFanin, fCompl), vLevels, Level+1 );
+        if ( i < Vec_PtrSize(vSuper) - 1 )
+            Io_OutStr( pFile, fCompl? " + " : " * " );
+    }
+    Io_OutStr( pFile, (Level==0? "" : ")") );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writes the primary input list.]
@@ -132,7 +183,7 @@ void Io_NtkWriteEqnOne( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteEqnCis( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_NtkWriteEqnCis( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pTerm, * pNet;
     int LineLength;
@@ -150,12 +201,12 @@ void Io_NtkWriteEqnCis( FILE * pFile, Abc_Ntk_t * pNtk )
         AddedLength = strlen(Abc_ObjName(pNet)) + 1;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, " \n" );
+            Io_OutStr( pFile, " \n" );
             // reset the line length
             LineLength  = 0;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s", Abc_ObjName(pNet) );
+        Io_OutPrintf( pFile, " %s", Abc_ObjName(pNet) );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -172,7 +223,7 @@ void Io_NtkWriteEqnCis( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteEqnCos( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_NtkWriteEqnCos( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pTerm, * pNet;
     int LineLength;
@@ -190,12 +241,12 @@ void Io_NtkWriteEqnCos( FILE * pFile, Abc_Ntk_t * pNtk )
         AddedLength = strlen(Abc_ObjName(pNet)) + 1;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, " \n" );
+            Io_OutStr( pFile, " \n" );
             // reset the line length
             LineLength  = 0;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s", Abc_ObjName(pNet) );
+        Io_OutPrintf( pFile, " %s", Abc_ObjName(pNet) );
         LineLength += AddedLength;
         NameCounter++;
     }
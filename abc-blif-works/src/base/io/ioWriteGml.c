@@ -45,70 +45,71 @@ ABC_NAMESPACE_IMPL_START
 ***********************************************************************/
 void Io_WriteGml( Abc_Ntk_t * pNtk, char * pFileName )
 {
-    FILE * pFile;
+    Io_Out_t * pFile;
     Abc_Obj_t * pObj, * pFanin;
     int i, k;
 
     assert( Abc_NtkIsStrash(pNtk) || Abc_NtkIsLogic(pNtk)  );
 
     // start the output stream
-    pFile = fopen( pFileName, "w" );
+    pFile = Io_OutStart( pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Io_WriteGml(): Cannot open the output file \"%s\".\n", pFileName );
         return;
     }
-    fprintf( pFile, "# GML for \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
-	fprintf( pFile, "graph [\n" );
+    Io_OutPrintf( pFile, "# GML for \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+	Io_OutPrintf( pFile, "graph [\n" );
 
     // output the POs
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
     Abc_NtkForEachPo( pNtk, pObj, i )
     {
-        fprintf( pFile, "    node [ id %5d label \"%s\"\n", pObj->Id, Abc_ObjName(pObj) );
-        fprintf( pFile, "        graphics [ type \"triangle\" fill \"#00FFFF\" ]\n" );   // blue
-        fprintf( pFile, "    ]\n" );
+        Io_OutPrintf( pFile, "    node [ id %5d label \"%s\"\n", pObj->Id, Abc_ObjName(pObj) );
+        Io_OutPrintf( pFile, "        graphics [ type \"triangle\" fill \"#00FFFF\" ]\n" );   // blue
+        Io_OutPrintf( pFile, "    ]\n" );
     }
     // output the PIs
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
     Abc_NtkForEachPi( pNtk, pObj, i )
     {
-        fprintf( pFile, "    node [ id %5d label \"%s\"\n", pObj->Id, Abc_ObjName(pObj) );
-        fprintf( pFile, "        graphics [ type \"triangle\" fill \"#00FF00\" ]\n" );   // green
-        fprintf( pFile, "    ]\n" );
+        Io_OutPrintf( pFile, "    node [ id %5d label \"%s\"\n", pObj->Id, Abc_ObjName(pObj) );
+        Io_OutPrintf( pFile, "        graphics [ type \"triangle\" fill \"#00FF00\" ]\n" );   // green
+        Io_OutPrintf( pFile, "    ]\n" );
     }
     // output the latches
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
     Abc_NtkForEachLatch( pNtk, pObj, i )
     {
-        fprintf( pFile, "    node [ id %5d label \"%s\"\n", pObj->Id, Abc_ObjName(pObj) );
-        fprintf( pFile, "        graphics [ type \"rectangle\" fill \"#FF0000\" ]\n" );   // red
-        fprintf( pFile, "    ]\n" );
+        Io_OutPrintf( pFile, "    node [ id %5d label \"%s\"\n", pObj->Id, Abc_ObjName(pObj) );
+        Io_OutPrintf( pFile, "        graphics [ type \"rectangle\" fill \"#FF0000\" ]\n" );   // red
+        Io_OutPrintf( pFile, "    ]\n" );
     }
     // output the nodes
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
     Abc_NtkForEachNode( pNtk, pObj, i )
     {
-        fprintf( pFile, "    node [ id %5d label \"%s\"\n", pObj->Id, Abc_ObjName(pObj) );
-        fprintf( pFile, "        graphics [ type \"ellipse\" fill \"#CCCCFF\" ]\n" );     // grey
-        fprintf( pFile, "    ]\n" );
+        Io_OutPrintf( pFile, "    node [ id %5d label \"%s\"\n", pObj->Id, Abc_ObjName(pObj) );
+        Io_OutPrintf( pFile, "        graphics [ type \"ellipse\" fill \"#CCCCFF\" ]\n" );     // grey
+        Io_OutPrintf( pFile, "    ]\n" );
     }
 
     // output the edges
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "\n" );
     Abc_NtkForEachObj( pNtk, pObj, i )
     {
         Abc_ObjForEachFanin( pObj, pFanin, k )
         {
-            fprintf( pFile, "    edge [ source %5d   target %5d\n", pObj->Id, pFanin->Id );
-            fprintf( pFile, "        graphics [ type \"line\" arrow \"first\" ]\n" );
-            fprintf( pFile, "    ]\n" );
+            Io_OutPrintf( pFile, "    edge [ source %5d   target %5d\n", pObj->Id, pFanin->Id );
+            Io_OutPrintf( pFile, "        graphics [ type \"line\" arrow \"first\" ]\n" );
+            Io_OutPrintf( pFile, "    ]\n" );
         }
     }
 
-	fprintf( pFile, "]\n" );
-	fprintf( pFile, "\n" );
-	fclose( pFile );
+	Io_OutPrintf( pFile, "]\n" );
+	Io_OutPrintf( pFile, "\n" );
+	if ( !Io_OutStop( pFile ) )
+		fprintf( stdout, "Io_WriteGml(): Writing the output file \"%s\" has failed.\n", pFileName );
 }
 
 
@@ -81,8 +81,8 @@ v_10_s1	>	v_4 ([v_10_s1__v_4] = 1), v_8 ([v_10_s1__v_8] = 1).
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static void Io_WriteListEdge( FILE * pFile, Abc_Obj_t * pObj );
-static void Io_WriteListHost( FILE * pFile, Abc_Ntk_t * pNtk );
+static void Io_WriteListEdge( Io_Out_t * pFile, Abc_Obj_t * pObj );
+static void Io_WriteListHost( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -101,22 +101,22 @@ static void Io_WriteListHost( FILE * pFile, Abc_Ntk_t * pNtk );
 ***********************************************************************/
 void Io_WriteList( Abc_Ntk_t * pNtk, char * pFileName, int fUseHost )
 {
-    FILE * pFile;
+    Io_Out_t * pFile;
     Abc_Obj_t * pObj;
     int i;
 
 //    assert( Abc_NtkIsSeq(pNtk)  );
 
     // start the output stream
-    pFile = fopen( pFileName, "w" );
+    pFile = Io_OutStart( pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Io_WriteList(): Cannot open the output file \"%s\".\n", pFileName );
         return;
     }
 
-    fprintf( pFile, "# Adjacency list for sequential AIG \"%s\"\n", pNtk->pName );
-    fprintf( pFile, "# written by ABC on %s\n", Extra_TimeStamp() );
+    Io_OutPrintf( pFile, "# Adjacency list for sequential AIG \"%s\"\n", pNtk->pName );
+    Io_OutPrintf( pFile, "# written by ABC on %s\n", Extra_TimeStamp() );
 
     // write the constant node
     if ( Abc_ObjFanoutNum( Abc_AigConst1(pNtk) ) > 0 )
@@ -137,8 +137,9 @@ void Io_WriteList( Abc_Ntk_t * pNtk, char * pFileName, int fUseHost )
         Abc_NtkForEachPo( pNtk, pObj, i )
             Io_WriteListEdge( pFile, pObj );
 
-	fprintf( pFile, "\n" );
-	fclose( pFile );
+	Io_OutPrintf( pFile, "\n" );
+	if ( !Io_OutStop( pFile ) )
+		fprintf( stdout, "Io_WriteList(): Writing the output file \"%s\" has failed.\n", pFileName );
 }
 
 /**Function*************************************************************
@@ -152,22 +153,22 @@ void Io_WriteList( Abc_Ntk_t * pNtk, char * pFileName, int fUseHost )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteListEdge( FILE * pFile, Abc_Obj_t * pObj )
+void Io_WriteListEdge( Io_Out_t * pFile, Abc_Obj_t * pObj )
 {
     Abc_Obj_t * pFanout;
     int i;
-    fprintf( pFile, "%-10s >    ", Abc_ObjName(pObj) );
+    Io_OutPrintf( pFile, "%-10s >    ", Abc_ObjName(pObj) );
     Abc_ObjForEachFanout( pObj, pFanout, i )
     {
-        fprintf( pFile, " %s", Abc_ObjName(pFanout) );
-        fprintf( pFile, " ([%s_to_", Abc_ObjName(pObj) );
-//        fprintf( pFile, "%s] = %d)", Abc_ObjName(pFanout), Seq_ObjFanoutL(pObj, pFanout) );
-        fprintf( pFile, "%s] = %d)", Abc_ObjName(pFanout), 0 );
+        Io_OutPrintf( pFile, " %s", Abc_ObjName(pFanout) );
+        Io_OutPrintf( pFile, " ([%s_to_", Abc_ObjName(pObj) );
+//        Io_OutPrintf( pFile, "%s] = %d)", Abc_ObjName(pFanout), Seq_ObjFanoutL(pObj, pFanout) );
+        Io_OutPrintf( pFile, "%s] = %d)", Abc_ObjName(pFanout), 0 );
         if ( i != Abc_ObjFanoutNum(pObj) - 1 )
-            fprintf( pFile, "," );
+            Io_OutPrintf( pFile, "," );
     }
-    fprintf( pFile, "." );
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "." );
+    Io_OutPrintf( pFile, "\n" );
 }
 
 /**Function*************************************************************
@@ -181,29 +182,29 @@ void Io_WriteListEdge( FILE * pFile, Abc_Obj_t * pObj )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteListHost( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_WriteListHost( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pObj;
     int i;
 
     Abc_NtkForEachPo( pNtk, pObj, i )
     {
-        fprintf( pFile, "%-10s >    ", Abc_ObjName(pObj) );
-        fprintf( pFile, " %s ([%s_to_%s] = %d)", "HOST", Abc_ObjName(pObj), "HOST", 0 );
-        fprintf( pFile, "." );
-        fprintf( pFile, "\n" );
+        Io_OutPrintf( pFile, "%-10s >    ", Abc_ObjName(pObj) );
+        Io_OutPrintf( pFile, " %s ([%s_to_%s] = %d)", "HOST", Abc_ObjName(pObj), "HOST", 0 );
+        Io_OutPrintf( pFile, "." );
+        Io_OutPrintf( pFile, "\n" );
     }
 
-    fprintf( pFile, "%-10s >    ", "HOST" );
+    Io_OutPrintf( pFile, "%-10s >    ", "HOST" );
     Abc_NtkForEachPi( pNtk, pObj, i )
     {
-        fprintf( pFile, " %s", Abc_ObjName(pObj) );
-        fprintf( pFile, " ([%s_to_%s] = %d)", "HOST", Abc_ObjName(pObj), 0 );
+        Io_OutPrintf( pFile, " %s", Abc_ObjName(pObj) );
+        Io_OutPrintf( pFile, " ([%s_to_%s] = %d)", "HOST", Abc_ObjName(pObj), 0 );
         if ( i != Abc_NtkPiNum(pNtk) - 1 )
-            fprintf( pFile, "," );
+            Io_OutPrintf( pFile, "," );
     }
-    fprintf( pFile, "." );
-    fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "." );
+    Io_OutPrintf( pFile, "\n" );
 }
 
 
@@ -220,21 +221,21 @@ void Io_WriteListHost( FILE * pFile, Abc_Ntk_t * pNtk )
 ***********************************************************************/
 void Io_WriteCellNet( Abc_Ntk_t * pNtk, char * pFileName )
 {
-    FILE * pFile;
+    Io_Out_t * pFile;
     Abc_Obj_t * pObj, * pFanout;
     int i, k;
 
     assert( Abc_NtkIsLogic(pNtk)  );
 
     // start the output stream
-    pFile = fopen( pFileName, "w" );
+    pFile = Io_OutStart( pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Io_WriteCellNet(): Cannot open the output file \"%s\".\n", pFileName );
         return;
     }
 
-    fprintf( pFile, "# CellNet file for network \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    Io_OutPrintf( pFile, "# CellNet file for network \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
 
     // the only tricky part with writing is handling latches:
     // each latch comes with (a) single-input latch-input node, (b) latch proper, (c) single-input latch-output node
@@ -243,45 +244,46 @@ void Io_WriteCellNet( Abc_Ntk_t * pNtk, char * pFileName )
 
     // write the PIs
     Abc_NtkForEachPi( pNtk, pObj, i )
-        fprintf( pFile, "cell %d is 0\n", pObj->Id );
+        Io_OutPrintf( pFile, "cell %d is 0\n", pObj->Id );
     // write the POs
     Abc_NtkForEachPo( pNtk, pObj, i )
-        fprintf( pFile, "cell %d is 1\n", pObj->Id );
+        Io_OutPrintf( pFile, "cell %d is 1\n", pObj->Id );
     // write the latches (use the ID of latch input)
     Abc_NtkForEachLatch( pNtk, pObj, i )
-        fprintf( pFile, "cell %d is 2\n", Abc_ObjFanin0(pObj)->Id );
+        Io_OutPrintf( pFile, "cell %d is 2\n", Abc_ObjFanin0(pObj)->Id );
     // write the logic nodes
     Abc_NtkForEachNode( pNtk, pObj, i )
-        fprintf( pFile, "cell %d is %d\n", pObj->Id, 3+Abc_ObjFaninNum(pObj) );
+        Io_OutPrintf( pFile, "cell %d is %d\n", pObj->Id, 3+Abc_ObjFaninNum(pObj) );
 
     // write the nets driven by PIs
     Abc_NtkForEachPi( pNtk, pObj, i )
     {
-        fprintf( pFile, "net %d  %d 0", pObj->Id, pObj->Id );
+        Io_OutPrintf( pFile, "net %d  %d 0", pObj->Id, pObj->Id );
         Abc_ObjForEachFanout( pObj, pFanout, k )
-            fprintf( pFile, "  %d %d", pFanout->Id, 1 + Abc_ObjFanoutFaninNum(pFanout, pObj) );
-	    fprintf( pFile, "\n" );
+            Io_OutPrintf( pFile, "  %d %d", pFanout->Id, 1 + Abc_ObjFanoutFaninNum(pFanout, pObj) );
+	    Io_OutPrintf( pFile, "\n" );
     }
     // write the nets driven by latches
     Abc_NtkForEachLatch( pNtk, pObj, i )
     {
-        fprintf( pFile, "net %d  %d 0", Abc_ObjFanin0(pObj)->Id, Abc_ObjFanin0(pObj)->Id );
+        Io_OutPrintf( pFile, "net %d  %d 0", Abc_ObjFanin0(pObj)->Id, Abc_ObjFanin0(pObj)->Id );
         pObj = Abc_ObjFanout0(pObj);
         Abc_ObjForEachFanout( pObj, pFanout, k )
-            fprintf( pFile, "  %d %d", pFanout->Id, 1 + Abc_ObjFanoutFaninNum(pFanout, pObj) );
-	    fprintf( pFile, "\n" );
+            Io_OutPrintf( pFile, "  %d %d", pFanout->Id, 1 + Abc_ObjFanoutFaninNum(pFanout, pObj) );
+	    Io_OutPrintf( pFile, "\n" );
     }
     // write the nets driven by nodes
     Abc_NtkForEachNode( pNtk, pObj, i )
     {
-        fprintf( pFile, "net %d  %d 0", pObj->Id, pObj->Id );
+        Io_OutPrintf( pFile, "net %d  %d 0", pObj->Id, pObj->Id );
         Abc_ObjForEachFanout( pObj, pFanout, k )
-            fprintf( pFile, "  %d %d", pFanout->Id, 1 + Abc_ObjFanoutFaninNum(pFanout, pObj) );
-	    fprintf( pFile, "\n" );
+            Io_OutPrintf( pFile, "  %d %d", pFanout->Id, 1 + Abc_ObjFanoutFaninNum(pFanout, pObj) );
+	    Io_OutPrintf( pFile, "\n" );
     }
 
-	fprintf( pFile, "\n" );
-	fclose( pFile );
+	Io_OutPrintf( pFile, "\n" );
+	if ( !Io_OutStop( pFile ) )
+		fprintf( stdout, "Io_WriteCellNet(): Writing the output file \"%s\" has failed.\n", pFileName );
 }
 
 ////////////////////////////////////////////////////////////////////////
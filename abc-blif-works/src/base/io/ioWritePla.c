@@ -27,7 +27,7 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static int    Io_WritePlaOne( FILE * pFile, Abc_Ntk_t * pNtk );
+static int    Io_WritePlaOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -47,18 +47,18 @@ static int    Io_WritePlaOne( FILE * pFile, Abc_Ntk_t * pNtk );
 int Io_WritePla( Abc_Ntk_t * pNtk, char * pFileName )
 {
     Abc_Ntk_t * pExdc;
-    FILE * pFile;
+    Io_Out_t * pFile;
 
     assert( Abc_NtkIsSopNetlist(pNtk) );
     assert( Abc_NtkLevel(pNtk) == 1 );
 
-    pFile = fopen( pFileName, "w" );
+    pFile = Io_OutStart( pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Io_WritePla(): Cannot open the output file.\n" );
         return 0;
     }
-    fprintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    Io_OutPrintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
     // write the network
     Io_WritePlaOne( pFile, pNtk );
     // write EXDC network if it exists
@@ -66,7 +66,11 @@ int Io_WritePla( Abc_Ntk_t * pNtk, char * pFileName )
     if ( pExdc )
         printf( "Io_WritePla: EXDC is not written (warning).\n" );
     // finalize the file
-    fclose( pFile );
+    if ( !Io_OutStop( pFile ) )
+    {
+        fprintf( stdout, "Io_WritePla(): Writing the output file \"%s\" has failed.\n", pFileName );
+        return 0;
+    }
     return 1;
 }
 
@@ -81,7 +85,7 @@ int Io_WritePla( Abc_Ntk_t * pNtk, char * pFileName )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_WritePlaOne( FILE * pFile, Abc_Ntk_t * pNtk )
+int Io_WritePlaOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     ProgressBar * pProgress;
     Abc_Obj_t * pNode, * pFanin, * pDriver;
@@ -115,17 +119,17 @@ int Io_WritePlaOne( FILE * pFile, Abc_Ntk_t * pNtk )
     memset( pCubeOut, '0', nOutputs );    pCubeOut[nOutputs] = 0;
 
     // write the header
-    fprintf( pFile, ".i %d\n", nInputs );
-    fprintf( pFile, ".o %d\n", nOutputs );
-    fprintf( pFile, ".ilb" );
+    Io_OutPrintf( pFile, ".i %d\n", nInputs );
+    Io_OutPrintf( pFile, ".o %d\n", nOutputs );
+    Io_OutStr( pFile, ".ilb" );
     Abc_NtkForEachCi( pNtk, pNode, i )
-        fprintf( pFile, " %s", Abc_ObjName(Abc_ObjFanout0(pNode)) );
-    fprintf( pFile, "\n" );
-    fprintf( pFile, ".ob" );
+        Io_OutPrintf( pFile, " %s", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+    Io_OutChar( pFile, '\n' );
+    Io_OutStr( pFile, ".ob" );
     Abc_NtkForEachCo( pNtk, pNode, i )
-        fprintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin0(pNode)) );
-    fprintf( pFile, "\n" );
-    fprintf( pFile, ".p %d\n", nProducts );
+        Io_OutPrintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin0(pNode)) );
+    Io_OutChar( pFile, '\n' );
+    Io_OutPrintf( pFile, ".p %d\n", nProducts );
 
     // mark the CI nodes
     Abc_NtkForEachCi( pNtk, pNode, i )
@@ -146,14 +150,14 @@ int Io_WritePlaOne( FILE * pFile, Abc_Ntk_t * pNtk )
         {
             assert( Abc_ObjIsCi(pDriver) );
             pCubeIn[(int)(ABC_PTRUINT_T)pDriver->pCopy] = '1' - Abc_ObjFaninC0(pNode);
-            fprintf( pFile, "%s %s\n", pCubeIn, pCubeOut );
+            Io_OutPrintf( pFile, "%s %s\n", pCubeIn, pCubeOut );
             pCubeIn[(int)(ABC_PTRUINT_T)pDriver->pCopy] = '-';
             continue;
         }
         if ( Abc_NodeIsConst(pDriver) )
         {
             if ( Abc_NodeIsConst1(pDriver) )
-                fprintf( pFile, "%s %s\n", pCubeIn, pCubeOut );
+                Io_OutPrintf( pFile, "%s %s\n", pCubeIn, pCubeOut );
             continue;
         }
 
@@ -170,7 +174,7 @@ int Io_WritePlaOne( FILE * pFile, Abc_Ntk_t * pNtk )
                 assert( (int)(ABC_PTRUINT_T)pFanin->pCopy < nInputs );
                 pCubeIn[(int)(ABC_PTRUINT_T)pFanin->pCopy] = pCube[k];
             }
-            fprintf( pFile, "%s %s\n", pCubeIn, pCubeOut );
+            Io_OutPrintf( pFile, "%s %s\n", pCubeIn, pCubeOut );
         }
         // clean the cube for future writing
         Abc_ObjForEachFanin( pDriver, pFanin, k )
@@ -182,7 +186,7 @@ int Io_WritePlaOne( FILE * pFile, Abc_Ntk_t * pNtk )
         Extra_ProgressBarUpdate( pProgress, i, NULL );
     }
     Extra_ProgressBarStop( pProgress );
-    fprintf( pFile, ".e\n" );
+    Io_OutStr( pFile, ".e\n" );
 
     // clean the CI nodes
     Abc_NtkForEachCi( pNtk, pNode, i )
@@ -29,8 +29,8 @@ ABC_NAMESPACE_IMPL_START
 
 static int Io_WriteSmvCheckNames( Abc_Ntk_t * pNtk );
 
-static int Io_WriteSmvOne( FILE * pFile, Abc_Ntk_t * pNtk );
-static int Io_WriteSmvOneNode( FILE * pFile, Abc_Obj_t * pNode );
+static int Io_WriteSmvOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static int Io_WriteSmvOneNode( Io_Out_t * pFile, Abc_Obj_t * pNode );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -71,20 +71,20 @@ static int hasPrefix(const char *needle, const char *haystack)
 int Io_WriteSmv( Abc_Ntk_t * pNtk, char * pFileName )
 {
     Abc_Ntk_t * pExdc;
-    FILE * pFile;
+    Io_Out_t * pFile;
     assert( Abc_NtkIsSopNetlist(pNtk) );
     if ( !Io_WriteSmvCheckNames(pNtk) )
     {
         fprintf( stdout, "Io_WriteSmv(): Signal names in this benchmark contain parantheses making them impossible to reproduce in the SMV format. Use \"short_names\".\n" );
         return 0;
     }
-    pFile = fopen( pFileName, "w" );
+    pFile = Io_OutStart( pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Io_WriteSmv(): Cannot open the output file.\n" );
         return 0;
     }
-    fprintf( pFile, "-- benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    Io_OutPrintf( pFile, "-- benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
     // write the network
     Io_WriteSmvOne( pFile, pNtk );
     // write EXDC network if it exists
@@ -92,7 +92,11 @@ int Io_WriteSmv( Abc_Ntk_t * pNtk, char * pFileName )
     if ( pExdc )
         printf( "Io_WriteSmv: EXDC is not written (warning).\n" );
     // finalize the file
-    fclose( pFile );
+    if ( !Io_OutStop( pFile ) )
+    {
+        fprintf( stdout, "Io_WriteSmv(): Writing the output file \"%s\" has failed.\n", pFileName );
+        return 0;
+    }
     return 1;
 }
 
@@ -107,27 +111,27 @@ int Io_WriteSmv( Abc_Ntk_t * pNtk, char * pFileName )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_WriteSmvOne( FILE * pFile, Abc_Ntk_t * pNtk )
+int Io_WriteSmvOne( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     ProgressBar * pProgress;
     Abc_Obj_t * pNode;
     int i;
 
     // write the PIs/POs/latches
-    fprintf( pFile, "MODULE main\n");   // nusmv needs top module to be main
-    fprintf ( pFile, "\n" );
+    Io_OutPrintf( pFile, "MODULE main\n");   // nusmv needs top module to be main
+    Io_OutChar( pFile, '\n' );
 
-    fprintf( pFile, "VAR  -- inputs\n");
+    Io_OutPrintf( pFile, "VAR  -- inputs\n");
     Abc_NtkForEachPi( pNtk, pNode, i )
-        fprintf( pFile, "    %s : boolean;\n", 
+        Io_OutPrintf( pFile, "    %s : boolean;\n", 
                 cleanUNSAFE(Abc_ObjName(Abc_ObjFanout0(pNode))) );
-    fprintf ( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
 
-    fprintf( pFile, "VAR  -- state variables\n");
+    Io_OutPrintf( pFile, "VAR  -- state variables\n");
     Abc_NtkForEachLatch( pNtk, pNode, i )
-        fprintf( pFile, "    %s : boolean;\n", 
+        Io_OutPrintf( pFile, "    %s : boolean;\n", 
                 cleanUNSAFE(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pNode)))) ); 
-    fprintf ( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
 
     // No outputs needed for NuSMV: 
     // TODO: Add sepcs by recognizing assume_.* and assert_.*
@@ -136,7 +140,7 @@ int Io_WriteSmvOne( FILE * pFile, Abc_Ntk_t * pNtk )
     //    fprintf( pFile, "OUTPUT(%s)\n", Abc_ObjName(Abc_ObjFanin0(pNode)) );
     
     // write internal nodes
-    fprintf( pFile, "DEFINE\n");
+    Io_OutPrintf( pFile, "DEFINE\n");
     pProgress = Extra_ProgressBarStart( stdout, Abc_NtkObjNumMax(pNtk) );
     Abc_NtkForEachNode( pNtk, pNode, i )
     {
@@ -144,9 +148,9 @@ int Io_WriteSmvOne( FILE * pFile, Abc_Ntk_t * pNtk )
         Io_WriteSmvOneNode( pFile, pNode );
     }
     Extra_ProgressBarStop( pProgress );
-    fprintf ( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
 
-    fprintf( pFile, "ASSIGN\n");
+    Io_OutPrintf( pFile, "ASSIGN\n");
     Abc_NtkForEachLatch( pNtk, pNode, i )
     {
         int Reset = (int)(ABC_PTRUINT_T)Abc_ObjData( pNode );
@@ -155,33 +159,33 @@ int Io_WriteSmvOne( FILE * pFile, Abc_Ntk_t * pNtk )
 
         if (Reset != 3)
         {
-            fprintf( pFile, "    init(%s) := %d;\n", 
+            Io_OutPrintf( pFile, "    init(%s) := %d;\n", 
                 cleanUNSAFE(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pNode)))),
                 Reset - 1); 
         }
-        fprintf( pFile, "    next(%s) := ", 
+        Io_OutPrintf( pFile, "    next(%s) := ", 
                 cleanUNSAFE(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pNode)))) ); 
-        fprintf( pFile, "%s;\n", 
+        Io_OutPrintf( pFile, "%s;\n", 
                 cleanUNSAFE(Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin0(pNode)))) );
     }
       
-    fprintf ( pFile, "\n" );
+    Io_OutChar( pFile, '\n' );
     Abc_NtkForEachPo( pNtk, pNode, i )
     {
         const char *n = cleanUNSAFE(Abc_ObjName(Abc_ObjFanin0(pNode)));
         // fprintf( pFile, "-- output %s;\n", n );
         if (hasPrefix("assume_fair_", n))
         {
-            fprintf( pFile, "FAIRNESS %s;\n", n );
+            Io_OutPrintf( pFile, "FAIRNESS %s;\n", n );
         }
         else if (hasPrefix("Assert_", n) || 
                 hasPrefix("assert_safety_", n))
         {
-            fprintf( pFile, "INVARSPEC %s;\n", n );
+            Io_OutPrintf( pFile, "INVARSPEC %s;\n", n );
         }
         else if (hasPrefix("assert_fair_", n))
         {
-            fprintf( pFile, "LTLSPEC G F %s;\n", n );
+            Io_OutPrintf( pFile, "LTLSPEC G F %s;\n", n );
         }
     }
 
@@ -199,7 +203,7 @@ int Io_WriteSmvOne( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_WriteSmvOneNode( FILE * pFile, Abc_Obj_t * pNode )
+int Io_WriteSmvOneNode( Io_Out_t * pFile, Abc_Obj_t * pNode )
 {
     int nFanins;
 
@@ -208,27 +212,27 @@ int Io_WriteSmvOneNode( FILE * pFile, Abc_Obj_t * pNode )
     if ( nFanins == 0 )
     {   // write the constant 1 node
         assert( Abc_NodeIsConst1(pNode) );
-        fprintf( pFile, "    %s", cleanUNSAFE(Abc_ObjName(Abc_ObjFanout0(pNode)) ) );
-        fprintf( pFile, " := 1;\n" );
+        Io_OutPrintf( pFile, "    %s", cleanUNSAFE(Abc_ObjName(Abc_ObjFanout0(pNode)) ) );
+        Io_OutStr( pFile, " := 1;\n" );
     }
     else if ( nFanins == 1 )
     {   // write the interver/buffer
         if ( Abc_NodeIsBuf(pNode) )
         {
-            fprintf( pFile, "    %s := ", cleanUNSAFE(Abc_ObjName(Abc_ObjFanout0(pNode))) );
-            fprintf( pFile, "%s;\n",      cleanUNSAFE(Abc_ObjName(Abc_ObjFanin0(pNode))) );
+            Io_OutPrintf( pFile, "    %s := ", cleanUNSAFE(Abc_ObjName(Abc_ObjFanout0(pNode))) );
+            Io_OutPrintf( pFile, "%s;\n",      cleanUNSAFE(Abc_ObjName(Abc_ObjFanin0(pNode))) );
         }
         else
         {
-            fprintf( pFile, "    %s := !",  cleanUNSAFE(Abc_ObjName(Abc_ObjFanout0(pNode))) );
-            fprintf( pFile, "%s;\n",       cleanUNSAFE(Abc_ObjName(Abc_ObjFanin0(pNode))) );
+            Io_OutPrintf( pFile, "    %s := !",  cleanUNSAFE(Abc_ObjName(Abc_ObjFanout0(pNode))) );
+            Io_OutPrintf( pFile, "%s;\n",       cleanUNSAFE(Abc_ObjName(Abc_ObjFanin0(pNode))) );
         }
     }
     else
     {   // write the AND gate
-        fprintf( pFile, "    %s", cleanUNSAFE(Abc_ObjName(Abc_ObjFanout0(pNode))) );
-        fprintf( pFile, " := %s & ", cleanUNSAFE(Abc_ObjName(Abc_ObjFanin0(pNode))) );
-        fprintf( pFile, "%s;\n", cleanUNSAFE(Abc_ObjName(Abc_ObjFanin1(pNode))) );
+        Io_OutPrintf( pFile, "    %s", cleanUNSAFE(Abc_ObjName(Abc_ObjFanout0(pNode))) );
+        Io_OutPrintf( pFile, " := %s & ", cleanUNSAFE(Abc_ObjName(Abc_ObjFanin0(pNode))) );
+        Io_OutPrintf( pFile, "%s;\n", cleanUNSAFE(Abc_ObjName(Abc_ObjFanin1(pNode))) );
     }
     return 1;
 }
@@ -29,13 +29,14 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static void Io_WriteVerilogInt( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_WriteVerilogPis( FILE * pFile, Abc_Ntk_t * pNtk, int Start );
-static void Io_WriteVerilogPos( FILE * pFile, Abc_Ntk_t * pNtk, int Start );
-static void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start );
-static void Io_WriteVerilogRegs( FILE * pFile, Abc_Ntk_t * pNtk, int Start );
-static void Io_WriteVerilogLatches( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_WriteVerilogObjects( FILE * pFile, Abc_Ntk_t * pNtk );
+static void Io_WriteVerilogInt( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_WriteVerilogPis( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int Start );
+static void Io_WriteVerilogPos( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int Start );
+static void Io_WriteVerilogWires( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int Start );
+static void Io_WriteVerilogRegs( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int Start );
+static void Io_WriteVerilogLatches( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_WriteVerilogObjects( Io_Out_t * pFile, Abc_Ntk_t * pNtk );
+static void Io_WriteVerilogHop( Io_Out_t * pFile, Hop_Obj_t * pObj, Vec_Vec_t * vLevels, int Level );
 static int  Io_WriteVerilogWiresCount( Abc_Ntk_t * pNtk );
 static char * Io_WriteVerilogGetName( char * pName );
 
@@ -57,7 +58,7 @@ static char * Io_WriteVerilogGetName( char * pName );
 void Io_WriteVerilog( Abc_Ntk_t * pNtk, char * pFileName )
 {
     Abc_Ntk_t * pNetlist;
-    FILE * pFile;
+    Io_Out_t * pFile;
     int i;
     // can only write nodes represented using local AIGs
     if ( !Abc_NtkIsAigNetlist(pNtk) && !Abc_NtkIsMappedNetlist(pNtk) )
@@ -66,7 +67,7 @@ void Io_WriteVerilog( Abc_Ntk_t * pNtk, char * pFileName )
         return;
     }
     // start the output stream
-    pFile = fopen( pFileName, "w" );
+    pFile = Io_OutStart( pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Io_WriteVerilog(): Cannot open the output file \"%s\".\n", pFileName );
@@ -74,8 +75,8 @@ void Io_WriteVerilog( Abc_Ntk_t * pNtk, char * pFileName )
     }
 
     // write the equations for the network
-    fprintf( pFile, "// Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
-	fprintf( pFile, "\n" );
+    Io_OutPrintf( pFile, "// Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+	Io_OutChar( pFile, '\n' );
 
     // write modules
     if ( pNtk->pDesign )
@@ -88,7 +89,7 @@ void Io_WriteVerilog( Abc_Ntk_t * pNtk, char * pFileName )
             assert( Abc_NtkIsNetlist(pNetlist) );
             if ( pNetlist == pNtk )
                 continue;
-	        fprintf( pFile, "\n" );
+	        Io_OutChar( pFile, '\n' );
             Io_WriteVerilogInt( pFile, pNetlist );
         }
     }
@@ -97,8 +98,9 @@ void Io_WriteVerilog( Abc_Ntk_t * pNtk, char * pFileName )
         Io_WriteVerilogInt( pFile, pNtk );
     }
 
-	fprintf( pFile, "\n" );
-	fclose( pFile );
+	Io_OutChar( pFile, '\n' );
+	if ( !Io_OutStop( pFile ) )
+		fprintf( stdout, "Io_WriteVerilog(): Writing the output file \"%s\" has failed.\n", pFileName );
 }
 
 /**Function*************************************************************
@@ -112,55 +114,55 @@ void Io_WriteVerilog( Abc_Ntk_t * pNtk, char * pFileName )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogInt( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_WriteVerilogInt( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     // write inputs and outputs
 //    fprintf( pFile, "module %s ( gclk,\n   ", Abc_NtkName(pNtk) );
-    fprintf( pFile, "module %s ( ", Abc_NtkName(pNtk) );
+    Io_OutPrintf( pFile, "module %s ( ", Abc_NtkName(pNtk) );
     // add the clock signal if it does not exist
     if ( Abc_NtkLatchNum(pNtk) > 0 && Nm_ManFindIdByName(pNtk->pManName, "clock", ABC_OBJ_PI) == -1 )
-        fprintf( pFile, "clock, " );
+        Io_OutStr( pFile, "clock, " );
     // write other primary inputs
-    fprintf( pFile, "\n   " );
+    Io_OutStr( pFile, "\n   " );
     if ( Abc_NtkPiNum(pNtk) > 0  )
     {
         Io_WriteVerilogPis( pFile, pNtk, 3 );
-        fprintf( pFile, ",\n   " );
+        Io_OutStr( pFile, ",\n   " );
     }
     if ( Abc_NtkPoNum(pNtk) > 0  )
         Io_WriteVerilogPos( pFile, pNtk, 3 );
-    fprintf( pFile, "  );\n" );
+    Io_OutStr( pFile, "  );\n" );
     // add the clock signal if it does not exist
     if ( Abc_NtkLatchNum(pNtk) > 0 && Nm_ManFindIdByName(pNtk->pManName, "clock", ABC_OBJ_PI) == -1 )
-        fprintf( pFile, "  input  clock;\n" );
+        Io_OutStr( pFile, "  input  clock;\n" );
     // write inputs, outputs, registers, and wires
     if ( Abc_NtkPiNum(pNtk) > 0  )
     {
 //        fprintf( pFile, "  input gclk," );
-        fprintf( pFile, "  input " );
+        Io_OutStr( pFile, "  input " );
         Io_WriteVerilogPis( pFile, pNtk, 10 );
-        fprintf( pFile, ";\n" );
+        Io_OutStr( pFile, ";\n" );
     }
     if ( Abc_NtkPoNum(pNtk) > 0  )
     {
-        fprintf( pFile, "  output" );
+        Io_OutStr( pFile, "  output" );
         Io_WriteVerilogPos( pFile, pNtk, 5 );
-        fprintf( pFile, ";\n" );
+        Io_OutStr( pFile, ";\n" );
     }
     // if this is not a blackbox, write internal signals
     if ( !Abc_NtkHasBlackbox(pNtk) )
     {
         if ( Abc_NtkLatchNum(pNtk) > 0 )
         {
-            fprintf( pFile, "  reg" );
+            Io_OutStr( pFile, "  reg" );
             Io_WriteVerilogRegs( pFile, pNtk, 4 );
-            fprintf( pFile, ";\n" );
+            Io_OutStr( pFile, ";\n" );
         }
         if ( Io_WriteVerilogWiresCount(pNtk) > 0 )
         {
-            fprintf( pFile, "  wire" );
+            Io_OutStr( pFile, "  wire" );
             Io_WriteVerilogWires( pFile, pNtk, 4 );
-            fprintf( pFile, ";\n" );
+            Io_OutStr( pFile, ";\n" );
         }
         // write nodes
         Io_WriteVerilogObjects( pFile, pNtk );        
@@ -169,7 +171,7 @@ void Io_WriteVerilogInt( FILE * pFile, Abc_Ntk_t * pNtk )
             Io_WriteVerilogLatches( pFile, pNtk );
     }
     // finalize the file
-    fprintf( pFile, "endmodule\n\n" );
+    Io_OutStr( pFile, "endmodule\n\n" );
 } 
 
 /**Function*************************************************************
@@ -183,7 +185,7 @@ void Io_WriteVerilogInt( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogPis( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
+void Io_WriteVerilogPis( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int Start )
 {
     Abc_Obj_t * pTerm, * pNet;
     int LineLength;
@@ -200,12 +202,12 @@ void Io_WriteVerilogPis( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
         AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, "\n   " );
+            Io_OutStr( pFile, "\n   " );
             // reset the line length
             LineLength  = 3;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (i==Abc_NtkPiNum(pNtk)-1)? "" : "," );
+        Io_OutPrintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (i==Abc_NtkPiNum(pNtk)-1)? "" : "," );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -222,7 +224,7 @@ void Io_WriteVerilogPis( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogPos( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
+void Io_WriteVerilogPos( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int Start )
 {
     Abc_Obj_t * pTerm, * pNet, * pSkip;
     int LineLength;
@@ -255,12 +257,12 @@ void Io_WriteVerilogPos( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
         AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, "\n   " );
+            Io_OutStr( pFile, "\n   " );
             // reset the line length
             LineLength  = 3;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (i==Abc_NtkPoNum(pNtk)-1)? "" : "," );
+        Io_OutPrintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (i==Abc_NtkPoNum(pNtk)-1)? "" : "," );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -285,7 +287,7 @@ void Io_WriteVerilogPos( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
+void Io_WriteVerilogWires( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int Start )
 {
     Abc_Obj_t * pObj, * pNet, * pBox, * pTerm;
     int LineLength;
@@ -312,12 +314,12 @@ void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
         AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, "\n   " );
+            Io_OutStr( pFile, "\n   " );
             // reset the line length
             LineLength  = 3;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
+        Io_OutPrintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -329,12 +331,12 @@ void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
         AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, "\n   " );
+            Io_OutStr( pFile, "\n   " );
             // reset the line length
             LineLength  = 3;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
+        Io_OutPrintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -350,12 +352,12 @@ void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
             AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
             if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
             { // write the line extender
-                fprintf( pFile, "\n   " );
+                Io_OutStr( pFile, "\n   " );
                 // reset the line length
                 LineLength  = 3;
                 NameCounter = 0;
             }
-            fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
+            Io_OutPrintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
             LineLength += AddedLength;
             NameCounter++;
         }
@@ -369,12 +371,12 @@ void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
             AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
             if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
             { // write the line extender
-                fprintf( pFile, "\n   " );
+                Io_OutStr( pFile, "\n   " );
                 // reset the line length
                 LineLength  = 3;
                 NameCounter = 0;
             }
-            fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
+            Io_OutPrintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
             LineLength += AddedLength;
             NameCounter++;
         }
@@ -393,7 +395,7 @@ void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogRegs( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
+void Io_WriteVerilogRegs( Io_Out_t * pFile, Abc_Ntk_t * pNtk, int Start )
 {
     Abc_Obj_t * pLatch, * pNet;
     int LineLength;
@@ -416,12 +418,12 @@ void Io_WriteVerilogRegs( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
         AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, "\n   " );
+            Io_OutStr( pFile, "\n   " );
             // reset the line length
             LineLength  = 3;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
+        Io_OutPrintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -438,7 +440,7 @@ void Io_WriteVerilogRegs( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogLatches( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_WriteVerilogLatches( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pLatch;
     int i;
@@ -447,13 +449,13 @@ void Io_WriteVerilogLatches( FILE * pFile, Abc_Ntk_t * pNtk )
     // write the latches
 //    fprintf( pFile, "  always @(posedge %s) begin\n", Io_WriteVerilogGetName(Abc_ObjFanout0(Abc_NtkPi(pNtk,0))) );
 //    fprintf( pFile, "  always begin\n" );
-    fprintf( pFile, "  always @ (posedge clock) begin\n" );
+    Io_OutStr( pFile, "  always @ (posedge clock) begin\n" );
     Abc_NtkForEachLatch( pNtk, pLatch, i )
     {
-        fprintf( pFile, "    %s", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pLatch)))) );
-        fprintf( pFile, " <= %s;\n", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin0(pLatch)))) );
+        Io_OutPrintf( pFile, "    %s", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pLatch)))) );
+        Io_OutPrintf( pFile, " <= %s;\n", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin0(pLatch)))) );
     }
-    fprintf( pFile, "  end\n" );
+    Io_OutStr( pFile, "  end\n" );
     // check if there are initial values
     Abc_NtkForEachLatch( pNtk, pLatch, i )
         if ( Abc_LatchInit(pLatch) == ABC_INIT_ZERO || Abc_LatchInit(pLatch) == ABC_INIT_ONE )
@@ -461,15 +463,15 @@ void Io_WriteVerilogLatches( FILE * pFile, Abc_Ntk_t * pNtk )
     if ( i == Abc_NtkLatchNum(pNtk) )
         return;
     // write the initial values
-    fprintf( pFile, "  initial begin\n" );
+    Io_OutStr( pFile, "  initial begin\n" );
     Abc_NtkForEachLatch( pNtk, pLatch, i )
     {
         if ( Abc_LatchInit(pLatch) == ABC_INIT_ZERO )
-            fprintf( pFile, "    %s <= 1\'b0;\n", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pLatch)))) );
+            Io_OutPrintf( pFile, "    %s <= 1\'b0;\n", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pLatch)))) );
         else if ( Abc_LatchInit(pLatch) == ABC_INIT_ONE )
-            fprintf( pFile, "    %s <= 1\'b1;\n", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pLatch)))) );
+            Io_OutPrintf( pFile, "    %s <= 1\'b1;\n", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pLatch)))) );
     }
-    fprintf( pFile, "  end\n" );
+    Io_OutStr( pFile, "  end\n" );
 }
 
 /**Function*************************************************************
@@ -483,7 +485,7 @@ void Io_WriteVerilogLatches( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogObjects( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_WriteVerilogObjects( Io_Out_t * pFile, Abc_Ntk_t * pNtk )
 {
     Vec_Vec_t * vLevels;
     Abc_Ntk_t * pNtkBox;
@@ -499,19 +501,19 @@ void Io_WriteVerilogObjects( FILE * pFile, Abc_Ntk_t * pNtk )
         if ( Abc_ObjIsLatch(pObj) )
             continue;
         pNtkBox = (Abc_Ntk_t *)pObj->pData;
-        fprintf( pFile, "  %s box%0*d", pNtkBox->pName, nDigits, Counter++ );
-        fprintf( pFile, "(" );
+        Io_OutPrintf( pFile, "  %s box%0*d", pNtkBox->pName, nDigits, Counter++ );
+        Io_OutChar( pFile, '(' );
         Abc_NtkForEachPi( pNtkBox, pTerm, k )
         {
-            fprintf( pFile, ".%s",   Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(pTerm))) );
-            fprintf( pFile, "(%s), ", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin(pObj,k)))) );
+            Io_OutPrintf( pFile, ".%s",   Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(pTerm))) );
+            Io_OutPrintf( pFile, "(%s), ", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin(pObj,k)))) );
         }
         Abc_NtkForEachPo( pNtkBox, pTerm, k )
         {
-            fprintf( pFile, ".%s",   Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin0(pTerm))) );
-            fprintf( pFile, "(%s)%s", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout(pObj,k)))), k==Abc_NtkPoNum(pNtkBox)-1? "":", " );
+            Io_OutPrintf( pFile, ".%s",   Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin0(pTerm))) );
+            Io_OutPrintf( pFile, "(%s)%s", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout(pObj,k)))), k==Abc_NtkPoNum(pNtkBox)-1? "":", " );
         }
-        fprintf( pFile, ");\n" );
+        Io_OutStr( pFile, ");\n" );
     }
     // write nodes
     if ( Abc_NtkHasMapping(pNtk) )
@@ -524,17 +526,17 @@ void Io_WriteVerilogObjects( FILE * pFile, Abc_Ntk_t * pNtk )
             Mio_Gate_t * pGate = (Mio_Gate_t *)pObj->pData;
             Mio_Pin_t * pGatePin;
             // write the node
-            fprintf( pFile, "  %-*s g%0*d", Length, Mio_GateReadName(pGate), nDigits, Counter++ );
-            fprintf( pFile, "(" );
+            Io_OutPrintf( pFile, "  %-*s g%0*d", Length, Mio_GateReadName(pGate), nDigits, Counter++ );
+            Io_OutChar( pFile, '(' );
             for ( pGatePin = Mio_GateReadPins(pGate), i = 0; pGatePin; pGatePin = Mio_PinReadNext(pGatePin), i++ )
             {
-                fprintf( pFile, ".%s", Io_WriteVerilogGetName(Mio_PinReadName(pGatePin)) );
-                fprintf( pFile, "(%s), ", Io_WriteVerilogGetName(Abc_ObjName( Abc_ObjFanin(pObj,i) )) );
+                Io_OutPrintf( pFile, ".%s", Io_WriteVerilogGetName(Mio_PinReadName(pGatePin)) );
+                Io_OutPrintf( pFile, "(%s), ", Io_WriteVerilogGetName(Abc_ObjName( Abc_ObjFanin(pObj,i) )) );
             }
             assert ( i == Abc_ObjFaninNum(pObj) );
-            fprintf( pFile, ".%s", Io_WriteVerilogGetName(Mio_GateReadOutName(pGate)) );
-            fprintf( pFile, "(%s)", Io_WriteVerilogGetName(Abc_ObjName( Abc_ObjFanout0(pObj) )) );
-            fprintf( pFile, ");\n" );
+            Io_OutPrintf( pFile, ".%s", Io_WriteVerilogGetName(Mio_GateReadOutName(pGate)) );
+            Io_OutPrintf( pFile, "(%s)", Io_WriteVerilogGetName(Abc_ObjName( Abc_ObjFanout0(pObj) )) );
+            Io_OutStr( pFile, ");\n" );
         }
     }
     else
@@ -543,13 +545,13 @@ void Io_WriteVerilogObjects( FILE * pFile, Abc_Ntk_t * pNtk )
         Abc_NtkForEachNode( pNtk, pObj, i )
         {
             pFunc = (Hop_Obj_t *)pObj->pData;
-            fprintf( pFile, "  assign %s = ", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(pObj))) );
+            Io_OutPrintf( pFile, "  assign %s = ", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(pObj))) );
             // set the input names
             Abc_ObjForEachFanin( pObj, pFanin, k )
                 Hop_IthVar((Hop_Man_t *)pNtk->pManFunc, k)->pData = Extra_UtilStrsav(Io_WriteVerilogGetName(Abc_ObjName(pFanin)));
             // write the formula
-            Hop_ObjPrintVerilog( pFile, pFunc, vLevels, 0 );
-            fprintf( pFile, ";\n" );
+            Io_WriteVerilogHop( pFile, pFunc, vLevels, 0 );
+            Io_OutStr( pFile, ";\n" );
             // clear the input names
             Abc_ObjForEachFanin( pObj, pFanin, k )
                 ABC_FREE( Hop_IthVar((Hop_Man_t *)pNtk->pManFunc, k)->pData );
@@ -558,6 +560,95 @@ void Io_WriteVerilogObjects( FILE * pFile, Abc_Ntk_t * pNtk )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes Verilog formula for the AIG rooted at this node.]
+
+  Description [Same as Hop_ObjPrintVerilog() but writes into the buffered
+  output. The formula is in terms of PIs, which should have their names 
+  assigned in pObj->pData fields.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Io_WriteVerilogHop( Io_Out_t * pFile, Hop_Obj_t * pObj, Vec_Vec_t * vLevels, int Level )
+{
+    Vec_Ptr_t * vSuper;
+    Hop_Obj_t * pFanin, * pFanin0, * pFanin1, * pFaninC;
+    int fCompl, i;
+    // store the complemented attribute
+    fCompl = Hop_IsComplement(pObj);
+    pObj = Hop_Regular(pObj);
+    // constant case
+    if ( Hop_ObjIsConst1(pObj) )
+    {
+        Io_OutStr( pFile, fCompl? "1\'b0" : "1\'b1" );
+        return;
+    }
+    // PI case
+    if ( Hop_ObjIsPi(pObj) )
+    {
+        if ( fCompl )
+            Io_OutChar( pFile, '~' );
+        Io_OutStr( pFile, (char*)pObj->pData );
+        return;
+    }
+    // EXOR case
+    if ( Hop_ObjIsExor(pObj) )
+    {
+        Vec_VecExpand( vLevels, Level );
+        vSuper = Vec_VecEntry( vLevels, Level );
+        Hop_ObjCollectMulti( pObj, vSuper );
+        Io_OutStr( pFile, (Level==0? "" : "(") );
+        Vec_PtrForEachEntry( Hop_Obj_t *, vSuper, pFanin, i )
+        {
+            Io_WriteVerilogHop( pFile, Hop_NotCond(pFanin, (fCompl && i==0)), vLevels, Level+1 );
+            if ( i < Vec_PtrSize(vSuper) - 1 )
+                Io_OutStr( pFile, " ^ " );
+        }
+        Io_OutStr( pFile, (Level==0? "" : ")") );
+        return;
+    }
+    // MUX case
+    if ( Hop_ObjIsMuxType(pObj) )
+    {
+        if ( Hop_ObjRecognizeExor( pObj, &pFanin0, &pFanin1 ) )
+        {
+            Io_OutStr( pFile, (Level==0? "" : "(") );
+            Io_WriteVerilogHop( pFile, Hop_NotCond(pFanin0, fCompl), vLevels, Level+1 );
+            Io_OutStr( pFile, " ^ " );
+            Io_WriteVerilogHop( pFile, pFanin1, vLevels, Level+1 );
+            Io_OutStr( pFile, (Level==0? "" : ")") );
+        }
+        else 
+        {
+            pFaninC = Hop_ObjRecognizeMux( pObj, &pFanin1, &pFanin0 );
+            Io_OutStr( pFile, (Level==0? "" : "(") );
+            Io_WriteVerilogHop( pFile, pFaninC, vLevels, Level+1 );
+            Io_OutStr( pFile, " ? " );
+            Io_WriteVerilogHop( pFile, Hop_NotCond(pFanin1, fCompl), vLevels, Level+1 );
+            Io_OutStr( pFile, " : " );
+            Io_WriteVerilogHop( pFile, Hop_NotCond(pFanin0, fCompl), vLevels, Level+1 );
+            Io_OutStr( pFile, (Level==0? "" : ")") );
+        }
+        return;
+    }
+    // AND case
+    Vec_VecExpand( vLevels, Level );
+    vSuper = Vec_VecEntry(vLevels, Level);
+    Hop_ObjCollectMulti( pObj, vSuper );
+    Io_OutStr( pFile, (Level==0? "" : "(") );
+    Vec_PtrForEachEntry( Hop_Obj_t *, vSuper, pFanin, i )
+    {
+        Io_WriteVerilogHop( pFile, Hop_NotCond(pFanin, fCompl), vLevels, Level+1 );
+        if ( i < Vec_PtrSize(vSuper) - 1 )
+            Io_OutStr( pFile, fCompl? " | " : " & " );
+    }
+    Io_OutStr( pFile, (Level==0? "" : ")") );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Counts the number of wires.]
@@ -84,6 +84,7 @@ extern ABC_DLL void            Abc_FrameRestart( Abc_Frame_t * p );
 extern ABC_DLL int             Abc_FrameShowProgress( Abc_Frame_t * p );
 extern ABC_DLL void            Abc_FrameClearVerifStatus( Abc_Frame_t * p );
 
+extern ABC_DLL Abc_Ntk_t *     Abc_FrameDupNetwork( Abc_Ntk_t * pNtk );
 extern ABC_DLL void            Abc_FrameSetCurrentNetwork( Abc_Frame_t * p, Abc_Ntk_t * pNet );
 extern ABC_DLL void            Abc_FrameSwapCurrentAndBackup( Abc_Frame_t * p );
 extern ABC_DLL void            Abc_FrameReplaceCurrentNetwork( Abc_Frame_t * p, Abc_Ntk_t * pNet );
@@ -345,6 +345,54 @@ int Abc_FrameSetMode( Abc_Frame_t * p, int fNameMode )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Replaces the saved network by its compact image.]
+
+  Description [Returns the placeholder network, which takes the place
+  of the given one in the stack of saved networks, or the given network
+  if it cannot be compacted.]
+               
+  SideEffects [Deletes the given network if it was compacted.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Ntk_t * Abc_FrameCompactNetwork( Abc_Ntk_t * pNtk )
+{
+    extern Vec_Int_t * Io_SesPackNtk( Abc_Ntk_t * pNtk );
+    Abc_Ntk_t * pNtkImage;
+    Vec_Int_t * vImage;
+    if ( pNtk->vImage || (vImage = Io_SesPackNtk( pNtk )) == NULL )
+        return pNtk;
+    pNtkImage = Abc_NtkAlloc( ABC_NTK_LOGIC, ABC_FUNC_SOP, 0 );
+    pNtkImage->vImage = vImage;
+    Abc_NtkSetBackup( pNtkImage, Abc_NtkBackup(pNtk) );
+    Abc_NtkSetStep( pNtkImage, Abc_NtkStep(pNtk) );
+    Abc_NtkDelete( pNtk );
+    return pNtkImage;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the copy of the saved network.]
+
+  Description [Restores the network from its compact image if the saved
+  network was compacted.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Abc_FrameDupNetwork( Abc_Ntk_t * pNtk )
+{
+    extern Abc_Ntk_t * Io_SesUnpackNtk( Vec_Int_t * vImage );
+    if ( pNtk->vImage == NULL )
+        return Abc_NtkDup( pNtk );
+    return Io_SesUnpackNtk( pNtk->vImage );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Sets the given network to be the current one.]
@@ -353,7 +401,8 @@ int Abc_FrameSetMode( Abc_Frame_t * p, int fNameMode )
   The previous current network is attached to the given network as 
   a backup copy. In the stack of backup networks contains too many
   networks (defined by the paramater "savesteps"), the bottom
-  most network is deleted.]
+  most network is deleted. The networks saved two or more steps ago
+  are kept as compact images, which are restored by "recall".]
                
   SideEffects []
 
@@ -399,6 +448,11 @@ void Abc_FrameSetCurrentNetwork( Abc_Frame_t * p, Abc_Ntk_t * pNtkNew )
         // clean the pointer of the network before the last one
         Abc_NtkSetBackup( pNtk3, NULL );
     }
+
+    // compact the network saved two steps ago (the one saved before it is already compact)
+    pNtk = Abc_NtkBackup( p->pNtkCur );
+    if ( pNtk && Abc_NtkBackup(pNtk) )
+        Abc_NtkSetBackup( pNtk, Abc_FrameCompactNetwork( Abc_NtkBackup(pNtk) ) );
 }
 
 /**Function*************************************************************
@@ -425,6 +479,19 @@ void Abc_FrameSwapCurrentAndBackup( Abc_Frame_t * p )
     if ( pNtkBack == NULL )
         return;
 
+    // restore the backup if it was compacted
+    if ( pNtkBack->vImage )
+    {
+        pNtkBack2 = Abc_FrameDupNetwork( pNtkBack );
+        if ( pNtkBack2 == NULL )
+            return;
+        Abc_NtkSetBackup( pNtkBack2, Abc_NtkBackup(pNtkBack) );
+        Abc_NtkSetStep( pNtkBack2, Abc_NtkStep(pNtkBack) );
+        Abc_NtkSetBackup( pNtkCur, pNtkBack2 );
+        Abc_NtkDelete( pNtkBack );
+        pNtkBack = pNtkBack2;
+    }
+
     // remember the backup of the backup
     pNtkBack2 = Abc_NtkBackup( pNtkBack );
     iStepBack = Abc_NtkStep  ( pNtkBack );
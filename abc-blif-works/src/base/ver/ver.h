@@ -52,6 +52,7 @@ struct Ver_Man_t_
     int             fMapped;       // mapped verilog
     int             fUseMemMan;    // allocate memory manager in the networks
     int             fCheck;        // checks network for currectness
+    int             nThreads;      // the number of threads parsing the modules
     // input file stream
     char *          pFileName;
     Ver_Stream_t *  pReader;
@@ -70,6 +71,7 @@ struct Ver_Man_t_
     Vec_Ptr_t *     vStackFn;
     Vec_Int_t *     vStackOp;
     Vec_Int_t *     vPerm;
+    Vec_Ptr_t *     vDefined;      // modules defined in the part of the file parsed (parallel parser)
 };
 
 
@@ -87,6 +89,7 @@ struct Ver_Man_t_
 
 /*=== verCore.c ========================================================*/
 extern Abc_Lib_t *    Ver_ParseFile( char * pFileName, Abc_Lib_t * pGateLib, int fCheck, int fUseMemMan );
+extern void           Ver_ParseBench( char * pFileName, int nThreads, int fCheck );
 extern void           Ver_ParsePrintErrorMessage( Ver_Man_t * p );
 /*=== verFormula.c ========================================================*/
 extern void *         Ver_FormulaParser( char * pFormula, void * pMan, Vec_Ptr_t * vNames, Vec_Ptr_t * vStackFn, Vec_Int_t * vStackOp, char * pErrorMessage );
@@ -96,6 +99,7 @@ extern int            Ver_ParseSkipComments( Ver_Man_t * p );
 extern char *         Ver_ParseGetName( Ver_Man_t * p );
 /*=== verStream.c ========================================================*/
 extern Ver_Stream_t * Ver_StreamAlloc( char * pFileName );
+extern Ver_Stream_t * Ver_StreamAllocMem( char * pFileName, char * pBeg, char * pEnd, int LineBeg );
 extern void           Ver_StreamFree( Ver_Stream_t * p );
 extern char *         Ver_StreamGetFileName( Ver_Stream_t * p );
 extern int            Ver_StreamGetFileSize( Ver_Stream_t * p );
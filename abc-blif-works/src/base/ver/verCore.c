@@ -21,6 +21,11 @@
 #include "ver.h"
 #include "mio.h"
 #include "main.h"
+#include "gia.h"
+
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -55,6 +60,10 @@ static Ver_Man_t * Ver_ParseStart( char * pFileName, Abc_Lib_t * pGateLib );
 static void Ver_ParseStop( Ver_Man_t * p );
 static void Ver_ParseFreeData( Ver_Man_t * p );
 static void Ver_ParseInternal( Ver_Man_t * p );
+static int  Ver_ParseModules( Ver_Man_t * p );
+static int  Ver_ParseModulesPar( Ver_Man_t * p );
+static void Ver_ParseFreeLib( Abc_Lib_t * pLib );
+static Abc_Ntk_t * Ver_ParseFindOrCreateNetwork( Ver_Man_t * pMan, char * pName );
 static int  Ver_ParseModule( Ver_Man_t * p );
 static int  Ver_ParseSignal( Ver_Man_t * p, Abc_Ntk_t * pNtk, Ver_SignalType_t SigType );
 static int  Ver_ParseAlways( Ver_Man_t * p, Abc_Ntk_t * pNtk );
@@ -78,6 +87,27 @@ static inline int Ver_NtkIsDefined( Abc_Ntk_t * pNtkBox )  { assert( pNtkBox->pN
 static inline int Ver_ObjIsConnected( Abc_Obj_t * pObj )   { assert( Abc_ObjIsBox(pObj) ); return Abc_ObjFaninNum(pObj) || Abc_ObjFanoutNum(pObj); }
 
 int glo_fMapped = 0; // this is bad!
+int glo_nVerThreads = 1; // the number of threads parsing the modules
+
+#define VER_CHUNK_SIZE    (1 << 22)  // the smallest part of the file parsed by one thread
+
+typedef struct Ver_Chunk_t_     Ver_Chunk_t;
+struct Ver_Chunk_t_
+{
+    char *          pBeg;          // the first character of the part
+    char *          pEnd;          // the first character after the part
+    int             LineBeg;       // the line number of the first character
+    Vec_Ptr_t *     vModules;      // the modules defined in the part
+};
+
+typedef struct Ver_ThData_t_    Ver_ThData_t;
+struct Ver_ThData_t_
+{
+    Ver_Man_t *     pMan;          // the parser of this thread
+    Vec_Ptr_t *     vChunks;       // the parts of the file
+    volatile int *  pNext;         // the next part to be parsed
+    volatile int *  pfFailed;      // set when a part cannot be parsed
+};
 
 typedef struct Ver_Bundle_t_    Ver_Bundle_t;
 struct Ver_Bundle_t_
@@ -140,7 +170,8 @@ void Ver_ParseStop( Ver_Man_t * p )
 {
     if ( p->pProgress )
         Extra_ProgressBarStop( p->pProgress );
-    Ver_StreamFree( p->pReader );
+    if ( p->pReader )
+        Ver_StreamFree( p->pReader );
     Vec_PtrFree( p->vNames   );
     Vec_PtrFree( p->vStackFn );
     Vec_IntFree( p->vStackOp );
@@ -168,6 +199,7 @@ Abc_Lib_t * Ver_ParseFile( char * pFileName, Abc_Lib_t * pGateLib, int fCheck, i
     p->fMapped    = glo_fMapped;
     p->fCheck     = fCheck;
     p->fUseMemMan = fUseMemMan;
+    p->nThreads   = glo_nVerThreads;
     if ( glo_fMapped )
     {
         Hop_ManStop((Hop_Man_t *)p->pDesign->pManFunc);
@@ -197,29 +229,17 @@ Abc_Lib_t * Ver_ParseFile( char * pFileName, Abc_Lib_t * pGateLib, int fCheck, i
 void Ver_ParseInternal( Ver_Man_t * pMan )
 {
     Abc_Ntk_t * pNtk;
-    char * pToken;
     int i;
 
     // preparse the modeles
-    pMan->pProgress = Extra_ProgressBarStart( stdout, Ver_StreamGetFileSize(pMan->pReader) );
-    while ( 1 )
+    if ( pMan->nThreads < 2 || !Ver_ParseModulesPar( pMan ) )
     {
-        // get the next token
-        pToken = Ver_ParseGetName( pMan );
-        if ( pToken == NULL )
-            break;
-        if ( strcmp( pToken, "module" ) )
-        {
-            sprintf( pMan->sError, "Cannot read \"module\" directive." );
-            Ver_ParsePrintErrorMessage( pMan );
-            return;
-        }
-        // parse the module
-        if ( !Ver_ParseModule(pMan) )
+        pMan->pProgress = Extra_ProgressBarStart( stdout, Ver_StreamGetFileSize(pMan->pReader) );
+        if ( !Ver_ParseModules( pMan ) )
             return;
+        Extra_ProgressBarStop( pMan->pProgress );
+        pMan->pProgress = NULL;
     }
-    Extra_ProgressBarStop( pMan->pProgress );
-    pMan->pProgress = NULL;
 
     // process defined and undefined boxes
     if ( !Ver_ParseAttachBoxes( pMan ) )
@@ -241,6 +261,421 @@ void Ver_ParseInternal( Ver_Man_t * pMan )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Parses the modules until the end of the file.]
+
+  Description [Returns 0 if parsing has failed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ver_ParseModules( Ver_Man_t * pMan )
+{
+    char * pToken;
+    while ( 1 )
+    {
+        // get the next token
+        pToken = Ver_ParseGetName( pMan );
+        if ( pToken == NULL )
+            break;
+        if ( strcmp( pToken, "module" ) )
+        {
+            sprintf( pMan->sError, "Cannot read \"module\" directive." );
+            Ver_ParsePrintErrorMessage( pMan );
+            return 0;
+        }
+        // parse the module
+        if ( !Ver_ParseModule(pMan) )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the library whose modules share one AIG manager.]
+
+  Description [Skips the modules that were moved to another library.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ver_ParseFreeLib( Abc_Lib_t * pLib )
+{
+    Abc_Ntk_t * pNtk;
+    int i, k = 0;
+    Vec_PtrForEachEntry( Abc_Ntk_t *, pLib->vModules, pNtk, i )
+    {
+        if ( pNtk->pDesign != pLib )
+            continue;
+        // the manager is stopped once by Abc_LibFree()
+        if ( pNtk->pManFunc == pLib->pManFunc )
+            pNtk->pManFunc = NULL;
+        Vec_PtrWriteEntry( pLib->vModules, k++, pNtk );
+    }
+    Vec_PtrShrink( pLib->vModules, k );
+    Abc_LibFree( pLib, NULL );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the file into parts starting with the "module" keyword.]
+
+  Description [The first part starts at the beginning of the file. The
+  keyword is recognized if it begins a token in the same way as it is 
+  read by Ver_ParseGetName(): after a space or a comment and before one
+  of the characters terminating the names.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Ver_ParseSplitFile( char * pContents, size_t nContents, int nThreads )
+{
+    Vec_Ptr_t * vChunks;
+    Ver_Chunk_t * pChunk;
+    char * pCur, * pEnd = pContents + nContents;
+    int nChunks, Line = 1, fTokenBeg = 1;
+    nChunks = Abc_MinInt( 4 * nThreads, (int)(nContents / VER_CHUNK_SIZE) + 1 );
+    vChunks = Vec_PtrAlloc( nChunks );
+    pChunk = ABC_CALLOC( Ver_Chunk_t, 1 );
+    pChunk->pBeg     = pContents;
+    pChunk->LineBeg  = 1;
+    pChunk->vModules = Vec_PtrAlloc( 100 );
+    Vec_PtrPush( vChunks, pChunk );
+    for ( pCur = pContents; pCur < pEnd; pCur++ )
+    {
+        if ( *pCur == '\n' )
+            Line++;
+        if ( *pCur == ' ' || *pCur == '\t' || *pCur == '\n' || *pCur == '\r' )
+        {
+            fTokenBeg = 1;
+            continue;
+        }
+        if ( pCur[0] == '/' && pCur[1] == '/' )
+        {
+            // skip till the end of line
+            while ( pCur + 1 < pEnd && pCur[1] != '\n' )
+                pCur++;
+            fTokenBeg = 1;
+            continue;
+        }
+        if ( pCur[0] == '/' && pCur[1] == '*' )
+        {
+            // skip till the next occurance of */
+            for ( pCur += 2; pCur < pEnd && !(pCur[0] == '*' && pCur[1] == '/'); pCur++ )
+                if ( *pCur == '\n' )
+                    Line++;
+            pCur++;
+            fTokenBeg = 1;
+            continue;
+        }
+        if ( *pCur == '\\' )
+        {
+            // skip the escaped name
+            while ( pCur + 1 < pEnd && pCur[1] != ' ' && pCur[1] != '\n' && pCur[1] != '\r' )
+                pCur++;
+            fTokenBeg = 0;
+            continue;
+        }
+        if ( fTokenBeg && pCur > pContents && (size_t)(pCur - pChunk->pBeg) >= nContents / nChunks && 
+             !strncmp( pCur, "module", 6 ) && (pCur + 6 == pEnd || strchr( " \t\n\r(),;", pCur[6] )) )
+        {
+            // start a new part
+            pChunk->pEnd     = pCur;
+            pChunk = ABC_CALLOC( Ver_Chunk_t, 1 );
+            pChunk->pBeg     = pCur;
+            pChunk->LineBeg  = Line;
+            pChunk->vModules = Vec_PtrAlloc( 100 );
+            Vec_PtrPush( vChunks, pChunk );
+        }
+        fTokenBeg = 0;
+    }
+    pChunk->pEnd = pEnd;
+    return vChunks;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the parser of one thread.]
+
+  Description [The modules are parsed into a private library with its 
+  own AIG manager. The errors are not printed because the file is parsed 
+  again sequentially if any of the parts cannot be parsed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Ver_Man_t * Ver_ParseStartWorker( Ver_Man_t * pMan )
+{
+    Ver_Man_t * p;
+    p = ABC_ALLOC( Ver_Man_t, 1 );
+    memset( p, 0, sizeof(Ver_Man_t) );
+    p->pFileName  = pMan->pFileName;
+    p->fMapped    = pMan->fMapped;
+    p->fCheck     = pMan->fCheck;
+    p->fUseMemMan = pMan->fUseMemMan;
+    p->vNames     = Vec_PtrAlloc( 100 );
+    p->vStackFn   = Vec_PtrAlloc( 100 );
+    p->vStackOp   = Vec_IntAlloc( 100 );
+    p->vPerm      = Vec_IntAlloc( 100 );
+    p->pDesign    = Abc_LibCreate( pMan->pFileName );
+    p->pDesign->pLibrary = pMan->pDesign->pLibrary;
+    p->pDesign->pGenlib  = pMan->pDesign->pGenlib;
+    if ( p->fMapped )
+    {
+        Hop_ManStop((Hop_Man_t *)p->pDesign->pManFunc);
+        p->pDesign->pManFunc = NULL;
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the parts of the file in one thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Ver_ParseChunkThread( void * pArg )
+{
+    Ver_ThData_t * pData = (Ver_ThData_t *)pArg;
+    Ver_Man_t * pMan = pData->pMan;
+    Ver_Chunk_t * pChunk;
+    int i;
+#ifdef ABC_USE_PTHREADS
+    while ( !*pData->pfFailed && (i = __sync_fetch_and_add( pData->pNext, 1 )) < Vec_PtrSize(pData->vChunks) )
+#else
+    while ( !*pData->pfFailed && (i = (*pData->pNext)++) < Vec_PtrSize(pData->vChunks) )
+#endif
+    {
+        pChunk = (Ver_Chunk_t *)Vec_PtrEntry( pData->vChunks, i );
+        pMan->pReader  = Ver_StreamAllocMem( pMan->pFileName, pChunk->pBeg, pChunk->pEnd, pChunk->LineBeg );
+        pMan->vDefined = pChunk->vModules;
+        if ( !Ver_ParseModules( pMan ) || pMan->fError )
+            *pData->pfFailed = 1;
+        Ver_StreamFree( pMan->pReader );
+        pMan->pReader  = NULL;
+        pMan->vDefined = NULL;
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the modules parsed by the threads into the design.]
+
+  Description [The modules are added in the order they are first mentioned
+  in the file, the same as when parsing sequentially. The boxes are linked 
+  to the modules of the design using the table of defined modules. Returns 
+  0 if a module is defined more than once.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ver_ParseMergeChunks( Ver_Man_t * pMan, Vec_Ptr_t * vChunks )
+{
+    st_table * tDefined;
+    Ver_Chunk_t * pChunk;
+    Abc_Ntk_t * pNtk, * pNtkBox;
+    Abc_Obj_t * pObj;
+    char * pName;
+    int i, k, j;
+    // hash the defined modules by name
+    tDefined = st_init_table( strcmp, st_strhash );
+    Vec_PtrForEachEntry( Ver_Chunk_t *, vChunks, pChunk, i )
+    Vec_PtrForEachEntry( Abc_Ntk_t *, pChunk->vModules, pNtk, k )
+        if ( st_insert( tDefined, pNtk->pName, (char *)pNtk ) )
+        {
+            st_free_table( tDefined );
+            return 0;
+        }
+    // add the modules to the design
+    Vec_PtrForEachEntry( Ver_Chunk_t *, vChunks, pChunk, i )
+    Vec_PtrForEachEntry( Abc_Ntk_t *, pChunk->vModules, pNtk, k )
+    {
+        Abc_LibAddModel( pMan->pDesign, pNtk );
+        // transfer the local functions into the AIG manager of the design
+        if ( Abc_NtkHasAig(pNtk) )
+        {
+            Abc_NtkForEachNode( pNtk, pObj, j )
+                pObj->pData = Hop_Transfer( (Hop_Man_t *)pNtk->pManFunc, (Hop_Man_t *)pMan->pDesign->pManFunc, (Hop_Obj_t *)pObj->pData, Abc_ObjFaninNum(pObj) );
+            pNtk->pManFunc = pMan->pDesign->pManFunc;
+        }
+        // link the boxes with the modules of the design
+        Abc_NtkForEachBlackbox( pNtk, pObj, j )
+        {
+            if ( pObj->pData == NULL )
+                continue;
+            pName = ((Abc_Ntk_t *)pObj->pData)->pName;
+            if ( st_lookup( tDefined, pName, (char **)&pNtkBox ) )
+                Abc_LibAddModel( pMan->pDesign, pNtkBox );
+            else
+                pNtkBox = Ver_ParseFindOrCreateNetwork( pMan, pName );
+            pObj->pData = pNtkBox;
+        }
+    }
+    st_free_table( tDefined );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the modules using several threads.]
+
+  Description [Maps the file into memory, splits it into parts starting
+  with a module, and parses the parts concurrently. Returns 0 if the file
+  should be parsed sequentially, in particular, when it contains an error.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ver_ParseModulesPar( Ver_Man_t * pMan )
+{
+    Ver_ThData_t * pThData;
+    Vec_Ptr_t * vChunks;
+    Ver_Chunk_t * pChunk;
+    char * pContents;
+    size_t nContents;
+    int nThreads, iNext = 0, fFailed = 0, RetValue, i;
+    // split the file
+    pContents = Gia_FileMap( pMan->pFileName, &nContents );
+    if ( pContents == NULL )
+        return 0;
+    vChunks = Ver_ParseSplitFile( pContents, nContents, pMan->nThreads );
+    if ( Vec_PtrSize(vChunks) == 1 )
+    {
+        pChunk = (Ver_Chunk_t *)Vec_PtrEntry( vChunks, 0 );
+        Vec_PtrFree( pChunk->vModules );
+        ABC_FREE( pChunk );
+        Vec_PtrFree( vChunks );
+        Gia_FileUnmap( pContents, nContents );
+        return 0;
+    }
+    // start the parsers
+    nThreads = Abc_MinInt( pMan->nThreads, Vec_PtrSize(vChunks) );
+    pThData = ABC_CALLOC( Ver_ThData_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pThData[i].pMan     = Ver_ParseStartWorker( pMan );
+        pThData[i].vChunks  = vChunks;
+        pThData[i].pNext    = &iNext;
+        pThData[i].pfFailed = &fFailed;
+    }
+    // parse the parts
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t * pThreads = ABC_ALLOC( pthread_t, nThreads );
+        int Status;
+        for ( i = 1; i < nThreads; i++ )
+        {
+            Status = pthread_create( pThreads + i, NULL, Ver_ParseChunkThread, (void *)(pThData + i) );
+            assert( Status == 0 );
+        }
+        Ver_ParseChunkThread( (void *)pThData );
+        for ( i = 1; i < nThreads; i++ )
+            pthread_join( pThreads[i], NULL );
+        ABC_FREE( pThreads );
+    }
+    else
+#endif
+    Ver_ParseChunkThread( (void *)pThData );
+    // collect the modules
+    RetValue = !fFailed && Ver_ParseMergeChunks( pMan, vChunks );
+    // stop the parsers
+    for ( i = 0; i < nThreads; i++ )
+    {
+        Ver_ParseRemoveSuffixTable( pThData[i].pMan );
+        Ver_ParseFreeLib( pThData[i].pMan->pDesign );
+        pThData[i].pMan->pDesign = NULL;
+        Ver_ParseStop( pThData[i].pMan );
+    }
+    ABC_FREE( pThData );
+    Vec_PtrForEachEntry( Ver_Chunk_t *, vChunks, pChunk, i )
+    {
+        Vec_PtrFree( pChunk->vModules );
+        ABC_FREE( pChunk );
+    }
+    Vec_PtrFree( vChunks );
+    Gia_FileUnmap( pContents, nContents );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Measures the parsing throughput for different numbers of threads.]
+
+  Description [Parses the file using 1, 2, 4, etc threads up to nThreads
+  and checks that the same design is derived each time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ver_ParseBench( char * pFileName, int nThreads, int fCheck )
+{
+    Abc_Lib_t * pDesign;
+    Abc_Ntk_t * pNtk;
+    double Speed;
+    char * pContents;
+    size_t nFileSize;
+    int nThreadsOld = glo_nVerThreads;
+    int nModules, nModules0 = -1, nObjs, nObjs0 = -1;
+    abctime clk;
+    int k, i;
+    // get the 64-bit file size without reading the file
+    pContents = Gia_FileMap( pFileName, &nFileSize );
+    if ( pContents == NULL )
+        return;
+    Gia_FileUnmap( pContents, nFileSize );
+    printf( "Parsing file \"%s\" (%.2f MB) using up to %d threads.\n", pFileName, 1.0*nFileSize/(1<<20), nThreads );
+    for ( k = 1; ; k = Abc_MinInt( 2 * k, nThreads ) )
+    {
+        glo_nVerThreads = k;
+        clk = Abc_ClockTicks( 0 );
+        pDesign = Ver_ParseFile( pFileName, NULL, fCheck, 1 );
+        clk = Abc_ClockTicks( 0 ) - clk;
+        if ( pDesign == NULL )
+        {
+            printf( "Parsing the file has failed.\n" );
+            break;
+        }
+        nModules = Vec_PtrSize( pDesign->vModules );
+        nObjs = 0;
+        Vec_PtrForEachEntry( Abc_Ntk_t *, pDesign->vModules, pNtk, i )
+            nObjs += Abc_NtkObjNum( pNtk );
+        Ver_ParseFreeLib( pDesign );
+        Speed = 1.0 * nFileSize / (1<<20) / (1.0 * (clk ? clk : 1) / CLOCKS_PER_SEC);
+        printf( "Threads = %3d : Modules = %7d  Objects = %10d  ", k, nModules, nObjs );
+        printf( "Time = %8.2f sec  Throughput = %8.2f MB/s\n", 1.0*clk/CLOCKS_PER_SEC, Speed );
+        if ( nModules0 == -1 )
+            nModules0 = nModules, nObjs0 = nObjs;
+        else if ( nModules != nModules0 || nObjs != nObjs0 )
+            printf( "The design parsed using %d threads differs from the one parsed using one thread.\n", k );
+        if ( k == nThreads )
+            break;
+    }
+    glo_nVerThreads = nThreadsOld;
+}
+
 /**Function*************************************************************
 
   Synopsis    [File parser.]
@@ -256,7 +691,7 @@ void Ver_ParseFreeData( Ver_Man_t * p )
 {
     if ( p->pDesign )
     {
-        Abc_LibFree( p->pDesign, NULL );
+        Ver_ParseFreeLib( p->pDesign );
         p->pDesign = NULL;
     }
 }
@@ -275,6 +710,8 @@ void Ver_ParseFreeData( Ver_Man_t * p )
 void Ver_ParsePrintErrorMessage( Ver_Man_t * p )
 {
     p->fError = 1;
+    if ( p->Output == NULL ) // the file will be parsed again sequentially
+        return;
     if ( p->fTopLevel ) // the line number is not given
         fprintf( p->Output, "%s: %s\n", p->pFileName, p->sError );
     else // print the error message with the line number
@@ -408,6 +845,8 @@ int Ver_ParseModule( Ver_Man_t * pMan )
 
     // get the network with this name
     pNtk = Ver_ParseFindOrCreateNetwork( pMan, pWord );
+    if ( pMan->vDefined )
+        Vec_PtrPush( pMan->vDefined, pNtk );
 
     // make sure we stopped at the opening paranthesis
     if ( Ver_StreamPopChar(p) != '(' )
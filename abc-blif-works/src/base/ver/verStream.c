@@ -109,6 +109,38 @@ Ver_Stream_t * Ver_StreamAlloc( char * pFileName )
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the reader for the part of the file already in memory.]
+
+  Description [The reader does not copy the data and does not free it.
+  The text between pBeg and pEnd is parsed as if it were the whole file,
+  with line numbers counted starting from LineBeg. The byte at pEnd 
+  should be readable (either the next part of the file or a zero).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Ver_Stream_t * Ver_StreamAllocMem( char * pFileName, char * pBeg, char * pEnd, int LineBeg )
+{
+    Ver_Stream_t * p;
+    p = ABC_ALLOC( Ver_Stream_t, 1 );
+    memset( p, 0, sizeof(Ver_Stream_t) );
+    p->pFileName   = pFileName;
+    p->nFileSize   = pEnd - pBeg;
+    p->nFileRead   = pEnd - pBeg;
+    // use the data as the buffer that is never reloaded
+    p->pBuffer     = pBeg;
+    p->nBufferSize = pEnd - pBeg;
+    p->pBufferCur  = pBeg;
+    p->pBufferEnd  = pEnd;
+    p->pBufferStop = pEnd;
+    p->nLineCounter = LineBeg;
+    return p;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Loads new data into the file reader.]
@@ -154,9 +186,11 @@ void Ver_StreamReload( Ver_Stream_t * p )
 ***********************************************************************/
 void Ver_StreamFree( Ver_Stream_t * p )
 {
-    if ( p->pFile )
+    if ( p->pFile ) // the buffer of the memory reader belongs to the caller
+    {
         fclose( p->pFile );
-    ABC_FREE( p->pBuffer );
+        ABC_FREE( p->pBuffer );
+    }
     ABC_FREE( p );
 }
 
@@ -118,6 +118,7 @@ extern char *            Mio_GateReadSop           ( Mio_Gate_t * pGate );
 extern word              Mio_GateReadTruth         ( Mio_Gate_t * pGate );
 extern int               Mio_GateReadValue         ( Mio_Gate_t * pGate );
 extern void              Mio_GateSetValue          ( Mio_Gate_t * pGate, int Value );
+extern void              Mio_LibrarySetName        ( Mio_Library_t * pLib, char * pName );
 extern char *            Mio_PinReadName           ( Mio_Pin_t * pPin );  
 extern Mio_PinPhase_t    Mio_PinReadPhase          ( Mio_Pin_t * pPin );  
 extern double            Mio_PinReadInputLoad      ( Mio_Pin_t * pPin );  
@@ -150,6 +150,7 @@ word              Mio_GateReadTruth   ( Mio_Gate_t * pGate )            { return
 word *            Mio_GateReadTruthP  ( Mio_Gate_t * pGate )            { return pGate->nInputs <= 6 ? NULL: pGate->pTruth; }
 int               Mio_GateReadValue   ( Mio_Gate_t * pGate )            { return pGate->Value;     }
 void              Mio_GateSetValue    ( Mio_Gate_t * pGate, int Value ) { pGate->Value = Value;    }
+void              Mio_LibrarySetName  ( Mio_Library_t * pLib, char * pName ) { ABC_FREE( pLib->pName ); pLib->pName = Mio_UtilStrsav( pName ); }
 
 /**Function*************************************************************
 
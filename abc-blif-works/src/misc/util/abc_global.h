@@ -60,6 +60,23 @@
 #endif
 #endif
 
+// the qualifier of static variables that are private to each thread
+#if defined(ABC_USE_PTHREADS) && defined(__GNUC__)
+#define ABC_THREAD_LOCAL __thread
+#elif defined(ABC_USE_PTHREADS) && defined(_MSC_VER)
+#define ABC_THREAD_LOCAL __declspec(thread)
+#else
+#define ABC_THREAD_LOCAL
+#if defined(ABC_USE_PTHREADS)
+#define ABC_NO_THREAD_LOCAL
+#endif
+#endif
+
+// the compiler can build the AVX2 and AVX-512 kernels chosen at run time
+#if defined(__GNUC__) && (__GNUC__ >= 5) && (defined(__x86_64__) || defined(__i386__))
+#define ABC_USE_AVX
+#endif
+
 /*
 #ifdef __cplusplus
 #error "C++ code"
@@ -195,6 +212,9 @@ typedef unsigned __int64 ABC_UINT64_T;
 #endif /* defined(PLATFORM) */
 
 typedef ABC_UINT64_T word;
+
+// the time in clock() ticks
+typedef ABC_INT64_T abctime;
 
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
@@ -248,6 +268,32 @@ static inline double Abc_AbsDouble( double a           ) { return a < 0 ? -a : a
 static inline double Abc_MaxDouble( double a, double b ) { return a > b ?  a : b; }
 static inline double Abc_MinDouble( double a, double b ) { return a < b ?  a : b; }
 
+// returns the wall-clock time (fThread = 0) or the CPU time of the calling
+// thread (fThread = 1); unlike clock(), neither adds up the time of all threads
+static inline abctime Abc_ClockTicks( int fThread )
+{
+#if defined(CLOCK_MONOTONIC) && defined(CLOCK_THREAD_CPUTIME_ID)
+    struct timespec ts;
+    if ( clock_gettime( fThread ? CLOCK_THREAD_CPUTIME_ID : CLOCK_MONOTONIC, &ts ) == 0 )
+        return (abctime)ts.tv_sec * CLOCKS_PER_SEC + ts.tv_nsec / (1000000000 / CLOCKS_PER_SEC);
+#endif
+    return (abctime)clock();
+}
+
+// returns the widest vector kernel supported by the CPU
+// (0 = 64-bit words, 1 = AVX2, 2 = AVX-512)
+static inline int Abc_CpuVectorKernel()
+{
+#ifdef ABC_USE_AVX
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+        return 2;
+    if ( __builtin_cpu_supports("avx2") )
+        return 1;
+#endif
+    return 0;
+}
+
 enum Abc_VerbLevel 
 {
     ABC_PROMPT   = -2, 
@@ -0,0 +1,433 @@
+/**CFile****************************************************************
+
+  FileName    [satPort.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [C-language MiniSat solver.]
+
+  Synopsis    [Portfolio of SAT solvers with learned clause sharing.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: satPort.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <assert.h>
+#include <time.h>
+#include "satSolver.h"
+
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the exchange buffer is a set of single-writer rings (one per solver);
+// each solver appends its short learned clauses to its own ring and
+// reads the rings of the other solvers at every restart
+#define SAT_SHARE_RING_SIZE  (1 << 16)   // the number of ints in one ring
+#define SAT_SHARE_LITS_MAX   8           // the largest clause to be shared
+
+typedef struct Sat_Share_t_ Sat_Share_t;
+struct Sat_Share_t_
+{
+    int                nThreads;  // the number of solvers
+    int **             pRings;    // the rings of clauses (one per solver)
+    volatile unsigned * pHeads;   // the write positions (one per solver)
+    unsigned *         pReads;    // the read positions (nThreads x nThreads)
+};
+
+#ifdef ABC_USE_PTHREADS
+#define SAT_SHARE_BARRIER()  __sync_synchronize()
+#else
+#define SAT_SHARE_BARRIER()
+#endif
+
+typedef struct Sat_PortThData_t_ Sat_PortThData_t;
+struct Sat_PortThData_t_
+{
+    sat_solver *       pSat;      // the solver
+    lit *              pBeg;      // the assumptions
+    lit *              pEnd;
+    ABC_INT64_T        nConfLimit;
+    ABC_INT64_T        nInsLimit;
+    ABC_INT64_T        nConfLimitGlobal;
+    ABC_INT64_T        nInsLimitGlobal;
+    int                iThread;   // the index of this solver
+    int                Status;    // the result of solving
+    volatile int *     pWinner;   // the index of the first solver to finish
+    volatile int *     pStop;     // the flag to stop all solvers
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates the clause exchange buffer.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Sat_ShareAlloc( int nThreads )
+{
+    Sat_Share_t * p;
+    int i;
+    p = ABC_CALLOC( Sat_Share_t, 1 );
+    p->nThreads = nThreads;
+    p->pRings   = ABC_ALLOC( int *, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+        p->pRings[i] = ABC_ALLOC( int, SAT_SHARE_RING_SIZE );
+    p->pHeads   = ABC_CALLOC( unsigned, nThreads );
+    p->pReads   = ABC_CALLOC( unsigned, nThreads * nThreads );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deallocates the clause exchange buffer.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_ShareFree( void * pShare )
+{
+    Sat_Share_t * p = (Sat_Share_t *)pShare;
+    int i;
+    for ( i = 0; i < p->nThreads; i++ )
+        ABC_FREE( p->pRings[i] );
+    ABC_FREE( p->pRings );
+    ABC_FREE( p->pHeads );
+    ABC_FREE( p->pReads );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes one learned clause of the given solver.]
+
+  Description [Only the owner of the ring writes into it, so no locking
+  is needed. The clause becomes visible after the head is moved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_ShareExport( void * pShare, int iThread, lit * pBeg, lit * pEnd )
+{
+    Sat_Share_t * p = (Sat_Share_t *)pShare;
+    int * pRing = p->pRings[iThread];
+    unsigned Head = p->pHeads[iThread];
+    int k, nLits = pEnd - pBeg;
+    if ( nLits > SAT_SHARE_LITS_MAX )
+        return;
+    pRing[Head++ & (SAT_SHARE_RING_SIZE-1)] = nLits;
+    for ( k = 0; k < nLits; k++ )
+        pRing[Head++ & (SAT_SHARE_RING_SIZE-1)] = pBeg[k];
+    SAT_SHARE_BARRIER();
+    p->pHeads[iThread] = Head;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the clauses published by other solvers.]
+
+  Description [Appends the clauses to vClauses as the clause size followed
+  by the literals. If a reader lags behind too much, the clauses it did
+  not see are skipped. If the writer overwrote the data while it was
+  being copied, the copied data is discarded. Returns the number of
+  imported clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_ShareImport( void * pShare, int iThread, veci * vClauses )
+{
+    Sat_Share_t * p = (Sat_Share_t *)pShare;
+    unsigned Head, Read, * pRead;
+    int i, k, nLits, * pRing, nStart, nCopied, nClauses = 0;
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        if ( i == iThread )
+            continue;
+        pRing = p->pRings[i];
+        pRead = p->pReads + iThread * p->nThreads + i;
+        Head  = p->pHeads[i];
+        SAT_SHARE_BARRIER();
+        if ( Head - *pRead > SAT_SHARE_RING_SIZE / 2 )
+        {
+            *pRead = Head;
+            continue;
+        }
+        nStart  = veci_size( vClauses );
+        nCopied = 0;
+        for ( Read = *pRead; Read != Head; )
+        {
+            nLits = pRing[Read & (SAT_SHARE_RING_SIZE-1)];
+            if ( nLits < 1 || nLits > SAT_SHARE_LITS_MAX || Head - Read < (unsigned)nLits + 1 )
+                break;
+            veci_push( vClauses, nLits );
+            for ( k = 1; k <= nLits; k++ )
+                veci_push( vClauses, pRing[(Read + k) & (SAT_SHARE_RING_SIZE-1)] );
+            Read += nLits + 1;
+            nCopied++;
+        }
+        // check that the data was not overwritten while copying
+        SAT_SHARE_BARRIER();
+        if ( Read != Head || p->pHeads[i] - *pRead > SAT_SHARE_RING_SIZE )
+            veci_resize( vClauses, nStart );
+        else
+            nClauses += nCopied;
+        *pRead = Head;
+    }
+    return nClauses;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the problem clauses of the solver.]
+
+  Description [The solver should be at the top level. Learned clauses
+  are not copied. Returns NULL if the problem is trivially UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+sat_solver * sat_solver_dup( sat_solver * s )
+{
+    sat_solver * pNew;
+    clause ** pClauses;
+    int i;
+    assert( veci_size(&s->trail_lim) == 0 );
+    pNew = sat_solver_new();
+    sat_solver_setnvars( pNew, s->size );
+    pNew->fSkipSimplify = s->fSkipSimplify;
+    // copy the top-level assignments
+    for ( i = 0; i < s->qtail; i++ )
+        if ( !sat_solver_addclause( pNew, s->trail + i, s->trail + i + 1 ) )
+        {
+            sat_solver_delete( pNew );
+            return NULL;
+        }
+    // copy the problem clauses
+    pClauses = (clause **)vecp_begin( &s->clauses );
+    for ( i = 0; i < vecp_size(&s->clauses); i++ )
+        if ( !sat_solver_addclause( pNew, sat_solver_clause_begin(pClauses[i]), sat_solver_clause_begin(pClauses[i]) + sat_solver_clause_size(pClauses[i]) ) )
+        {
+            sat_solver_delete( pNew );
+            return NULL;
+        }
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Changes the search strategy of the solver.]
+
+  Description [Configuration 0 leaves the solver unchanged. Other
+  configurations use a different random seed, a different initial
+  polarity, and bias variable activities through activity factors.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void sat_solver_diversify( sat_solver * s, int iConfig )
+{
+    unsigned Rand;
+    int i;
+    if ( iConfig == 0 )
+        return;
+    s->random_seed = 91648253 + 7919 * iConfig;
+    Rand = 1 + 2654435761u * (unsigned)iConfig;
+    for ( i = 0; i < s->size; i++ )
+    {
+        Rand ^= Rand << 13; Rand ^= Rand >> 17; Rand ^= Rand << 5;
+        // initial polarity: positive, random, or default
+        if ( iConfig % 3 == 1 )
+            s->polarity[i] = 1;
+        else if ( iConfig % 3 == 2 )
+            s->polarity[i] = (char)(Rand & 1);
+        // bias the activity of a random subset of variables
+        if ( iConfig > 1 && (Rand >> 8) % 4 == 0 )
+        {
+            s->factors[i] = 1.0 + (double)((Rand >> 12) % 1000) / 1000;
+            veci_push( &s->act_vars, i );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one solver of the portfolio.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Sat_PortWorkerThread( void * pArg )
+{
+    Sat_PortThData_t * pData = (Sat_PortThData_t *)pArg;
+    pData->Status = sat_solver_solve( pData->pSat, pData->pBeg, pData->pEnd,
+        pData->nConfLimit, pData->nInsLimit, pData->nConfLimitGlobal, pData->nInsLimitGlobal );
+#ifdef ABC_USE_PTHREADS
+    if ( pData->Status != l_Undef && __sync_bool_compare_and_swap( pData->pWinner, -1, pData->iThread ) )
+        *pData->pStop = 1;
+#endif
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using a portfolio of solvers.]
+
+  Description [Runs nThreads differently configured copies of the solver
+  in parallel. The copies share short learned clauses and stop as soon
+  as one of them solves the problem. The model (or the final conflict)
+  of the winner is transferred into the given solver, which makes this
+  procedure a drop-in replacement for sat_solver_solve(). The stop flag
+  of the given solver, if any, is polled by all copies and is restored
+  when the procedure returns. Falls back to sat_solver_solve() if threads
+  are not available or if the solver already polls two external flags.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int sat_solver_solve_portfolio( sat_solver * s, int nThreads, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal, int fVerbose )
+{
+#ifdef ABC_USE_PTHREADS
+    Sat_PortThData_t * pData;
+    sat_solver ** pSats, * pWin;
+    pthread_t * pThreads;
+    volatile int Winner = -1, Stop = 0;
+    volatile int * pStopOld = s->pStop, * pStop2Old = s->pStop2;
+    int i, k, Status, clk = clock();
+    if ( nThreads <= 1 || s->pStore || s->pFile || s->qhead != s->qtail || veci_size(&s->trail_lim) > 0 || (pStopOld && pStop2Old) )
+        return sat_solver_solve( s, begin, end, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
+    // create the portfolio
+    pSats = ABC_ALLOC( sat_solver *, nThreads );
+    pSats[0] = s;
+    for ( i = 1; i < nThreads; i++ )
+    {
+        pSats[i] = sat_solver_dup( s );
+        if ( pSats[i] == NULL )
+        {
+            for ( k = 1; k < i; k++ )
+                sat_solver_delete( pSats[k] );
+            ABC_FREE( pSats );
+            return sat_solver_solve( s, begin, end, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
+        }
+        sat_solver_diversify( pSats[i], i );
+    }
+    pData = ABC_CALLOC( Sat_PortThData_t, nThreads );
+    pThreads = ABC_ALLOC( pthread_t, nThreads );
+    s->pShare = Sat_ShareAlloc( nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pSats[i]->pShare = s->pShare;
+        pSats[i]->iShare = i;
+        pSats[i]->pStop  = &Stop;
+        pSats[i]->pStop2 = pStopOld ? pStopOld : pStop2Old;
+        pData[i].pSat    = pSats[i];
+        pData[i].pBeg    = begin;
+        pData[i].pEnd    = end;
+        pData[i].nConfLimit       = nConfLimit;
+        pData[i].nInsLimit        = nInsLimit;
+        pData[i].nConfLimitGlobal = nConfLimitGlobal;
+        pData[i].nInsLimitGlobal  = nInsLimitGlobal;
+        pData[i].iThread = i;
+        pData[i].Status  = l_Undef;
+        pData[i].pWinner = &Winner;
+        pData[i].pStop   = &Stop;
+    }
+    // solve the problem
+    for ( i = 1; i < nThreads; i++ )
+    {
+        Status = pthread_create( pThreads + i, NULL, Sat_PortWorkerThread, (void *)(pData + i) );
+        assert( Status == 0 );
+    }
+    Sat_PortWorkerThread( (void *)pData );
+    for ( i = 1; i < nThreads; i++ )
+        pthread_join( pThreads[i], NULL );
+    // transfer the results of the winner
+    Status = l_Undef;
+    if ( Winner >= 0 )
+    {
+        Status = pData[Winner].Status;
+        pWin   = pSats[Winner];
+        if ( pWin != s )
+        {
+            veci_resize( &s->model, 0 );
+            for ( i = 0; i < veci_size(&pWin->model); i++ )
+                veci_push( &s->model, veci_begin(&pWin->model)[i] );
+            veci_resize( &s->conf_final, 0 );
+            for ( i = 0; i < veci_size(&pWin->conf_final); i++ )
+                veci_push( &s->conf_final, veci_begin(&pWin->conf_final)[i] );
+        }
+    }
+    if ( fVerbose )
+    {
+        printf( "Portfolio of %d solvers: ", nThreads );
+        if ( Winner >= 0 )
+            printf( "Solver %d finished first (%s) after %d conflicts.  ",
+                Winner, Status == l_True ? "SAT" : "UNSAT", (int)pSats[Winner]->stats.conflicts );
+        else
+            printf( "Undecided.  " );
+        ABC_PRT( "Time", clock() - clk );
+    }
+    // clean up
+    Sat_ShareFree( s->pShare );
+    s->pShare = NULL;
+    s->iShare = 0;
+    s->pStop  = pStopOld;
+    s->pStop2 = pStop2Old;
+    for ( i = 1; i < nThreads; i++ )
+        sat_solver_delete( pSats[i] );
+    ABC_FREE( pThreads );
+    ABC_FREE( pData );
+    ABC_FREE( pSats );
+    return Status;
+#else
+    return sat_solver_solve( s, begin, end, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
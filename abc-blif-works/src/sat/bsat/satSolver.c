@@ -90,6 +90,7 @@ static inline int irand(double* seed, int size) {
 // Predeclarations:
 
 static void sat_solver_sort(void** array, int size, int(*comp)(const void *, const void *));
+clause*     sat_solver_propagate(sat_solver* s);
 
 //=================================================================================================
 // Clause datatype + minor functions:
@@ -535,6 +536,58 @@ static void sat_solver_record(sat_solver* s, veci* cls)
         s->stats.learnts++;
         s->stats.learnts_literals += veci_size(cls);
     }
+
+    // share the learned clause with the portfolio
+    if ( s->pShare )
+        Sat_ShareExport( s->pShare, s->iShare, begin, end );
+}
+
+// adds the clauses learned by other solvers of the portfolio (returns 0 if UNSAT)
+static int sat_solver_import(sat_solver* s)
+{
+    lbool*  values = s->assigns;
+    veci    shared;
+    lit*    pLits;
+    clause* c;
+    int     k, i, j, nLits, RetValue = true;
+
+    assert(sat_solver_dlevel(s) == 0);
+    veci_new(&shared);
+    Sat_ShareImport( s->pShare, s->iShare, &shared );
+    for (k = 0; k < veci_size(&shared); k += nLits + 1){
+        nLits = veci_begin(&shared)[k];
+        pLits = veci_begin(&shared) + k + 1;
+        // skip satisfied clauses and remove false literals
+        for (i = j = 0; i < nLits; i++){
+            lbool sig = !lit_sign(pLits[i]); sig += sig - 1;
+            if (lit_var(pLits[i]) >= s->size || values[lit_var(pLits[i])] == sig)
+                break;
+            if (values[lit_var(pLits[i])] == l_Undef)
+                pLits[j++] = pLits[i];
+        }
+        if (i < nLits)
+            continue;
+        if (j == 0){
+            veci_resize(&s->conf_final,0);
+            RetValue = false;
+            break;
+        }
+        if (j == 1){
+            if (!enqueue(s,pLits[0],(clause*)0) || sat_solver_propagate(s) != 0){
+                veci_resize(&s->conf_final,0);
+                RetValue = false;
+                break;
+            }
+            continue;
+        }
+        c = clause_new(s,pLits,pLits+j,1);
+        vecp_push(&s->learnts,c);
+        act_clause_bump(s,c);
+        s->stats.learnts++;
+        s->stats.learnts_literals += j;
+    }
+    veci_delete(&shared);
+    return RetValue;
 }
 
 
@@ -1037,7 +1090,8 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts, ABC_INT
 
             if ( (s->nConfLimit && s->stats.conflicts > s->nConfLimit) ||
 //                 (s->nInsLimit  && s->stats.inspects  > s->nInsLimit) )
-                 (s->nInsLimit  && s->stats.propagations > s->nInsLimit) )
+                 (s->nInsLimit  && s->stats.propagations > s->nInsLimit) ||
+                 (s->pStop && *s->pStop) || (s->pStop2 && *s->pStop2) )
             {
                 // Reached bound on number of conflicts:
                 s->progress_estimate = sat_solver_progress(s);
@@ -1502,6 +1556,12 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
         nof_conflicts = (ABC_INT64_T)( 100 * luby(2, restart_iter++) );
 //printf( "%d ", (int)nof_conflicts );
 //        nConfs = s->stats.conflicts;
+        // pick up the clauses learned by the portfolio
+        if ( s->pShare && s->root_level == 0 && !sat_solver_import(s) )
+        {
+            status = l_False;
+            break;
+        }
         status = sat_solver_search(s, nof_conflicts, nof_learnts);
 //        if ( status == l_True )
 //            printf( "%d ", s->stats.conflicts - nConfs );
@@ -1523,6 +1583,8 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
         }
         if ( s->nRuntimeLimit && clock() > s->nRuntimeLimit )
             break;
+        if ( (s->pStop && *s->pStop) || (s->pStop2 && *s->pStop2) )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
@@ -1552,6 +1614,18 @@ int sat_solver_nclauses(sat_solver* s)
 }
 
 
+int sat_solver_clause_size(clause* c)
+{
+    return clause_size(c);
+}
+
+
+lit* sat_solver_clause_begin(clause* c)
+{
+    return clause_begin(c);
+}
+
+
 int sat_solver_nconflicts(sat_solver* s)
 {
     return (int)s->stats.conflicts;
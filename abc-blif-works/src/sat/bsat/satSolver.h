@@ -110,12 +110,24 @@ extern void        sat_solver_store_mark_roots( sat_solver * s );
 extern void        sat_solver_store_mark_clauses_a( sat_solver * s );
 extern void *      sat_solver_store_release( sat_solver * s ); 
 
+// portfolio solving
+extern sat_solver* sat_solver_dup( sat_solver * s );
+extern void        sat_solver_diversify( sat_solver * s, int iConfig );
+extern int         sat_solver_solve_portfolio( sat_solver * s, int nThreads, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal, int fVerbose );
+extern void *      Sat_ShareAlloc( int nThreads );
+extern void        Sat_ShareFree( void * p );
+extern void        Sat_ShareExport( void * p, int iThread, lit * pBeg, lit * pEnd );
+extern int         Sat_ShareImport( void * p, int iThread, veci * vClauses );
+
 //=================================================================================================
 // Solver representation:
 
 struct clause_t;
 typedef struct clause_t clause;
 
+extern int         sat_solver_clause_size(clause* c);
+extern lit*        sat_solver_clause_begin(clause* c);
+
 struct sat_solver_t
 {
     int      size;          // nof variables
@@ -186,6 +198,12 @@ struct sat_solver_t
     int      nClauses;
     int      nRoots;
 
+    // portfolio solving
+    void *   pShare;        // clause exchange buffer shared by the portfolio
+    int      iShare;        // the index of this solver in the portfolio
+    volatile int * pStop;   // set externally when the solver should stop
+    volatile int * pStop2;  // another such flag (for example, set by the caller's caller)
+
     veci     temp_clause;    // temporary storage for a CNF clause
 };
 
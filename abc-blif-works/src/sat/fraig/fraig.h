@@ -93,6 +93,8 @@ struct Prove_ParamsStruct_t_
     // global resources applied
     ABC_INT64_T  nTotalBacktracksMade;  // the total number of backtracks made
     ABC_INT64_T  nTotalInspectsMade;    // the total number of inspects made
+    // portfolio SAT solving
+    int     nThreads;              // the number of solvers in the final SAT call
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -73,6 +73,8 @@ void Prove_ParamsSetDefault( Prove_Params_t * pParams )
     pParams->nTotalBacktrackLimit = 0;       // global limit on the number of backtracks
     pParams->nTotalInspectLimit   = 0;       // global limit on the number of clause inspects
 //    pParams->nTotalInspectLimit   = 100000000;  // global limit on the number of clause inspects
+    // portfolio SAT solving
+    pParams->nThreads             = 1;       // the number of solvers in the final SAT call
 }
 
 /**Function*************************************************************
@@ -105,6 +107,7 @@ void Prove_ParamsPrint( Prove_Params_t * pParams )
     printf( "Last-gasp mitering limit: %d\n", pParams->nMiteringLimitLast );
     printf( "Total conflict limit: %lld\n", pParams->nTotalBacktrackLimit );
     printf( "Total inspection limit: %lld\n", pParams->nTotalInspectLimit );
+    printf( "Portfolio SAT threads: %d\n", pParams->nThreads );
     printf( "Parameter dump complete.\n" );
 }
 
@@ -50,9 +50,15 @@ struct Pdr_Par_t_
     int fDumpInv;     // dump inductive invariant
     int fShortest;    // forces bug traces to be shortest
     int fSkipGeneral; // skips expensive generalization step
+    int fSolveAll;    // solves all outputs in one run, sharing the frames
     int fVerbose;     // verbose output
     int fVeryVerbose; // very verbose output
+    int nThreads;     // the number of threads sharing lemmas
+    int fBenchmark;   // compares the multi-threaded engine with the serial one
     int iFrame;       // explored up to this frame
+    int nFailOuts;    // the number of disproved outputs (with fSolveAll)
+    int nProveOuts;   // the number of proved outputs (with fSolveAll)
+    volatile int * pStop; // set externally when the engine should stop
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -54,8 +54,11 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->fMonoCnf      =       0;  // monolythic CNF
     pPars->fDumpInv      =       0;  // dump inductive invariant
     pPars->fShortest     =       0;  // forces bug traces to be shortest
+    pPars->fSolveAll     =       0;  // solves all outputs in one run, sharing the frames
     pPars->fVerbose      =       0;  // verbose output
     pPars->fVeryVerbose  =       0;  // very verbose output
+    pPars->nThreads      =       1;  // the number of threads sharing lemmas
+    pPars->fBenchmark    =       0;  // compares the multi-threaded engine with the serial one
     pPars->iFrame        =      -1;  // explored up to this frame
 }
 
@@ -127,7 +130,7 @@ int Pdr_ManPushClauses( Pdr_Man_t * p )
 {
     Pdr_Set_t * pTemp, * pCubeK, * pCubeK1;
     Vec_Ptr_t * vArrayK, * vArrayK1;
-    int i, j, k, m, RetValue = 0, kMax = Vec_PtrSize(p->vSolvers)-1;
+    int i, j, k, m, RetValue = 0, RetValue2, kMax = Vec_PtrSize(p->vSolvers)-1;
     int Counter = 0;
     int clk = clock();
     Vec_VecForEachLevelStartStop( p->vClauses, vArrayK, k, 1, kMax )
@@ -150,7 +153,10 @@ int Pdr_ManPushClauses( Pdr_Man_t * p )
             }
 
             // check if the clause can be moved to the next frame
-            if ( !Pdr_ManCheckCube( p, k, pCubeK, NULL, 0 ) )
+            RetValue2 = Pdr_ManCheckCube( p, k, pCubeK, NULL, 0 );
+            if ( RetValue2 == -1 )
+                return -1;
+            if ( !RetValue2 )
                 continue;
 
             {
@@ -423,6 +429,9 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
     while ( !Pdr_QueueIsEmpty(p) )
     {
         Counter++;
+        // import the lemmas derived by other threads
+        if ( p->pShare && Pdr_ManShareImport( p ) == -1 )
+            return -1;
         pThis = Pdr_QueueHead( p );
         if ( pThis->iFrame == 0 )
             return 0; // SAT
@@ -440,7 +449,13 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
         p->tContain += clock() - clk;
 
         // check if the cube is already contained
-        if ( Pdr_ManCheckCubeCs( p, pThis->iFrame, pThis->pState ) ) // cube is blocked by clauses in this frame
+        RetValue = Pdr_ManCheckCubeCs( p, pThis->iFrame, pThis->pState );
+        if ( RetValue == -1 )
+        {
+            Pdr_OblDeref( pThis );
+            return -1;
+        }
+        if ( RetValue ) // cube is blocked by clauses in this frame
         {
             Pdr_OblDeref( pThis );
             continue;
@@ -464,8 +479,17 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             // check other frames
             assert( pPred == NULL );
             for ( k = pThis->iFrame; k < kMax; k++ )
-                if ( !Pdr_ManCheckCube( p, k, pCubeMin, NULL, 0 ) )
+            {
+                RetValue = Pdr_ManCheckCube( p, k, pCubeMin, NULL, 0 );
+                if ( RetValue == -1 )
+                {
+                    Pdr_SetDeref( pCubeMin );
+                    Pdr_OblDeref( pThis );
+                    return -1;
+                }
+                if ( !RetValue )
                     break;
+            }
 
             // add new clause
             if ( p->pPars->fVeryVerbose )
@@ -484,6 +508,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
 
             Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
             p->nCubes++;
+            if ( p->pShare )
+                Pdr_ManSharePublish( p, k, pCubeMin );
             // add clause
             for ( i = 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
@@ -513,10 +539,71 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
         // check the timeout
         if ( p->timeToStop && clock() >= p->timeToStop )
             return -1;
+        if ( Pdr_ManIsStopped(p) )
+            return -1;
     }
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Moves to the next undecided output in the current frame.]
+
+  Description [Returns 0 if all undecided outputs are checked in this
+  frame. In this case, the current output is set to the first undecided
+  output to be checked in the next frame.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_ManNextOutput( Pdr_Man_t * p )
+{
+    int i;
+    for ( i = p->iOutCur + 1; i < Vec_IntSize(p->vOutMap); i++ )
+        if ( Vec_IntEntry(p->vOutMap, i) == -1 )
+        {
+            p->iOutCur = i;
+            return 1;
+        }
+    for ( i = 0; i < Vec_IntSize(p->vOutMap); i++ )
+        if ( Vec_IntEntry(p->vOutMap, i) == -1 )
+        {
+            p->iOutCur = i;
+            break;
+        }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the counter-example for the current output.]
+
+  Description [The counter-example is derived from the proof obligations,
+  which are then removed. The clauses of the frames remain valid and are
+  used to solve the remaining outputs. Returns 1 if all outputs are 
+  disproved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_ManRetireOutput( Pdr_Man_t * p )
+{
+    Abc_Cex_t * pCex;
+    assert( Vec_IntEntry(p->vOutMap, p->iOutCur) == -1 );
+    pCex = Pdr_ManDeriveCex( p );
+    Pdr_QueueStop( p );
+    Vec_PtrWriteEntry( p->vCexes, p->iOutCur, pCex );
+    Vec_IntWriteEntry( p->vOutMap, p->iOutCur, 0 );
+    p->pPars->nFailOuts++;
+    if ( p->pPars->fVerbose )
+        printf( "Output %d is disproved in frame %d.\n", p->iOutCur, pCex->iFrame );
+    return p->pPars->nFailOuts == Vec_IntSize(p->vOutMap);
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -532,6 +619,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
 {
     int fPrintClauses = 0;
     Pdr_Set_t * pCube;
+    int i, Entry, fNewFrame = 0;
     int k, RetValue = -1;
     int clkTotal = clock();
     int clkStart = clock();
@@ -548,7 +636,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         {
             if ( p->pPars->fVerbose ) 
                 Pdr_ManPrintProgress( p, 1, clock() - clkStart );
-            printf( "Reached conflict limit (%d).\n",  p->pPars->nConfLimit );
+            if ( !Pdr_ManIsStopped(p) )
+                printf( "Reached conflict limit (%d).\n",  p->pPars->nConfLimit );
             p->pPars->iFrame = k;
             return -1;
         }
@@ -559,11 +648,24 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             {
                 if ( p->pPars->fVerbose ) 
                     Pdr_ManPrintProgress( p, 1, clock() - clkStart );
-                printf( "Reached conflict limit (%d).\n",  p->pPars->nConfLimit );
+                if ( !Pdr_ManIsStopped(p) )
+                    printf( "Reached conflict limit (%d).\n",  p->pPars->nConfLimit );
                 p->pPars->iFrame = k;
                 return -1;
             }
-            if ( RetValue == 0 )
+            if ( RetValue == 0 && p->vOutMap ) // continue with other outputs
+            {
+                if ( p->pPars->fVerbose ) 
+                    Pdr_ManPrintProgress( p, 1, clock() - clkStart );
+                pCube = NULL;
+                if ( Pdr_ManRetireOutput( p ) )
+                {
+                    p->pPars->iFrame = k;
+                    return 0; // SAT
+                }
+                fNewFrame = !Pdr_ManNextOutput( p );
+            }
+            else if ( RetValue == 0 )
             {
                 if ( fPrintClauses )
                 {
@@ -573,11 +675,17 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                 if ( p->pPars->fVerbose ) 
                     Pdr_ManPrintProgress( p, 1, clock() - clkStart );
                 p->pPars->iFrame = k;
+                // another thread may have solved the problem first
+                if ( p->pShare && !Pdr_ManShareClaim( p ) )
+                    return -1;
                 return 0; // SAT
             }
         }
-        else
+        else if ( p->vOutMap == NULL || !Pdr_ManNextOutput( p ) )
+            fNewFrame = 1;
+        if ( fNewFrame )
         {
+            fNewFrame = 0;
             if ( p->pPars->fVerbose ) 
                 Pdr_ManPrintProgress( p, 1, clock() - clkStart );
             // open a new timeframe
@@ -590,15 +698,43 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                 Pdr_ManPrintClauses( p, 0 );
             }
             // push clauses into this timeframe
-            if ( Pdr_ManPushClauses( p ) )
+            if ( p->pShare && Pdr_ManShareImport( p ) == -1 )
+                RetValue = -1;
+            else
+                RetValue = Pdr_ManPushClauses( p );
+            if ( RetValue == -1 )
             {
                 if ( p->pPars->fVerbose ) 
                     Pdr_ManPrintProgress( p, 1, clock() - clkStart );
+                p->pPars->iFrame = k;
+                return -1;
+            }
+            if ( RetValue )
+            {
+                if ( p->pPars->fVerbose ) 
+                    Pdr_ManPrintProgress( p, 1, clock() - clkStart );
+                // another thread may have solved the problem first
+                if ( p->pShare && !Pdr_ManShareClaim( p ) )
+                {
+                    p->pPars->iFrame = k;
+                    return -1;
+                }
                 Pdr_ManReportInvariant( p );
                 Pdr_ManVerifyInvariant( p );
                 if ( p->pPars->fDumpInv )
                     Pdr_ManDumpClauses( p, (char *)"inv.pla" );
                 p->pPars->iFrame = k;
+                if ( p->vOutMap ) // the remaining outputs are proved
+                {
+                    Vec_IntForEachEntry( p->vOutMap, Entry, i )
+                        if ( Entry == -1 )
+                        {
+                            Vec_IntWriteEntry( p->vOutMap, i, 1 );
+                            p->pPars->nProveOuts++;
+                        }
+                    if ( p->pPars->nFailOuts )
+                        return 0; // SAT
+                }
                 return 1; // UNSAT
             }
             if ( p->pPars->fVerbose ) 
@@ -620,6 +756,11 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             p->pPars->iFrame = k;
             return -1;
         }
+        if ( Pdr_ManIsStopped(p) )
+        {
+            p->pPars->iFrame = k;
+            return -1;
+        }
         if ( p->pPars->nFrameMax && k >= p->pPars->nFrameMax )
         {
             if ( p->pPars->fVerbose ) 
@@ -650,7 +791,19 @@ int Pdr_ManSolve_( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t ** pvPrioInit,
     int clk = clock();
     p = Pdr_ManStart( pAig, pPars, pvPrioInit? *pvPrioInit : NULL );
     RetValue = Pdr_ManSolveInt( p );
-    *ppCex = RetValue ? NULL : Pdr_ManDeriveCex( p );
+    if ( p->vCexes )
+    {
+        // save the counter-examples of all outputs with the AIG
+        *ppCex = NULL;
+        if ( pAig->vSeqModelVec )
+            Vec_PtrFreeFree( pAig->vSeqModelVec );
+        pAig->vSeqModelVec = p->vCexes;
+        p->vCexes = NULL;
+        if ( p->pPars->nFailOuts )
+            RetValue = 0;
+    }
+    else
+        *ppCex = RetValue ? NULL : Pdr_ManDeriveCex( p );
 //    if ( *ppCex && pPars->fVerbose )
 //        printf( "Found counter-example in frame %d after exploring %d frames.\n", 
 //            (*ppCex)->iFrame, p->nFrames );
@@ -691,6 +844,14 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
     Vec_IntFree( vPrioInit );
     return RetValue;
 */
+#ifdef ABC_USE_PTHREADS
+    if ( pPars->nThreads > 1 && pPars->fSolveAll )
+        printf( "Multi-threaded PDR does not support solving all outputs; using one thread.\n" );
+    else if ( pPars->nThreads > 1 && pPars->fBenchmark )
+        return Pdr_ManBenchmark( pAig, pPars, ppCex );
+    else if ( pPars->nThreads > 1 )
+        return Pdr_ManSolvePar( pAig, pPars, ppCex );
+#endif
     return Pdr_ManSolve_( pAig, pPars, NULL, ppCex );
 }
 
@@ -61,6 +61,8 @@ struct Pdr_Obl_t_
     Pdr_Obl_t * pLink;     // queue link
 };
 
+typedef struct Pdr_Shr_t_ Pdr_Shr_t;
+
 typedef struct Pdr_Man_t_ Pdr_Man_t;
 struct Pdr_Man_t_
 {
@@ -88,12 +90,27 @@ struct Pdr_Man_t_
     Vec_Int_t * vCiVals;   // cone leaf values
     Vec_Int_t * vCoVals;   // cone root values
     Vec_Int_t * vNodes;    // cone nodes
-    Vec_Int_t * vUndo;     // cone undos
+    Vec_Int_t * vCands;    // cone leaves tried as don't-cares
     Vec_Int_t * vVisits;   // intermediate
     Vec_Int_t * vCi2Rem;   // CIs to be removed
     Vec_Int_t * vRes;      // final result
     Vec_Int_t * vSuppLits; // support literals
     Pdr_Set_t * pCubeJust; // justification
+    // bit-parallel ternary simulation
+    word *      pTerOne;   // lanes where the object has value 1
+    word *      pTerZero;  // lanes where the object has value 0
+    int *       pTerMark;  // the last batch where the object was updated
+    int         nTerMark;  // the current batch
+    // multiple outputs
+    int         iOutCur;   // the output currently solved
+    Vec_Int_t * vOutMap;   // output status (-1 = undecided, 0 = disproved, 1 = proved)
+    Vec_Ptr_t * vCexes;    // counter-examples of the disproved outputs
+    // lemma sharing
+    Pdr_Shr_t * pShare;    // lemmas shared with other threads
+    int         iThread;   // the number of this thread
+    int         iShareNext;// the first shared lemma not seen by this thread
+    int         nPublished;// the number of lemmas published
+    int         nImported; // the number of lemmas imported
     // statistics
     int         nBlocks;   // the number of times blockState was called
     int         nObligs;   // the number of proof obligations derived
@@ -127,6 +144,8 @@ struct Pdr_Man_t_
 ////////////////////////////////////////////////////////////////////////
 
 static inline sat_solver * Pdr_ManSolver( Pdr_Man_t * p, int k )  { return (sat_solver *)Vec_PtrEntry(p->vSolvers, k); }
+static inline int          Pdr_ManIsStopped( Pdr_Man_t * p )       { return p->pPars->pStop && *p->pPars->pStop;             }
+static inline Aig_Obj_t *  Pdr_ManPo( Pdr_Man_t * p )              { return Aig_ManPo(p->pAig, p->iOutCur);                  }
 
 ////////////////////////////////////////////////////////////////////////
 ///                    FUNCTION DECLARATIONS                         ///
@@ -141,6 +160,7 @@ extern int             Pdr_ManFreeVar( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManNewSolver( Pdr_Man_t * p, int k, int fInit );
 /*=== pdrCore.c ==========================================================*/
 extern int             Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet );
+extern int             Pdr_ManSolveInt( Pdr_Man_t * p );
 /*=== pdrInv.c ==========================================================*/
 extern void            Pdr_ManPrintProgress( Pdr_Man_t * p, int fClose, int Time );
 extern void            Pdr_ManPrintClauses( Pdr_Man_t * p, int kStart );
@@ -151,6 +171,12 @@ extern void            Pdr_ManVerifyInvariant( Pdr_Man_t * p );
 extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrioInit );
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
+/*=== pdrPar.c ==========================================================*/
+extern void            Pdr_ManSharePublish( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
+extern int             Pdr_ManShareImport( Pdr_Man_t * p );
+extern int             Pdr_ManShareClaim( Pdr_Man_t * p );
+extern int             Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex );
+extern int             Pdr_ManBenchmark( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex );
 /*=== pdrSat.c ==========================================================*/
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
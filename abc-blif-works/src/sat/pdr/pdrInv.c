@@ -326,6 +326,7 @@ void Pdr_ManVerifyInvariant( Pdr_Man_t * p )
     // create solver with the cubes
     kThis = Vec_PtrSize(p->vSolvers);
     pSat  = Pdr_ManCreateSolver( p, kThis );
+    pSat->pStop = NULL; // the verification should not be interrupted
     // add the property output
     Pdr_ManSetPropertyOutput( p, kThis );
     // add the clauses
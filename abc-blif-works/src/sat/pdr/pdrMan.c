@@ -61,12 +61,23 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p->vCiVals  = Vec_IntAlloc( 100 );  // cone leaf values
     p->vCoVals  = Vec_IntAlloc( 100 );  // cone root values
     p->vNodes   = Vec_IntAlloc( 100 );  // cone nodes
-    p->vUndo    = Vec_IntAlloc( 100 );  // cone undos
+    p->vCands   = Vec_IntAlloc( 100 );  // cone leaves tried as don't-cares
     p->vVisits  = Vec_IntAlloc( 100 );  // intermediate
     p->vCi2Rem  = Vec_IntAlloc( 100 );  // CIs to be removed
     p->vRes     = Vec_IntAlloc( 100 );  // final result
     p->vSuppLits= Vec_IntAlloc( 100 );  // support literals
     p->pCubeJust= Pdr_SetAlloc( Saig_ManRegNum(pAig) );
+    // bit-parallel ternary simulation
+    p->pTerOne  = ABC_ALLOC( word, Aig_ManObjNumMax(pAig) );
+    p->pTerZero = ABC_ALLOC( word, Aig_ManObjNumMax(pAig) );
+    p->pTerMark = ABC_CALLOC( int, Aig_ManObjNumMax(pAig) );
+    // multiple outputs
+    p->iOutCur  = (pPars->iOutput==-1)? 0 : pPars->iOutput;
+    if ( pPars->fSolveAll )
+    {
+        p->vOutMap = Vec_IntStartFull( Saig_ManPoNum(pAig) );
+        p->vCexes  = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    }
     // additional AIG data-members
     if ( pAig->pFanData == NULL )
         Aig_ManFanoutStart( pAig );
@@ -135,12 +146,18 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Vec_IntFree( p->vCiVals   );  // cone leaf values
     Vec_IntFree( p->vCoVals   );  // cone root values
     Vec_IntFree( p->vNodes    );  // cone nodes
-    Vec_IntFree( p->vUndo     );  // cone undos
+    Vec_IntFree( p->vCands    );  // cone leaves tried as don't-cares
     Vec_IntFree( p->vVisits   );  // intermediate
     Vec_IntFree( p->vCi2Rem   );  // CIs to be removed
     Vec_IntFree( p->vRes      );  // final result
     Vec_IntFree( p->vSuppLits );  // support literals
     ABC_FREE( p->pCubeJust );
+    ABC_FREE( p->pTerOne );
+    ABC_FREE( p->pTerZero );
+    ABC_FREE( p->pTerMark );
+    Vec_IntFreeP( &p->vOutMap );
+    if ( p->vCexes )
+        Vec_PtrFreeFree( p->vCexes );
     // additional AIG data-members
     if ( p->pAig->pFanData != NULL )
         Aig_ManFanoutStop( p->pAig );
@@ -170,7 +187,7 @@ Abc_Cex_t * Pdr_ManDeriveCex( Pdr_Man_t * p )
         nFrames++;
     // create the counter-example
     pCex = Abc_CexAlloc( Aig_ManRegNum(p->pAig), Saig_ManPiNum(p->pAig), nFrames );
-    pCex->iPo    = (p->pPars->iOutput==-1)? 0 : p->pPars->iOutput;
+    pCex->iPo    = p->iOutCur;
     pCex->iFrame = nFrames-1;
     for ( pObl = p->pQueue, f = 0; pObl; pObl = pObl->pNext, f++ )
         for ( i = pObl->pState->nLits; i < pObl->pState->nTotal; i++ )
@@ -0,0 +1,438 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Multi-threaded PDR with lemma sharing.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 20, 2010.]
+
+  Revision    [$Id: pdrPar.c,v 1.00 2010/11/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+
+#ifdef ABC_USE_PTHREADS
+#include <pthread.h>
+#include <errno.h>
+#include <time.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// lemmas shared by the threads
+struct Pdr_Shr_t_
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;        // protects the fields below
+    pthread_cond_t   Cond;         // signaled when a thread is done
+#endif
+    Vec_Ptr_t *      vLemmas;      // the lemmas published by the threads (append-only)
+    Vec_Int_t *      vFrames;      // the frame of each lemma
+    Vec_Int_t *      vOwners;      // the thread that published each lemma
+    volatile int     nLemmas;      // the number of lemmas (read without the lock)
+    int              iWinner;      // the thread with the first definitive result
+    int              nDone;        // the number of finished threads
+    volatile int     fStop;        // set when the threads should stop
+    volatile int *   pStopExt;     // set externally when the engine should stop
+};
+
+// data of one thread
+typedef struct Pdr_ThData_t_ Pdr_ThData_t;
+struct Pdr_ThData_t_
+{
+    Aig_Man_t *      pAig;         // the private copy of the AIG
+    Pdr_Par_t        Pars;         // the private copy of the parameters
+    Vec_Int_t *      vPrioInit;    // the initial flop priorities
+    Pdr_Shr_t *      pShare;       // the shared lemmas
+    int              iThread;      // the number of this thread
+    int              RetValue;     // the result of the thread
+    Abc_Cex_t *      pCex;         // the counter-example
+    int              nPublished;   // the number of lemmas published
+    int              nImported;    // the number of lemmas imported
+    int              nCubes;       // the number of lemmas derived
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the lemma derived in the k-th frame.]
+
+  Description [The other threads see the copy of the lemma when they
+  call Pdr_ManShareImport().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManSharePublish( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Shr_t * pShare = p->pShare;
+    Pdr_Set_t * pCopy = Pdr_SetDup( pCube );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &pShare->Mutex );
+#endif
+    Vec_PtrPush( pShare->vLemmas, pCopy );
+    Vec_IntPush( pShare->vFrames, k );
+    Vec_IntPush( pShare->vOwners, p->iThread );
+    pShare->nLemmas = Vec_PtrSize( pShare->vLemmas );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &pShare->Mutex );
+#endif
+    p->nPublished++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Imports the lemmas published by the other threads.]
+
+  Description [A lemma derived by another thread in frame k is added
+  to frame min(k, kMax) of this manager, only if it is inductive relative
+  to the previous frame of this manager. This keeps the frames of each
+  manager consistent, even though they may differ from the frames of the
+  thread that derived the lemma. The lock is not taken if no lemma has
+  been published since the last call. Returns -1 if the threads should
+  stop.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManShareImport( Pdr_Man_t * p )
+{
+    Pdr_Shr_t * pShare = p->pShare;
+    Vec_Ptr_t * vCubes;
+    Vec_Int_t * vFrames;
+    Pdr_Set_t * pCube;
+    int i, k, RetValue, kMax = Vec_PtrSize(p->vSolvers)-1, nImported = 0;
+    if ( pShare->pStopExt && *pShare->pStopExt )
+        pShare->fStop = 1;
+    if ( pShare->fStop )
+        return -1;
+    // quit if there are no new lemmas
+    if ( pShare->nLemmas == p->iShareNext )
+        return 0;
+    // copy the new lemmas of the other threads
+    vCubes  = Vec_PtrAlloc( 16 );
+    vFrames = Vec_IntAlloc( 16 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &pShare->Mutex );
+#endif
+    for ( i = p->iShareNext; i < Vec_PtrSize(pShare->vLemmas); i++ )
+    {
+        if ( Vec_IntEntry(pShare->vOwners, i) == p->iThread )
+            continue;
+        Vec_PtrPush( vCubes, Pdr_SetDup((Pdr_Set_t *)Vec_PtrEntry(pShare->vLemmas, i)) );
+        Vec_IntPush( vFrames, Vec_IntEntry(pShare->vFrames, i) );
+    }
+    p->iShareNext = Vec_PtrSize(pShare->vLemmas);
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &pShare->Mutex );
+#endif
+    // add the lemmas that hold in this manager
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+    {
+        k = Abc_MinInt( Vec_IntEntry(vFrames, i), kMax );
+        if ( k < 1 || Pdr_ManCheckContainment( p, k, pCube ) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        RetValue = Pdr_ManCheckCube( p, k-1, pCube, NULL, p->pPars->nConfLimit );
+        if ( RetValue != 1 )
+        {
+            Pdr_SetDeref( pCube );
+            if ( RetValue == -1 && Pdr_ManIsStopped(p) )
+            {
+                for ( i++; i < Vec_PtrSize(vCubes); i++ )
+                    Pdr_SetDeref( (Pdr_Set_t *)Vec_PtrEntry(vCubes, i) );
+                break;
+            }
+            continue;
+        }
+        Vec_VecPush( p->vClauses, k, pCube );   // consume ref
+        for ( RetValue = 1; RetValue <= k; RetValue++ )
+            Pdr_ManSolverAddClause( p, RetValue, pCube );
+        nImported++;
+    }
+    Vec_PtrFree( vCubes );
+    Vec_IntFree( vFrames );
+    p->nImported += nImported;
+    return Pdr_ManIsStopped(p) ? -1 : nImported;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Claims the result for this thread.]
+
+  Description [Returns 1 if this thread is the first one to solve the 
+  problem. In this case, the other threads are stopped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManShareClaim( Pdr_Man_t * p )
+{
+    Pdr_Shr_t * pShare = p->pShare;
+    int fClaimed = 0;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &pShare->Mutex );
+#endif
+    if ( pShare->iWinner == -1 )
+    {
+        pShare->iWinner = p->iThread;
+        pShare->fStop = 1;
+        fClaimed = 1;
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &pShare->Mutex );
+#endif
+    return fClaimed;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Procedure executed by one PDR thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Pdr_ManWorkerThread( void * pArg )
+{
+    Pdr_ThData_t * pData = (Pdr_ThData_t *)pArg;
+    Pdr_Shr_t * pShare = pData->pShare;
+    Pdr_Man_t * p;
+    int clk = clock();
+    p = Pdr_ManStart( pData->pAig, &pData->Pars, pData->vPrioInit );
+    pData->vPrioInit = NULL;
+    p->pShare  = pShare;
+    p->iThread = pData->iThread;
+    pData->RetValue = Pdr_ManSolveInt( p );
+    pData->pCex = pData->RetValue ? NULL : Pdr_ManDeriveCex( p );
+    p->tTotal += clock() - clk;
+    pData->nPublished = p->nPublished;
+    pData->nImported  = p->nImported;
+    pData->nCubes     = p->nCubes;
+    Pdr_ManStop( p );
+    Cnf_ClearMemory();
+    // report that the thread is done
+    pthread_mutex_lock( &pShare->Mutex );
+    assert( pData->RetValue == -1 || pShare->iWinner == pData->iThread );
+    pShare->nDone++;
+    pthread_cond_signal( &pShare->Cond );
+    pthread_mutex_unlock( &pShare->Mutex );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs several PDR threads sharing the lemmas.]
+
+  Description [Each thread works on its own copy of the AIG and has its
+  own SAT solvers for the timeframes, because the solvers cannot be used
+  by several threads at the same time. The threads are diversified by
+  the initial priorities of the flops, which define the order of trying
+  to drop literals in generalization. The lemmas derived by one thread
+  are published into the shared log and imported by the other threads
+  before they block the next proof obligation and before they push the
+  clauses to the next frame. The first thread that proves or disproves
+  the property stops the others.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
+{
+    Pdr_Shr_t Share, * pShare = &Share;
+    Pdr_ThData_t * pData;
+    pthread_t * pThreads;
+    struct timespec Deadline;
+    int i, k, Status, RetValue = -1, fTimeOut = 0, nThreads = pPars->nThreads;
+    abctime clk = Abc_ClockTicks( 0 );
+    *ppCex = NULL;
+    memset( pShare, 0, sizeof(Pdr_Shr_t) );
+    pShare->vLemmas  = Vec_PtrAlloc( 1000 );
+    pShare->vFrames  = Vec_IntAlloc( 1000 );
+    pShare->vOwners  = Vec_IntAlloc( 1000 );
+    pShare->iWinner  = -1;
+    pShare->pStopExt = pPars->pStop;
+    pthread_mutex_init( &pShare->Mutex, NULL );
+    pthread_cond_init( &pShare->Cond, NULL );
+    // prepare the threads
+    Aig_ManRandom( 1 );
+    pData = ABC_CALLOC( Pdr_ThData_t, nThreads );
+    pThreads = ABC_ALLOC( pthread_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pData[i].pAig    = Aig_ManDupSimple( pAig );
+        pData[i].Pars    = *pPars;
+        pData[i].Pars.nThreads     = 1;
+        pData[i].Pars.nTimeOut     = 0;
+        pData[i].Pars.fVerbose     = 0;
+        pData[i].Pars.fVeryVerbose = 0;
+        pData[i].Pars.iFrame       = -1;
+        pData[i].Pars.pStop        = &pShare->fStop;
+        pData[i].pShare  = pShare;
+        pData[i].iThread = i;
+        if ( i == 0 )
+            continue;
+        // diversify the threads
+        pData[i].vPrioInit = Vec_IntStart( Aig_ManRegNum(pAig) );
+        for ( k = 0; k < Aig_ManRegNum(pAig); k++ )
+            Vec_IntWriteEntry( pData[i].vPrioInit, k, Aig_ManRandom(0) % (4 * i) );
+        if ( i & 1 )
+            pData[i].Pars.fTwoRounds ^= 1;
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        Status = pthread_create( pThreads + i, NULL, Pdr_ManWorkerThread, (void *)(pData + i) );
+        assert( Status == 0 );
+    }
+    // wait for the first definitive result or the timeout
+    clock_gettime( CLOCK_REALTIME, &Deadline );
+    Deadline.tv_sec += pPars->nTimeOut;
+    pthread_mutex_lock( &pShare->Mutex );
+    while ( pShare->nDone < nThreads && pShare->iWinner == -1 )
+    {
+        if ( pPars->nTimeOut == 0 )
+            pthread_cond_wait( &pShare->Cond, &pShare->Mutex );
+        else if ( pthread_cond_timedwait( &pShare->Cond, &pShare->Mutex, &Deadline ) == ETIMEDOUT )
+        {
+            fTimeOut = (pShare->iWinner == -1);
+            break;
+        }
+    }
+    pShare->fStop = 1;
+    pthread_mutex_unlock( &pShare->Mutex );
+    for ( i = 0; i < nThreads; i++ )
+        pthread_join( pThreads[i], NULL );
+    // collect the results
+    if ( pShare->iWinner >= 0 )
+    {
+        RetValue = pData[pShare->iWinner].RetValue;
+        pPars->iFrame = pData[pShare->iWinner].Pars.iFrame;
+        *ppCex = pData[pShare->iWinner].pCex;
+        pData[pShare->iWinner].pCex = NULL;
+    }
+    else
+    {
+        for ( i = 0; i < nThreads; i++ )
+            pPars->iFrame = Abc_MaxInt( pPars->iFrame, pData[i].Pars.iFrame );
+        if ( fTimeOut )
+            printf( "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
+    }
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nThreads; i++ )
+        {
+            printf( "Thread %2d : ", i );
+            printf( "%-10s ", pData[i].RetValue == 1 ? "proved" : (pData[i].RetValue == 0 ? "disproved" : "undecided") );
+            printf( "Frame =%4d  ", pData[i].Pars.iFrame );
+            printf( "Clause =%6d  ", pData[i].nCubes );
+            printf( "Published =%6d  ", pData[i].nPublished );
+            printf( "Imported =%6d\n", pData[i].nImported );
+        }
+        printf( "Lemmas shared by %d threads = %d.  ", nThreads, Vec_PtrSize(pShare->vLemmas) );
+        ABC_PRT( "Wall time", Abc_ClockTicks( 0 ) - clk );
+    }
+    // clean up
+    for ( i = 0; i < nThreads; i++ )
+    {
+        if ( pData[i].pCex )
+            Abc_CexFree( pData[i].pCex );
+        Vec_IntFreeP( &pData[i].vPrioInit );
+        Aig_ManStop( pData[i].pAig );
+    }
+    ABC_FREE( pThreads );
+    ABC_FREE( pData );
+    for ( i = 0; i < Vec_PtrSize(pShare->vLemmas); i++ )
+        Pdr_SetDeref( (Pdr_Set_t *)Vec_PtrEntry(pShare->vLemmas, i) );
+    Vec_PtrFree( pShare->vLemmas );
+    Vec_IntFree( pShare->vFrames );
+    Vec_IntFree( pShare->vOwners );
+    pthread_cond_destroy( &pShare->Cond );
+    pthread_mutex_destroy( &pShare->Mutex );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the multi-threaded PDR with the serial one.]
+
+  Description [Solves the same property using the serial engine and
+  using the multi-threaded engine and prints the results and the runtimes
+  of both. Returns the result of the multi-threaded engine.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManBenchmark( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
+{
+    Pdr_Par_t Pars;
+    Abc_Cex_t * pCex = NULL;
+    abctime TimesWall[2];
+    int i, RetValues[2], Frames[2], TimesCpu[2], Threads[2];
+    for ( i = 0; i < 2; i++ )
+    {
+        Pars = *pPars;
+        Pars.nThreads = Threads[i] = i ? pPars->nThreads : 1;
+        Pars.fBenchmark = 0;
+        TimesWall[i]  = Abc_ClockTicks( 0 );
+        TimesCpu[i]   = clock();
+        RetValues[i]  = Pdr_ManSolve( pAig, &Pars, i ? ppCex : &pCex );
+        TimesWall[i]  = Abc_ClockTicks( 0 ) - TimesWall[i];
+        TimesCpu[i]   = clock() - TimesCpu[i];
+        Frames[i]     = Pars.iFrame;
+    }
+    if ( pCex )
+        Abc_CexFree( pCex );
+    printf( "Engine    Threads  Result      Frame       Wall        CPU\n" );
+    for ( i = 0; i < 2; i++ )
+        printf( "%-8s  %7d  %-10s  %5d  %7.2f sec  %7.2f sec\n", i ? "parallel" : "serial", Threads[i],
+            RetValues[i] == 1 ? "proved" : (RetValues[i] == 0 ? "disproved" : "undecided"), Frames[i],
+            1.0*TimesWall[i]/CLOCKS_PER_SEC, 1.0*TimesCpu[i]/CLOCKS_PER_SEC );
+    if ( RetValues[0] != -1 && RetValues[1] != -1 && RetValues[0] != RetValues[1] )
+        printf( "Pdr_ManBenchmark(): The results of the engines are different.\n" );
+    printf( "Speedup of the wall-clock time = %.2f.\n", 1.0 * TimesWall[0] / (TimesWall[1] ? TimesWall[1] : 1) );
+    pPars->iFrame = Frames[1];
+    return RetValues[1];
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -54,7 +54,7 @@ sat_solver * Pdr_ManCreateSolver( Pdr_Man_t * p, int k )
     Vec_VecExpand( p->vClauses, k );
     Vec_IntPush( p->vActVars, 0 );
     // add property cone
-    Pdr_ObjSatVar( p, k, Aig_ManPo(p->pAig, (p->pPars->iOutput==-1)?0:p->pPars->iOutput ) );
+    Pdr_ObjSatVar( p, k, Pdr_ManPo(p) );
     return pSat;
 }
 
@@ -160,7 +160,9 @@ Vec_Int_t * Pdr_ManCubeToLits( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, int fCom
 
   Synopsis    [Sets the property output to 0 (sat) forever.]
 
-  Description []
+  Description [When all outputs are solved together, sets each output
+  that is not disproved. These outputs are known to hold in the k-th 
+  timeframe, so the clauses are implied by the frame.]
                
   SideEffects []
 
@@ -170,11 +172,26 @@ Vec_Int_t * Pdr_ManCubeToLits( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, int fCom
 void Pdr_ManSetPropertyOutput( Pdr_Man_t * p, int k )
 {
     sat_solver * pSat;
-    int Lit, RetValue;
+    Aig_Obj_t * pObj;
+    int i, Lit, RetValue;
     pSat = Pdr_ManSolver(p, k);
-    Lit = toLitCond( Pdr_ObjSatVar(p, k, Aig_ManPo(p->pAig, (p->pPars->iOutput==-1)?0:p->pPars->iOutput)), 1 ); // neg literal
-    RetValue = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
-    assert( RetValue == 1 );
+    if ( p->vOutMap == NULL )
+    {
+        Lit = toLitCond( Pdr_ObjSatVar(p, k, Pdr_ManPo(p)), 1 ); // neg literal
+        RetValue = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
+        assert( RetValue == 1 );
+    }
+    else
+    {
+        Saig_ManForEachPo( p->pAig, pObj, i )
+        {
+            if ( Vec_IntEntry(p->vOutMap, i) == 0 ) // disproved
+                continue;
+            Lit = toLitCond( Pdr_ObjSatVar(p, k, pObj), 1 ); // neg literal
+            RetValue = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
+            assert( RetValue == 1 );
+        }
+    }
     sat_solver_compress( pSat );
 }
 
@@ -246,7 +263,8 @@ int Pdr_ManCheckCubeCs( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
     pSat = Pdr_ManFetchSolver( p, k );
     vLits = Pdr_ManCubeToLits( p, k, pCube, 0, 0 );
     RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntArray(vLits) + Vec_IntSize(vLits), 0, 0, 0, 0 );
-    assert( RetValue != l_Undef );
+    if ( RetValue == l_Undef )
+        return -1;
     return (RetValue == l_False);
 }
 
@@ -274,7 +292,7 @@ int Pdr_ManCheckCube( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppPr
     if ( pCube == NULL ) // solve the property
     {
         clk = clock();
-        Lit = toLit( Pdr_ObjSatVar(p, k, Aig_ManPo(p->pAig, (p->pPars->iOutput==-1)?0:p->pPars->iOutput)) ); // pos literal (property fails)
+        Lit = toLit( Pdr_ObjSatVar(p, k, Pdr_ManPo(p)) ); // pos literal (property fails)
         RetValue = sat_solver_solve( pSat, &Lit, &Lit + 1, nConfLimit, 0, 0, 0 );
         if ( RetValue == l_Undef )
             return -1;
@@ -187,59 +187,112 @@ int Pdr_ManSimDataInit( Aig_Man_t * pAig,
 
 /**Function*************************************************************
 
-  Synopsis    [Tries to assign ternary value to one of the CIs.]
+  Synopsis    [Returns the lanes of the object in the current batch.]
 
-  Description []
+  Description [Objects not updated in the current batch have the same
+  value in all lanes, which is taken from the ternary simulation info.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Pdr_ManExtendOne( Aig_Man_t * pAig, Aig_Obj_t * pObj, Vec_Int_t * vUndo, Vec_Int_t * vVis )
+static inline void Pdr_ManExtendGetWords( Pdr_Man_t * p, Aig_Obj_t * pObj, int fCompl, word * pOne, word * pZero )
 {
-    Aig_Obj_t * pFanout;
-    int i, k, iFanout, Value, Value2;
-    assert( Saig_ObjIsLo(pAig, pObj) );
-    assert( Aig_ObjIsTravIdCurrent(pAig, pObj) );
-    // save original value
-    Value = Pdr_ManSimInfoGet( pAig, pObj );
-    assert( Value == PDR_ZER || Value == PDR_ONE );
-    Vec_IntPush( vUndo, Aig_ObjId(pObj) );
-    Vec_IntPush( vUndo, Value );
-    // update original value
-    Pdr_ManSimInfoSet( pAig, pObj, PDR_UND );
-    // traverse
+    int Value;
+    if ( p->pTerMark[Aig_ObjId(pObj)] == p->nTerMark )
+    {
+        *pOne  = p->pTerOne[Aig_ObjId(pObj)];
+        *pZero = p->pTerZero[Aig_ObjId(pObj)];
+    }
+    else
+    {
+        Value  = Pdr_ManSimInfoGet( p->pAig, pObj );
+        *pOne  = (Value == PDR_ONE) ? ~(word)0 : 0;
+        *pZero = (Value == PDR_ZER) ? ~(word)0 : 0;
+    }
+    if ( fCompl )
+    {
+        word Temp = *pOne;
+        *pOne = *pZero;
+        *pZero = Temp;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates ternary values of CIs in the 64 lanes.]
+
+  Description [If fPrefix is 0, lane i sets only the i-th of the nLanes 
+  candidates to the ternary value. If fPrefix is 1, lane i sets the first 
+  i+1 candidates to the ternary value. The CIs removed earlier are ternary
+  in all lanes. Only the nodes whose fanins changed are re-evaluated, and 
+  they are collected in vVis. Returns the lanes where a CO became ternary.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Pdr_ManExtendLanes( Pdr_Man_t * p, int * pCands, int nLanes, int fPrefix, Vec_Int_t * vNodes, Vec_Int_t * vCoObjs, Vec_Int_t * vVis )
+{
+    Aig_Man_t * pAig = p->pAig;
+    Aig_Obj_t * pObj;
+    word One0, Zero0, One1, Zero1, uMask, uFail = 0;
+    int i, Value, * pMark = p->pTerMark;
+    assert( nLanes > 0 && nLanes <= 64 );
+    // set the candidates
+    p->nTerMark++;
     Vec_IntClear( vVis );
-    Vec_IntPush( vVis, Aig_ObjId(pObj) );
-    Aig_ManForEachObjVec( vVis, pAig, pObj, i )
+    for ( i = 0; i < nLanes; i++ )
     {
-        Aig_ObjForEachFanout( pAig, pObj, pFanout, iFanout, k )
-        {
-            if ( !Aig_ObjIsTravIdCurrent(pAig, pFanout) )
-                continue;
-            assert( Aig_ObjId(pObj) < Aig_ObjId(pFanout) );
-            Value = Pdr_ManSimInfoGet( pAig, pFanout );
-            if ( Value == PDR_UND )
-                continue;
-            Value2 = Pdr_ManExtendOneEval( pAig, pFanout );
-            if ( Value2 == Value )
-                continue;
-            assert( Value2 == PDR_UND );
-            Vec_IntPush( vUndo, Aig_ObjId(pFanout) );
-            Vec_IntPush( vUndo, Value );
-            if ( Aig_ObjIsPo(pFanout) )
-                return 0;
-            assert( Aig_ObjIsNode(pFanout) );
-            Vec_IntPushOrder( vVis, Aig_ObjId(pFanout) );
-        }
+        pObj  = Aig_ManObj( pAig, pCands[i] );
+        assert( Saig_ObjIsLo(pAig, pObj) );
+        Value = Pdr_ManSimInfoGet( pAig, pObj );
+        assert( Value == PDR_ZER || Value == PDR_ONE );
+        // lanes where the candidate keeps its value
+        uMask = fPrefix ? (((word)1) << i) - 1 : ~(((word)1) << i);
+        p->pTerOne[pCands[i]]  = (Value == PDR_ONE) ? uMask : 0;
+        p->pTerZero[pCands[i]] = (Value == PDR_ZER) ? uMask : 0;
+        pMark[pCands[i]] = p->nTerMark;
+        Vec_IntPush( vVis, pCands[i] );
     }
-    return 1;
+    // propagate the changes in the topological order
+    Aig_ManForEachObjVec( vNodes, pAig, pObj, i )
+    {
+        if ( pMark[Aig_ObjFaninId0(pObj)] != p->nTerMark && pMark[Aig_ObjFaninId1(pObj)] != p->nTerMark )
+            continue;
+        Value = Pdr_ManSimInfoGet( pAig, pObj );
+        if ( Value == PDR_UND )
+            continue;
+        Pdr_ManExtendGetWords( p, Aig_ObjFanin0(pObj), Aig_ObjFaninC0(pObj), &One0, &Zero0 );
+        Pdr_ManExtendGetWords( p, Aig_ObjFanin1(pObj), Aig_ObjFaninC1(pObj), &One1, &Zero1 );
+        One0 &= One1;
+        Zero0 |= Zero1;
+        // skip the node if its value did not change in any lane
+        if ( Value == PDR_ONE ? !~One0 : !~Zero0 )
+            continue;
+        p->pTerOne[Aig_ObjId(pObj)]  = One0;
+        p->pTerZero[Aig_ObjId(pObj)] = Zero0;
+        pMark[Aig_ObjId(pObj)] = p->nTerMark;
+        Vec_IntPush( vVis, Aig_ObjId(pObj) );
+    }
+    // collect the lanes where the outputs became undefined
+    Aig_ManForEachObjVec( vCoObjs, pAig, pObj, i )
+    {
+        if ( pMark[Aig_ObjFaninId0(pObj)] != p->nTerMark )
+            continue;
+        Pdr_ManExtendGetWords( p, Aig_ObjFanin0(pObj), Aig_ObjFaninC0(pObj), &One0, &Zero0 );
+        uFail |= ~(One0 | Zero0);
+    }
+    if ( nLanes < 64 )
+        uFail &= (((word)1) << nLanes) - 1;
+    return uFail;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Undoes the partial results of ternary simulation.]
+  Synopsis    [Commits the values of one lane.]
 
   Description []
                
@@ -248,15 +301,66 @@ int Pdr_ManExtendOne( Aig_Man_t * pAig, Aig_Obj_t * pObj, Vec_Int_t * vUndo, Vec
   SeeAlso     []
 
 ***********************************************************************/
-void Pdr_ManExtendUndo( Aig_Man_t * pAig, Vec_Int_t * vUndo )
+void Pdr_ManExtendCommit( Pdr_Man_t * p, int iLane, Vec_Int_t * vVis )
 {
     Aig_Obj_t * pObj;
     int i, Value;
-    Aig_ManForEachObjVec( vUndo, pAig, pObj, i )
+    Aig_ManForEachObjVec( vVis, p->pAig, pObj, i )
+    {
+        if ( (p->pTerOne[Aig_ObjId(pObj)] >> iLane) & 1 )
+            Value = PDR_ONE;
+        else if ( (p->pTerZero[Aig_ObjId(pObj)] >> iLane) & 1 )
+            Value = PDR_ZER;
+        else
+            Value = PDR_UND;
+        Pdr_ManSimInfoSet( p->pAig, pObj, Value );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Tries to assign ternary values to the candidate CIs.]
+
+  Description [The candidates are tried in the given order, and each is 
+  removed if the COs keep their values. The candidates are processed in 
+  batches of 64 using bit-parallel simulation. First, each candidate of 
+  the batch is tried alone, and the candidates that fail are dropped, 
+  because ternary simulation is monotone and they would fail later too.
+  Next, the remaining candidates are tried in prefixes. The prefix lanes 
+  where the COs keep their values are committed, the next candidate is 
+  dropped, and the remaining ones are tried again. The result is the same
+  as when the candidates are tried one at a time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManExtendCands( Pdr_Man_t * p, Vec_Int_t * vCands, Vec_Int_t * vNodes, Vec_Int_t * vCoObjs, Vec_Int_t * vVis, Vec_Int_t * vCi2Rem )
+{
+    int pLanes[64];
+    word uFail;
+    int i, k, iStart, nLanes, nKeep, nGood;
+    for ( iStart = 0; iStart < Vec_IntSize(vCands); iStart += nLanes )
     {
-        Value  = Vec_IntEntry(vUndo, ++i);
-        assert( Pdr_ManSimInfoGet(pAig, pObj) == PDR_UND );
-        Pdr_ManSimInfoSet( pAig, pObj, Value );
+        nLanes = ABC_MIN( 64, Vec_IntSize(vCands) - iStart );
+        // drop the candidates that cannot be removed alone
+        uFail = Pdr_ManExtendLanes( p, Vec_IntArray(vCands) + iStart, nLanes, 0, vNodes, vCoObjs, vVis );
+        for ( nKeep = i = 0; i < nLanes; i++ )
+            if ( !((uFail >> i) & 1) )
+                pLanes[nKeep++] = Vec_IntEntry( vCands, iStart + i );
+        // remove the longest prefixes of the remaining candidates
+        for ( k = 0; k < nKeep; k += nGood + 1 )
+        {
+            uFail = Pdr_ManExtendLanes( p, pLanes + k, nKeep - k, 1, vNodes, vCoObjs, vVis );
+            for ( nGood = 0; nGood < nKeep - k; nGood++ )
+                if ( (uFail >> nGood) & 1 )
+                    break;
+            if ( nGood > 0 )
+                Pdr_ManExtendCommit( p, nGood - 1, vVis );
+            for ( i = 0; i < nGood; i++ )
+                Vec_IntPush( vCi2Rem, pLanes[k + i] );
+        }
     }
 }
 
@@ -357,7 +461,7 @@ Pdr_Set_t * Pdr_ManTernarySim( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
     Vec_Int_t * vCiVals = p->vCiVals;  // cone leaf values (0/1 CI values)
     Vec_Int_t * vCoVals = p->vCoVals;  // cone root values (0/1 CO values)
     Vec_Int_t * vNodes  = p->vNodes;   // cone nodes (node obj IDs)
-    Vec_Int_t * vUndo   = p->vUndo;    // cone undos (node obj IDs)
+    Vec_Int_t * vCands  = p->vCands;   // cone leaves tried as don't-cares (CI obj IDs)
     Vec_Int_t * vVisits = p->vVisits;  // intermediate (obj IDs)
     Vec_Int_t * vCi2Rem = p->vCi2Rem;  // CIs to be removed (CI obj IDs)
     Vec_Int_t * vRes    = p->vRes;     // final result (flop literals)
@@ -368,7 +472,7 @@ Pdr_Set_t * Pdr_ManTernarySim( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
     // collect CO objects
     Vec_IntClear( vCoObjs );
     if ( pCube == NULL ) // the target is the property output
-        Vec_IntPush( vCoObjs, Aig_ObjId(Aig_ManPo(p->pAig, (p->pPars->iOutput==-1)?0:p->pPars->iOutput)) ); 
+        Vec_IntPush( vCoObjs, Aig_ObjId(Pdr_ManPo(p)) ); 
     else // the target is the cube
     {
         for ( i = 0; i < pCube->nLits; i++ )
@@ -400,8 +504,8 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
     RetValue = Pdr_ManSimDataInit( p->pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, NULL );
     assert( RetValue );
 
-    // try removing high-priority flops
-    Vec_IntClear( vCi2Rem );
+    // collect high-priority flops followed by low-priority flops
+    Vec_IntClear( vCands );
     Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
     {
         if ( !Saig_ObjIsLo( p->pAig, pObj ) )
@@ -409,13 +513,8 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
         Entry = Aig_ObjPioNum(pObj) - Saig_ManPiNum(p->pAig);
         if ( vPrio != NULL && Vec_IntEntry( vPrio, Entry ) != 0 )
             continue;
-        Vec_IntClear( vUndo );
-        if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-            Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-        else
-            Pdr_ManExtendUndo( p->pAig, vUndo );
+        Vec_IntPush( vCands, Aig_ObjId(pObj) );
     }
-    // try removing low-priority flops
     Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
     {
         if ( !Saig_ObjIsLo( p->pAig, pObj ) )
@@ -423,12 +522,11 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
         Entry = Aig_ObjPioNum(pObj) - Saig_ManPiNum(p->pAig);
         if ( vPrio == NULL || Vec_IntEntry( vPrio, Entry ) == 0 )
             continue;
-        Vec_IntClear( vUndo );
-        if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-            Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-        else
-            Pdr_ManExtendUndo( p->pAig, vUndo );
+        Vec_IntPush( vCands, Aig_ObjId(pObj) );
     }
+    // try removing them in this order
+    Vec_IntClear( vCi2Rem );
+    Pdr_ManExtendCands( p, vCands, vNodes, vCoObjs, vVisits, vCi2Rem );
 if ( p->pPars->fVeryVerbose )
 Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, vCi2Rem );
     RetValue = Pdr_ManSimDataInit( p->pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, vCi2Rem );